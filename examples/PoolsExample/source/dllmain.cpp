@@ -15,11 +15,37 @@ void PoolExample1()
 	}
 }
 
+// same as above, but gathers the handles first and calls each native once per batch
+// the pool can hold more peds than the buffer, so a full buffer is sent off before gathering the rest
+void PoolExample1Batched()
+{
+	static int handles[256];
+	int count = 0;
+
+	auto flush = [&]()
+	{
+		NativeInvoke::InvokeBatch<Scripting::ScriptVoid>(NATIVE_SET_CHAR_ACCURACY, handles, count, nullptr, 100);
+		NativeInvoke::InvokeBatch<Scripting::ScriptVoid>(NATIVE_SET_CHAR_SHOOT_RATE, handles, count, nullptr, 100);
+		count = 0;
+	};
+
+	auto pool = CPools::ms_pPedPool;
+	for (int i = 0; i < pool->m_nCount; i++)
+	{
+		if (auto ped = pool->Get(i))
+		{
+			handles[count++] = pool->GetIndex(ped);
+			if (count == 256) flush();
+		}
+	}
+	flush();
+}
+
 // make all romans taxis fly up
 void PoolExample2()
 {
 	int index;
-	auto mdlinfo = (CVehicleModelInfo*)CModelInfo::GetModelInfo(rage::atStringHash("rom"), &index);
+	auto mdlinfo = (CVehicleModelInfo*)CModelInfo::FindModelInfo("rom"_joaat, &index);
 
 	auto pool = CPools::ms_pVehiclePool;
 	for (int i = 0; i < pool->m_nCount; i++)
@@ -40,6 +66,6 @@ void PoolExample2()
 // ran after the sdk initializes, add all your hooks/events/etc here
 void plugin::gameStartupEvent()
 {
-	plugin::processScriptsEvent::Add(PoolExample1);
+	plugin::processScriptsEvent::Add(PoolExample1); // or PoolExample1Batched
 	plugin::processScriptsEvent::Add(PoolExample2);
 }
\ No newline at end of file
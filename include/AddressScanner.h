@@ -0,0 +1,236 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// signature scanner and address cache
+// doesn't touch any windows or game code so it works on any byte buffer, the game side of it lives in NewAddressSet.h
+namespace AddressScanner
+{
+	const uint32_t MAX_PATTERN_LENGTH = 128;
+
+	struct tPattern
+	{
+		uint8_t m_aBytes[MAX_PATTERN_LENGTH];
+		uint8_t m_aMask[MAX_PATTERN_LENGTH];	// 0xFF = byte has to match, 0x00 = wildcard
+		uint32_t m_nLength;
+		uint32_t m_nAnchor;						// first non-wildcard byte, used to prefilter with sse2
+	};
+
+	inline int HexDigit(char c)
+	{
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return -1;
+	}
+
+	// IDA style, "8B 0D ? ? ? ? 85 C9", ?? works as a wildcard too
+	inline bool ParsePattern(const char* sPattern, tPattern& out)
+	{
+		out.m_nLength = 0;
+		out.m_nAnchor = MAX_PATTERN_LENGTH;
+
+		const char* p = sPattern;
+		while (*p)
+		{
+			if (*p == ' ')
+			{
+				p++;
+				continue;
+			}
+			if (out.m_nLength == MAX_PATTERN_LENGTH) return false;
+
+			if (*p == '?')
+			{
+				out.m_aBytes[out.m_nLength] = 0;
+				out.m_aMask[out.m_nLength] = 0;
+				p++;
+				if (*p == '?') p++;
+			}
+			else
+			{
+				int hi = HexDigit(p[0]);
+				int lo = hi >= 0 ? HexDigit(p[1]) : -1;
+				if (lo < 0) return false;
+
+				out.m_aBytes[out.m_nLength] = (uint8_t)((hi << 4) | lo);
+				out.m_aMask[out.m_nLength] = 0xFF;
+				if (out.m_nAnchor == MAX_PATTERN_LENGTH) out.m_nAnchor = out.m_nLength;
+				p += 2;
+			}
+			out.m_nLength++;
+		}
+
+		// a pattern with nothing to match on is useless
+		return out.m_nLength > 0 && out.m_nAnchor != MAX_PATTERN_LENGTH;
+	}
+
+	inline bool MatchAt(const uint8_t* pData, const tPattern& pattern)
+	{
+		for (uint32_t i = 0; i < pattern.m_nLength; i++)
+		{
+			if ((pData[i] & pattern.m_aMask[i]) != pattern.m_aBytes[i]) return false;
+		}
+		return true;
+	}
+
+	inline uint32_t LowestSetBit(uint32_t bits)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, bits);
+		return index;
+#else
+		return __builtin_ctz(bits);
+#endif
+	}
+
+	// returns the first match in [pData, pData + nSize) or nullptr
+	inline const uint8_t* Find(const uint8_t* pData, size_t nSize, const tPattern& pattern)
+	{
+		if (nSize < pattern.m_nLength) return nullptr;
+
+		const size_t last = nSize - pattern.m_nLength;
+		const __m128i anchor = _mm_set1_epi8((char)pattern.m_aBytes[pattern.m_nAnchor]);
+
+		// compare 16 candidate positions at a time against the anchor byte, only full match the hits
+		size_t i = 0;
+		for (; i + 15 <= last; i += 16)
+		{
+			__m128i block = _mm_loadu_si128((const __m128i*)(pData + i + pattern.m_nAnchor));
+			uint32_t bits = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, anchor));
+			while (bits)
+			{
+				const uint8_t* candidate = pData + i + LowestSetBit(bits);
+				if (MatchAt(candidate, pattern)) return candidate;
+				bits &= bits - 1;
+			}
+		}
+		for (; i <= last; i++)
+		{
+			if (MatchAt(pData + i, pattern)) return pData + i;
+		}
+		return nullptr;
+	}
+
+	// 64-bit FNV-1a
+	inline uint64_t Hash(const void* pData, size_t nSize, uint64_t nHash = 0xCBF29CE484222325ull)
+	{
+		const uint8_t* p = (const uint8_t*)pData;
+		for (size_t i = 0; i < nSize; i++)
+		{
+			nHash ^= p[i];
+			nHash *= 0x100000001B3ull;
+		}
+		return nHash;
+	}
+
+	inline uint64_t GetPatternKey(const char* sPattern, int32_t nOffset)
+	{
+		return Hash(&nOffset, sizeof(nOffset), Hash(sPattern, strlen(sPattern)));
+	}
+
+	struct tCacheEntry
+	{
+		uint64_t m_nKey;
+		uint32_t m_nOffset;						// relative to the image base
+		uint32_t pad;
+	};
+
+	struct tCacheHeader
+	{
+		uint32_t m_nMagic;
+		uint32_t m_nVersion;
+		uint64_t m_nImageHash;
+		uint32_t m_nGameVersion;
+		uint32_t m_nNumEntries;
+	};
+
+	const uint32_t CACHE_MAGIC = 0x43415649; // IVAC
+	const uint32_t CACHE_VERSION = 1;
+
+	// everything resolved for one image, the file is thrown away as soon as the image hash doesn't match
+	struct tCache
+	{
+		uint64_t m_nImageHash = 0;
+		uint32_t m_nGameVersion = 0;
+		std::vector<tCacheEntry> m_aEntries;
+
+		bool Find(uint64_t nKey, uint32_t& nOffset) const
+		{
+			for (auto& entry : m_aEntries)
+			{
+				if (entry.m_nKey == nKey)
+				{
+					nOffset = entry.m_nOffset;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void Add(uint64_t nKey, uint32_t nOffset)
+		{
+			m_aEntries.push_back({ nKey, nOffset, 0 });
+		}
+
+		bool Load(const char* sPath, uint64_t nImageHash)
+		{
+			FILE* file = fopen(sPath, "rb");
+			if (!file) return false;
+
+			// the entry count has to agree with the file size, a truncated or corrupt file is thrown away before it's trusted
+			fseek(file, 0, SEEK_END);
+			long size = ftell(file);
+			fseek(file, 0, SEEK_SET);
+
+			tCacheHeader header;
+			bool valid = size >= (long)sizeof(header)
+				&& fread(&header, sizeof(header), 1, file) == 1
+				&& header.m_nMagic == CACHE_MAGIC
+				&& header.m_nVersion == CACHE_VERSION
+				&& header.m_nImageHash == nImageHash
+				&& (uint64_t)size == sizeof(header) + (uint64_t)header.m_nNumEntries * sizeof(tCacheEntry);
+
+			if (valid)
+			{
+				m_aEntries.resize(header.m_nNumEntries);
+				if (header.m_nNumEntries && fread(m_aEntries.data(), sizeof(tCacheEntry), header.m_nNumEntries, file) != header.m_nNumEntries)
+				{
+					m_aEntries.clear();
+					valid = false;
+				}
+			}
+			fclose(file);
+
+			if (!valid) return false;
+			m_nImageHash = header.m_nImageHash;
+			m_nGameVersion = header.m_nGameVersion;
+			return true;
+		}
+
+		bool Save(const char* sPath) const
+		{
+			FILE* file = fopen(sPath, "wb");
+			if (!file) return false;
+
+			tCacheHeader header;
+			header.m_nMagic = CACHE_MAGIC;
+			header.m_nVersion = CACHE_VERSION;
+			header.m_nImageHash = m_nImageHash;
+			header.m_nGameVersion = m_nGameVersion;
+			header.m_nNumEntries = (uint32_t)m_aEntries.size();
+
+			bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+			if (ok && header.m_nNumEntries) ok = fwrite(m_aEntries.data(), sizeof(tCacheEntry), header.m_nNumEntries, file) == header.m_nNumEntries;
+			fclose(file);
+			return ok;
+		}
+	};
+}
@@ -9,7 +9,7 @@ public:
 
 	void ForceTrack(char* trackName, int nUnk1, int nUnk2)
 	{
-		((void(__thiscall*)(char*, int, int))(AddressSetter::Get(0x6C4700, 0x3D6820)))(trackName, nUnk1, nUnk2);
+		((void(__thiscall*)(char*, int, int))(AddressSetter::Get<0x6C4700, 0x3D6820>()))(trackName, nUnk1, nUnk2);
 	}
 };
 VALIDATE_SIZE(CRadioStation, 0x1934);
@@ -26,14 +26,14 @@ public:
 
 	static CRadioStation* GetRadioStation(int id)
 	{
-		return ((CRadioStation*(__cdecl*)(int))(AddressSetter::Get(0x6C4CC0, 0x3D6E30)))(id);
+		return ((CRadioStation*(__cdecl*)(int))(AddressSetter::Get<0x6C4CC0, 0x3D6E30>()))(id);
 	}
 	static CRadioStation* GetRadioStationByName(char* name)
 	{
-		return ((CRadioStation*(__cdecl*)(char*))(AddressSetter::Get(0x6C5F00, 0x3D8070)))(name);
+		return ((CRadioStation*(__cdecl*)(char*))(AddressSetter::Get<0x6C5F00, 0x3D8070>()))(name);
 	}
 	static CRadioStation* GetRadioStationByHash(uint32_t hash)
 	{
-		return ((CRadioStation*(__cdecl*)(uint32_t))(AddressSetter::Get(0x6C4C60, 0x3D6DD0)))(hash);
+		return ((CRadioStation*(__cdecl*)(uint32_t))(AddressSetter::Get<0x6C4C60, 0x3D6DD0>()))(hash);
 	}
 };
\ No newline at end of file
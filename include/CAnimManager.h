@@ -23,10 +23,10 @@ public:
 
 	static void Initialise()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x531120, 0x78DFE0)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x531120, 0x78DFE0>()))();
 	}
 	static void AddAnimAssocDefinition(int id, const char* pName, const char* pFile, uint32_t numAnims, const char** pAnimNames, AnimDescriptor* pAnimDescs, int unk1, int unk2, int unk3, bool unk4)
 	{
-		return ((void(__stdcall*)(int, const char*, const char*, uint32_t, const char**, AnimDescriptor*, int, int, int, bool))(AddressSetter::Get(0x530F70, 0x78DE00)))(id, pName, pFile, numAnims, pAnimNames, pAnimDescs, unk1, unk2, unk3, unk4);
+		return ((void(__stdcall*)(int, const char*, const char*, uint32_t, const char**, AnimDescriptor*, int, int, int, bool))(AddressSetter::Get<0x530F70, 0x78DE00>()))(id, pName, pFile, numAnims, pAnimNames, pAnimDescs, unk1, unk2, unk3, unk4);
 	}
 };
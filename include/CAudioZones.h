@@ -10,7 +10,7 @@ public:
 
 	static void Update(bool bForceUpdate, CVector TestCoors)
 	{
-		((void(__cdecl*)(bool, CVector))(AddressSetter::Get(0x73CDB0, 0x5B1F90)))(bForceUpdate, TestCoors);
+		((void(__cdecl*)(bool, CVector))(AddressSetter::Get<0x73CDB0, 0x5B1F90>()))(bForceUpdate, TestCoors);
 	}
 };
 auto& LastUpdateCoors = AddressSetter::GetRef<CVector>(0x12932B0, 0xF59B00);
\ No newline at end of file
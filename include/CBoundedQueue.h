@@ -0,0 +1,106 @@
+#include <atomic>
+#include <memory>
+
+// fixed size lock-free ring, many producers and one consumer (vyukov's bounded queue)
+// every cell has a sequence number that says whose turn it is: pos means free for the producer that claims pos,
+// pos + 1 means written and waiting for the consumer, and pos + capacity hands it back for the next lap
+// Push and Pop take a function that reads or writes the cell in place, so big or non-copyable entries never get copied
+template<typename T>
+class CBoundedQueue
+{
+	struct tCell
+	{
+		std::atomic<uint32_t> m_nSequence;
+		T m_Value;
+	};
+
+	std::unique_ptr<tCell[]> m_aCells;
+	uint32_t m_nMask;
+	alignas(64) std::atomic<uint32_t> m_nTail{ 0 };	// producers
+	alignas(64) std::atomic<uint32_t> m_nHead{ 0 };	// only written by the consumer
+
+	// hands the cell back to the producers even if the consumer's function throws, otherwise the queue would be stuck on it
+	struct tRelease
+	{
+		CBoundedQueue* m_pQueue;
+		tCell* m_pCell;
+		uint32_t m_nPos;
+
+		~tRelease()
+		{
+			m_pCell->m_nSequence.store(m_nPos + m_pQueue->m_nMask + 1, std::memory_order_release);
+			m_pQueue->m_nHead.store(m_nPos + 1, std::memory_order_relaxed);
+		}
+	};
+
+public:
+	// nCapacity gets rounded up to a power of 2
+	CBoundedQueue(uint32_t nCapacity)
+	{
+		uint32_t size = 2;
+		while (size < nCapacity) size <<= 1;
+
+		m_aCells.reset(new tCell[size]);
+		m_nMask = size - 1;
+		for (uint32_t i = 0; i < size; i++)
+		{
+			m_aCells[i].m_nSequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	CBoundedQueue(const CBoundedQueue&) = delete;
+	CBoundedQueue& operator=(const CBoundedQueue&) = delete;
+
+	// any thread, write(T&) fills in the claimed cell, returns false without calling it if the queue is full
+	// write must not throw, a claimed cell can't be given back and the consumer would wait on it forever
+	template<typename F>
+	bool Push(F&& write)
+	{
+		uint32_t pos = m_nTail.load(std::memory_order_relaxed);
+		tCell* cell;
+		while (true)
+		{
+			cell = &m_aCells[pos & m_nMask];
+			uint32_t seq = cell->m_nSequence.load(std::memory_order_acquire);
+			int32_t diff = (int32_t)(seq - pos);
+			if (diff == 0)
+			{
+				if (m_nTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (diff < 0)
+			{
+				return false; // full
+			}
+			else
+			{
+				pos = m_nTail.load(std::memory_order_relaxed);
+			}
+		}
+
+		write(cell->m_Value);
+		cell->m_nSequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// the consumer thread, read(T&) gets the oldest entry in place, returns false without calling it if the queue is empty
+	// the cell is only handed back to the producers once read returns or throws
+	template<typename F>
+	bool Pop(F&& read)
+	{
+		uint32_t pos = m_nHead.load(std::memory_order_relaxed);
+		tCell* cell = &m_aCells[pos & m_nMask];
+		if (cell->m_nSequence.load(std::memory_order_acquire) != pos + 1) return false;
+
+		tRelease release{ this, cell, pos };
+		read(cell->m_Value);
+		return true;
+	}
+
+	uint32_t GetCapacity() const { return m_nMask + 1; }
+
+	// rough, other threads can be pushing at the same time
+	uint32_t GetSize() const
+	{
+		return m_nTail.load(std::memory_order_relaxed) - m_nHead.load(std::memory_order_relaxed);
+	}
+};
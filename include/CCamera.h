@@ -12,7 +12,7 @@ public:
 
 	CCam* CreateCam(int type, CCam* unk, CCam* unk2)
 	{
-		return ((CCam*(__thiscall*)(CCamera*, int, CCam*, CCam*))(AddressSetter::Get(0x51F510, 0x5DF770)))(this, type, unk, unk2);
+		return ((CCam*(__thiscall*)(CCamera*, int, CCam*, CCam*))(AddressSetter::Get<0x51F510, 0x5DF770>()))(this, type, unk, unk2);
 	}
 };
 CCamera& TheCamera = AddressSetter::GetRef<CCamera>(0xB21A6C, 0xB488E8);
@@ -0,0 +1,181 @@
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// hands work from any thread to the game thread, e.g. GameThreadQueue.Post([=]() { CWorld::Add(entity, false); })
+// the closures are built straight into the cells of a CBoundedQueue, the same lock-free ring CRayBatch uses
+// closures up to InlineSize bytes live inside the cell, bigger ones are heap allocated and the cell only keeps the pointer
+// Drain runs them in order until the queue is empty or the time budget is used up, whatever's left waits for the next Drain
+class CCommandQueue
+{
+public:
+	enum
+	{
+		InlineSize = 48,
+	};
+
+	typedef uint64_t(*tTicksFunc)();	// microseconds, for the budget
+
+private:
+	typedef void(*tInvokeFunc)(void* storage);
+	typedef void(*tDestroyFunc)(void* storage);
+
+	struct tCommand
+	{
+		tInvokeFunc m_pInvoke;
+		tDestroyFunc m_pDestroy;
+		alignas(8) uint8_t m_aStorage[InlineSize];
+	};
+
+	template<typename F>
+	struct tInline
+	{
+		static void Invoke(void* storage) { (*(F*)storage)(); }
+		static void Destroy(void* storage) { ((F*)storage)->~F(); }
+	};
+
+	template<typename F>
+	struct tHeap
+	{
+		static void Invoke(void* storage) { (**(F**)storage)(); }
+		static void Destroy(void* storage) { delete *(F**)storage; }
+	};
+
+	static void Nothing(void*) {}
+
+	// the closure is destroyed even if it throws, the queue's Pop hands the cell back either way
+	struct tDestroy
+	{
+		tCommand& m_Command;
+		~tDestroy() { m_Command.m_pDestroy(m_Command.m_aStorage); }
+	};
+
+	CBoundedQueue<tCommand> m_Queue;
+	std::atomic<uint32_t> m_nDropped{ 0 };
+	uint32_t m_nFailed = 0;
+	tTicksFunc m_pGetMicroseconds;
+
+	// runs the command at the head if there is one
+	// Drain runs inside the game's own frame with nothing above it to catch, so an exception stops at the command that threw it,
+	// the same as CTask::unhandled_exception and processCameraEvent
+	bool RunOne()
+	{
+		return m_Queue.Pop([this](tCommand& command)
+		{
+			tDestroy destroy{ command };
+			try
+			{
+				command.m_pInvoke(command.m_aStorage);
+			}
+			catch (...)
+			{
+				m_nFailed++;
+			}
+		});
+	}
+
+public:
+	uint32_t m_nBudgetMicroseconds = 2000;		// per Drain, 0 runs everything that's queued
+
+	static uint64_t GetSteadyMicroseconds()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// nCapacity gets rounded up to a power of 2
+	CCommandQueue(uint32_t nCapacity = 4096, tTicksFunc pGetMicroseconds = GetSteadyMicroseconds) : m_Queue(nCapacity)
+	{
+		m_pGetMicroseconds = pGetMicroseconds;
+	}
+
+	// anything still queued is destroyed without running
+	~CCommandQueue()
+	{
+		while (m_Queue.Pop([](tCommand& command) { command.m_pDestroy(command.m_aStorage); })) {}
+	}
+
+	void SetClock(tTicksFunc pGetMicroseconds) { m_pGetMicroseconds = pGetMicroseconds; }
+
+	// any thread, fn is any void() callable, returns false and drops fn if the queue is full
+	// if copying fn into the queue throws the exception comes out of Post and Drain skips the cell it had
+	template<typename F>
+	bool Post(F&& fn)
+	{
+		typedef typename std::decay<F>::type T;
+
+		// a claimed cell has to be published, so a throwing copy leaves an empty command behind and is rethrown after
+		std::exception_ptr error;
+		bool posted = m_Queue.Push([&](tCommand& command)
+		{
+			try
+			{
+				if constexpr (sizeof(T) <= InlineSize && alignof(T) <= 8)
+				{
+					new (command.m_aStorage) T(std::forward<F>(fn));
+					command.m_pInvoke = tInline<T>::Invoke;
+					command.m_pDestroy = tInline<T>::Destroy;
+				}
+				else
+				{
+					*(T**)command.m_aStorage = new T(std::forward<F>(fn));
+					command.m_pInvoke = tHeap<T>::Invoke;
+					command.m_pDestroy = tHeap<T>::Destroy;
+				}
+			}
+			catch (...)
+			{
+				command.m_pInvoke = Nothing;
+				command.m_pDestroy = Nothing;
+				error = std::current_exception();
+			}
+		});
+		if (error) std::rethrow_exception(error);
+		if (!posted) m_nDropped.fetch_add(1, std::memory_order_relaxed);
+		return posted;
+	}
+
+	// the single consumer thread, returns how many commands ran
+	// the budget is checked between commands so one long command can still go over it, at least one command runs per call
+	// a command that throws is counted in GetNumFailed and skipped, Drain itself never throws
+	uint32_t Drain()
+	{
+		uint32_t count = 0;
+		if (m_nBudgetMicroseconds == 0)
+		{
+			while (RunOne()) count++;
+			return count;
+		}
+
+		uint64_t end = m_pGetMicroseconds() + m_nBudgetMicroseconds;
+		while (RunOne())
+		{
+			count++;
+			if (m_pGetMicroseconds() >= end) break;
+		}
+		return count;
+	}
+
+	// rough, other threads can be pushing at the same time
+	uint32_t GetNumQueued() const
+	{
+		return m_Queue.GetSize();
+	}
+
+	// commands that didn't fit since the queue was made
+	uint32_t GetNumDropped() const
+	{
+		return m_nDropped.load(std::memory_order_relaxed);
+	}
+
+	// commands that threw since the queue was made, only read it from the thread that drains
+	uint32_t GetNumFailed() const
+	{
+		return m_nFailed;
+	}
+};
+
+// drained at the start of every processScriptsEvent, after the script thread is set up so natives are safe to call
+CCommandQueue GameThreadQueue;
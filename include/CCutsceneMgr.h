@@ -5,6 +5,6 @@ public:
 
 	static bool IsRunning()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x45F210, 0x3F02B0)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x45F210, 0x3F02B0>()))();
 	}
 };
\ No newline at end of file
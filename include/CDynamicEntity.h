@@ -8,13 +8,13 @@ public:
 	// used for reading bone positions e.g. seat locations
 	CMatrix* GetBoneMatrix(int boneID)
 	{
-		return ((CMatrix*(__thiscall*)(CDynamicEntity*, int))(AddressSetter::Get(0x5C7710, 0x4F1930)))(this, boneID);
+		return ((CMatrix*(__thiscall*)(CDynamicEntity*, int))(AddressSetter::Get<0x5C7710, 0x4F1930>()))(this, boneID);
 	}
 
 	// used for transform modifications e.g. popup lights, firetruck/apc cannon but 1:1 identical to the above
 	CMatrix* GetBoneMatrix2(int boneID)
 	{
-		return ((CMatrix * (__thiscall*)(CDynamicEntity*, int))(AddressSetter::Get(0xD9100, 0x315390)))(this, boneID);
+		return ((CMatrix * (__thiscall*)(CDynamicEntity*, int))(AddressSetter::Get<0xD9100, 0x315390>()))(this, boneID);
 	}
 };
 
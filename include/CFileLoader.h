@@ -11,41 +11,41 @@ public:
 	// priority? it's set to 2 and 1 for loading default.dat in TBoGT but 0 everywhere else
 	static void LoadLevel(char* levelName, int nUnk)
 	{
-		((void(__cdecl*)(char*, int))(AddressSetter::Get(0x4D79A0, 0x6CBE60)))(levelName, nUnk);
+		((void(__cdecl*)(char*, int))(AddressSetter::Get<0x4D79A0, 0x6CBE60>()))(levelName, nUnk);
 	}
 
 	static void LoadObjectTypes(char* fileName)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x4D67E0, 0x6CACA0)))(fileName);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x4D67E0, 0x6CACA0>()))(fileName);
 	}
 
 	static void LoadWater(char* fileName)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x544920, 0x5AE4C0)))(fileName);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x544920, 0x5AE4C0>()))(fileName);
 	}
 
 	static void LoadSpeechData(char* fileName)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x8ECC70, 0x3A9620)))(fileName);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x8ECC70, 0x3A9620>()))(fileName);
 	}
 
 	static void MountWavePack(char* fileName, char* mount)
 	{
-		((void(__cdecl*)(char*, char*))(AddressSetter::Get(0x8EB8D0, 0x38F8D0)))(fileName, mount);
+		((void(__cdecl*)(char*, char*))(AddressSetter::Get<0x8EB8D0, 0x38F8D0>()))(fileName, mount);
 	}
 
 	static void LoadObject(char* pLine)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x4D2120, 0x6C6700)))(pLine);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x4D2120, 0x6C6700>()))(pLine);
 	}
 
 	static void LoadPedObject(char* pLine)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x4D11A0, 0x6C57E0)))(pLine);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x4D11A0, 0x6C57E0>()))(pLine);
 	}
 
 	static void LoadVehicleObject(char* pLine)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x4D5D70, 0x6CA230)))(pLine);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x4D5D70, 0x6CA230>()))(pLine);
 	}
 };
\ No newline at end of file
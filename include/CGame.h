@@ -7,6 +7,6 @@ public:
 	static inline uint32_t& m_nCurrentEpisodeMenu = AddressSetter::GetRef<uint32_t>(0xCF8078, 0xD2D788); // used for switching hudcolor in each episode's menu screen and for loading the right episode when you hit play
 	static bool Initialise(const char* sGameDat)
 	{
-		return ((bool(__cdecl*)(const char*))(AddressSetter::Get(0x4ADA50, 0x770660)))(sGameDat);
+		return ((bool(__cdecl*)(const char*))(AddressSetter::Get<0x4ADA50, 0x770660>()))(sGameDat);
 	}
 };
\ No newline at end of file
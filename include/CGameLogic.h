@@ -6,14 +6,14 @@ public:
 
 	static bool Save()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x3B79F0, 0x3D45A0)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x3B79F0, 0x3D45A0>()))();
 	}
 	static bool Load()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x3B7A20, 0x3D45D0)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x3B7A20, 0x3D45D0>()))();
 	}
 	static void RestorePlayerStuffDuringResurrection(CPed* pPlayerPed, CVector NewCoors, float NewHeading)
 	{
-		((void(__cdecl*)(CPed*, CVector, float))(AddressSetter::Get(0x3B7B40, 0x3D46F0)))(pPlayerPed, NewCoors, NewHeading);
+		((void(__cdecl*)(CPed*, CVector, float))(AddressSetter::Get<0x3B7B40, 0x3D46F0>()))(pPlayerPed, NewCoors, NewHeading);
 	}
 };
\ No newline at end of file
@@ -20,10 +20,10 @@ public:
 
 	static bool Save()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x48EC50, 0x7EB6C0)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x48EC50, 0x7EB6C0>()))();
 	}
 	static bool Load()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x48EC80, 0x7EB6F0)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x48EC80, 0x7EB6F0>()))();
 	}
 };
\ No newline at end of file
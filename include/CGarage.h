@@ -25,11 +25,11 @@ public:
 
 	void StoreCar(CVehicle* pCar)
 	{
-		((void(__thiscall*)(CStoredCar*, CVehicle*))(AddressSetter::Get(0x88A430, 0x868B90)))(this, pCar);
+		((void(__thiscall*)(CStoredCar*, CVehicle*))(AddressSetter::Get<0x88A430, 0x868B90>()))(this, pCar);
 	}
 	void RestoreCar()
 	{
-		((void(__thiscall*)(CStoredCar*))(AddressSetter::Get(0x88A600, 0x868D60)))(this);
+		((void(__thiscall*)(CStoredCar*))(AddressSetter::Get<0x88A600, 0x868D60>()))(this);
 	}
 };
 VALIDATE_SIZE(CStoredCar, 0x48);
@@ -73,23 +73,23 @@ public:
 
 	bool IsPointInsideGarage(CVector Point)
 	{
-		return ((bool(__thiscall*)(CGarage*))(AddressSetter::Get(0x4FF4D0, 0x565AA0)))(this);
+		return ((bool(__thiscall*)(CGarage*))(AddressSetter::Get<0x4FF4D0, 0x565AA0>()))(this);
 	}
 	void PlayerArrestedOrDied()
 	{
-		((void(__thiscall*)(CGarage*))(AddressSetter::Get(0x4FF480, 0x565A50)))(this);
+		((void(__thiscall*)(CGarage*))(AddressSetter::Get<0x4FF480, 0x565A50>()))(this);
 	}
 	void StoreAndRemoveCarsForThisHideOut(CStoredCar* aStoredCars, bool unk)
 	{
-		((void(__thiscall*)(CGarage*, CStoredCar*, bool))(AddressSetter::Get(0x500DF0, 0x5673C0)))(this, aStoredCars, unk);
+		((void(__thiscall*)(CGarage*, CStoredCar*, bool))(AddressSetter::Get<0x500DF0, 0x5673C0>()))(this, aStoredCars, unk);
 	}
 	void TidyUpGarageClose()
 	{
-		((void(__thiscall*)(CGarage*))(AddressSetter::Get(0x500960, 0x566F30)))(this);
+		((void(__thiscall*)(CGarage*))(AddressSetter::Get<0x500960, 0x566F30>()))(this);
 	}
 	void Update()
 	{
-		((void(__thiscall*)(CGarage*))(AddressSetter::Get(0x501230, 0x567810)))(this);
+		((void(__thiscall*)(CGarage*))(AddressSetter::Get<0x501230, 0x567810>()))(this);
 	}
 };
 VALIDATE_SIZE(CGarage, 0x6C);
@@ -135,11 +135,11 @@ public:
 
 	void CopyGarageIntoSaveGarage(CGarage* pGarage)
 	{
-		((void(__thiscall*)(CSaveGarage*, CGarage*))(AddressSetter::Get(0x4FEF00, 0x5654D0)))(this, pGarage);
+		((void(__thiscall*)(CSaveGarage*, CGarage*))(AddressSetter::Get<0x4FEF00, 0x5654D0>()))(this, pGarage);
 	}
 	void CopyGarageOutOfSaveGarage(CGarage* pGarage)
 	{
-		((void(__thiscall*)(CSaveGarage*, CGarage*))(AddressSetter::Get(0x4FEF90, 0x565560)))(this, pGarage);
+		((void(__thiscall*)(CSaveGarage*, CGarage*))(AddressSetter::Get<0x4FEF90, 0x565560>()))(this, pGarage);
 	}
 };
 VALIDATE_SIZE(CSaveGarage, 0x48);
@@ -170,34 +170,34 @@ public:
 
 	static bool CameraShouldBeOutside()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x4FF470, 0x565A40)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x4FF470, 0x565A40>()))();
 	}
 	static void CloseHideOutGaragesBeforeSave(bool unk)
 	{
-		((void(__cdecl*)(bool))(AddressSetter::Get(0x500FE0, 0x5675B0)))(unk);
+		((void(__cdecl*)(bool))(AddressSetter::Get<0x500FE0, 0x5675B0>()))(unk);
 	}
 	static void Init()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x4FF080, 0x565650)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x4FF080, 0x565650>()))();
 	}
 	static bool Load()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x501110, 0x5676E0)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x501110, 0x5676E0>()))();
 	}
 	static void PlayerArrestedOrDied()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x500A90, 0x567060)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x500A90, 0x567060>()))();
 	}
 	static bool Save()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x501030, 0x567600)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x501030, 0x567600>()))();
 	}
 	static void Shutdown()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x4FF020, 0x5655F0)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x4FF020, 0x5655F0>()))();
 	}
 	static void Update()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x502200, 0x5687E0)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x502200, 0x5687E0>()))();
 	}
 };
\ No newline at end of file
@@ -12,11 +12,11 @@ public:
 
 	static void LoadIpls(CVector pos, bool unk)
 	{
-		((void(__cdecl*)(CVector, bool))(AddressSetter::Get(0x726FA0, 0x60B8C0)))(pos, unk);
+		((void(__cdecl*)(CVector, bool))(AddressSetter::Get<0x726FA0, 0x60B8C0>()))(pos, unk);
 	}
 	static void SetIplsRequired(CVector pos)
 	{
-		((void(__cdecl*)(CVector))(AddressSetter::Get(0x7267C0, 0x60B060)))(pos);
+		((void(__cdecl*)(CVector))(AddressSetter::Get<0x7267C0, 0x60B060>()))(pos);
 	}
 };
 
@@ -25,10 +25,10 @@ CVector& gvecIplsNeededAtPosn = AddressSetter::GetRef<CVector>(0xB3BE50, 0xB4919
 
 void SetIfIplIsRequired(CVector2D* pos, IplDef* def)
 {
-	((void(__cdecl*)(CVector2D*, IplDef*))(AddressSetter::Get(0x726520, 0x60AD50)))(pos, def);
+	((void(__cdecl*)(CVector2D*, IplDef*))(AddressSetter::Get<0x726520, 0x60AD50>()))(pos, def);
 }
 
 void SetIfIplIsRequiredReducedBB(CVector2D* pos, IplDef* def)
 {
-	((void(__cdecl*)(CVector2D*, IplDef*))(AddressSetter::Get(0x726560, 0x60AE00)))(pos, def);
+	((void(__cdecl*)(CVector2D*, IplDef*))(AddressSetter::Get<0x726560, 0x60AE00>()))(pos, def);
 }
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <memory>
+
+// small work stealing thread pool for read-only work that doesn't need to run on the game thread
+// never touch game state or call natives from a job, copy what you need first (see CPoolSnapshot.h)
+class CJobSystem
+{
+public:
+	typedef std::function<void()> tJob;
+
+	// counts the jobs pushed against it that haven't finished yet
+	struct tJobCounter
+	{
+		std::atomic<uint32_t> m_nPending{ 0 };
+
+		bool IsDone() const { return m_nPending.load(std::memory_order_acquire) == 0; }
+	};
+
+private:
+	struct tQueuedJob
+	{
+		tJob m_Job;
+		tJobCounter* m_pCounter;
+	};
+
+	// each worker pops from the back of its own queue and steals from the front of the others
+	struct tWorkerQueue
+	{
+		std::mutex m_Mutex;
+		std::deque<tQueuedJob> m_aJobs;
+	};
+
+	std::vector<std::unique_ptr<tWorkerQueue>> m_aQueues;
+	std::vector<std::thread> m_aWorkers;
+	std::atomic<uint32_t> m_nActiveWorkers{ 0 };		// workers still inside WorkerLoop
+	std::mutex m_SleepMutex;
+	std::condition_variable m_WakeUp;
+	std::atomic<uint32_t> m_nQueued{ 0 };
+	std::atomic<bool> m_bRunning{ false };
+	std::atomic<uint32_t> m_nNextQueue{ 0 };
+#ifdef _WIN32
+	// Shutdown(false) waits on one done event per worker, a worker sets it and parks on m_hParked in the same call
+	std::atomic<bool> m_bPark{ false };
+	std::vector<HANDLE> m_aDoneEvents;
+	HANDLE m_hParked = nullptr;			// never set, left open for the parked workers
+#endif
+
+	bool PopOrSteal(uint32_t nQueue, tQueuedJob& out)
+	{
+		uint32_t numQueues = (uint32_t)m_aQueues.size();
+		for (uint32_t i = 0; i < numQueues; i++)
+		{
+			auto& queue = *m_aQueues[(nQueue + i) % numQueues];
+			std::lock_guard<std::mutex> lock(queue.m_Mutex);
+			if (queue.m_aJobs.empty()) continue;
+
+			if (i == 0)
+			{
+				out = std::move(queue.m_aJobs.back());
+				queue.m_aJobs.pop_back();
+			}
+			else
+			{
+				out = std::move(queue.m_aJobs.front());
+				queue.m_aJobs.pop_front();
+			}
+			m_nQueued.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+		return false;
+	}
+
+	static void Execute(tQueuedJob& job)
+	{
+		job.m_Job();
+		job.m_pCounter->m_nPending.fetch_sub(1, std::memory_order_release);
+	}
+
+	void WorkerLoop(uint32_t nQueue)
+	{
+		// acquire so m_bPark is seen as Shutdown left it
+		while (m_bRunning.load(std::memory_order_acquire))
+		{
+			tQueuedJob job;
+			if (PopOrSteal(nQueue, job))
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_WakeUp.wait(lock, [this] { return m_nQueued.load(std::memory_order_relaxed) > 0 || !m_bRunning.load(std::memory_order_relaxed); });
+		}
+#ifdef _WIN32
+		// on FreeLibrary the dll is unmapped as soon as DllMain returns, so this thread can't run another instruction of it
+		// SignalObjectAndWait lets Shutdown go from inside the kernel, the worker stays parked there until the process exits
+		if (m_bPark.load(std::memory_order_relaxed))
+		{
+			SignalObjectAndWait(m_aDoneEvents[nQueue], m_hParked, INFINITE, FALSE);
+		}
+#endif
+		// last access to this, Shutdown can let the job system go after this
+		m_nActiveWorkers.fetch_sub(1, std::memory_order_release);
+	}
+
+public:
+	// 0 workers = one per core minus the game thread
+	// can be started again after Shutdown, the worker count stays what it was the first time
+	void Start(uint32_t nNumWorkers = 0)
+	{
+		if (!m_aWorkers.empty()) return;
+
+		if (m_aQueues.empty())
+		{
+			if (nNumWorkers == 0)
+			{
+				uint32_t cores = std::thread::hardware_concurrency();
+				nNumWorkers = cores > 1 ? cores - 1 : 1;
+			}
+
+			for (uint32_t i = 0; i < nNumWorkers; i++)
+			{
+				m_aQueues.push_back(std::make_unique<tWorkerQueue>());
+			}
+		}
+
+		m_bRunning = true;
+		m_nActiveWorkers = (uint32_t)m_aQueues.size();
+#ifdef _WIN32
+		m_bPark = false;
+		if (!m_hParked) m_hParked = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+		for (uint32_t i = 0; i < m_aQueues.size(); i++)
+		{
+			m_aDoneEvents.push_back(CreateEvent(nullptr, TRUE, FALSE, nullptr));
+		}
+#endif
+		for (uint32_t i = 0; i < m_aQueues.size(); i++)
+		{
+			m_aWorkers.emplace_back(&CJobSystem::WorkerLoop, this, i);
+		}
+	}
+
+	// workers finish their current job and exit, anything still queued stays queued and only runs if something Waits on it
+	// once this returns no worker touches the job system anymore
+	// bJoin = false is for under the loader lock on FreeLibrary, where a thread can't finish exiting until DllMain returns
+	// so the workers signal once they're done with this dll's code for good and are detached, on windows they're parked
+	// in the kernel for the rest of the process, that's a few idle threads per unload instead of a crash in unmapped code
+	void Shutdown(bool bJoin = true)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+#ifdef _WIN32
+			m_bPark = !bJoin;
+#endif
+			m_bRunning = false;
+		}
+		m_WakeUp.notify_all();
+
+		if (bJoin)
+		{
+			for (auto& worker : m_aWorkers) worker.join();
+		}
+		else
+		{
+#ifdef _WIN32
+			for (HANDLE done : m_aDoneEvents) WaitForSingleObject(done, INFINITE);
+#else
+			while (m_nActiveWorkers.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+#endif
+			for (auto& worker : m_aWorkers) worker.detach();
+		}
+		m_aWorkers.clear();
+#ifdef _WIN32
+		for (HANDLE done : m_aDoneEvents) CloseHandle(done);
+		m_aDoneEvents.clear();
+#endif
+	}
+
+	~CJobSystem()
+	{
+		// joinable std::threads terminate the process when they're destroyed
+		for (auto& worker : m_aWorkers) worker.detach();
+	}
+
+	bool IsRunning() const { return m_bRunning.load(std::memory_order_relaxed); }
+
+	// runs the job straight away on the calling thread if the workers haven't been started
+	void Push(tJob job, tJobCounter& counter)
+	{
+		counter.m_nPending.fetch_add(1, std::memory_order_relaxed);
+
+		if (!IsRunning())
+		{
+			tQueuedJob queued = { std::move(job), &counter };
+			Execute(queued);
+			return;
+		}
+
+		auto& queue = *m_aQueues[m_nNextQueue.fetch_add(1, std::memory_order_relaxed) % m_aQueues.size()];
+		{
+			std::lock_guard<std::mutex> lock(queue.m_Mutex);
+			queue.m_aJobs.push_back({ std::move(job), &counter });
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_nQueued.fetch_add(1, std::memory_order_relaxed);
+		}
+		m_WakeUp.notify_one();
+	}
+
+	// splits [0, nCount) into chunks of nGrainSize, kernel is called as kernel(begin, end)
+	template<typename F>
+	void ParallelFor(uint32_t nCount, uint32_t nGrainSize, tJobCounter& counter, F kernel)
+	{
+		if (nGrainSize == 0) nGrainSize = 1;
+		for (uint32_t begin = 0; begin < nCount; begin += nGrainSize)
+		{
+			uint32_t end = nCount - begin > nGrainSize ? begin + nGrainSize : nCount;
+			Push([kernel, begin, end] { kernel(begin, end); }, counter);
+		}
+	}
+
+	// blocks until the counter is done, the calling thread helps out with queued jobs in the meantime
+	void Wait(tJobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			tQueuedJob job;
+			if (!m_aQueues.empty() && PopOrSteal(0, job)) Execute(job);
+			else std::this_thread::yield();
+		}
+	}
+};
+
+CJobSystem JobSystem;
\ No newline at end of file
@@ -61,6 +61,7 @@ inline CMatrix MultiplyMatrix(CMatrix* a, CMatrix* b)
 
 //////////////////////////////////////////////////
 // Matrix Inverse (orthonormal basis assumed)
+// scaled matrices: InverseMatrixAffine, projection: InverseProjectionMatrix, see CSimdVector.h
 //////////////////////////////////////////////////
 
 inline CMatrix InverseMatrix(const CMatrix& m)
@@ -276,4 +277,19 @@ inline CQuaternion MatrixToQuaternion(const CMatrix& m)
     }
 
     return q;
+}
+
+// inverse of MatrixToQuaternion, quaternion needs to be normalized, pos is left at 0
+inline CMatrix QuaternionToMatrix(const CQuaternion& q)
+{
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    CMatrix m;
+    m.right = CVector_pad(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy));
+    m.at = CVector_pad(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx));
+    m.up = CVector_pad(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy));
+    m.pos = CVector_pad();
+    return m;
 }
\ No newline at end of file
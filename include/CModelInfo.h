@@ -41,12 +41,12 @@ public:
 
 	void SetAnimGroup(char* group)
 	{
-		((void(__thiscall*)(CBaseModelInfo*, char*))(AddressSetter::Get(0x58F3F0, 0x63D400)))(this, group);
+		((void(__thiscall*)(CBaseModelInfo*, char*))(AddressSetter::Get<0x58F3F0, 0x63D400>()))(this, group);
 	}
 
 	void SetTexDictionary(char* txd)
 	{
-		((void(__thiscall*)(CBaseModelInfo*, char*))(AddressSetter::Get(0x58EE30, 0x63CE40)))(this, txd);
+		((void(__thiscall*)(CBaseModelInfo*, char*))(AddressSetter::Get<0x58EE30, 0x63CE40>()))(this, txd);
 	}
 };
 VALIDATE_SIZE(CBaseModelInfo, 0x60);
@@ -139,22 +139,22 @@ public:
 	// sets center of mass and mass in the phBound based on the center of mass param and fMass off handling
 	void SetHandlingParams(tHandlingData* pHandling, CVector* pCenterOfMass)
 	{
-		((void(__thiscall*)(CBaseModelInfo*, tHandlingData*, CVector*))(AddressSetter::Get(0x7E7D70, 0x6477B0)))(this, pHandling, pCenterOfMass);
+		((void(__thiscall*)(CBaseModelInfo*, tHandlingData*, CVector*))(AddressSetter::Get<0x7E7D70, 0x6477B0>()))(this, pHandling, pCenterOfMass);
 	}
 
 	static int GetNumberOfSeats(int modelIndex)
 	{
-		return ((int(__cdecl*)(int))(AddressSetter::Get(0x7E6A60, 0x6464A0)))(modelIndex);
+		return ((int(__cdecl*)(int))(AddressSetter::Get<0x7E6A60, 0x6464A0>()))(modelIndex);
 	}
 	
 	void ChooseVehicleColour(uint8_t* color1, uint8_t* color2, uint8_t* color3, uint8_t* color4, int startingColor)
 	{
-		((void(__thiscall*)(CVehicleModelInfo*, uint8_t*, uint8_t*, uint8_t*, uint8_t*, int))(AddressSetter::Get(0x7E6930, 0x646370)))(this, color1, color2, color3, color4, startingColor);
+		((void(__thiscall*)(CVehicleModelInfo*, uint8_t*, uint8_t*, uint8_t*, uint8_t*, int))(AddressSetter::Get<0x7E6930, 0x646370>()))(this, color1, color2, color3, color4, startingColor);
 	}
 
 	void SetSecondaryAnimGroup(char* group)
 	{
-		((void(__thiscall*)(CVehicleModelInfo*, char*))(AddressSetter::Get(0x7EAC80, 0x64A6C0)))(this, group);
+		((void(__thiscall*)(CVehicleModelInfo*, char*))(AddressSetter::Get<0x7EAC80, 0x64A6C0>()))(this, group);
 	}
 
 	static inline CRGBA* ms_vehicleColourTable = (CRGBA*)AddressSetter::Get(0x12D65A8, 0x1001BE0); // ms_vehicleColourTable[196]
@@ -170,27 +170,126 @@ VALIDATE_OFFSET(CVehicleModelInfo, m_nAnimIndex2, 0xC0);
 
 class CModelInfo
 {
+	// plugin side hash -> index table over ms_modelInfoPtrs, open addressing with linear probing
+	enum { NUM_MODEL_INFOS = 31000, HASH_INDEX_SIZE = 65536 };
+	struct tHashIndexSlot
+	{
+		uint32_t m_nHash;
+		int32_t m_nIndex;	// -1 if the slot is empty
+	};
+	static inline tHashIndexSlot ms_aHashIndex[HASH_INDEX_SIZE];
+	static inline bool ms_bHashIndexBuilt = false;
+
+	// the first model with a hash wins, same as the game
+	static void InsertHashIndex(uint32_t hash, int32_t index)
+	{
+		for (uint32_t i = hash & (HASH_INDEX_SIZE - 1);; i = (i + 1) & (HASH_INDEX_SIZE - 1))
+		{
+			auto& slot = ms_aHashIndex[i];
+			if (slot.m_nIndex == -1)
+			{
+				slot.m_nHash = hash;
+				slot.m_nIndex = index;
+				return;
+			}
+			if (slot.m_nHash == hash) return;
+		}
+	}
+
+	static void AddToHashIndex(CBaseModelInfo* modelInfo)
+	{
+		if (!modelInfo || !ms_bHashIndexBuilt) return;
+
+		// one game lookup per added model to find where it went
+		int index = -1;
+		if (GetModelInfo(modelInfo->m_nHash, &index) == modelInfo && index >= 0) InsertHashIndex(modelInfo->m_nHash, index);
+	}
+
 public:
 	static inline CBaseModelInfo** ms_modelInfoPtrs = (CBaseModelInfo**)AddressSetter::Get(0x11F73B0, 0xE2C168); // ms_modelInfoPtrs[31000]
 
 	static CBaseModelInfo* GetModelInfo(uint32_t hashKey, int* index)
 	{
-		return ((CBaseModelInfo*(__cdecl*)(uint32_t, int*))(AddressSetter::Get(0x58AAE0, 0x4DD2D0)))(hashKey, index);
+		return ((CBaseModelInfo*(__cdecl*)(uint32_t, int*))(AddressSetter::Get<0x58AAE0, 0x4DD2D0>()))(hashKey, index);
 	}
 	static CPedModelInfo* AddPedModel(char* modelName)
 	{
-		return ((CPedModelInfo*(__cdecl*)(char*))(AddressSetter::Get(0x58AE90, 0x4DD680)))(modelName);
+		auto modelInfo = ((CPedModelInfo*(__cdecl*)(char*))(AddressSetter::Get<0x58AE90, 0x4DD680>()))(modelName);
+		AddToHashIndex(modelInfo);
+		return modelInfo;
 	}
 	static CVehicleModelInfo* AddVehicleModel(char* modelName)
 	{
-		return ((CVehicleModelInfo*(__cdecl*)(char*))(AddressSetter::Get(0x58AE20, 0x4DD610)))(modelName);
+		auto modelInfo = ((CVehicleModelInfo*(__cdecl*)(char*))(AddressSetter::Get<0x58AE20, 0x4DD610>()))(modelName);
+		AddToHashIndex(modelInfo);
+		return modelInfo;
 	}
 	static CBaseModelInfo* AddAtomicModel(char* modelName)
 	{
-		return ((CBaseModelInfo*(__cdecl*)(char*))(AddressSetter::Get(0x58AC60, 0x4DD450)))(modelName);
+		auto modelInfo = ((CBaseModelInfo*(__cdecl*)(char*))(AddressSetter::Get<0x58AC60, 0x4DD450>()))(modelName);
+		AddToHashIndex(modelInfo);
+		return modelInfo;
+	}
+
+	// built once the gameLoadEvent callbacks have run, models added later are picked up by FindModelInfo on first use
+	static void BuildHashIndex()
+	{
+		for (auto& slot : ms_aHashIndex)
+		{
+			slot.m_nIndex = -1;
+		}
+		for (int32_t i = 0; i < NUM_MODEL_INFOS; i++)
+		{
+			if (auto modelInfo = ms_modelInfoPtrs[i]) InsertHashIndex(modelInfo->m_nHash, i);
+		}
+		ms_bHashIndexBuilt = true;
+	}
+
+	// same as GetModelInfo without the game call once the model is in the index
+	// anything that isn't, added by another plugin or after BuildHashIndex, goes to the game and is indexed if it was found
+	// a model that doesn't exist asks the game every time, it could still be added later
+	static CBaseModelInfo* FindModelInfo(uint32_t hashKey, int* index = nullptr)
+	{
+		tHashIndexSlot* pStale = nullptr;
+		if (ms_bHashIndexBuilt)
+		{
+			for (uint32_t i = hashKey & (HASH_INDEX_SIZE - 1);; i = (i + 1) & (HASH_INDEX_SIZE - 1))
+			{
+				auto& slot = ms_aHashIndex[i];
+				if (slot.m_nIndex == -1) break;
+				if (slot.m_nHash == hashKey)
+				{
+					auto modelInfo = ms_modelInfoPtrs[slot.m_nIndex];
+					if (modelInfo && modelInfo->m_nHash == hashKey)
+					{
+						if (index) *index = slot.m_nIndex;
+						return modelInfo;
+					}
+					pStale = &slot;
+					break;
+				}
+			}
+		}
+
+		int i = -1;
+		auto modelInfo = GetModelInfo(hashKey, &i);
+		if (index) *index = i;
+		if (modelInfo && i >= 0 && ms_bHashIndexBuilt)
+		{
+			if (pStale) pStale->m_nIndex = i;
+			else InsertHashIndex(hashKey, i);
+		}
+		return modelInfo;
+	}
+
+	static int32_t FindModelIndex(uint32_t hashKey)
+	{
+		int index;
+		FindModelInfo(hashKey, &index);
+		return index;
 	}
 	static void Initialise()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x58AFF0, 0x4DD7B0)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x58AFF0, 0x4DD7B0>()))();
 	}
 };
\ No newline at end of file
@@ -8,14 +8,14 @@ public:
 	static inline bool& m_bIsHostingGame = AddressSetter::GetRef<bool>(0x14A82FD, 0x14CB4EC);
 	static bool IsNetworkGameRunning()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x62F90, 0x2C1A10)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x62F90, 0x2C1A10>()))();
 	}
 	static bool IsNetworkSession()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x3B79E0, 0x3D4590)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x3B79E0, 0x3D4590>()))();
 	}
 	static void CheckFramerate(bool bUnk, int time)
 	{
-		((void(__cdecl*)(bool, int))(AddressSetter::Get(0x60310, 0x2BEDD0)))(bUnk, time);
+		((void(__cdecl*)(bool, int))(AddressSetter::Get<0x60310, 0x2BEDD0>()))(bUnk, time);
 	}
 };
\ No newline at end of file
@@ -61,7 +61,7 @@ struct PedWeapons
 
 	void GiveWeapon(int weaponType, uint32_t ammoQuantity, bool unk1, bool unk2, bool unk3)
 	{
-		((void(__thiscall*)(PedWeapons*, int, uint32_t, bool, bool, bool))(AddressSetter::Get(0x5AB750, 0x5CD690)))(this, weaponType, ammoQuantity, unk1, unk2, unk3);
+		((void(__thiscall*)(PedWeapons*, int, uint32_t, bool, bool, bool))(AddressSetter::Get<0x5AB750, 0x5CD690>()))(this, weaponType, ammoQuantity, unk1, unk2, unk3);
 	}
 };
 VALIDATE_SIZE(PedWeapons, 0xCC);
@@ -161,15 +161,15 @@ public:																	// 000-210
 
 	void ProcessWeaponSwitch()
 	{
-		((void(__thiscall*)(CPed*))(AddressSetter::Get(0x5BE7D0, 0x597180)))(this);
+		((void(__thiscall*)(CPed*))(AddressSetter::Get<0x5BE7D0, 0x597180>()))(this);
 	}
 	CPad* GetPadFromPlayer()
 	{
-		return ((CPad*(__thiscall*)(CPed*))(AddressSetter::Get(0x5BE5D0, 0x596F80)))(this);
+		return ((CPad*(__thiscall*)(CPed*))(AddressSetter::Get<0x5BE5D0, 0x596F80>()))(this);
 	}
 	CVehicle* GetVehicle()
 	{
-		return ((CVehicle*(__thiscall*)(CPed*))(AddressSetter::Get(0x26AB0, 0x9FBA0)))(this);
+		return ((CVehicle*(__thiscall*)(CPed*))(AddressSetter::Get<0x26AB0, 0x9FBA0>()))(this);
 	}
 	void SetHealth(float health, int unk)
 	{
@@ -181,7 +181,7 @@ public:																	// 000-210
 	}
 	void ProcessHeading()
 	{
-		((void(__thiscall*)(CPed*))(AddressSetter::Get(0x4A28B0, 0x53F9E0)))(this);
+		((void(__thiscall*)(CPed*))(AddressSetter::Get<0x4A28B0, 0x53F9E0>()))(this);
 	}
 };
 
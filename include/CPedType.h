@@ -6,11 +6,11 @@ public:
 	// if true the game sets CPedModelInfo::m_bStreamedPed to 1
 	static bool IsPedTypePlayer(char* type)
 	{
-		return ((bool(__cdecl*)(char*))(AddressSetter::Get(0x7CB880, 0x806D60)))(type);
+		return ((bool(__cdecl*)(char*))(AddressSetter::Get<0x7CB880, 0x806D60>()))(type);
 	}
 	// returns pedtype id from string
 	static int FindPedType(char* type)
 	{
-		return ((int(__cdecl*)(char*))(AddressSetter::Get(0x7CB8E0, 0x806DC0)))(type);
+		return ((int(__cdecl*)(char*))(AddressSetter::Get<0x7CB8E0, 0x806DC0>()))(type);
 	}
 };
\ No newline at end of file
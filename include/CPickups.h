@@ -3,6 +3,6 @@ class CPickups
 public:
 	static void DoPickUpEffects()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x534280, 0x589100)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x534280, 0x589100>()))();
 	}
 };
\ No newline at end of file
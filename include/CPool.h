@@ -13,20 +13,20 @@ public:
 
 	CPool(int size, char* name, int entrySize)
 	{
-		((void(__thiscall*)(CPool*, int, char*, int))(AddressSetter::Get(0x872F10, 0x3F3DB0)))(this, size, name, entrySize);
+		((void(__thiscall*)(CPool*, int, char*, int))(AddressSetter::Get<0x872F10, 0x3F3DB0>()))(this, size, name, entrySize);
 	}
 
 	T* GetAt(uint32_t nHandle)
 	{
-		return ((T*(__thiscall*)(CPool*, uint32_t))(AddressSetter::Get(0x26700, 0x92E00)))(this, nHandle);
+		return ((T*(__thiscall*)(CPool*, uint32_t))(AddressSetter::Get<0x26700, 0x92E00>()))(this, nHandle);
 	}
 	uint32_t GetIndex(T* pObject)
 	{
-		return ((uint32_t(__thiscall*)(CPool*, void*))(AddressSetter::Get(0x47230, 0xAFF10)))(this, pObject);
+		return ((uint32_t(__thiscall*)(CPool*, void*))(AddressSetter::Get<0x47230, 0xAFF10>()))(this, pObject);
 	}
 	void* New()
 	{
-		return ((void*(__thiscall*)(CPool*))(AddressSetter::Get(0x39CB0, 0x9F3A0)))(this);
+		return ((void*(__thiscall*)(CPool*))(AddressSetter::Get<0x39CB0, 0x9F3A0>()))(this);
 	}
 
 	// helper functions
@@ -41,40 +41,101 @@ public:
 		return (T*)&m_pObjects[m_nEntrySize * slot];
 	}
 
+	// bit n set when slot i + n is used, slots past the end of the pool read as free
+	uint32_t GetUsedMask(int i)
+	{
+		// the 0x80 flag marks free slots, movemask collects it for 16 slots at once
+		if (i + 16 <= (int)m_nCount) return ~_mm_movemask_epi8(_mm_loadu_si128((__m128i*)&m_pFlags[i])) & 0xFFFF;
+
+		uint32_t used = 0;
+		for (int j = i; j < (int)m_nCount; j++)
+		{
+			if (IsValid(j)) used |= 1 << (j - i);
+		}
+		return used;
+	}
+
+	// the first used slot from curr on, -1 if there isn't one
+	// gaps between used slots are mostly short and a plain loop gets past them quickest,
+	// only once 16 slots in a row are free does it switch to checking 16 at a time
 	int FindNextUsed(int curr)
 	{
-		for (int i = curr; i < m_nCount; i++)
+		int i = curr;
+		int scalarEnd = i + 16 < (int)m_nCount ? i + 16 : (int)m_nCount;
+		for (; i < scalarEnd; i++)
 		{
 			if (IsValid(i)) return i;
 		}
+		for (; i < (int)m_nCount; i += 16)
+		{
+			if (uint32_t used = GetUsedMask(i))
+			{
+				unsigned long bit;
+				_BitScanForward(&bit, used);
+				return i + bit;
+			}
+		}
 		return -1;
 	}
 
 	// pool iterator
+	// works through the used bits of one 16 slot block at a time, the next used slot is known a step early and its object prefetched
+	// a slot the loop body frees is still skipped, one it fills in a block that's already been read isn't visited this time round
 	struct Iterator
 	{
 		Iterator(CPool<T>* ptr, int id)
 		{
 			pool = ptr;
 			index = id;
+			if (id != -1)
+			{
+				base = id & ~15;
+				bits = pool->GetUsedMask(base) & ~((2u << (id - base)) - 1);
+			}
+			LookAhead();
 		}
 
-		T* operator*() const { return pool->Get(index); }
+		T* operator*() const { return (T*)&pool->m_pObjects[pool->m_nEntrySize * index]; }
 		Iterator& operator++()
 		{
-			index = pool->FindNextUsed(index + 1);
+			index = next;
+			while (index != -1 && !pool->IsValid(index)) index = NextUsed();
+			LookAhead();
 			return *this;
 		}
 		bool operator!= (const Iterator& b) { return index != b.index; };
 
 	private:
+		int NextUsed()
+		{
+			while (!bits)
+			{
+				base += 16;
+				if (base >= (int)pool->m_nCount) return -1;
+				bits = pool->GetUsedMask(base);
+			}
+			unsigned long bit;
+			_BitScanForward(&bit, bits);
+			bits &= bits - 1;
+			return base + bit;
+		}
+
+		void LookAhead()
+		{
+			next = index == -1 ? -1 : NextUsed();
+			if (next != -1) _mm_prefetch((const char*)&pool->m_pObjects[pool->m_nEntrySize * next], _MM_HINT_T0);
+		}
+
 		CPool<T>* pool;
 		int index = 0;
+		int next = -1;
+		int base = 0;
+		uint32_t bits = 0;		// used slots in the block at base that haven't been handed out yet
 	};
 };
 VALIDATE_SIZE(CPool<CPed>, 0x1C);
 
 template<typename T>
-auto begin(CPool<T>* pool) { return CPool<T>::Iterator(pool, pool->FindNextUsed(0)); }
+auto begin(CPool<T>* pool) { return typename CPool<T>::Iterator(pool, pool->FindNextUsed(0)); }
 template<typename T>
-auto end(CPool<T>* pool) { return CPool<T>::Iterator(pool, -1); }
\ No newline at end of file
+auto end(CPool<T>* pool) { return typename CPool<T>::Iterator(pool, -1); }
\ No newline at end of file
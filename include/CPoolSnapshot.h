@@ -0,0 +1,95 @@
+#include <type_traits>
+
+// compact copy of the used slots of a pool, taken on the game thread so worker threads can read it safely
+// Data should be a small struct of just the fields the work needs, Extract fills it from the entity
+template<typename T, typename Data>
+class CPoolSnapshot
+{
+public:
+	std::vector<int32_t> m_aSlots;
+	std::vector<uint8_t> m_aFlags;		// flag byte at the time of the snapshot, the low bits change when a slot is reused
+	std::vector<Data> m_aData;
+
+	template<typename Extract>
+	void Take(CPool<T>* pool, Extract extract)
+	{
+		m_aSlots.clear();
+		m_aFlags.clear();
+		m_aData.clear();
+
+		for (int i = pool->FindNextUsed(0); i != -1; i = pool->FindNextUsed(i + 1))
+		{
+			m_aSlots.push_back(i);
+			m_aFlags.push_back(pool->m_pFlags[i]);
+			m_aData.push_back(extract(pool->Get(i)));
+		}
+	}
+
+	uint32_t Size() const { return (uint32_t)m_aSlots.size(); }
+
+	// returns the entity entry i was taken from, or nullptr if it's been removed or the slot reused since
+	T* Get(CPool<T>* pool, uint32_t i) const
+	{
+		int32_t slot = m_aSlots[i];
+		if (pool->m_pFlags[slot] != m_aFlags[i]) return nullptr;
+		return pool->Get(slot);
+	}
+};
+
+// runs a read-only kernel over a pool snapshot on the job system, one result per entity
+// call Process once per tick from processScriptsEvent, the results of the previous tick's snapshot
+// are handed to merge on the game thread before the next snapshot gets taken
+template<typename T, typename Data, typename Result>
+class CPoolJob
+{
+	// every worker writes its own elements, vector<bool> packs them into shared words
+	static_assert(!std::is_same_v<Result, bool>, "use uint8_t instead of bool for results");
+
+	CPoolSnapshot<T, Data> m_Snapshot;
+	std::vector<Result> m_aResults;
+	CJobSystem::tJobCounter m_Counter;
+	bool m_bInFlight = false;
+
+public:
+	// extract: Data(T*), game thread
+	// kernel: Result(const Data&), worker threads
+	// merge: void(const CPoolSnapshot<T, Data>&, const std::vector<Result>&), game thread, a tick later
+	// returns false while the previous tick's work is still running, nothing new is started then
+	template<typename Extract, typename Kernel, typename Merge>
+	bool Process(CPool<T>* pool, Extract extract, Kernel kernel, Merge merge, uint32_t nGrainSize = 64)
+	{
+		if (m_bInFlight)
+		{
+			if (!m_Counter.IsDone()) return false;
+
+			merge(m_Snapshot, m_aResults);
+			m_bInFlight = false;
+		}
+
+		m_Snapshot.Take(pool, extract);
+		m_aResults.resize(m_Snapshot.Size());
+
+		auto data = m_Snapshot.m_aData.data();
+		auto results = m_aResults.data();
+		JobSystem.ParallelFor(m_Snapshot.Size(), nGrainSize, m_Counter, [data, results, kernel](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				results[i] = kernel(data[i]);
+			}
+		});
+		m_bInFlight = true;
+		return true;
+	}
+
+	// blocks until the work in flight is done and merges it now instead of next tick
+	template<typename Merge>
+	void Flush(Merge merge)
+	{
+		if (!m_bInFlight) return;
+
+		JobSystem.Wait(m_Counter);
+		merge(m_Snapshot, m_aResults);
+		m_bInFlight = false;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,87 @@
+// tracks which slots of a pool were filled or emptied since the last update
+// the flag bytes are compared against last frame's copy 16 at a time, only the slots that changed are looked at after that
+// the first update only records the current state, entities that already exist don't fire m_OnCreated
+template<typename T>
+class CPoolTracker
+{
+	std::vector<uint8_t> m_aPrevFlags;
+
+	// a slot that got reused between two updates changes its low bits and shows up as both removed and added
+	void Classify(int32_t slot, uint8_t was, uint8_t now)
+	{
+		if (!(was & 0x80)) m_aRemoved.push_back(slot);
+		if (!(now & 0x80)) m_aAdded.push_back(slot);
+	}
+
+public:
+	std::vector<int32_t> m_aAdded;		// slots filled since the last update
+	std::vector<int32_t> m_aRemoved;	// slots emptied since the last update, the entities are already gone
+	EventDispatcher<T*, int32_t> m_OnCreated;
+	EventDispatcher<int32_t> m_OnRemoved;
+	bool m_bEnabled = false;			// keeps m_aAdded/m_aRemoved up to date even without any callbacks
+
+	bool IsActive() const
+	{
+		return m_bEnabled || m_OnCreated.Size() || m_OnRemoved.Size();
+	}
+
+	void Reset()
+	{
+		m_aPrevFlags.clear();
+		m_aAdded.clear();
+		m_aRemoved.clear();
+	}
+
+	void Update(CPool<T>* pool)
+	{
+		m_aAdded.clear();
+		m_aRemoved.clear();
+		if (!pool) return;
+
+		uint32_t count = pool->m_nCount;
+		uint8_t* curr = pool->m_pFlags;
+		if (m_aPrevFlags.size() != count)
+		{
+			m_aPrevFlags.assign(curr, curr + count);
+			return;
+		}
+
+		uint8_t* prev = m_aPrevFlags.data();
+		uint32_t i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i now = _mm_loadu_si128((__m128i*)&curr[i]);
+			__m128i was = _mm_loadu_si128((__m128i*)&prev[i]);
+			uint32_t changed = ~_mm_movemask_epi8(_mm_cmpeq_epi8(now, was)) & 0xFFFF;
+			while (changed)
+			{
+				unsigned long bit;
+				_BitScanForward(&bit, changed);
+				Classify(i + bit, prev[i + bit], curr[i + bit]);
+				changed &= changed - 1;
+			}
+			_mm_storeu_si128((__m128i*)&prev[i], now);
+		}
+		for (; i < count; i++)
+		{
+			if (curr[i] != prev[i])
+			{
+				Classify(i, prev[i], curr[i]);
+				prev[i] = curr[i];
+			}
+		}
+
+		for (auto slot : m_aRemoved)
+		{
+			m_OnRemoved.Run(slot);
+		}
+		for (auto slot : m_aAdded)
+		{
+			m_OnCreated.Run(pool->Get(slot), slot);
+		}
+	}
+};
+
+// updated at the start of every processScriptsEvent while active
+CPoolTracker<CPed> PedPoolTracker;
+CPoolTracker<CVehicle> VehiclePoolTracker;
\ No newline at end of file
@@ -11,10 +11,10 @@ public:
 
 	static void Initialise()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x5F87D0, 0x531010)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x5F87D0, 0x531010>()))();
 	}
 	static void RemovePed(CPed* pPed, bool unk)
 	{
-		return ((void(__cdecl*)(CPed*, bool))(AddressSetter::Get(0x5F8D40, 0x531580)))(pPed, unk);
+		return ((void(__cdecl*)(CPed*, bool))(AddressSetter::Get<0x5F8D40, 0x531580>()))(pPed, unk);
 	}
 };
\ No newline at end of file
@@ -2,4 +2,109 @@ class CQuaternion
 {
 public:
 	float x, y, z, w;
-};
\ No newline at end of file
+
+	float Dot(const CQuaternion& rhs) const { return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w; }
+	float MagnitudeSqr() const { return Dot(*this); }
+	float Magnitude() const { return sqrtf(MagnitudeSqr()); }
+
+	// the inverse for unit quaternions
+	CQuaternion Conjugate() const { return { -x, -y, -z, w }; }
+
+	CQuaternion Normalized() const
+	{
+		float mag = Magnitude();
+		if (mag > 1e-6f)
+			return { x / mag, y / mag, z / mag, w / mag };
+		return { 0, 0, 0, 1 };
+	}
+
+	// rotate a vector by a unit quaternion
+	CVector Rotate(const CVector& v) const
+	{
+		// v + 2w(q x v) + 2(q x (q x v))
+		CVector q(x, y, z);
+		CVector t = Cross(q, v) * 2.0f;
+		return v + t * w + Cross(q, t);
+	}
+};
+
+// a * b applies b first, then a
+inline CQuaternion operator*(const CQuaternion& a, const CQuaternion& b)
+{
+	return {
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+	};
+}
+
+// acos for [0, 1], Abramowitz & Stegun 4.4.45, max error around 7e-5 radians
+inline float FastAcos(float x)
+{
+	return sqrtf(1.0f - x) * (1.5707288f + x * (-0.2121144f + x * (0.0742610f - 0.0187293f * x)));
+}
+
+// normalized lerp, takes the shortest path, cheap and good enough for small steps like per frame smoothing
+inline CQuaternion Nlerp(const CQuaternion& a, const CQuaternion& b, float t)
+{
+	float sign = a.Dot(b) < 0.0f ? -1.0f : 1.0f;
+	float ta = 1.0f - t;
+	float tb = t * sign;
+	CQuaternion q = { a.x * ta + b.x * tb, a.y * ta + b.y * tb, a.z * ta + b.z * tb, a.w * ta + b.w * tb };
+	return q.Normalized();
+}
+
+// spherical lerp, takes the shortest path, constant angular speed
+inline CQuaternion Slerp(const CQuaternion& a, const CQuaternion& b, float t)
+{
+	float cosTheta = a.Dot(b);
+	float sign = cosTheta < 0.0f ? -1.0f : 1.0f;
+	cosTheta *= sign;
+
+	// nearly the same rotation, sin(theta) goes to 0 and nlerp is exact enough
+	if (cosTheta > 0.9995f) return Nlerp(a, b, t);
+
+	float theta = FastAcos(cosTheta);
+	float invSinTheta = 1.0f / sqrtf(1.0f - cosTheta * cosTheta);
+	float ta = sinf((1.0f - t) * theta) * invSinTheta;
+	float tb = sinf(t * theta) * invSinTheta * sign;
+	// the acos error gets scaled up by 1 / sin(theta) for small angles, normalizing takes it back out of the length
+	CQuaternion q = { a.x * ta + b.x * tb, a.y * ta + b.y * tb, a.z * ta + b.z * tb, a.w * ta + b.w * tb };
+	return q.Normalized();
+}
+
+// out[i] = Nlerp(a[i], b[i], t[i]), one quaternion per sse register, out can alias a or b
+inline void NlerpQuaternions(const CQuaternion* a, const CQuaternion* b, const float* t, CQuaternion* out, uint32_t count)
+{
+	const __m128 signBit = _mm_set1_ps(-0.0f);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		__m128 qa = _mm_loadu_ps(&a[i].x);
+		__m128 qb = _mm_loadu_ps(&b[i].x);
+
+		__m128 d = _mm_mul_ps(qa, qb);
+		d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+		d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+		qb = _mm_xor_ps(qb, _mm_and_ps(d, signBit)); // flip b onto a's hemisphere
+
+		__m128 tt = _mm_set1_ps(t[i]);
+		__m128 q = _mm_add_ps(qa, _mm_mul_ps(_mm_sub_ps(qb, qa), tt));
+
+		__m128 m = _mm_mul_ps(q, q);
+		m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+		m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m128 r = _mm_rsqrt_ps(m);
+		r = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), r), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_mul_ps(r, r), m)));
+		_mm_storeu_ps(&out[i].x, _mm_mul_ps(q, r));
+	}
+}
+
+// out[i] = Slerp(a[i], b[i], t[i]), out can alias a or b
+inline void SlerpQuaternions(const CQuaternion* a, const CQuaternion* b, const float* t, CQuaternion* out, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		out[i] = Slerp(a[i], b[i], t[i]);
+	}
+}
\ No newline at end of file
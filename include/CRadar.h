@@ -59,49 +59,49 @@ public:
 
 	static void DrawBlips()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x412170, 0x472D30)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x412170, 0x472D30>()))();
 	}
 	static void DrawBlipNames()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x40D7F0, 0x46E340)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x40D7F0, 0x46E340>()))();
 	}
 	static void DrawFrameFront()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x40BB20, 0x46C670)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x40BB20, 0x46C670>()))();
 	}
 	static void DrawFrameBack()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x40A380, 0x46AEE0)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x40A380, 0x46AEE0>()))();
 	}
 	static void DrawRoute(bool bMenu)
 	{
-		((void(__cdecl*)(bool))(AddressSetter::Get(0x46F490, 0x4920D0)))(bMenu);
+		((void(__cdecl*)(bool))(AddressSetter::Get<0x46F490, 0x4920D0>()))(bMenu);
 	}
 	static int32_t ConvertUniqueBlipToActualBlip(int32_t Index)
 	{
-		return ((int32_t(__cdecl*)(int32_t))(AddressSetter::Get(0x40AA80, 0x46B5E0)))(Index);
+		return ((int32_t(__cdecl*)(int32_t))(AddressSetter::Get<0x40AA80, 0x46B5E0>()))(Index);
 	}
 	static int32_t CreateBlip(bool unk, int32_t BlpType, CVector* vecPosition, int32_t DispFlag, char* pScriptName)
 	{
-		return ((int32_t(__cdecl*)(bool, int32_t, CVector*, int32_t, char*))(AddressSetter::Get(0x412750, 0x473310)))(unk, BlpType, vecPosition, DispFlag, pScriptName);
+		return ((int32_t(__cdecl*)(bool, int32_t, CVector*, int32_t, char*))(AddressSetter::Get<0x412750, 0x473310>()))(unk, BlpType, vecPosition, DispFlag, pScriptName);
 	}
 	static void SetBlipParameter(int paramId, int32_t Index, int value)
 	{
-		((void(__cdecl*)(int, int32_t, int))(AddressSetter::Get(0x410DC0, 0x471980)))(paramId, Index, value);
+		((void(__cdecl*)(int, int32_t, int))(AddressSetter::Get<0x410DC0, 0x471980>()))(paramId, Index, value);
 	}
 	// 0 - scale
 	// 16 - rotation
 	static void SetBlipParameter(int paramId, int32_t Index, float value)
 	{
-		((void(__cdecl*)(int, int32_t, float))(AddressSetter::Get(0x40E720, 0x46F270)))(paramId, Index, value);
+		((void(__cdecl*)(int, int32_t, float))(AddressSetter::Get<0x40E720, 0x46F270>()))(paramId, Index, value);
 	}
 	static bool RemoveBlip(int32_t Index, bool isScriptHandle)
 	{
-		return ((bool(__cdecl*)(int32_t, bool))(AddressSetter::Get(0x40E620, 0x46F170)))(Index, isScriptHandle);
+		return ((bool(__cdecl*)(int32_t, bool))(AddressSetter::Get<0x40E620, 0x46F170>()))(Index, isScriptHandle);
 	}
 	static bool IsBlipIdInUse(int32_t Index)
 	{
-		return ((bool(__cdecl*)(int32_t))(AddressSetter::Get(0x40E600, 0x46F150)))(Index);
+		return ((bool(__cdecl*)(int32_t))(AddressSetter::Get<0x40E600, 0x46F150>()))(Index);
 	}
 };
 
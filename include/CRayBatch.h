@@ -0,0 +1,142 @@
+#include <atomic>
+#include <future>
+#include <vector>
+
+// line of sight requests from any thread, run in one go on the game thread
+// requests go into a CBoundedQueue (fixed size, lock-free, many producers, one consumer)
+// and Process runs everything queued and hands the results out through futures or callbacks
+
+struct tRayResult
+{
+	bool m_bValid = false;				// false if the queue was full and the ray never ran
+	bool m_bHit = false;
+	tLineOfSightResults m_Results;
+};
+
+class CRayBatch
+{
+public:
+	// same parameters as CWorld::ProcessLineOfSight minus the ones nobody knows the meaning of
+	typedef bool(*tRayFunc)(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough);
+	typedef void(*tRayCallback)(const tRayResult& result, void* context);
+
+	// the parameters zmenu uses
+	static bool DefaultRayFunc(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough)
+	{
+		return CWorld::ProcessLineOfSight(source, target, nullptr, pResults, nFlags, 1, 0, nSeeThroughShootThrough, 4);
+	}
+
+private:
+	struct tRayRequest
+	{
+		CVector m_vSource;
+		CVector m_vTarget;
+		uint32_t m_nFlags;
+		uint32_t m_nSeeThroughShootThrough;
+		std::promise<tRayResult>* m_pPromise;
+		tRayCallback m_pCallback;
+		void* m_pContext;
+	};
+
+	CBoundedQueue<tRayRequest> m_Queue;
+	std::vector<tRayRequest> m_aBatch;
+	std::vector<tRayResult> m_aResults;
+	tRayFunc m_pRayFunc;
+
+	bool Push(const tRayRequest& request)
+	{
+		return m_Queue.Push([&](tRayRequest& cell) { cell = request; });
+	}
+
+	bool Pop(tRayRequest& out)
+	{
+		return m_Queue.Pop([&](tRayRequest& cell) { out = cell; });
+	}
+
+	static void Deliver(const tRayRequest& request, const tRayResult& result)
+	{
+		if (request.m_pPromise)
+		{
+			request.m_pPromise->set_value(result);
+			delete request.m_pPromise;
+		}
+		if (request.m_pCallback) request.m_pCallback(result, request.m_pContext);
+	}
+
+public:
+	uint32_t m_nMaxRaysPerProcess = UINT32_MAX;		// anything over this waits for the next Process
+
+	// nCapacity gets rounded up to a power of 2
+	CRayBatch(uint32_t nCapacity = 4096, tRayFunc pRayFunc = DefaultRayFunc) : m_Queue(nCapacity)
+	{
+		m_pRayFunc = pRayFunc;
+	}
+
+	// anything still queued is delivered as invalid so no future is left waiting forever
+	~CRayBatch()
+	{
+		tRayRequest request;
+		while (Pop(request))
+		{
+			Deliver(request, tRayResult());
+		}
+	}
+
+	void SetRayFunc(tRayFunc pRayFunc) { m_pRayFunc = pRayFunc; }
+
+	// any thread, the future is ready after the Process that ran the ray, or right away with m_bValid false if the queue was full
+	std::future<tRayResult> Submit(const CVector& source, const CVector& target, uint32_t nFlags, uint32_t nSeeThroughShootThrough = 0)
+	{
+		auto promise = new std::promise<tRayResult>();
+		auto future = promise->get_future();
+		if (!Push({ source, target, nFlags, nSeeThroughShootThrough, promise, nullptr, nullptr }))
+		{
+			promise->set_value(tRayResult());
+			delete promise;
+		}
+		return future;
+	}
+
+	// any thread, callback runs on the thread calling Process, returns false and doesn't call it if the queue was full
+	bool Submit(const CVector& source, const CVector& target, uint32_t nFlags, tRayCallback callback, void* context = nullptr, uint32_t nSeeThroughShootThrough = 0)
+	{
+		return Push({ source, target, nFlags, nSeeThroughShootThrough, nullptr, callback, context });
+	}
+
+	// game thread, or whichever single thread owns the batch, returns how many rays were run
+	uint32_t Process()
+	{
+		m_aBatch.clear();
+		tRayRequest request;
+		while (m_aBatch.size() < m_nMaxRaysPerProcess && Pop(request))
+		{
+			m_aBatch.push_back(request);
+		}
+		if (m_aBatch.empty()) return 0;
+
+		// every ray first, then the results, keeps the game's collision code hot in the cache
+		m_aResults.resize(m_aBatch.size());
+		for (size_t i = 0; i < m_aBatch.size(); i++)
+		{
+			auto& req = m_aBatch[i];
+			auto& result = m_aResults[i];
+			result = tRayResult();
+			result.m_bValid = true;
+			result.m_bHit = m_pRayFunc(&req.m_vSource, &req.m_vTarget, &result.m_Results, req.m_nFlags, req.m_nSeeThroughShootThrough);
+		}
+		for (size_t i = 0; i < m_aBatch.size(); i++)
+		{
+			Deliver(m_aBatch[i], m_aResults[i]);
+		}
+		return (uint32_t)m_aBatch.size();
+	}
+
+	// rough, other threads can be pushing at the same time
+	uint32_t GetNumQueued() const
+	{
+		return m_Queue.GetSize();
+	}
+};
+
+// processed at the start of every processScriptsEvent
+CRayBatch RayBatch;
@@ -0,0 +1,246 @@
+// caches line of sight results for rays that get repeated every frame with nearly the same endpoints
+// the endpoints are snapped to a grid of m_fQuantum and together with the flags make up the key, so rays that move less than that share a result
+// results expire after m_nMaxAgeFrames, and early if one of the entities passed in moved more than m_fMoveThreshold since the ray ran
+// or isn't there anymore, the entities are kept as pool slot + flag byte so a deleted one is noticed instead of read
+// a cached m_pInst is as old as the result, check the entity still exists before using it
+// game thread only
+class CRayCache
+{
+	struct tKey
+	{
+		int32_t m_nSource[3];
+		int32_t m_nTarget[3];
+		uint32_t m_nFlags;
+
+		bool operator==(const tKey& rhs) const { return memcmp(this, &rhs, sizeof(tKey)) == 0; }
+	};
+
+	enum eEntityPool : uint8_t
+	{
+		POOL_NONE,
+		POOL_PED,
+		POOL_VEHICLE,
+		POOL_OBJECT,
+		POOL_BUILDING,
+	};
+
+	// the flag byte of a used slot is a counter that changes every time the slot is reused, the same as in script handles
+	struct tEntityRef
+	{
+		eEntityPool m_nPool;
+		uint8_t m_nFlags;
+		int32_t m_nSlot;
+		CVector m_vPosition;
+	};
+
+	struct tEntry
+	{
+		tKey m_Key;
+		bool m_bUsed;
+		bool m_bHit;
+		uint32_t m_nFrame;
+		tEntityRef m_aEntities[2];
+		tLineOfSightResults m_Results;
+	};
+
+	std::vector<tEntry> m_aEntries;		// direct mapped, a new ray just replaces whatever was in its slot
+	uint32_t m_nMask;
+	uint32_t m_nFrame = 0;
+	CRayBatch::tRayFunc m_pRayFunc;
+
+	static CVector GetEntityPosition(CEntity* entity)
+	{
+		return entity->m_pMatrix ? ToVector(entity->m_pMatrix->pos) : entity->m_placement.m_vPosition;
+	}
+
+	// only compares addresses, nothing in the pool is called
+	template<typename T>
+	static bool FindInPool(CPool<T>* pool, eEntityPool nPool, CEntity* entity, tEntityRef& ref)
+	{
+		uint8_t* address = (uint8_t*)entity;
+		if (!pool || address < pool->m_pObjects || address >= pool->m_pObjects + pool->m_nCount * pool->m_nEntrySize) return false;
+
+		ref.m_nPool = nPool;
+		ref.m_nSlot = (int32_t)((address - pool->m_pObjects) / pool->m_nEntrySize);
+		ref.m_nFlags = pool->m_pFlags[ref.m_nSlot];
+		return true;
+	}
+
+	// false if the entity isn't in any of the pools, it can't be checked later so the ray isn't cached
+	static bool MakeEntityRef(CEntity* entity, tEntityRef& ref)
+	{
+		ref.m_nPool = POOL_NONE;
+		ref.m_nFlags = 0;
+		ref.m_nSlot = -1;
+		ref.m_vPosition = CVector();
+		if (!entity) return true;
+
+		if (!FindInPool(CPools::ms_pPedPool, POOL_PED, entity, ref)
+			&& !FindInPool(CPools::ms_pVehiclePool, POOL_VEHICLE, entity, ref)
+			&& !FindInPool(CPools::ms_pObjectPool, POOL_OBJECT, entity, ref)
+			&& !FindInPool(CPools::ms_pBuildingPool, POOL_BUILDING, entity, ref)) return false;
+
+		ref.m_vPosition = GetEntityPosition(entity);
+		return true;
+	}
+
+	template<typename T>
+	static CEntity* GetIfAlive(CPool<T>* pool, const tEntityRef& ref)
+	{
+		if (!pool || pool->m_pFlags[ref.m_nSlot] != ref.m_nFlags) return nullptr;
+		return (CEntity*)pool->Get(ref.m_nSlot);
+	}
+
+	// nullptr once the entity is deleted or its slot belongs to someone else
+	static CEntity* GetIfAlive(const tEntityRef& ref)
+	{
+		switch (ref.m_nPool)
+		{
+		case POOL_PED: return GetIfAlive(CPools::ms_pPedPool, ref);
+		case POOL_VEHICLE: return GetIfAlive(CPools::ms_pVehiclePool, ref);
+		case POOL_OBJECT: return GetIfAlive(CPools::ms_pObjectPool, ref);
+		case POOL_BUILDING: return GetIfAlive(CPools::ms_pBuildingPool, ref);
+		default: return nullptr;
+		}
+	}
+
+	tKey MakeKey(const CVector& source, const CVector& target, uint32_t nFlags, uint32_t nSeeThroughShootThrough) const
+	{
+		float inv = 1.0f / m_fQuantum;
+		tKey key;
+		key.m_nSource[0] = (int32_t)floorf(source.x * inv);
+		key.m_nSource[1] = (int32_t)floorf(source.y * inv);
+		key.m_nSource[2] = (int32_t)floorf(source.z * inv);
+		key.m_nTarget[0] = (int32_t)floorf(target.x * inv);
+		key.m_nTarget[1] = (int32_t)floorf(target.y * inv);
+		key.m_nTarget[2] = (int32_t)floorf(target.z * inv);
+		key.m_nFlags = nFlags | (nSeeThroughShootThrough << 24);
+		return key;
+	}
+
+	static uint32_t HashKey(const tKey& key)
+	{
+		// fnv-1a over the 7 words
+		const uint32_t* words = (const uint32_t*)&key;
+		uint32_t hash = 2166136261u;
+		for (uint32_t i = 0; i < sizeof(tKey) / 4; i++)
+		{
+			hash = (hash ^ words[i]) * 16777619u;
+		}
+		return hash ^ (hash >> 15);
+	}
+
+	// a deleted entity counts as moved
+	bool HasMoved(const tEntry& entry) const
+	{
+		float thresholdSqr = m_fMoveThreshold * m_fMoveThreshold;
+		for (uint32_t i = 0; i < 2; i++)
+		{
+			const tEntityRef& ref = entry.m_aEntities[i];
+			if (ref.m_nPool == POOL_NONE) continue;
+
+			CEntity* entity = GetIfAlive(ref);
+			if (!entity || (GetEntityPosition(entity) - ref.m_vPosition).MagnitudeSqr() > thresholdSqr) return true;
+		}
+		return false;
+	}
+
+public:
+	float m_fQuantum = 0.25f;
+	uint32_t m_nMaxAgeFrames = 4;		// 0 turns the cache off
+	float m_fMoveThreshold = 0.5f;
+
+	// stats since the last ResetStats
+	uint32_t m_nHits = 0;
+	uint32_t m_nMisses = 0;				// every miss, including the two below
+	uint32_t m_nExpired = 0;			// the key was there but too old
+	uint32_t m_nMoved = 0;				// the key was there but an entity moved or was deleted
+	uint32_t m_nUncached = 0;			// not counted as misses, an entity wasn't in the ped/vehicle/object/building pools
+
+	// nSize gets rounded up to a power of 2
+	CRayCache(uint32_t nSize = 1024, CRayBatch::tRayFunc pRayFunc = CRayBatch::DefaultRayFunc)
+	{
+		uint32_t size = 1;
+		while (size < nSize) size <<= 1;
+
+		m_aEntries.resize(size);
+		m_nMask = size - 1;
+		m_pRayFunc = pRayFunc;
+		Clear();
+	}
+
+	void SetRayFunc(CRayBatch::tRayFunc pRayFunc) { m_pRayFunc = pRayFunc; }
+
+	// called once per frame, at the start of processScriptsEvent for the global cache
+	void NextFrame() { m_nFrame++; }
+	uint32_t GetFrame() const { return m_nFrame; }
+
+	void Clear()
+	{
+		for (auto& entry : m_aEntries)
+		{
+			entry.m_bUsed = false;
+		}
+	}
+
+	void ResetStats()
+	{
+		m_nHits = m_nMisses = m_nExpired = m_nMoved = m_nUncached = 0;
+	}
+
+	float GetHitRate() const
+	{
+		uint32_t total = m_nHits + m_nMisses;
+		return total ? (float)m_nHits / total : 0.0f;
+	}
+
+	// same as CRayBatch::tRayFunc, pSourceEntity/pTargetEntity are optional and only used to invalidate the result when they move or get deleted
+	// they're only looked at during this call, nothing keeps the pointers
+	bool ProcessLineOfSight(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough = 0, CEntity* pSourceEntity = nullptr, CEntity* pTargetEntity = nullptr)
+	{
+		if (m_nMaxAgeFrames == 0)
+			return m_pRayFunc(source, target, pResults, nFlags, nSeeThroughShootThrough);
+
+		tEntityRef entities[2];
+		if (!MakeEntityRef(pSourceEntity, entities[0]) || !MakeEntityRef(pTargetEntity, entities[1]))
+		{
+			m_nUncached++;
+			return m_pRayFunc(source, target, pResults, nFlags, nSeeThroughShootThrough);
+		}
+
+		tKey key = MakeKey(*source, *target, nFlags, nSeeThroughShootThrough);
+		tEntry& entry = m_aEntries[HashKey(key) & m_nMask];
+		if (entry.m_bUsed && entry.m_Key == key)
+		{
+			if (m_nFrame - entry.m_nFrame >= m_nMaxAgeFrames) m_nExpired++;
+			else if (HasMoved(entry)) m_nMoved++;
+			else
+			{
+				m_nHits++;
+				*pResults = entry.m_Results;
+				return entry.m_bHit;
+			}
+		}
+		m_nMisses++;
+
+		entry.m_Key = key;
+		entry.m_bUsed = true;
+		entry.m_nFrame = m_nFrame;
+		entry.m_aEntities[0] = entities[0];
+		entry.m_aEntities[1] = entities[1];
+		entry.m_Results = tLineOfSightResults();
+		entry.m_bHit = m_pRayFunc(source, target, &entry.m_Results, nFlags, nSeeThroughShootThrough);
+		*pResults = entry.m_Results;
+		return entry.m_bHit;
+	}
+
+	// the global cache as a CRayBatch::tRayFunc, RayBatch.SetRayFunc(CRayCache::CachedRayFunc) puts it in front of the batched rays too
+	static bool CachedRayFunc(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough);
+};
+
+CRayCache RayCache;
+
+inline bool CRayCache::CachedRayFunc(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough)
+{
+	return RayCache.ProcessLineOfSight(source, target, pResults, nFlags, nSeeThroughShootThrough);
+}
@@ -39,10 +39,10 @@ public:
 
 	static bool Save()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x4E5D60, 0x5BBB00)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x4E5D60, 0x5BBB00>()))();
 	}
 	static bool Load()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x4E5F00, 0x5BBC90)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x4E5F00, 0x5BBC90>()))();
 	}
 };
\ No newline at end of file
@@ -0,0 +1,152 @@
+// batched world to screen, projects N positions through a view * projection matrix in one pass
+// 4 points go through at a time with the frustum test done on the clip space values, no natives involved
+// d3d conventions: row vectors, w > 0 in front of the camera, clip z from 0 (near) to w (far)
+
+enum eProjectFlags : uint8_t
+{
+	PROJECT_VISIBLE = 1,		// inside the frustum, the screen position is valid
+	PROJECT_BEHIND_CAMERA = 2,	// on or behind the camera plane, the screen position is 0
+	PROJECT_OUTSIDE = 4,		// in front of the camera but outside the frustum, the screen position is valid but off screen or clipped by near/far
+};
+
+class CScreenProjector
+{
+	CMatrix m_mViewProjection;
+	float m_fScreenX = 0, m_fScreenY = 0;
+	float m_fScreenW = 1, m_fScreenH = 1;
+
+	// 4 points in soa form, visible and behind get one bit per point
+	void Project4(__m128 x, __m128 y, __m128 z, __m128& sx, __m128& sy, __m128& depth, int& visible, int& behind) const
+	{
+		const float* m = &m_mViewProjection.right.x;
+		__m128 cx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m[0])), _mm_mul_ps(y, _mm_set1_ps(m[4]))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(m[8])), _mm_set1_ps(m[12])));
+		__m128 cy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m[1])), _mm_mul_ps(y, _mm_set1_ps(m[5]))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(m[9])), _mm_set1_ps(m[13])));
+		__m128 cz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m[2])), _mm_mul_ps(y, _mm_set1_ps(m[6]))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(m[10])), _mm_set1_ps(m[14])));
+		__m128 cw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m[3])), _mm_mul_ps(y, _mm_set1_ps(m[7]))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(m[11])), _mm_set1_ps(m[15])));
+
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 front = _mm_cmpgt_ps(cw, _mm_set1_ps(1e-6f));
+		__m128 inside = _mm_and_ps(_mm_cmple_ps(_mm_and_ps(cx, absMask), cw), _mm_cmple_ps(_mm_and_ps(cy, absMask), cw));
+		inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmpge_ps(cz, _mm_setzero_ps()), _mm_cmple_ps(cz, cw)));
+		inside = _mm_and_ps(inside, front);
+
+		// lanes behind the camera divide by 1 and get masked to 0 after
+		__m128 invW = _mm_div_ps(_mm_set1_ps(1.0f), _mm_or_ps(_mm_and_ps(front, cw), _mm_andnot_ps(front, _mm_set1_ps(1.0f))));
+		__m128 half = _mm_set1_ps(0.5f);
+		sx = _mm_add_ps(_mm_set1_ps(m_fScreenX), _mm_mul_ps(_mm_add_ps(half, _mm_mul_ps(_mm_mul_ps(cx, invW), half)), _mm_set1_ps(m_fScreenW)));
+		sy = _mm_add_ps(_mm_set1_ps(m_fScreenY), _mm_mul_ps(_mm_sub_ps(half, _mm_mul_ps(_mm_mul_ps(cy, invW), half)), _mm_set1_ps(m_fScreenH)));
+		depth = _mm_and_ps(_mm_mul_ps(cz, invW), front);
+		sx = _mm_and_ps(sx, front);
+		sy = _mm_and_ps(sy, front);
+
+		visible = _mm_movemask_ps(inside);
+		behind = ~_mm_movemask_ps(front) & 0xF;
+	}
+
+public:
+	// screen rect the -1 to 1 ndc range is mapped onto, y goes down
+	void SetScreen(float x, float y, float w, float h)
+	{
+		m_fScreenX = x;
+		m_fScreenY = y;
+		m_fScreenW = w;
+		m_fScreenH = h;
+	}
+
+	// view * projection as a full 4x4, see CSimdMatrix::Load4x4
+	void SetViewProjection(const CMatrix& viewProj)
+	{
+		m_mViewProjection = viewProj;
+	}
+
+	const CMatrix& GetViewProjection() const { return m_mViewProjection; }
+
+	// the projection matrix and resolution come from the viewport, the view matrix from BuildViewMatrix or wherever else
+	// e.g. projector.SetViewport(Scene.m_pGlobalScene->m_pGameViewport->m_pData, CScreenProjector::BuildViewMatrix(cam->m_mMatrix))
+	void SetViewport(const tViewportData& data, const CMatrix& view)
+	{
+		CMatrix viewProj;
+		CSimdMatrix::Load4x4(view).Multiply4x4(CSimdMatrix::Load4x4(data.m_mProjectionMatrix)).Store4x4(viewProj);
+		SetViewProjection(viewProj);
+		SetScreen(0, 0, (float)data.m_nResX, (float)data.m_nResY);
+	}
+
+	// game camera matrices are right/forward/up, rage's view space is right/up/back and looks down -z
+	static CMatrix BuildViewMatrix(const CMatrix& cam)
+	{
+		CVector right = ToVector(cam.right), at = ToVector(cam.at), up = ToVector(cam.up), pos = ToVector(cam.pos);
+
+		CMatrix m;
+		m.right = CVector_pad(right.x, up.x, -at.x, 0);
+		m.at = CVector_pad(right.y, up.y, -at.y, 0);
+		m.up = CVector_pad(right.z, up.z, -at.z, 0);
+		m.pos = CVector_pad(-right.Dot(pos), -up.Dot(pos), at.Dot(pos), 0x3F800000); // w = 1.0f
+		return m;
+	}
+
+	// out and flags get count entries, depth is optional and is the ndc z (0 near, 1 far)
+	// returns how many points are visible
+	uint32_t Project(const CVector* in, CVector2D* out, uint8_t* flags, uint32_t count, float* pDepth = nullptr) const
+	{
+		uint32_t numVisible = 0;
+		uint32_t i = 0;
+		if (gSimdLevel >= SIMD_SSE)
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 x = _mm_setr_ps(in[i].x, in[i + 1].x, in[i + 2].x, in[i + 3].x);
+				__m128 y = _mm_setr_ps(in[i].y, in[i + 1].y, in[i + 2].y, in[i + 3].y);
+				__m128 z = _mm_setr_ps(in[i].z, in[i + 1].z, in[i + 2].z, in[i + 3].z);
+
+				__m128 sx, sy, depth;
+				int visible, behind;
+				Project4(x, y, z, sx, sy, depth, visible, behind);
+
+				// interleave into x, y pairs
+				_mm_storeu_ps(&out[i].x, _mm_unpacklo_ps(sx, sy));
+				_mm_storeu_ps(&out[i + 2].x, _mm_unpackhi_ps(sx, sy));
+				if (pDepth) _mm_storeu_ps(&pDepth[i], depth);
+
+				for (uint32_t j = 0; j < 4; j++)
+				{
+					uint8_t f = (visible >> j) & 1 ? PROJECT_VISIBLE : ((behind >> j) & 1 ? PROJECT_BEHIND_CAMERA : PROJECT_OUTSIDE);
+					flags[i + j] = f;
+					numVisible += f == PROJECT_VISIBLE;
+				}
+			}
+		}
+		for (; i < count; i++)
+		{
+			float d;
+			flags[i] = Project(in[i], out[i], &d);
+			if (pDepth) pDepth[i] = d;
+			numVisible += flags[i] == PROJECT_VISIBLE;
+		}
+		return numVisible;
+	}
+
+	uint8_t Project(const CVector& in, CVector2D& out, float* pDepth = nullptr) const
+	{
+		const float* m = &m_mViewProjection.right.x;
+		float cx = in.x * m[0] + in.y * m[4] + in.z * m[8] + m[12];
+		float cy = in.x * m[1] + in.y * m[5] + in.z * m[9] + m[13];
+		float cz = in.x * m[2] + in.y * m[6] + in.z * m[10] + m[14];
+		float cw = in.x * m[3] + in.y * m[7] + in.z * m[11] + m[15];
+
+		if (!(cw > 1e-6f))
+		{
+			out.x = 0;
+			out.y = 0;
+			if (pDepth) *pDepth = 0;
+			return PROJECT_BEHIND_CAMERA;
+		}
+
+		float invW = 1.0f / cw;
+		out.x = m_fScreenX + (0.5f + cx * invW * 0.5f) * m_fScreenW;
+		out.y = m_fScreenY + (0.5f - cy * invW * 0.5f) * m_fScreenH;
+		if (pDepth) *pDepth = cz * invW;
+
+		bool inside = fabsf(cx) <= cw && fabsf(cy) <= cw && cz >= 0.0f && cz <= cw;
+		return inside ? PROJECT_VISIBLE : PROJECT_OUTSIDE;
+	}
+};
@@ -0,0 +1,410 @@
+// 16 byte aligned vector and matrix types with the same layout as CVector_pad and CMatrix
+// game data that's 16 byte aligned (entity matrices are) can be used in place through From, anything else should be copied in
+// the w lane is the CVector_pad flags and is ignored by everything that works on 3 components
+
+class alignas(16) CSimdVector
+{
+public:
+	float x, y, z, w;
+
+	CSimdVector() : x(0), y(0), z(0), w(0) {}
+	CSimdVector(float x, float y, float z, float w = 0) : x(x), y(y), z(z), w(w) {}
+	CSimdVector(__m128 v) { _mm_store_ps(&x, v); }
+	explicit CSimdVector(const CVector& v) : x(v.x), y(v.y), z(v.z), w(0) {}
+
+	static CSimdVector& From(CVector_pad& v) { return reinterpret_cast<CSimdVector&>(v); }
+	static const CSimdVector& From(const CVector_pad& v) { return reinterpret_cast<const CSimdVector&>(v); }
+
+	__m128 Get() const { return _mm_load_ps(&x); }
+	CVector ToVector() const { return CVector(x, y, z); }
+	CVector_pad ToPadded() const { return CVector_pad(x, y, z); }
+
+	static __m128 MaskXYZ(__m128 v) { return _mm_and_ps(v, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))); }
+
+	// x + y + z broadcast to all lanes
+	static __m128 Dot3(__m128 a, __m128 b)
+	{
+		__m128 m = MaskXYZ(_mm_mul_ps(a, b));
+		m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// the w lane is masked, flags that happen to be a nan would otherwise come out as w * w - w * w
+	static __m128 Cross(__m128 a, __m128 b)
+	{
+		__m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+		return MaskXYZ(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+	}
+
+	// rsqrt is only good for 12 bits, one newton step brings it close to full float precision
+	static __m128 ReciprocalSqrt(__m128 d)
+	{
+		__m128 r = _mm_rsqrt_ps(d);
+		__m128 rrd = _mm_mul_ps(_mm_mul_ps(r, r), d);
+		return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), r), _mm_sub_ps(_mm_set1_ps(3.0f), rrd));
+	}
+
+	// zero length vectors normalize to zero like CVector::Normalized
+	static __m128 Normalize(__m128 v)
+	{
+		__m128 d = Dot3(v, v);
+		__m128 valid = _mm_cmpgt_ps(d, _mm_set1_ps(1e-12f));
+		return _mm_and_ps(MaskXYZ(_mm_mul_ps(v, ReciprocalSqrt(d))), valid);
+	}
+
+	float Dot(const CSimdVector& rhs) const { return _mm_cvtss_f32(Dot3(Get(), rhs.Get())); }
+	CSimdVector Cross(const CSimdVector& rhs) const { return Cross(Get(), rhs.Get()); }
+	float MagnitudeSqr() const { return Dot(*this); }
+	float Magnitude() const { return _mm_cvtss_f32(_mm_sqrt_ss(Dot3(Get(), Get()))); }
+	CSimdVector Normalized() const { return Normalize(Get()); }
+	void Normalize() { *this = Normalize(Get()); }
+
+	CSimdVector operator+(const CSimdVector& rhs) const { return _mm_add_ps(Get(), rhs.Get()); }
+	CSimdVector operator-(const CSimdVector& rhs) const { return _mm_sub_ps(Get(), rhs.Get()); }
+	CSimdVector operator*(const CSimdVector& rhs) const { return _mm_mul_ps(Get(), rhs.Get()); }
+	CSimdVector operator*(float scalar) const { return _mm_mul_ps(Get(), _mm_set1_ps(scalar)); }
+};
+VALIDATE_SIZE(CVector_pad, 0x10);
+VALIDATE_SIZE(CSimdVector, 0x10);
+VALIDATE_OFFSET(CSimdVector, x, 0x0);
+VALIDATE_OFFSET(CSimdVector, y, 0x4);
+VALIDATE_OFFSET(CSimdVector, z, 0x8);
+VALIDATE_OFFSET(CSimdVector, w, 0xC);
+
+class alignas(16) CSimdMatrix
+{
+public:
+	CSimdVector right; // 00-10
+	CSimdVector at; // 10-20
+	CSimdVector up; // 20-30
+	CSimdVector pos; // 30-40
+
+	CSimdMatrix() {}
+	CSimdMatrix(const CMatrix& m)
+		: right(CSimdVector::MaskXYZ(_mm_loadu_ps(&m.right.x))), at(CSimdVector::MaskXYZ(_mm_loadu_ps(&m.at.x))),
+		up(CSimdVector::MaskXYZ(_mm_loadu_ps(&m.up.x))), pos(CSimdVector::MaskXYZ(_mm_loadu_ps(&m.pos.x))) {}
+
+	static CSimdMatrix& From(CMatrix& m) { return reinterpret_cast<CSimdMatrix&>(m); }
+	static const CSimdMatrix& From(const CMatrix& m) { return reinterpret_cast<const CSimdMatrix&>(m); }
+
+	CMatrix ToMatrix() const
+	{
+		CMatrix m;
+		m.right = right.ToPadded();
+		m.at = at.ToPadded();
+		m.up = up.ToPadded();
+		m.pos = pos.ToPadded();
+		return m;
+	}
+
+	// ignores the w lanes of the matrix so the flags of a reinterpreted CMatrix don't leak into the results
+	__m128 TransformVector(__m128 v) const
+	{
+		__m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+		__m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+		__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(right.Get(), x), _mm_mul_ps(at.Get(), y)), _mm_mul_ps(up.Get(), z));
+		return CSimdVector::MaskXYZ(r);
+	}
+
+	__m128 TransformPosition(__m128 v) const
+	{
+		return _mm_add_ps(TransformVector(v), CSimdVector::MaskXYZ(pos.Get()));
+	}
+
+	CSimdVector TransformVector(const CSimdVector& v) const { return TransformVector(v.Get()); }
+	CSimdVector TransformPosition(const CSimdVector& v) const { return TransformPosition(v.Get()); }
+
+	// same as MultiplyMatrix, this * b
+	CSimdMatrix operator*(const CSimdMatrix& b) const
+	{
+		CSimdMatrix out;
+		out.right = TransformVector(b.right.Get());
+		out.at = TransformVector(b.at.Get());
+		out.up = TransformVector(b.up.Get());
+		out.pos = TransformPosition(b.pos.Get());
+		return out;
+	}
+
+	// same as InverseMatrix, only valid for rotation + translation
+	CSimdMatrix InverseOrthonormal() const
+	{
+		__m128 r = right.Get(), a = at.Get(), u = up.Get(), w = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(r, a, u, w);
+
+		CSimdMatrix out;
+		out.right = CSimdVector::MaskXYZ(r);
+		out.at = CSimdVector::MaskXYZ(a);
+		out.up = CSimdVector::MaskXYZ(u);
+		out.pos = _mm_sub_ps(_mm_setzero_ps(), out.TransformVector(pos.Get()));
+		return out;
+	}
+
+	// rotation, scale and shear + translation, the rows of the inverse 3x3 are cross products of the columns divided by the determinant
+	// returns false and leaves out untouched if the matrix can't be inverted, the same relative test as Inverse4x4
+	// so a uniformly tiny scale still inverts and a nearly flat matrix of any size doesn't
+	bool InverseAffine(CSimdMatrix& out) const
+	{
+		__m128 r = right.Get(), a = at.Get(), u = up.Get();
+		__m128 c0 = CSimdVector::Cross(a, u);
+		__m128 c1 = CSimdVector::Cross(u, r);
+		__m128 c2 = CSimdVector::Cross(r, a);
+
+		// hadamard's inequality again, |det| <= |right||at||up|
+		float det = _mm_cvtss_f32(CSimdVector::Dot3(r, c0));
+		// square roots before the product so the bound under or overflows where det itself would
+		__m128 lengths = _mm_sqrt_ps(_mm_unpacklo_ps(_mm_unpacklo_ps(CSimdVector::Dot3(r, r), CSimdVector::Dot3(u, u)), CSimdVector::Dot3(a, a)));
+		lengths = _mm_mul_ss(_mm_mul_ss(lengths, _mm_shuffle_ps(lengths, lengths, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_ps(lengths, lengths, _MM_SHUFFLE(2, 2, 2, 2)));
+		float bound = _mm_cvtss_f32(lengths);
+		if (!(fabsf(det) > bound * 1e-6f)) return false;
+
+		__m128 invDet = _mm_set1_ps(1.0f / det);
+		c0 = _mm_mul_ps(c0, invDet);
+		c1 = _mm_mul_ps(c1, invDet);
+		c2 = _mm_mul_ps(c2, invDet);
+		__m128 w = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(c0, c1, c2, w);
+
+		out.right = CSimdVector::MaskXYZ(c0);
+		out.at = CSimdVector::MaskXYZ(c1);
+		out.up = CSimdVector::MaskXYZ(c2);
+		out.pos = _mm_sub_ps(_mm_setzero_ps(), out.TransformVector(pos.Get()));
+		return true;
+	}
+
+	// quaternion needs to be normalized
+	static CSimdMatrix FromQuaternion(const CQuaternion& q)
+	{
+		__m128 v = _mm_loadu_ps(&q.x);
+		__m128 v2 = _mm_add_ps(v, v);
+
+		#define SWIZZLE(vec, a, b, c) _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, c, b, a))
+		// right = (1 - 2yy - 2zz, 2xy + 2zw, 2xz - 2yw)
+		__m128 right = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(SWIZZLE(v, 1, 0, 0), SWIZZLE(v2, 1, 1, 2)), _mm_set_ps(0, 1, 1, -1)),
+			_mm_mul_ps(_mm_mul_ps(SWIZZLE(v, 2, 3, 3), SWIZZLE(v2, 2, 2, 1)), _mm_set_ps(0, -1, 1, -1)));
+		// at = (2xy - 2zw, 1 - 2xx - 2zz, 2yz + 2xw)
+		__m128 at = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(SWIZZLE(v, 0, 0, 1), SWIZZLE(v2, 1, 0, 2)), _mm_set_ps(0, 1, -1, 1)),
+			_mm_mul_ps(_mm_mul_ps(SWIZZLE(v, 3, 2, 3), SWIZZLE(v2, 2, 2, 0)), _mm_set_ps(0, 1, -1, -1)));
+		// up = (2xz + 2yw, 2yz - 2xw, 1 - 2xx - 2yy)
+		__m128 up = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(SWIZZLE(v, 0, 1, 0), SWIZZLE(v2, 2, 2, 0)), _mm_set_ps(0, -1, 1, 1)),
+			_mm_mul_ps(_mm_mul_ps(SWIZZLE(v, 3, 3, 1), SWIZZLE(v2, 1, 0, 1)), _mm_set_ps(0, -1, -1, 1)));
+		#undef SWIZZLE
+
+		CSimdMatrix out;
+		out.right = _mm_add_ps(right, _mm_set_ps(0, 0, 0, 1));
+		out.at = _mm_add_ps(at, _mm_set_ps(0, 0, 1, 0));
+		out.up = _mm_add_ps(up, _mm_set_ps(0, 1, 0, 0));
+		out.pos = _mm_setzero_ps();
+		return out;
+	}
+
+	CQuaternion ToQuaternion() const
+	{
+		return MatrixToQuaternion(ToMatrix());
+	}
+
+	// everything below treats the matrix as a full 4x4 with the w lanes as the 4th column, d3d row vector convention
+	// only use these on matrices that really have a 4th column like projection matrices, a CMatrix from an entity has flags there
+	static CSimdMatrix Load4x4(const CMatrix& m)
+	{
+		CSimdMatrix out;
+		out.right = _mm_loadu_ps(&m.right.x);
+		out.at = _mm_loadu_ps(&m.at.x);
+		out.up = _mm_loadu_ps(&m.up.x);
+		out.pos = _mm_loadu_ps(&m.pos.x);
+		return out;
+	}
+
+	void Store4x4(CMatrix& m) const
+	{
+		_mm_storeu_ps(&m.right.x, right.Get());
+		_mm_storeu_ps(&m.at.x, at.Get());
+		_mm_storeu_ps(&m.up.x, up.Get());
+		_mm_storeu_ps(&m.pos.x, pos.Get());
+	}
+
+	// x * right + y * at + z * up + w * pos, all 4 lanes
+	__m128 TransformHomogeneous(__m128 v) const
+	{
+		__m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+		__m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+		__m128 w = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(right.Get(), x), _mm_mul_ps(at.Get(), y)), _mm_add_ps(_mm_mul_ps(up.Get(), z), _mm_mul_ps(pos.Get(), w)));
+	}
+
+	// this * b as full 4x4 matrices, the rows of this go through b
+	CSimdMatrix Multiply4x4(const CSimdMatrix& b) const
+	{
+		CSimdMatrix out;
+		out.right = b.TransformHomogeneous(right.Get());
+		out.at = b.TransformHomogeneous(at.Get());
+		out.up = b.TransformHomogeneous(up.Get());
+		out.pos = b.TransformHomogeneous(pos.Get());
+		return out;
+	}
+
+	// largest element of this * inv - identity, a cheap error bound for any of the inverses
+	float InverseError(const CSimdMatrix& inv) const
+	{
+		CSimdMatrix p = Multiply4x4(inv);
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 e = _mm_and_ps(_mm_sub_ps(p.right.Get(), _mm_set_ps(0, 0, 0, 1)), absMask);
+		e = _mm_max_ps(e, _mm_and_ps(_mm_sub_ps(p.at.Get(), _mm_set_ps(0, 0, 1, 0)), absMask));
+		e = _mm_max_ps(e, _mm_and_ps(_mm_sub_ps(p.up.Get(), _mm_set_ps(0, 1, 0, 0)), absMask));
+		e = _mm_max_ps(e, _mm_and_ps(_mm_sub_ps(p.pos.Get(), _mm_set_ps(1, 0, 0, 0)), absMask));
+		e = _mm_max_ps(e, _mm_shuffle_ps(e, e, _MM_SHUFFLE(2, 3, 0, 1)));
+		e = _mm_max_ps(e, _mm_shuffle_ps(e, e, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(e);
+	}
+
+	#define SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+	#define SWIZZLE(v, x, y, z, w) SHUFFLE(v, v, x, y, z, w)
+
+	// 2x2 blocks are stored as (m00, m01, m10, m11)
+	static __m128 Mat2Mul(__m128 a, __m128 b) // a * b
+	{
+		return _mm_add_ps(_mm_mul_ps(a, SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(SWIZZLE(a, 1, 0, 3, 2), SWIZZLE(b, 2, 1, 2, 1)));
+	}
+	static __m128 Mat2AdjMul(__m128 a, __m128 b) // adj(a) * b
+	{
+		return _mm_sub_ps(_mm_mul_ps(SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(SWIZZLE(a, 1, 1, 2, 2), SWIZZLE(b, 2, 3, 0, 1)));
+	}
+	static __m128 Mat2MulAdj(__m128 a, __m128 b) // a * adj(b)
+	{
+		return _mm_sub_ps(_mm_mul_ps(a, SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(SWIZZLE(a, 1, 0, 3, 2), SWIZZLE(b, 2, 1, 2, 1)));
+	}
+
+	// general 4x4 inverse, cramer's rule done on 2x2 blocks so there's no branching on the matrix contents
+	// fails when the matrix is singular or so badly conditioned the result would be mostly rounding error
+	// (|det| tiny compared to the product of the row lengths), out is left untouched then
+	bool Inverse4x4(CSimdMatrix& out) const
+	{
+		__m128 r0 = right.Get(), r1 = at.Get(), r2 = up.Get(), r3 = pos.Get();
+
+		__m128 A = _mm_movelh_ps(r0, r1);
+		__m128 B = _mm_movehl_ps(r1, r0);
+		__m128 C = _mm_movelh_ps(r2, r3);
+		__m128 D = _mm_movehl_ps(r3, r2);
+
+		// (|A|, |B|, |C|, |D|)
+		__m128 detSub = _mm_sub_ps(_mm_mul_ps(SHUFFLE(r0, r2, 0, 2, 0, 2), SHUFFLE(r1, r3, 1, 3, 1, 3)),
+			_mm_mul_ps(SHUFFLE(r0, r2, 1, 3, 1, 3), SHUFFLE(r1, r3, 0, 2, 0, 2)));
+		__m128 detA = SWIZZLE(detSub, 0, 0, 0, 0);
+		__m128 detB = SWIZZLE(detSub, 1, 1, 1, 1);
+		__m128 detC = SWIZZLE(detSub, 2, 2, 2, 2);
+		__m128 detD = SWIZZLE(detSub, 3, 3, 3, 3);
+
+		__m128 D_C = Mat2AdjMul(D, C);
+		__m128 A_B = Mat2AdjMul(A, B);
+		__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));
+		__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));
+		__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B));
+		__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		__m128 tr = _mm_mul_ps(A_B, SWIZZLE(D_C, 0, 2, 1, 3));
+		tr = _mm_add_ps(tr, SWIZZLE(tr, 1, 0, 3, 2));
+		tr = _mm_add_ps(tr, SWIZZLE(tr, 2, 3, 0, 1));
+		__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+		// hadamard's inequality, |det| <= product of the row lengths
+		__m128 s0 = _mm_mul_ps(r0, r0), s1 = _mm_mul_ps(r1, r1), s2 = _mm_mul_ps(r2, r2), s3 = _mm_mul_ps(r3, r3);
+		_MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+		__m128 lengths = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3)));
+		lengths = _mm_mul_ps(lengths, SWIZZLE(lengths, 1, 0, 3, 2));
+		lengths = _mm_mul_ps(lengths, SWIZZLE(lengths, 2, 3, 0, 1));
+		float det = _mm_cvtss_f32(detM);
+		float bound = _mm_cvtss_f32(lengths);
+		if (!(fabsf(det) > bound * 1e-6f)) return false;
+
+		__m128 rDetM = _mm_div_ps(_mm_set_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+		X = _mm_mul_ps(X, rDetM);
+		Y = _mm_mul_ps(Y, rDetM);
+		Z = _mm_mul_ps(Z, rDetM);
+		W = _mm_mul_ps(W, rDetM);
+
+		// adjugate the blocks and put them back into rows in one go
+		out.right = SHUFFLE(X, Y, 3, 1, 3, 1);
+		out.at = SHUFFLE(X, Y, 2, 0, 2, 0);
+		out.up = SHUFFLE(Z, W, 3, 1, 3, 1);
+		out.pos = SHUFFLE(Z, W, 2, 0, 2, 0);
+		return true;
+	}
+
+	#undef SWIZZLE
+	#undef SHUFFLE
+};
+VALIDATE_SIZE(CMatrix, 0x40);
+VALIDATE_SIZE(CSimdMatrix, 0x40);
+VALIDATE_OFFSET(CSimdMatrix, right, 0x0);
+VALIDATE_OFFSET(CSimdMatrix, at, 0x10);
+VALIDATE_OFFSET(CSimdMatrix, up, 0x20);
+VALIDATE_OFFSET(CSimdMatrix, pos, 0x30);
+
+// InverseMatrix for matrices that can be scaled or sheared, the flags of out are 0
+inline bool InverseMatrixAffine(const CMatrix& m, CMatrix& out)
+{
+	CSimdMatrix inv;
+	if (!CSimdMatrix(m).InverseAffine(inv)) return false;
+	out = inv.ToMatrix();
+	return true;
+}
+
+// full 4x4 inverse, the w lanes are used as the 4th column, see CSimdMatrix::Load4x4
+// pError gets the largest element of m * out - identity, well conditioned matrices stay under 1e-5
+inline bool InverseMatrix4x4(const CMatrix& m, CMatrix& out, float* pError = nullptr)
+{
+	CSimdMatrix sm = CSimdMatrix::Load4x4(m);
+	CSimdMatrix inv;
+	if (!sm.Inverse4x4(inv)) return false;
+	inv.Store4x4(out);
+	if (pError) *pError = sm.InverseError(inv);
+	return true;
+}
+
+// perspective projection matrices only have 7 meaningful elements
+//   sx  0   0   0
+//   0   sy  0   0
+//   cx  cy  a   s
+//   0   0   b   0
+// so the inverse is closed form, anything that doesn't look like that goes through InverseMatrix4x4
+inline bool InverseProjectionMatrix(const CMatrix& proj, CMatrix& out, float* pError = nullptr)
+{
+	const float* p = &proj.right.x;
+	float sx = p[0], sy = p[5], cx = p[8], cy = p[9], a = p[10], s = p[11], b = p[14];
+
+	const float eps = 1e-6f;
+	bool perspective = fabsf(p[1]) < eps && fabsf(p[2]) < eps && fabsf(p[3]) < eps
+		&& fabsf(p[4]) < eps && fabsf(p[6]) < eps && fabsf(p[7]) < eps
+		&& fabsf(p[12]) < eps && fabsf(p[13]) < eps && fabsf(p[15]) < eps;
+	if (!perspective)
+		return InverseMatrix4x4(proj, out, pError);
+
+	if (fabsf(sx) < eps || fabsf(sy) < eps || fabsf(s) < eps || fabsf(b) < eps) return false;
+
+	float* o = &out.right.x;
+	float isx = 1.0f / sx, isy = 1.0f / sy, is = 1.0f / s, ib = 1.0f / b;
+	o[0] = isx;			o[1] = 0;			o[2] = 0;	o[3] = 0;
+	o[4] = 0;			o[5] = isy;			o[6] = 0;	o[7] = 0;
+	o[8] = 0;			o[9] = 0;			o[10] = 0;	o[11] = ib;
+	o[12] = -cx * isx * is;	o[13] = -cy * isy * is;	o[14] = is;	o[15] = -a * ib * is;
+
+	if (pError) *pError = CSimdMatrix::Load4x4(proj).InverseError(CSimdMatrix::Load4x4(out));
+	return true;
+}
+
+// normalized device coordinates back to the space the matrix was inverted from
+// pass the inverse of view * projection to get world positions, ndc x/y are -1 to 1 and z is 0 (near) to 1 (far)
+inline bool UnprojectPoint(const CMatrix& invViewProj, float ndcX, float ndcY, float ndcZ, CVector& out)
+{
+	__m128 v = CSimdMatrix::Load4x4(invViewProj).TransformHomogeneous(_mm_set_ps(1.0f, ndcZ, ndcY, ndcX));
+	CSimdVector r(v);
+	if (fabsf(r.w) < 1e-12f) return false;
+
+	float invW = 1.0f / r.w;
+	out = CVector(r.x * invW, r.y * invW, r.z * invW);
+	return true;
+}
@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <cfloat>
+
+// uniform grid over the xy plane for proximity queries on peds and vehicles
+// cells are hashed into a fixed number of buckets and the entries are counting sorted by bucket, so a rebuild is two passes
+// and a query only touches the buckets of the cells it overlaps. z isn't part of the grid, it's only used in the distance checks
+enum eSpatialEntityType : uint8_t
+{
+	SPATIAL_PED,
+	SPATIAL_VEHICLE,
+	SPATIAL_OTHER,
+};
+
+struct tSpatialEntry
+{
+	CVector m_vPos;
+	CEntity* m_pEntity;
+	int32_t m_nSlot;				// pool slot, GetAt(handle) isn't needed to find it again
+	int16_t m_nCellX;
+	int16_t m_nCellY;
+	eSpatialEntityType m_nType;
+};
+
+class CSpatialGrid
+{
+	float m_fCellSize;
+	float m_fInvCellSize;
+	uint32_t m_nBucketMask;
+	std::vector<uint32_t> m_aBucketStart;	// entries of bucket b are [m_aBucketStart[b], m_aBucketStart[b + 1])
+	std::vector<tSpatialEntry> m_aEntries;	// sorted by bucket after Build
+	std::vector<tSpatialEntry> m_aPending;	// added since the last Build
+
+	int32_t GetCell(float f) const
+	{
+		int32_t c = (int32_t)floorf(f * m_fInvCellSize);
+		return c < INT16_MIN ? INT16_MIN : (c > INT16_MAX ? INT16_MAX : c);
+	}
+
+	uint32_t GetBucket(int32_t x, int32_t y) const
+	{
+		return (((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u)) & m_nBucketMask;
+	}
+
+	// two cells can share a bucket, the cell check keeps entries from being visited twice
+	template<typename F>
+	void VisitCell(int32_t x, int32_t y, F& fn) const
+	{
+		uint32_t b = GetBucket(x, y);
+		for (uint32_t i = m_aBucketStart[b]; i < m_aBucketStart[b + 1]; i++)
+		{
+			const tSpatialEntry& e = m_aEntries[i];
+			if (e.m_nCellX == x && e.m_nCellY == y) fn(e);
+		}
+	}
+
+	template<typename F>
+	void VisitCells(int32_t x0, int32_t y0, int32_t x1, int32_t y1, F& fn) const
+	{
+		// bigger than the whole table, one pass over everything is cheaper
+		if ((uint64_t)(x1 - x0 + 1) * (uint64_t)(y1 - y0 + 1) > m_nBucketMask + 1)
+		{
+			for (const auto& e : m_aEntries)
+			{
+				if (e.m_nCellX >= x0 && e.m_nCellX <= x1 && e.m_nCellY >= y0 && e.m_nCellY <= y1) fn(e);
+			}
+			return;
+		}
+
+		for (int32_t y = y0; y <= y1; y++)
+		{
+			for (int32_t x = x0; x <= x1; x++)
+			{
+				VisitCell(x, y, fn);
+			}
+		}
+	}
+
+public:
+	bool m_bEnabled = false;		// rebuilt from the ped and vehicle pools at the start of every processScriptsEvent
+
+	// nNumBuckets gets rounded up to a power of 2, a few times the expected entity count keeps the buckets short
+	CSpatialGrid(float fCellSize = 16.0f, uint32_t nNumBuckets = 4096)
+	{
+		uint32_t buckets = 1;
+		while (buckets < nNumBuckets) buckets <<= 1;
+
+		m_fCellSize = fCellSize;
+		m_fInvCellSize = 1.0f / fCellSize;
+		m_nBucketMask = buckets - 1;
+		m_aBucketStart.assign(buckets + 1, 0);
+	}
+
+	float GetCellSize() const { return m_fCellSize; }
+	uint32_t Size() const { return (uint32_t)m_aEntries.size(); }
+	const std::vector<tSpatialEntry>& GetEntries() const { return m_aEntries; }
+
+	void Clear()
+	{
+		m_aPending.clear();
+		m_aEntries.clear();
+		std::fill(m_aBucketStart.begin(), m_aBucketStart.end(), 0);
+	}
+
+	// entities added here only show up in queries after the next Build
+	void Add(const CVector& pos, CEntity* pEntity, int32_t nSlot = -1, eSpatialEntityType nType = SPATIAL_OTHER)
+	{
+		tSpatialEntry e;
+		e.m_vPos = pos;
+		e.m_pEntity = pEntity;
+		e.m_nSlot = nSlot;
+		e.m_nCellX = (int16_t)GetCell(pos.x);
+		e.m_nCellY = (int16_t)GetCell(pos.y);
+		e.m_nType = nType;
+		m_aPending.push_back(e);
+	}
+
+	// replaces the contents of the grid with everything added since the last Build
+	void Build()
+	{
+		uint32_t numBuckets = m_nBucketMask + 1;
+		std::fill(m_aBucketStart.begin(), m_aBucketStart.end(), 0);
+		for (const auto& e : m_aPending)
+		{
+			m_aBucketStart[GetBucket(e.m_nCellX, e.m_nCellY) + 1]++;
+		}
+		for (uint32_t b = 0; b < numBuckets; b++)
+		{
+			m_aBucketStart[b + 1] += m_aBucketStart[b];
+		}
+
+		// m_aBucketStart[b] is used as the write cursor and ends up at the start of bucket b + 1, shifted back after
+		m_aEntries.resize(m_aPending.size());
+		for (const auto& e : m_aPending)
+		{
+			m_aEntries[m_aBucketStart[GetBucket(e.m_nCellX, e.m_nCellY)]++] = e;
+		}
+		for (uint32_t b = numBuckets; b > 0; b--)
+		{
+			m_aBucketStart[b] = m_aBucketStart[b - 1];
+		}
+		m_aBucketStart[0] = 0;
+
+		m_aPending.clear();
+	}
+
+	// rebuilds the grid from the ped and vehicle pools, game thread only
+	void Update()
+	{
+		m_aPending.clear();
+
+		auto add = [this](auto* pool, eSpatialEntityType type)
+		{
+			if (!pool) return;
+			for (int i = pool->FindNextUsed(0); i != -1; i = pool->FindNextUsed(i + 1))
+			{
+				CEntity* entity = pool->Get(i);
+				Add(entity->m_pMatrix ? ToVector(entity->m_pMatrix->pos) : entity->m_placement.m_vPosition, entity, i, type);
+			}
+		};
+		add(CPools::ms_pPedPool, SPATIAL_PED);
+		add(CPools::ms_pVehiclePool, SPATIAL_VEHICLE);
+
+		Build();
+	}
+
+	// fn(const tSpatialEntry&) for everything inside the box, edges included
+	template<typename F>
+	void ForEachInBox(const CVector& vMin, const CVector& vMax, F fn) const
+	{
+		auto visit = [&](const tSpatialEntry& e)
+		{
+			const CVector& p = e.m_vPos;
+			if (p.x >= vMin.x && p.x <= vMax.x && p.y >= vMin.y && p.y <= vMax.y && p.z >= vMin.z && p.z <= vMax.z) fn(e);
+		};
+		VisitCells(GetCell(vMin.x), GetCell(vMin.y), GetCell(vMax.x), GetCell(vMax.y), visit);
+	}
+
+	// fn(const tSpatialEntry&, float distSqr) for everything within radius of center
+	template<typename F>
+	void ForEachInRadius(const CVector& center, float radius, F fn) const
+	{
+		float radiusSqr = radius * radius;
+		auto visit = [&](const tSpatialEntry& e)
+		{
+			float distSqr = (e.m_vPos - center).MagnitudeSqr();
+			if (distSqr <= radiusSqr) fn(e, distSqr);
+		};
+		VisitCells(GetCell(center.x - radius), GetCell(center.y - radius), GetCell(center.x + radius), GetCell(center.y + radius), visit);
+	}
+
+	uint32_t QueryBox(const CVector& vMin, const CVector& vMax, std::vector<const tSpatialEntry*>& out) const
+	{
+		out.clear();
+		ForEachInBox(vMin, vMax, [&](const tSpatialEntry& e) { out.push_back(&e); });
+		return (uint32_t)out.size();
+	}
+
+	uint32_t QueryRadius(const CVector& center, float radius, std::vector<const tSpatialEntry*>& out) const
+	{
+		out.clear();
+		ForEachInRadius(center, radius, [&](const tSpatialEntry& e, float) { out.push_back(&e); });
+		return (uint32_t)out.size();
+	}
+
+	// the k closest entries within maxRadius, closest first
+	// searches rings of cells outwards from the center and stops once no unvisited cell can beat the current k-th distance
+	uint32_t QueryNearest(const CVector& center, uint32_t k, std::vector<const tSpatialEntry*>& out, float maxRadius = FLT_MAX) const
+	{
+		out.clear();
+		if (k == 0 || m_aEntries.empty()) return 0;
+
+		struct tCandidate
+		{
+			float m_fDistSqr;
+			const tSpatialEntry* m_pEntry;
+			bool operator<(const tCandidate& rhs) const { return m_fDistSqr < rhs.m_fDistSqr; }
+		};
+		std::vector<tCandidate> heap; // max heap on distance, holds the best k so far
+		heap.reserve(k + 1);
+
+		float maxRadiusSqr = maxRadius * maxRadius;
+		uint32_t seen = 0;
+		auto visit = [&](const tSpatialEntry& e)
+		{
+			seen++;
+			float distSqr = (e.m_vPos - center).MagnitudeSqr();
+			if (distSqr > maxRadiusSqr) return;
+			if (heap.size() == k)
+			{
+				if (distSqr >= heap.front().m_fDistSqr) return;
+				std::pop_heap(heap.begin(), heap.end());
+				heap.pop_back();
+			}
+			heap.push_back({ distSqr, &e });
+			std::push_heap(heap.begin(), heap.end());
+		};
+
+		int32_t cx = GetCell(center.x), cy = GetCell(center.y);
+		int32_t maxRing = maxRadius < (float)INT16_MAX * m_fCellSize ? (int32_t)(maxRadius * m_fInvCellSize) + 1 : INT16_MAX;
+		for (int32_t r = 0; r <= maxRing; r++)
+		{
+			// the ring r cells around the center cell, top and bottom rows then the sides
+			if (r == 0)
+			{
+				VisitCell(cx, cy, visit);
+			}
+			else if ((uint64_t)(2 * r + 1) * (uint64_t)(2 * r + 1) > m_nBucketMask + 1)
+			{
+				// the rings now cover more cells than there are buckets, finish with one pass over the rest
+				for (const auto& e : m_aEntries)
+				{
+					if (abs(e.m_nCellX - cx) >= r || abs(e.m_nCellY - cy) >= r) visit(e);
+				}
+				break;
+			}
+			else
+			{
+				for (int32_t x = cx - r; x <= cx + r; x++)
+				{
+					VisitCell(x, cy - r, visit);
+					VisitCell(x, cy + r, visit);
+				}
+				for (int32_t y = cy - r + 1; y <= cy + r - 1; y++)
+				{
+					VisitCell(cx - r, y, visit);
+					VisitCell(cx + r, y, visit);
+				}
+			}
+
+			if (seen == m_aEntries.size()) break;
+
+			// anything in ring r + 1 is at least r cells away from the center
+			float ringDist = r * m_fCellSize;
+			if (heap.size() == k && heap.front().m_fDistSqr <= ringDist * ringDist) break;
+		}
+
+		std::sort_heap(heap.begin(), heap.end());
+		for (const auto& c : heap)
+		{
+			out.push_back(c.m_pEntry);
+		}
+		return (uint32_t)out.size();
+	}
+};
+
+// one per plugin, every .asi builds the sdk into itself so each has its own grid and pays for its own Update
+// set m_bEnabled to have it rebuilt before the processScriptsEvent callbacks run
+CSpatialGrid EntityGrid;
@@ -5,10 +5,10 @@ public:
 
 	static float GetStatValue(uint16_t index)
 	{
-		return ((float(__cdecl*)(uint16_t))(AddressSetter::Get(0x5633E0, 0x4D7A10)))(index);
+		return ((float(__cdecl*)(uint16_t))(AddressSetter::Get<0x5633E0, 0x4D7A10>()))(index);
 	}
 	static void SetStatValue(uint16_t index, float NewValue)
 	{
-		((void(__cdecl*)(uint16_t, float))(AddressSetter::Get(0x563D00, 0x4D8330)))(index, NewValue);
+		((void(__cdecl*)(uint16_t, float))(AddressSetter::Get<0x563D00, 0x4D8330>()))(index, NewValue);
 	}
 };
\ No newline at end of file
@@ -32,10 +32,10 @@ public:
 
 	static bool Save()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x56D020, 0x8C4190)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x56D020, 0x8C4190>()))();
 	}
 	static bool Load()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x56D1D0, 0x8C4340)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x56D1D0, 0x8C4340>()))();
 	}
 };
\ No newline at end of file
@@ -3,6 +3,6 @@ class CTaskComplexClimbLadder : public CTaskComplex
 public:
 	CTaskComplexClimbLadder(CObject* ladder, int32_t type, uint32_t unk0)
 	{
-		((void(__thiscall*)(CTaskComplexClimbLadder*, CObject*, int32_t, uint32_t))(AddressSetter::Get(0x8AD9D0, 0x8756F0)))(this, ladder, type, unk0);
+		((void(__thiscall*)(CTaskComplexClimbLadder*, CObject*, int32_t, uint32_t))(AddressSetter::Get<0x8AD9D0, 0x8756F0>()))(this, ladder, type, unk0);
 	}
 };
\ No newline at end of file
@@ -3,6 +3,6 @@ class CTaskComplexDie : public CTaskComplex
 public:
 	CTaskComplexDie(uint32_t unk, uint32_t unk2, uint32_t unk3_44, uint32_t unk4_190, float fBlendDelta, float fAnimSpeed, uint32_t unk5_1)
 	{
-		((void(__thiscall*)(CTaskComplexDie*, uint32_t, uint32_t, uint32_t, uint32_t, float, float, uint32_t))(AddressSetter::Get(0x6BC6C0, 0x818240)))(this, unk, unk2, unk3_44, unk4_190, fBlendDelta, fAnimSpeed, unk5_1);
+		((void(__thiscall*)(CTaskComplexDie*, uint32_t, uint32_t, uint32_t, uint32_t, float, float, uint32_t))(AddressSetter::Get<0x6BC6C0, 0x818240>()))(this, unk, unk2, unk3_44, unk4_190, fBlendDelta, fAnimSpeed, unk5_1);
 	}
 };
\ No newline at end of file
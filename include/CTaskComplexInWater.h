@@ -3,6 +3,6 @@ class CTaskComplexInWater : public CTaskComplex
 public:
 	CTaskComplexInWater(uint32_t unk, uint32_t unk2, bool bUnk)
 	{
-		((void(__thiscall*)(CTaskComplexInWater*, uint32_t, uint32_t, bool))(AddressSetter::Get(0x61EC00, 0x762950)))(this, unk, unk2, bUnk);
+		((void(__thiscall*)(CTaskComplexInWater*, uint32_t, uint32_t, bool))(AddressSetter::Get<0x61EC00, 0x762950>()))(this, unk, unk2, bUnk);
 	}
 };
\ No newline at end of file
@@ -10,6 +10,6 @@ class CTaskComplexNewGetInVehicle : public CTaskComplex
 public:
 	CTaskComplexNewGetInVehicle(CVehicle* veh, int32_t getInType, uint32_t unk27, int32_t unk, float fUnk)
 	{
-		((void(__thiscall*)(CTaskComplexNewGetInVehicle*, CVehicle*, int32_t, uint32_t, int32_t, float))(AddressSetter::Get(0x62BCF0, 0x86DFD0)))(this, veh, getInType, unk27, unk, fUnk);
+		((void(__thiscall*)(CTaskComplexNewGetInVehicle*, CVehicle*, int32_t, uint32_t, int32_t, float))(AddressSetter::Get<0x62BCF0, 0x86DFD0>()))(this, veh, getInType, unk27, unk, fUnk);
 	}
 };
\ No newline at end of file
@@ -3,6 +3,6 @@ class CTaskComplexPlayerOnFoot : public CTaskComplex
 public:
 	CTaskComplexPlayerOnFoot()
 	{
-		((void(__thiscall*)(CTaskComplexPlayerOnFoot*))(AddressSetter::Get(0x5AD950, 0x65A1F0)))(this);
+		((void(__thiscall*)(CTaskComplexPlayerOnFoot*))(AddressSetter::Get<0x5AD950, 0x65A1F0>()))(this);
 	}
 };
\ No newline at end of file
@@ -6,7 +6,7 @@ public:
 
 	CTaskComplexWander(uint32_t moveState, float initialDir, bool bSensibly, float targetRadius, uint32_t unk1)
 	{
-		((void(__thiscall*)(CTaskComplexWander*, uint32_t, float, bool, float, uint32_t))(AddressSetter::Get(0x618C70, 0x7FA900)))(this, moveState, initialDir, bSensibly, targetRadius, unk1);
+		((void(__thiscall*)(CTaskComplexWander*, uint32_t, float, bool, float, uint32_t))(AddressSetter::Get<0x618C70, 0x7FA900>()))(this, moveState, initialDir, bSensibly, targetRadius, unk1);
 	}
 };
 
@@ -16,7 +16,7 @@ public:
 	CTaskComplexWanderStandard(uint32_t moveState, float initialDir, bool bSensibly, float targetRadius, uint32_t unk1) : CTaskComplexWander(moveState, initialDir, bSensibly, targetRadius, unk1)
 	{
 		// this was probably inlined
-		*(uint32_t*)this = AddressSetter::Get(0x969794, 0x995474); // set vftable
+		*(uint32_t*)this = AddressSetter::Get<0x969794, 0x995474>(); // set vftable
 		this->m_fUnk = 0;
 	}
 };
\ No newline at end of file
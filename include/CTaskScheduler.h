@@ -0,0 +1,300 @@
+// cooperative tasks for plugin work that's too heavy for one frame, resumed from processScriptsEvent under a per frame time budget
+// needs c++20 (/std:c++20), with c++17 this header is empty and processScriptsEvent doesn't touch the scheduler
+//
+//	CTask SpawnPeds()
+//	{
+//		for (auto& spawn : spawns)
+//		{
+//			Spawn(spawn);
+//			co_await budgetExhausted();	// keeps going this frame unless the budget is used up
+//		}
+//		co_await millis(5000);			// game time, stops while paused
+//		Cleanup();
+//	}
+//	TaskScheduler.Start(SpawnPeds());
+//
+// game thread only, the clocks are passed in so nothing here knows about the game or the os,
+// Hooks.h makes the global one with the game's timer and QueryPerformanceCounter
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <vector>
+
+class CTaskScheduler;
+
+class CTask
+{
+public:
+	struct promise_type
+	{
+		CTaskScheduler* m_pScheduler = nullptr;
+		uint32_t m_nWakeFrame = 0;
+		uint32_t m_nWakeTime = 0;
+
+		CTask get_return_object() { return CTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+		// nothing runs until the scheduler first resumes it
+		std::suspend_always initial_suspend() { return {}; }
+		// the scheduler destroys it once it sees it's done
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		// same as the camera event, an exception just ends the task
+		void unhandled_exception() {}
+	};
+	typedef std::coroutine_handle<promise_type> tHandle;
+
+private:
+	tHandle m_Handle;
+
+	friend class CTaskScheduler;
+	explicit CTask(tHandle handle) : m_Handle(handle) {}
+
+public:
+	CTask(CTask&& rhs) noexcept : m_Handle(rhs.m_Handle) { rhs.m_Handle = nullptr; }
+	CTask(const CTask&) = delete;
+	CTask& operator=(const CTask&) = delete;
+
+	// a task that never got passed to Start is just thrown away
+	~CTask()
+	{
+		if (m_Handle) m_Handle.destroy();
+	}
+};
+
+class CTaskScheduler
+{
+public:
+	typedef uint32_t(*tTimeFunc)();		// milliseconds, for millis()
+	typedef uint64_t(*tTicksFunc)();	// microseconds, for the budget
+
+private:
+	struct tTaskEntry
+	{
+		CTask::tHandle m_Handle;
+		uint32_t m_nId;
+		bool m_bCancelled;
+	};
+
+	std::vector<tTaskEntry> m_aTasks;
+	uint32_t m_nNextId = 1;
+	uint32_t m_nFrame = 0;
+	uint32_t m_nCursor = 0;				// where the next Run starts, so tasks at the end of the list don't starve
+	bool m_bInRun = false;
+	uint64_t m_nBudgetEnd = 0;
+	tTimeFunc m_pGetTime;
+	tTicksFunc m_pGetMicroseconds;
+
+	bool IsReady(const CTask::promise_type& promise) const
+	{
+		return (int32_t)(m_nFrame - promise.m_nWakeFrame) >= 0 && (int32_t)(GetTime() - promise.m_nWakeTime) >= 0;
+	}
+
+public:
+	uint32_t m_nBudgetMicroseconds = 1000;	// per Run, 0 resumes every ready task
+
+	CTaskScheduler(tTimeFunc pGetTime, tTicksFunc pGetMicroseconds)
+	{
+		m_pGetTime = pGetTime;
+		m_pGetMicroseconds = pGetMicroseconds;
+	}
+
+	~CTaskScheduler()
+	{
+		Clear();
+	}
+
+	void SetClocks(tTimeFunc pGetTime, tTicksFunc pGetMicroseconds)
+	{
+		m_pGetTime = pGetTime;
+		m_pGetMicroseconds = pGetMicroseconds;
+	}
+
+	uint32_t GetTime() const { return m_pGetTime(); }
+	uint32_t GetFrame() const { return m_nFrame; }
+	uint32_t Size() const { return (uint32_t)m_aTasks.size(); }
+
+	// true once this Run has used up its budget, never true outside of Run
+	bool IsBudgetExhausted() const
+	{
+		return m_nBudgetEnd && m_pGetMicroseconds() >= m_nBudgetEnd;
+	}
+
+	// returns a handle for Cancel/IsRunning, handles are never 0
+	// the task first runs on the next Run
+	uint32_t Start(CTask task)
+	{
+		CTask::tHandle handle = task.m_Handle;
+		task.m_Handle = nullptr;
+
+		auto& promise = handle.promise();
+		promise.m_pScheduler = this;
+		promise.m_nWakeFrame = m_nFrame;
+		promise.m_nWakeTime = GetTime();
+
+		uint32_t id = m_nNextId++;
+		if (m_nNextId == 0) m_nNextId = 1;
+		m_aTasks.push_back({ handle, id, false });
+		return id;
+	}
+
+	bool IsRunning(uint32_t id) const
+	{
+		for (auto& task : m_aTasks)
+		{
+			if (task.m_nId == id) return !task.m_bCancelled;
+		}
+		return false;
+	}
+
+	// from inside a task (itself included) the task is only marked and gets destroyed by Run once it's suspended
+	bool Cancel(uint32_t id)
+	{
+		for (uint32_t i = 0; i < m_aTasks.size(); i++)
+		{
+			auto& task = m_aTasks[i];
+			if (task.m_nId != id || task.m_bCancelled) continue;
+
+			task.m_bCancelled = true;
+			if (!m_bInRun)
+			{
+				task.m_Handle.destroy();
+				m_aTasks.erase(m_aTasks.begin() + i);
+				if (m_nCursor > i) m_nCursor--;
+			}
+			return true;
+		}
+		return false;
+	}
+
+	// destroys every task without running them any further
+	// from inside a task they're only marked, the same as Cancel, Run destroys them once the running one is suspended
+	void Clear()
+	{
+		if (m_bInRun)
+		{
+			for (auto& task : m_aTasks)
+			{
+				task.m_bCancelled = true;
+			}
+			return;
+		}
+
+		for (auto& task : m_aTasks)
+		{
+			task.m_Handle.destroy();
+		}
+		m_aTasks.clear();
+		m_nCursor = 0;
+	}
+
+	// once per frame, resumes ready tasks round robin until the budget is used up, returns how many were resumed
+	// at least one task gets resumed per call so a budget that's too small can't stall everything
+	uint32_t Run()
+	{
+		m_nFrame++;
+		m_nBudgetEnd = m_nBudgetMicroseconds ? m_pGetMicroseconds() + m_nBudgetMicroseconds : 0;
+
+		uint32_t resumed = 0;
+		uint32_t count = (uint32_t)m_aTasks.size();
+		uint32_t index = m_nCursor < count ? m_nCursor : 0;
+		uint32_t remaining = count;
+		// tasks started from inside a task are appended after the first count and wait for the next Run
+		m_bInRun = true;
+		while (remaining && !(resumed && IsBudgetExhausted()))
+		{
+			remaining--;
+			CTask::tHandle handle = m_aTasks[index].m_Handle;
+			if (!m_aTasks[index].m_bCancelled)
+			{
+				if (!IsReady(handle.promise()))
+				{
+					index = index + 1 < count ? index + 1 : 0;
+					continue;
+				}
+				handle.resume();
+				resumed++;
+			}
+
+			// nothing gets erased while a task runs, index is still this task even if Start grew the list
+			if (handle.done() || m_aTasks[index].m_bCancelled)
+			{
+				handle.destroy();
+				m_aTasks.erase(m_aTasks.begin() + index);
+				count--;
+				if (index >= count) index = 0;
+				continue;
+			}
+			index = index + 1 < count ? index + 1 : 0;
+		}
+		m_bInRun = false;
+
+		// cancelled from inside a task but not reached before the budget ran out
+		for (uint32_t i = 0; i < m_aTasks.size();)
+		{
+			if (!m_aTasks[i].m_bCancelled)
+			{
+				i++;
+				continue;
+			}
+			m_aTasks[i].m_Handle.destroy();
+			m_aTasks.erase(m_aTasks.begin() + i);
+			if (index > i) index--;
+		}
+		m_nCursor = index;
+		m_nBudgetEnd = 0;
+		return resumed;
+	}
+};
+
+// co_await nextFrame(), resumes on the next Run
+inline auto nextFrame()
+{
+	struct tAwaiter
+	{
+		bool await_ready() { return false; }
+		void await_suspend(CTask::tHandle handle)
+		{
+			auto& promise = handle.promise();
+			promise.m_nWakeFrame = promise.m_pScheduler->GetFrame() + 1;
+			promise.m_nWakeTime = promise.m_pScheduler->GetTime();
+		}
+		void await_resume() {}
+	};
+	return tAwaiter();
+}
+
+// co_await millis(n), resumes on the first Run at least n milliseconds of scheduler time later, and never in the same Run
+inline auto millis(uint32_t n)
+{
+	struct tAwaiter
+	{
+		uint32_t m_nTime;
+		bool await_ready() { return false; }
+		void await_suspend(CTask::tHandle handle)
+		{
+			auto& promise = handle.promise();
+			promise.m_nWakeFrame = promise.m_pScheduler->GetFrame() + 1;
+			promise.m_nWakeTime = promise.m_pScheduler->GetTime() + m_nTime;
+		}
+		void await_resume() {}
+	};
+	return tAwaiter{ n };
+}
+
+// co_await budgetExhausted(), carries on straight away while there's budget left, otherwise waits for the next Run
+inline auto budgetExhausted()
+{
+	struct tAwaiter
+	{
+		bool await_ready() { return false; }
+		bool await_suspend(CTask::tHandle handle)
+		{
+			auto& promise = handle.promise();
+			if (!promise.m_pScheduler->IsBudgetExhausted()) return false;
+			promise.m_nWakeFrame = promise.m_pScheduler->GetFrame() + 1;
+			promise.m_nWakeTime = promise.m_pScheduler->GetTime();
+			return true;
+		}
+		void await_resume() {}
+	};
+	return tAwaiter();
+}
+#endif
@@ -4,6 +4,6 @@ public:
 	//CTaskSimpleNMHighFall::CTaskSimpleNMHighFall(v33, 1000, 10000, 0, 0)
 	CTaskSimpleNMHighFall(uint32_t nUnk, uint32_t nUnk2, uint32_t nUnk3, uint32_t nUnk4)
 	{
-		((void(__thiscall*)(CTaskSimpleNMHighFall*, uint32_t, uint32_t, uint32_t, uint32_t))(AddressSetter::Get(0x8616F0, 0x7DCC10)))(this, nUnk, nUnk2, nUnk3, nUnk4);
+		((void(__thiscall*)(CTaskSimpleNMHighFall*, uint32_t, uint32_t, uint32_t, uint32_t))(AddressSetter::Get<0x8616F0, 0x7DCC10>()))(this, nUnk, nUnk2, nUnk3, nUnk4);
 	}
 };
\ No newline at end of file
@@ -3,6 +3,6 @@ class CTaskSimpleNMJumpRollFromRoadVehicle : public CTaskSimple
 public:
 	CTaskSimpleNMJumpRollFromRoadVehicle(uint32_t time, uint32_t time2)
 	{
-		((void(__thiscall*)(CTaskSimpleNMJumpRollFromRoadVehicle*, uint32_t, uint32_t))(AddressSetter::Get(0x85CCB0, 0x7D81B0)))(this, time, time2);
+		((void(__thiscall*)(CTaskSimpleNMJumpRollFromRoadVehicle*, uint32_t, uint32_t))(AddressSetter::Get<0x85CCB0, 0x7D81B0>()))(this, time, time2);
 	}
 };
\ No newline at end of file
@@ -16,7 +16,7 @@ public:
 	{
 		__try
 		{
-			uint32_t funcPtr = AddressSetter::Get(0x1A76D0, 0x226AF0);
+			uint32_t funcPtr = AddressSetter::Get<0x1A76D0, 0x226AF0>();
 			uint32_t nativePtr;
 			_asm
 			{
@@ -36,26 +36,26 @@ public:
 	}
 	static bool IsPlayerOnAMission()
 	{
-		return ((bool(__cdecl*)())(AddressSetter::Get(0x403E00, 0x4AE3E0)))();
+		return ((bool(__cdecl*)())(AddressSetter::Get<0x403E00, 0x4AE3E0>()))();
 	}
 	static void GivePedScriptedTask(int handle, CTask* task, int unk)
 	{
-		((void(__cdecl*)(int, CTask*, int))(AddressSetter::Get(0x4067A0, 0x4B0DF0)))(handle, task, unk);
+		((void(__cdecl*)(int, CTask*, int))(AddressSetter::Get<0x4067A0, 0x4B0DF0>()))(handle, task, unk);
 	}
 	static void AddToBuildingSwapArray(CBuilding* pBildng, int32_t OldModIndx, int32_t NewModIndx)
 	{
-		((void(__cdecl*)(CBuilding*, int32_t, int32_t))(AddressSetter::Get(0x404490, 0x4AEA70)))(pBildng, OldModIndx, NewModIndx);
+		((void(__cdecl*)(CBuilding*, int32_t, int32_t))(AddressSetter::Get<0x404490, 0x4AEA70>()))(pBildng, OldModIndx, NewModIndx);
 	}
 	static void UndoBuildingSwaps()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x4045D0, 0x4AEBB0)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x4045D0, 0x4AEBB0>()))();
 	}
 	static void Save()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x406530, 0x4B0B80)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x406530, 0x4B0B80>()))();
 	}
 	static void Load()
 	{
-		return ((void(__cdecl*)())(AddressSetter::Get(0x409AF0, 0x4B40F0)))();
+		return ((void(__cdecl*)())(AddressSetter::Get<0x409AF0, 0x4B40F0>()))();
 	}
 };
\ No newline at end of file
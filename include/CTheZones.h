@@ -30,10 +30,10 @@ public:
 
 	static bool Save()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x48BF30, 0x64AAB0)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x48BF30, 0x64AAB0>()))();
 	}
 	static bool Load()
 	{
-		return ((int(__cdecl*)())(AddressSetter::Get(0x48BF90, 0x64AB10)))();
+		return ((int(__cdecl*)())(AddressSetter::Get<0x48BF90, 0x64AB10>()))();
 	}
 };
\ No newline at end of file
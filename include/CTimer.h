@@ -15,6 +15,6 @@ public:
 
 	static bool GetIsPaused()
 	{
-		return ((uint32_t(__cdecl*)())(AddressSetter::Get(0x44370, 0xAD0B0)))();
+		return ((uint32_t(__cdecl*)())(AddressSetter::Get<0x44370, 0xAD0B0>()))();
 	}
 };
\ No newline at end of file
@@ -10,6 +10,6 @@ public:
 
 	static void ForceWeatherNow(int Type)
 	{
-		return ((void(__cdecl*)(int))(AddressSetter::Get(0x5E41D0, 0x5A0910)))(Type);
+		return ((void(__cdecl*)(int))(AddressSetter::Get<0x5E41D0, 0x5A0910>()))(Type);
 	}
 };
\ No newline at end of file
@@ -0,0 +1,112 @@
+// callback storage for the events in Hooks.h
+// callbacks are kept in one contiguous array sorted by priority, lower priorities run first and equal priorities run in the order they were added
+// every change copies the array, Run keeps its own reference to the array it started with so callbacks can add or remove callbacks (including themselves) mid-dispatch
+// dispatchers with a name get every callback timed when IVSDK_HOOK_PROFILER is defined, see HookProfiler.h
+template<typename... Args>
+class EventDispatcher
+{
+public:
+	typedef void(*Callback)(Args...);
+	typedef void(*ContextCallback)(void*, Args...);
+
+	struct tEntry
+	{
+		Callback m_pFunc;
+		ContextCallback m_pContextFunc;
+		void* m_pContext;
+		int32_t m_nPriority;
+		uint32_t m_nHandle;
+#ifdef IVSDK_HOOK_PROFILER
+		HookProfiler::tCallbackStats* m_pStats = nullptr;
+#endif
+	};
+
+private:
+	std::shared_ptr<const std::vector<tEntry>> m_pEntries = std::make_shared<const std::vector<tEntry>>();
+	uint32_t m_nNextHandle = 1;
+	const char* m_sName;
+
+	uint32_t Insert(Callback func, ContextCallback contextFunc, void* context, int32_t priority)
+	{
+		auto entries = std::make_shared<std::vector<tEntry>>(*m_pEntries);
+		auto it = std::upper_bound(entries->begin(), entries->end(), priority, [](int32_t p, const tEntry& e) { return p < e.m_nPriority; });
+		uint32_t handle = m_nNextHandle++;
+		it = entries->insert(it, { func, contextFunc, context, priority, handle });
+#ifdef IVSDK_HOOK_PROFILER
+		if (m_sName) it->m_pStats = HookProfiler::Register(m_sName, handle, func ? (const void*)func : (const void*)contextFunc, priority);
+#endif
+		m_pEntries = entries;
+		return handle;
+	}
+
+	static void Call(const tEntry& entry, Args... args)
+	{
+		if (entry.m_pContextFunc) entry.m_pContextFunc(entry.m_pContext, args...);
+		else entry.m_pFunc(args...);
+	}
+
+public:
+	// sName shows up in the hook profiler, it has to outlive the dispatcher
+	EventDispatcher(const char* sName = nullptr) : m_sName(sName) {}
+
+	const char* GetName() const { return m_sName; }
+
+	// returns a handle that can be passed to Remove, handles are never 0
+	uint32_t Add(Callback func, int32_t priority = 0)
+	{
+		return Insert(func, nullptr, nullptr, priority);
+	}
+
+	uint32_t Add(ContextCallback func, void* context, int32_t priority = 0)
+	{
+		return Insert(nullptr, func, context, priority);
+	}
+
+	bool Remove(uint32_t handle)
+	{
+		auto it = std::find_if(m_pEntries->begin(), m_pEntries->end(), [handle](const tEntry& e) { return e.m_nHandle == handle; });
+		if (it == m_pEntries->end()) return false;
+
+#ifdef IVSDK_HOOK_PROFILER
+		if (it->m_pStats) HookProfiler::Unregister(it->m_pStats);
+#endif
+		auto entries = std::make_shared<std::vector<tEntry>>(*m_pEntries);
+		entries->erase(entries->begin() + (it - m_pEntries->begin()));
+		m_pEntries = entries;
+		return true;
+	}
+
+	void Clear()
+	{
+#ifdef IVSDK_HOOK_PROFILER
+		for (auto& entry : *m_pEntries)
+		{
+			if (entry.m_pStats) HookProfiler::Unregister(entry.m_pStats);
+		}
+#endif
+		m_pEntries = std::make_shared<const std::vector<tEntry>>();
+	}
+
+	size_t Size() const
+	{
+		return m_pEntries->size();
+	}
+
+	void Run(Args... args)
+	{
+		auto entries = m_pEntries;
+		for (auto& entry : *entries)
+		{
+#ifdef IVSDK_HOOK_PROFILER
+			if (entry.m_pStats && HookProfiler::ms_bEnabled)
+			{
+				uint64_t start = HookProfiler::GetTicks();
+				Call(entry, args...);
+				HookProfiler::Record(*entry.m_pStats, start, HookProfiler::GetTicks());
+				continue;
+			}
+#endif
+			Call(entry, args...);
+		}
+	}
+};
\ No newline at end of file
@@ -0,0 +1,351 @@
+// opt-in frame tracer, define IVSDK_FRAME_TRACER before including IVSDK.cpp to enable it
+// the hooks record begin/end events into a ring per thread, pressing ms_nHotkey writes the last ms_nFlushFrames frames
+// as chrome trace event json, which ui.perfetto.dev and chrome://tracing both open
+// IVSDK_HOOK_PROFILER also records its callback timings here as spans, so the rings and the clock are there with either define
+// a thread's ring is allocated the first time that thread records something, after that recording is a few stores
+// only the owning thread writes to a ring, Snapshot can run on any thread and skips whatever got overwritten while it was reading
+// the hotkey only copies the rings on the game thread, the json is written on a thread of its own
+//
+//	void MyPlugin()
+//	{
+//		IVSDK_TRACE_SCOPE("MyPlugin", 0);
+//		...
+//	}
+#if defined(IVSDK_FRAME_TRACER) || defined(IVSDK_HOOK_PROFILER)
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+namespace FrameTracer
+{
+	enum
+	{
+		EventsPerThread = 32768,	// power of two
+		MaxThreads = 16,			// threads past this aren't traced
+		FrameHistory = 1024,		// power of two, the most frames a flush can go back
+	};
+
+	enum eEventType : uint8_t
+	{
+		EVENT_BEGIN,
+		EVENT_END,
+		EVENT_FRAME,				// instant event at the start of every frame, m_nArg is the frame number
+		EVENT_SPAN,					// begin and end in one, recorded at the end, m_nTime is the start and m_nArg the duration
+	};
+
+	struct tEvent
+	{
+		const char* m_sName;		// has to be a literal or otherwise outlive the trace
+		const char* m_sCategory;	// spans only, same lifetime as m_sName
+		uint64_t m_nTime;			// nanoseconds
+		uint32_t m_nArg;
+		eEventType m_nType;
+	};
+
+	struct tThreadBuffer
+	{
+		std::atomic<uint32_t> m_nHead{ 0 };
+		uint32_t m_nIndex;
+		std::atomic<const char*> m_sName{ nullptr };
+		tEvent m_aEvents[EventsPerThread];
+	};
+
+	inline bool ms_bEnabled = true;
+	inline int ms_nHotkey = 0x7A;			// VK_F11
+	inline uint32_t ms_nFlushFrames = 30;
+
+	inline tThreadBuffer* ms_aBuffers[MaxThreads] = {};
+	inline std::atomic<uint32_t> ms_nNumBuffers{ 0 };
+	inline std::mutex ms_BuffersMutex;
+
+	// written by the game thread in NextFrame
+	inline std::atomic<uint32_t> ms_nFrame{ 0 };
+	inline uint64_t ms_aFrameStarts[FrameHistory] = {};
+
+	inline uint64_t GetTime()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// nullptr once MaxThreads threads have recorded something
+	inline tThreadBuffer* GetThreadBuffer()
+	{
+		thread_local tThreadBuffer* pBuffer = nullptr;
+		thread_local bool bFull = false;
+		if (!pBuffer && !bFull)
+		{
+			std::lock_guard<std::mutex> lock(ms_BuffersMutex);
+			uint32_t index = ms_nNumBuffers.load(std::memory_order_relaxed);
+			if (index == MaxThreads)
+			{
+				bFull = true;
+				return nullptr;
+			}
+			pBuffer = new tThreadBuffer();
+			pBuffer->m_nIndex = index;
+			ms_aBuffers[index] = pBuffer;
+			ms_nNumBuffers.store(index + 1, std::memory_order_release);
+		}
+		return pBuffer;
+	}
+
+	inline void Record(const char* sName, eEventType type, uint32_t nArg = 0, uint64_t nTime = GetTime(), const char* sCategory = nullptr)
+	{
+		if (!ms_bEnabled) return;
+		tThreadBuffer* pBuffer = GetThreadBuffer();
+		if (!pBuffer) return;
+
+		uint32_t head = pBuffer->m_nHead.load(std::memory_order_relaxed);
+		tEvent& event = pBuffer->m_aEvents[head & (EventsPerThread - 1)];
+		event.m_sName = sName;
+		event.m_sCategory = sCategory;
+		event.m_nTime = nTime;
+		event.m_nArg = nArg;
+		event.m_nType = type;
+		pBuffer->m_nHead.store(head + 1, std::memory_order_release);
+	}
+
+	inline void Begin(const char* sName, uint32_t nArg = 0) { Record(sName, EVENT_BEGIN, nArg); }
+	inline void End(const char* sName) { Record(sName, EVENT_END); }
+
+	// something that was timed with GetTime already, durations past ~4 seconds are cut off
+	inline void RecordSpan(const char* sName, const char* sCategory, uint64_t start, uint64_t end)
+	{
+		uint64_t duration = end - start;
+		Record(sName, EVENT_SPAN, duration > UINT32_MAX ? UINT32_MAX : (uint32_t)duration, start, sCategory);
+	}
+
+	// shows up as the thread's name in the trace, sName has to outlive the trace
+	inline void SetThreadName(const char* sName)
+	{
+		if (tThreadBuffer* pBuffer = GetThreadBuffer()) pBuffer->m_sName = sName;
+	}
+
+	struct tScope
+	{
+		const char* m_sName;
+
+		tScope(const char* sName, uint32_t nArg = 0) : m_sName(sName) { Begin(sName, nArg); }
+		~tScope() { End(m_sName); }
+	};
+
+	// the game thread calls this at the start of every processScriptsEvent
+	inline void NextFrame()
+	{
+		uint32_t frame = ms_nFrame.load(std::memory_order_relaxed) + 1;
+		uint64_t time = GetTime();
+		ms_aFrameStarts[frame & (FrameHistory - 1)] = time;
+		ms_nFrame.store(frame, std::memory_order_release);
+		Record("frame", EVENT_FRAME, frame);
+
+		tThreadBuffer* pBuffer = GetThreadBuffer();
+		if (pBuffer && !pBuffer->m_sName) pBuffer->m_sName = "game";
+	}
+
+	inline uint32_t GetFrame() { return ms_nFrame.load(std::memory_order_acquire); }
+
+	// a copy of the rings to write out, taking one is the only part of a flush that has to wait for nothing else
+	struct tSnapshot
+	{
+		struct tThread
+		{
+			uint32_t m_nTid;
+			const char* m_sName;
+			std::vector<tEvent> m_aEvents;
+		};
+
+		std::vector<tThread> m_aThreads;
+	};
+
+	// every thread's events since the start of the frame numFrames ago, 0 frames takes everything that's still in the rings
+	inline tSnapshot Snapshot(uint32_t numFrames)
+	{
+		uint32_t frame = GetFrame();
+		if (numFrames > frame) numFrames = frame;
+		if (numFrames > FrameHistory - 1) numFrames = FrameHistory - 1;
+		uint64_t start = numFrames ? ms_aFrameStarts[(frame - numFrames + 1) & (FrameHistory - 1)] : 0;
+
+		tSnapshot snapshot;
+		std::vector<tEvent> events;
+		uint32_t numBuffers = ms_nNumBuffers.load(std::memory_order_acquire);
+		for (uint32_t b = 0; b < numBuffers; b++)
+		{
+			tThreadBuffer* pBuffer = ms_aBuffers[b];
+			snapshot.m_aThreads.push_back({ pBuffer->m_nIndex + 1, pBuffer->m_sName.load() });
+			auto& thread = snapshot.m_aThreads.back();
+
+			// copy first, anything the owner wrapped around to in the meantime is thrown away
+			uint32_t head = pBuffer->m_nHead.load(std::memory_order_acquire);
+			uint32_t first = head > EventsPerThread ? head - EventsPerThread : 0;
+			events.assign(head - first, tEvent());
+			uint32_t split = EventsPerThread - (first & (EventsPerThread - 1));
+			if (split > head - first) split = head - first;
+			memcpy(events.data(), &pBuffer->m_aEvents[first & (EventsPerThread - 1)], split * sizeof(tEvent));
+			memcpy(events.data() + split, &pBuffer->m_aEvents[0], (head - first - split) * sizeof(tEvent));
+			std::atomic_thread_fence(std::memory_order_acquire);
+			// the owner might be in the middle of writing event newHead, which lands on the slot of newHead - EventsPerThread
+			uint32_t newHead = pBuffer->m_nHead.load(std::memory_order_relaxed);
+			uint32_t valid = newHead >= EventsPerThread ? newHead - EventsPerThread + 1 : 0;
+
+			// an end whose begin got overwritten or is before the window is dropped, perfetto doesn't like unmatched ends
+			uint32_t depth = 0;
+			for (uint32_t i = first; i != head; i++)
+			{
+				if ((int32_t)(i - valid) < 0) continue;
+				const tEvent& event = events[i - first];
+				if (event.m_nTime < start) continue;
+
+				if (event.m_nType == EVENT_BEGIN) depth++;
+				else if (event.m_nType == EVENT_END)
+				{
+					if (depth == 0) continue;
+					depth--;
+				}
+				thread.m_aEvents.push_back(event);
+			}
+		}
+		return snapshot;
+	}
+
+	// names are written as they were passed in, so quotes, backslashes and control characters need escaping
+	inline void WriteJsonString(FILE* file, const char* sString)
+	{
+		fputc('"', file);
+		for (const char* c = sString ? sString : ""; *c; c++)
+		{
+			uint8_t ch = (uint8_t)*c;
+			if (ch == '"' || ch == '\\')
+			{
+				fputc('\\', file);
+				fputc(ch, file);
+			}
+			else if (ch < 0x20) fprintf(file, "\\u%04x", ch);
+			else fputc(ch, file);
+		}
+		fputc('"', file);
+	}
+
+	// chrome trace event json, returns false if the file couldn't be opened
+	inline bool Write(const tSnapshot& snapshot, const char* sPath)
+	{
+		FILE* file = fopen(sPath, "w");
+		if (!file) return false;
+
+		fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+		fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GTAIV\"}}");
+
+		for (auto& thread : snapshot.m_aThreads)
+		{
+			uint32_t tid = thread.m_nTid;
+			if (thread.m_sName)
+			{
+				fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", tid);
+				WriteJsonString(file, thread.m_sName);
+				fprintf(file, "}}");
+			}
+
+			for (auto& event : thread.m_aEvents)
+			{
+				double ts = event.m_nTime / 1000.0;
+				switch (event.m_nType)
+				{
+				case EVENT_BEGIN:
+					fprintf(file, ",\n{\"name\":");
+					WriteJsonString(file, event.m_sName);
+					fprintf(file, ",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"arg\":%u}}", ts, tid, event.m_nArg);
+					break;
+				case EVENT_END:
+					fprintf(file, ",\n{\"name\":");
+					WriteJsonString(file, event.m_sName);
+					fprintf(file, ",\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", ts, tid);
+					break;
+				case EVENT_FRAME:
+					fprintf(file, ",\n{\"name\":\"frame %u\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", event.m_nArg, ts, tid);
+					break;
+				case EVENT_SPAN:
+					fprintf(file, ",\n{\"name\":");
+					WriteJsonString(file, event.m_sName);
+					fprintf(file, ",\"cat\":");
+					WriteJsonString(file, event.m_sCategory);
+					fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}", ts, event.m_nArg / 1000.0, tid);
+					break;
+				}
+			}
+		}
+
+		fprintf(file, "\n]}\n");
+		fclose(file);
+		return true;
+	}
+
+	// snapshot and write on the calling thread, for when there's no frame to hold up anymore
+	inline bool Flush(const char* sPath, uint32_t numFrames)
+	{
+		return Write(Snapshot(numFrames), sPath);
+	}
+
+	inline std::thread ms_Writer;
+	inline std::atomic<bool> ms_bWriting{ false };
+
+	// takes the snapshot here and writes it on a thread of its own, so the game only waits for the copy
+	// one write at a time, returns false without doing anything while the last one is still going
+	inline bool FlushAsync(const char* sPath, uint32_t numFrames)
+	{
+		if (ms_bWriting.exchange(true, std::memory_order_acquire)) return false;
+		// the last writer already cleared ms_bWriting, it's done or about to return
+		if (ms_Writer.joinable()) ms_Writer.join();
+
+		auto snapshot = std::make_shared<tSnapshot>(Snapshot(numFrames));
+		ms_Writer = std::thread([snapshot, path = std::string(sPath)]()
+		{
+			Write(*snapshot, path.c_str());
+			ms_bWriting.store(false, std::memory_order_release);
+		});
+		return true;
+	}
+
+	// for Deinit, the same as CJobSystem::Shutdown: on process exit the writer is already gone and joining it doesn't wait,
+	// on FreeLibrary it can't finish exiting under the loader lock so this waits for the write and lets the thread go
+	inline void WaitForFlush(bool bJoin = true)
+	{
+		if (!ms_Writer.joinable()) return;
+		if (bJoin)
+		{
+			ms_Writer.join();
+			return;
+		}
+		while (ms_bWriting.load(std::memory_order_acquire)) std::this_thread::yield();
+		ms_Writer.detach();
+	}
+
+#if defined(IVSDK_FRAME_TRACER) && defined(_WIN32)
+	// checked at the start of every processScriptsEvent before the new frame begins, writes IVSDKFrameTrace_<frame>.json next to the game
+	inline void PollHotkey()
+	{
+		static bool bWasDown = false;
+		bool bDown = (GetAsyncKeyState(ms_nHotkey) & 0x8000) != 0;
+		if (bDown && !bWasDown)
+		{
+			char path[64];
+			snprintf(path, sizeof(path), "IVSDKFrameTrace_%u.json", GetFrame());
+			FlushAsync(path, ms_nFlushFrames);
+		}
+		bWasDown = bDown;
+	}
+#endif
+}
+
+#endif
+
+// one per scope, it's always the same variable name
+#ifdef IVSDK_FRAME_TRACER
+#define IVSDK_TRACE_SCOPE(name, arg) FrameTracer::tScope _traceScope(name, arg)
+#else
+#define IVSDK_TRACE_SCOPE(name, arg)
+#endif
@@ -0,0 +1,257 @@
+// opt-in timing of every callback registered to the events in Hooks.h, define IVSDK_HOOK_PROFILER before including IVSDK.cpp to enable it
+// each callback gets a rolling histogram of its last WindowCalls to 2 * WindowCalls calls for p50/p99/max, plus all time totals
+// every call is also recorded as a span in FrameTracer's ring for the calling thread, on the same steady_clock nanoseconds,
+// so FrameTracer::Flush puts the callbacks on the same timeline as the frame tracer's hook scopes
+// an event is only ever dispatched from one thread so the stats have a single writer, the atomics are there so they can be read while the game runs
+#ifdef IVSDK_HOOK_PROFILER
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+namespace HookProfiler
+{
+	enum
+	{
+		NumBuckets = 128,		// 4 per power of 2 of ticks, from 8 up
+		WindowCalls = 512,		// calls per histogram generation
+	};
+
+	inline bool ms_bEnabled = true;
+
+	struct tCallbackStats
+	{
+		const char* m_sEvent;
+		char m_sName[96];					// module+offset of the callback, resolve it against the plugin's map file
+		uint32_t m_nHandle;
+		int32_t m_nPriority;
+		std::atomic<bool> m_bRemoved{ false };
+
+		std::atomic<uint64_t> m_nCalls{ 0 };
+		std::atomic<uint64_t> m_nTotalTicks{ 0 };
+		std::atomic<uint32_t> m_nMaxTicks{ 0 };
+		std::atomic<uint32_t> m_nLastTicks{ 0 };
+
+		// the writer fills m_aBuckets[m_nGeneration] and clears the other one when it switches over, percentiles read both
+		std::atomic<uint32_t> m_nGeneration{ 0 };
+		std::atomic<uint32_t> m_nWindowCalls{ 0 };
+		std::atomic<uint32_t> m_aWindowMax[2] = {};
+		std::atomic<uint32_t> m_aBuckets[2][NumBuckets] = {};
+	};
+
+	inline std::mutex ms_StatsMutex;
+	inline std::vector<std::unique_ptr<tCallbackStats>> ms_aStats;	// never freed, the trace and the report still point at removed callbacks
+
+	// ticks are FrameTracer's nanoseconds
+	inline uint64_t GetTicks()
+	{
+		return FrameTracer::GetTime();
+	}
+
+	inline double GetMicrosecondsPerTick()
+	{
+		return 0.001;
+	}
+
+	inline uint32_t GetBucket(uint32_t ticks)
+	{
+		if (ticks < 8) return ticks;
+		unsigned long octave;
+		_BitScanReverse(&octave, ticks);
+		return (octave - 1) * 4 + ((ticks >> (octave - 2)) & 3);
+	}
+
+	// upper bound of a bucket in ticks
+	inline uint32_t GetBucketLimit(uint32_t bucket)
+	{
+		if (bucket < 8) return bucket;
+		uint32_t octave = bucket / 4 + 1;
+		return ((5 + (bucket & 3)) << (octave - 2)) - 1;
+	}
+
+	// called by EventDispatcher::Add for dispatchers with a name
+	inline tCallbackStats* Register(const char* sEvent, uint32_t handle, const void* pFunc, int32_t priority)
+	{
+		auto stats = new tCallbackStats();
+		stats->m_sEvent = sEvent;
+		stats->m_nHandle = handle;
+		stats->m_nPriority = priority;
+
+		HMODULE module = NULL;
+		char path[MAX_PATH] = "";
+		if (GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCTSTR)pFunc, &module))
+		{
+			GetModuleFileNameA(module, path, sizeof(path));
+		}
+		const char* file = strrchr(path, '\\');
+		file = file ? file + 1 : path;
+		snprintf(stats->m_sName, sizeof(stats->m_sName), "%.80s+0x%X", file, (uint32_t)((uintptr_t)pFunc - (uintptr_t)module));
+
+		std::lock_guard<std::mutex> lock(ms_StatsMutex);
+		ms_aStats.emplace_back(stats);
+		return stats;
+	}
+
+	// called by EventDispatcher::Remove/Clear, the stats stay around and are marked as removed
+	inline void Unregister(tCallbackStats* stats)
+	{
+		stats->m_bRemoved.store(true, std::memory_order_relaxed);
+	}
+
+	inline void Record(tCallbackStats& stats, uint64_t start, uint64_t end)
+	{
+		uint64_t duration = end - start;
+		uint32_t ticks = duration > UINT32_MAX ? UINT32_MAX : (uint32_t)duration;
+
+		stats.m_nCalls.store(stats.m_nCalls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		stats.m_nTotalTicks.store(stats.m_nTotalTicks.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+		stats.m_nLastTicks.store(ticks, std::memory_order_relaxed);
+		if (ticks > stats.m_nMaxTicks.load(std::memory_order_relaxed)) stats.m_nMaxTicks.store(ticks, std::memory_order_relaxed);
+
+		uint32_t gen = stats.m_nGeneration.load(std::memory_order_relaxed);
+		auto& bucket = stats.m_aBuckets[gen][GetBucket(ticks)];
+		bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		if (ticks > stats.m_aWindowMax[gen].load(std::memory_order_relaxed)) stats.m_aWindowMax[gen].store(ticks, std::memory_order_relaxed);
+
+		uint32_t windowCalls = stats.m_nWindowCalls.load(std::memory_order_relaxed) + 1;
+		if (windowCalls >= WindowCalls)
+		{
+			gen ^= 1;
+			for (auto& b : stats.m_aBuckets[gen])
+			{
+				b.store(0, std::memory_order_relaxed);
+			}
+			stats.m_aWindowMax[gen].store(0, std::memory_order_relaxed);
+			stats.m_nGeneration.store(gen, std::memory_order_relaxed);
+			windowCalls = 0;
+		}
+		stats.m_nWindowCalls.store(windowCalls, std::memory_order_relaxed);
+
+		FrameTracer::RecordSpan(stats.m_sName, stats.m_sEvent, start, end);
+	}
+
+	struct tCallbackTiming
+	{
+		const char* m_sEvent;
+		const char* m_sName;
+		uint32_t m_nHandle;
+		int32_t m_nPriority;
+		bool m_bRemoved;
+		uint64_t m_nCalls;
+		double m_fAverage;					// all times in microseconds, average and max are all time
+		double m_fMax;
+		double m_fLast;
+		double m_fP50;						// the rest are over the rolling window
+		double m_fP99;
+		double m_fWindowMax;
+	};
+
+	// upper bound of the bucket the percentile falls into, capped by the window max
+	inline uint32_t GetPercentileTicks(const uint32_t* buckets, uint32_t count, uint32_t maxTicks, float percentile)
+	{
+		uint32_t target = (uint32_t)(count * percentile);
+		uint32_t seen = 0;
+		for (uint32_t i = 0; i < NumBuckets; i++)
+		{
+			seen += buckets[i];
+			if (seen > target)
+			{
+				uint32_t limit = GetBucketLimit(i);
+				return limit < maxTicks ? limit : maxTicks;
+			}
+		}
+		return maxTicks;
+	}
+
+	// every callback that was ever registered, removed ones included, slowest p99 first
+	// sEvent picks one event, e.g. "processScriptsEvent", nullptr returns all of them
+	inline std::vector<tCallbackTiming> GetTimings(const char* sEvent = nullptr)
+	{
+		double toMicroseconds = GetMicrosecondsPerTick();
+		std::vector<tCallbackTiming> timings;
+
+		std::lock_guard<std::mutex> lock(ms_StatsMutex);
+		for (auto& s : ms_aStats)
+		{
+			if (sEvent && strcmp(sEvent, s->m_sEvent) != 0) continue;
+
+			uint32_t buckets[NumBuckets];
+			uint32_t count = 0;
+			for (uint32_t i = 0; i < NumBuckets; i++)
+			{
+				buckets[i] = s->m_aBuckets[0][i].load(std::memory_order_relaxed) + s->m_aBuckets[1][i].load(std::memory_order_relaxed);
+				count += buckets[i];
+			}
+			uint32_t max0 = s->m_aWindowMax[0].load(std::memory_order_relaxed), max1 = s->m_aWindowMax[1].load(std::memory_order_relaxed);
+			uint32_t windowMax = max0 > max1 ? max0 : max1;
+
+			tCallbackTiming timing;
+			timing.m_sEvent = s->m_sEvent;
+			timing.m_sName = s->m_sName;
+			timing.m_nHandle = s->m_nHandle;
+			timing.m_nPriority = s->m_nPriority;
+			timing.m_bRemoved = s->m_bRemoved.load(std::memory_order_relaxed);
+			timing.m_nCalls = s->m_nCalls.load(std::memory_order_relaxed);
+			timing.m_fAverage = timing.m_nCalls ? s->m_nTotalTicks.load(std::memory_order_relaxed) * toMicroseconds / timing.m_nCalls : 0.0;
+			timing.m_fMax = s->m_nMaxTicks.load(std::memory_order_relaxed) * toMicroseconds;
+			timing.m_fLast = s->m_nLastTicks.load(std::memory_order_relaxed) * toMicroseconds;
+			timing.m_fP50 = GetPercentileTicks(buckets, count, windowMax, 0.5f) * toMicroseconds;
+			timing.m_fP99 = GetPercentileTicks(buckets, count, windowMax, 0.99f) * toMicroseconds;
+			timing.m_fWindowMax = windowMax * toMicroseconds;
+			timings.push_back(timing);
+		}
+
+		std::sort(timings.begin(), timings.end(), [](const tCallbackTiming& a, const tCallbackTiming& b) { return a.m_fP99 > b.m_fP99; });
+		return timings;
+	}
+
+	// one line per callback for an on-screen overlay, the slowest first, returns the number of lines written
+	// e.g. "processScriptsEvent MyPlugin.asi+0x1A2B0  p50 12.4 p99 40.1 max 85.0 us"
+	inline uint32_t FormatOverlay(char* buffer, uint32_t size, uint32_t maxLines = 16, const char* sEvent = nullptr)
+	{
+		if (size == 0) return 0;
+		buffer[0] = '\0';
+
+		auto timings = GetTimings(sEvent);
+		uint32_t lines = 0;
+		uint32_t used = 0;
+		for (auto& t : timings)
+		{
+			if (lines == maxLines || t.m_bRemoved) continue;
+			int written = snprintf(buffer + used, size - used, "%s %s  p50 %.1f p99 %.1f max %.1f us\n", t.m_sEvent, t.m_sName, t.m_fP50, t.m_fP99, t.m_fWindowMax);
+			if (written < 0 || used + written >= size)
+			{
+				buffer[used] = '\0';
+				break;
+			}
+			used += written;
+			lines++;
+		}
+		return lines;
+	}
+
+	// clears the stats, callbacks stay registered and the spans already in FrameTracer's rings stay there
+	inline void Reset()
+	{
+		std::lock_guard<std::mutex> lock(ms_StatsMutex);
+		for (auto& s : ms_aStats)
+		{
+			s->m_nCalls = 0;
+			s->m_nTotalTicks = 0;
+			s->m_nMaxTicks = 0;
+			s->m_nLastTicks = 0;
+			s->m_nWindowCalls = 0;
+			for (uint32_t gen = 0; gen < 2; gen++)
+			{
+				s->m_aWindowMax[gen] = 0;
+				for (auto& b : s->m_aBuckets[gen])
+				{
+					b = 0;
+				}
+			}
+		}
+	}
+}
+#endif
@@ -1,20 +1,52 @@
+#ifdef __cpp_impl_coroutine
+// the scheduler's clocks, millis() follows the game's timer so it stops while paused, the budget is wall time
+uint32_t GetTaskSchedulerTime()
+{
+	return CTimer::m_snTimeInMilliseconds;
+}
+
+uint64_t GetTaskSchedulerMicroseconds()
+{
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (uint64_t)counter.QuadPart * 1000000 / frequency.QuadPart;
+}
+
+// resumed at the end of every processScriptsEvent, after the callbacks
+CTaskScheduler TaskScheduler(GetTaskSchedulerTime, GetTaskSchedulerMicroseconds);
+#endif
+
 namespace plugin
 {
 	namespace processScriptsEvent
 	{
 		uint8_t threadDummy[256];
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "processScriptsEvent" };
 
 		void Run()
 		{
+#ifdef IVSDK_FRAME_TRACER
+			FrameTracer::PollHotkey();
+			FrameTracer::NextFrame();
+#endif
+			IVSDK_TRACE_SCOPE("processScriptsEvent", 0);
+
 			auto bak = CTheScripts::m_pCurrentThread;
 			CTheScripts::m_pCurrentThread = (uint32_t)threadDummy;
 
-			for (auto& f : funcPtrs)
-			{
-				f();
-			}
+			GameThreadQueue.Drain();
+			if (PedPoolTracker.IsActive()) PedPoolTracker.Update(CPools::ms_pPedPool);
+			if (VehiclePoolTracker.IsActive()) VehiclePoolTracker.Update(CPools::ms_pVehiclePool);
+			if (EntityGrid.m_bEnabled) EntityGrid.Update();
+			RayCache.NextFrame();
+			RayBatch.Process();
+
+			callbacks.Run();
+#ifdef __cpp_impl_coroutine
+			TaskScheduler.Run();
+#endif
 
 			CTheScripts::m_pCurrentThread = bak;
 		}
@@ -29,23 +61,28 @@ namespace plugin
 			}
 		}
 		// CGame::Process
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
+		{
+			return callbacks.Remove(handle);
 		}
 	};
 
 	namespace gameLoadPriorityEvent
 	{
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "gameLoadPriorityEvent" };
 
 		void Run()
 		{
-			for (auto& f : funcPtrs)
-			{
-				f();
-			}
+			callbacks.Run();
 		}
 		void __declspec(naked) MainHook()
 		{
@@ -58,23 +95,30 @@ namespace plugin
 			}
 		}
 		// before the first LoadLevel call, use for files that need to overwrite base game files
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
+		{
+			return callbacks.Remove(handle);
 		}
 	};
 	
 	namespace gameLoadEvent
 	{
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "gameLoadEvent" };
 
 		void Run()
 		{
-			for (auto& f : funcPtrs)
-			{
-				f();
-			}
+			// after the callbacks so the models they register are in it from the start
+			callbacks.Run();
+			CModelInfo::BuildHashIndex();
 		}
 		void __declspec(naked) MainHook()
 		{
@@ -87,9 +131,17 @@ namespace plugin
 			}
 		}
 		// after the last LoadLevel call, use for addon files that don't interfere with game files
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
+		{
+			return callbacks.Remove(handle);
 		}
 	};
 	
@@ -97,17 +149,14 @@ namespace plugin
 	{
 		uint8_t threadDummy[256];
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "ingameStartupEvent" };
 
 		void Run()
 		{
 			auto bak = CTheScripts::m_pCurrentThread;
 			CTheScripts::m_pCurrentThread = (uint32_t)threadDummy;
 
-			for (auto& f : funcPtrs)
-			{
-				f();
-			}
+			callbacks.Run();
 
 			CTheScripts::m_pCurrentThread = bak;
 		}
@@ -123,23 +172,28 @@ namespace plugin
 		}
 		// runs right before loading a save, starting a new game, switching episodes, etc.
 		// use this to clean things up
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Remove(handle);
 		}
 	};
 	
 	namespace mountDeviceEvent
 	{
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "mountDeviceEvent" };
 
 		void Run()
 		{
-			for (auto& f : funcPtrs)
-			{
-				f();
-			}
+			callbacks.Run();
 		}
 		void __declspec(naked) MainHook()
 		{
@@ -152,23 +206,29 @@ namespace plugin
 			}
 		}
 		// before update:/ is mounted, use this for any rage::fiDevice stuff
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Remove(handle);
 		}
 	};
 	
 	namespace drawingEvent
 	{
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "drawingEvent" };
 
 		void Run()
 		{
-			for (auto& f : funcPtrs)
-			{
-				f();
-			}
+			IVSDK_TRACE_SCOPE("drawingEvent", 0);
+			callbacks.Run();
 		}
 		void __declspec(naked) MainHook()
 		{
@@ -181,26 +241,31 @@ namespace plugin
 			}
 		}
 		// CRenderPhasePostRenderViewport, also works in menu, runs twice per frame when in game
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
+		{
+			return callbacks.Remove(handle);
 		}
 	};
 
 	namespace processCameraEvent
 	{
 		uintptr_t returnAddress;
-		std::list<void(*)()> funcPtrs;
+		EventDispatcher<> callbacks{ "processCameraEvent" };
 
 		void Run()
 		{
+			IVSDK_TRACE_SCOPE("processCameraEvent", 0);
 			try
 			{
-				for (auto& f : funcPtrs)
-				{
-					f();
-				}
-
+				callbacks.Run();
 			}
 			catch (std::exception* e)
 			{
@@ -217,9 +282,17 @@ namespace plugin
 			}
 		}
 		// after CCamera::m_pFinalCam has been written to
-		void Add(void(*funcPtr)())
+		uint32_t Add(void(*funcPtr)(), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*), void* context, int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Remove(handle);
 		}
 	};
 
@@ -227,14 +300,12 @@ namespace plugin
 	{
 		CVehicle* thisParam;
 		uintptr_t callAddress;
-		std::list<void(*)(CVehicle*)> funcPtrs;
+		EventDispatcher<CVehicle*> callbacks{ "processAutomobileEvent" };
 
 		void Run()
 		{
-			for (auto& f : funcPtrs)
-			{
-				f(thisParam);
-			}
+			IVSDK_TRACE_SCOPE("processAutomobileEvent", (uint32_t)thisParam);
+			callbacks.Run(thisParam);
 		}
 		void __declspec(naked) MainHook()
 		{
@@ -249,9 +320,17 @@ namespace plugin
 			}
 		}
 		// after CAutomobile::Process, overriding steer & pedals works here
-		void Add(void(*funcPtr)(CVehicle*))
+		uint32_t Add(void(*funcPtr)(CVehicle*), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*, CVehicle*), void* context, int32_t priority = 0)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
+		{
+			return callbacks.Remove(handle);
 		}
 	}
 
@@ -259,14 +338,12 @@ namespace plugin
 	{
 		CPad* thisParam;
 		uintptr_t callAddress;
-		std::list<void(*)(CPad*)> funcPtrs;
+		EventDispatcher<CPad*> callbacks{ "processPadEvent" };
 
 		void Run()
 		{
-			for (auto& f : funcPtrs)
-			{
-				f(thisParam);
-			}
+			IVSDK_TRACE_SCOPE("processPadEvent", (uint32_t)thisParam);
+			callbacks.Run(thisParam);
 		}
 		void __declspec(naked) MainHook()
 		{
@@ -281,9 +358,17 @@ namespace plugin
 			}
 		}
 		// set all pad controls here, called once per frame for each pad
-		void Add(void(*funcPtr)(CPad*))
+		uint32_t Add(void(*funcPtr)(CPad*), int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, priority);
+		}
+		uint32_t Add(void(*funcPtr)(void*, CPad*), void* context, int32_t priority = 0)
+		{
+			return callbacks.Add(funcPtr, context, priority);
+		}
+		bool Remove(uint32_t handle)
 		{
-			funcPtrs.emplace_back(funcPtr);
+			return callbacks.Remove(handle);
 		}
 	}
 
@@ -291,7 +376,7 @@ namespace plugin
 	{
 		void GetTexture(CSprite2d(__stdcall* funcPtr)(char*))
 		{
-			injector::MakeJMP(AddressSetter::Get(0x21DA10, 0xD300), funcPtr);
+			injector::MakeJMP(AddressSetter::Get<0x21DA10, 0xD300>(), funcPtr);
 		}
 	}
 };
\ No newline at end of file
@@ -4,12 +4,25 @@
 #include <stdint.h>
 #include <string>
 #include <list>
+#include <vector>
+#include <memory>
+#include <algorithm>
 #include <d3dx9.h>
 #include "injector/injector.hpp"
 
 #include "Addresses.h"
 #include "IVSDK.h"
 #include "Scripting/Scripting.h"
+#include "FrameTracer.h"
+#include "HookProfiler.h"
+#include "EventDispatcher.h"
+#include "CPoolTracker.h"
+#include "CSpatialGrid.h"
+#include "CBoundedQueue.h"
+#include "CRayBatch.h"
+#include "CRayCache.h"
+#include "CCommandQueue.h"
+#include "CTaskScheduler.h"
 #include "Hooks.h"
 
 namespace plugin
@@ -61,16 +74,31 @@ namespace plugin
 			gameStartupEvent();
 		}
 	}
-	void Deinit()
+	// bProcessExit is DllMain's lpReserved != NULL, the process is exiting instead of the plugin being unloaded
+	void Deinit(bool bProcessExit)
 	{
 		gameShutdownEvent();
+
+		// on process exit every other thread is already gone and joining them doesn't wait on anything,
+		// on FreeLibrary the workers can't finish exiting while DllMain holds the loader lock
+		JobSystem.Shutdown(bProcessExit);
+
+#ifdef IVSDK_NATIVE_PROFILER
+		NativeProfiler::WriteReport("IVSDKNativeProfile.csv");
+#endif
+#if defined(IVSDK_FRAME_TRACER) || defined(IVSDK_HOOK_PROFILER)
+		FrameTracer::WaitForFlush(bProcessExit);
+#endif
+#ifdef IVSDK_HOOK_PROFILER
+		FrameTracer::Flush("IVSDKHookTrace.json", 0);
+#endif
 	}
 }
 
 BOOL APIENTRY DllMain(HMODULE module, DWORD ul_reason_for_call, LPVOID lpReserved)
 {
 	if (ul_reason_for_call == DLL_PROCESS_ATTACH) plugin::Init();
-	if (ul_reason_for_call == DLL_PROCESS_DETACH) plugin::Deinit();
+	if (ul_reason_for_call == DLL_PROCESS_DETACH) plugin::Deinit(lpReserved != NULL);
 	return TRUE;
 }
 
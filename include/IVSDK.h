@@ -15,6 +15,7 @@ namespace plugin
 	void gameShutdownEvent();
 }
 
+#include "AddressScanner.h"
 #include "NewAddressSet.h"
 #include "CRGBA.h"
 #include "rage.h"
@@ -23,6 +24,8 @@ namespace plugin
 #include "CVector2D.h"
 #include "CQuaternion.h"
 #include "CMatrix.h"
+#include "CMatrixBatch.h"
+#include "CSimdVector.h"
 #include "CPlayerInfo.h"
 #include "CWorld.h"
 #include "CPad.h"
@@ -36,6 +39,8 @@ namespace plugin
 #include "CObject.h"
 #include "CPool.h"
 #include "CPools.h"
+#include "CJobSystem.h"
+#include "CPoolSnapshot.h"
 #include "CTask.h"
 #include "CTaskComplexWander.h"
 #include "CTaskComplexDie.h"
@@ -80,7 +85,9 @@ namespace plugin
 #include "grcTexture.h"
 #include "grcTextureFactory.h"
 #include "CSprite2d.h"
+#include "CViewport.h"
 #include "CDraw.h"
+#include "CScreenProjector.h"
 #include "pgDictionary.h"
 #include "CTxdStore.h"
 #include "CFileMgr.h"
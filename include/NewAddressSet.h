@@ -3,6 +3,25 @@ namespace AddressSetter
 	uint32_t gBaseAddress;
 	bool bAddressesRead = false;
 
+	// every Get<addr1070, addr1080>() pair used in the sdk gets a slot here, resolved once in Init
+	// plugin::Init calls Init from DllMain, so the table is filled in before any hook or script runs
+	const uint32_t MAX_REGISTERED_ADDRESSES = 2048;
+
+	struct tAddressPair
+	{
+		uint32_t addr1070;
+		uint32_t addr1080;
+	};
+
+	tAddressPair gAddressPairs[MAX_REGISTERED_ADDRESSES];
+	uint32_t gResolvedAddresses[MAX_REGISTERED_ADDRESSES];
+	// index 0 is never handed out and stays 0, a pair that didn't get a slot reads it through Get<>
+	uint32_t gNumRegisteredAddresses = 1;
+
+	// resolved version and signature scan results, keyed on a hash of the exe headers
+	const char* ADDRESS_CACHE_FILE = "IVSDKAddressCache.bin";
+	AddressScanner::tCache gAddressCache;
+
 	uint32_t GetVersionFromEXE()
 	{
 		TCHAR szFileName[MAX_PATH];
@@ -14,7 +33,7 @@ namespace AddressSetter
 		LPBYTE lpBuffer = NULL;
 		DWORD  verSize = GetFileVersionInfoSize(szFileName, &verHandle);
 
-		if (verSize != NULL)
+		if (verSize != 0)
 		{
 			LPSTR verData = new char[verSize];
 
@@ -60,13 +79,66 @@ namespace AddressSetter
 		}
 	}
 
+	// the nt headers include the link timestamp, checksum and section layout, that's enough to tell builds apart
+	uint64_t GetImageHash()
+	{
+		auto dosHeader = (IMAGE_DOS_HEADER*)gBaseAddress;
+		auto ntHeaders = (IMAGE_NT_HEADERS*)(gBaseAddress + dosHeader->e_lfanew);
+		return AddressScanner::Hash(ntHeaders, sizeof(IMAGE_NT_HEADERS) + ntHeaders->FileHeader.NumberOfSections * sizeof(IMAGE_SECTION_HEADER));
+	}
+
+	uint32_t Resolve(uint32_t addr1070, uint32_t addr1080)
+	{
+		if (plugin::gameVer == plugin::VERSION_1070) return gBaseAddress + addr1070;
+		if (plugin::gameVer == plugin::VERSION_1080) return gBaseAddress + addr1080;
+		return 0;
+	}
+
 	void Init()
 	{
-		DetermineVersion();
-		gBaseAddress = (uint32_t)GetModuleHandle(NULL);
+		gBaseAddress = (uint32_t)(uintptr_t)GetModuleHandle(NULL);
+
+		// skip the version resource parse when this exe has been seen before
+		uint64_t imageHash = GetImageHash();
+		if (gAddressCache.Load(ADDRESS_CACHE_FILE, imageHash))
+		{
+			plugin::gameVer = (plugin::eGameVersion)gAddressCache.m_nGameVersion;
+		}
+		else
+		{
+			DetermineVersion();
+			gAddressCache.m_nImageHash = imageHash;
+			gAddressCache.m_nGameVersion = plugin::gameVer;
+			gAddressCache.m_aEntries.clear();
+			gAddressCache.Save(ADDRESS_CACHE_FILE);
+		}
 		bAddressesRead = true;
+
+		for (uint32_t i = 1; i < gNumRegisteredAddresses; i++)
+		{
+			gResolvedAddresses[i] = Resolve(gAddressPairs[i].addr1070, gAddressPairs[i].addr1080);
+		}
+	}
+
+	// called during static init for every address pair, pairs registered after Init get resolved straight away
+	// returns 0 once the table is full, Get<> then gives 0 for that pair
+	uint32_t Register(uint32_t addr1070, uint32_t addr1080)
+	{
+		assert(gNumRegisteredAddresses < MAX_REGISTERED_ADDRESSES && "raise MAX_REGISTERED_ADDRESSES");
+		if (gNumRegisteredAddresses >= MAX_REGISTERED_ADDRESSES) return 0;
+
+		uint32_t index = gNumRegisteredAddresses++;
+		gAddressPairs[index] = { addr1070, addr1080 };
+		gResolvedAddresses[index] = bAddressesRead ? Resolve(addr1070, addr1080) : 0;
+		return index;
 	}
 
+	template<uint32_t addr1070, uint32_t addr1080>
+	struct AddressEntry
+	{
+		static inline const uint32_t index = Register(addr1070, addr1080);
+	};
+
 	// note that the base address is added here and 0x400000 is not subtracted, so rebase your .idb to 0x0 or subtract it yourself
 	template<typename T> T& GetRef(uint32_t addr1070, uint32_t addr1080)
 	{
@@ -76,7 +148,7 @@ namespace AddressSetter
 		}
 		if (plugin::gameVer == plugin::VERSION_1070) return *reinterpret_cast<T*>(gBaseAddress + addr1070);
 		if (plugin::gameVer == plugin::VERSION_1080) return *reinterpret_cast<T*>(gBaseAddress + addr1080);
-		return *reinterpret_cast<T*>(nullptr);
+		return *static_cast<T*>(nullptr);
 	}
 
 	uint32_t Get(uint32_t addr1070, uint32_t addr1080)
@@ -85,8 +157,48 @@ namespace AddressSetter
 		{
 			Init();
 		}
-		if (plugin::gameVer == plugin::VERSION_1070) return gBaseAddress + addr1070;
-		if (plugin::gameVer == plugin::VERSION_1080) return gBaseAddress + addr1080;
+		return Resolve(addr1070, addr1080);
+	}
+
+	// same as above but reads from the table filled in Init, use this for anything called more than once
+	// it doesn't check for Init, so it's 0 before DllMain has run, use the non-template version in static initializers
+	template<uint32_t addr1070, uint32_t addr1080> uint32_t Get()
+	{
+		return gResolvedAddresses[AddressEntry<addr1070, addr1080>::index];
+	}
+
+	// scans the exe's code section for an IDA style pattern, works on any game version
+	// the result is cached so this only ever scans once per exe, returns 0 if nothing was found
+	uint32_t Scan(const char* sPattern, int32_t nOffset = 0)
+	{
+		if (!bAddressesRead)
+		{
+			Init();
+		}
+
+		uint64_t key = AddressScanner::GetPatternKey(sPattern, nOffset);
+		uint32_t offset;
+		if (gAddressCache.Find(key, offset)) return gBaseAddress + offset;
+
+		AddressScanner::tPattern pattern;
+		if (!AddressScanner::ParsePattern(sPattern, pattern)) return 0;
+
+		auto dosHeader = (IMAGE_DOS_HEADER*)gBaseAddress;
+		auto ntHeaders = (IMAGE_NT_HEADERS*)(gBaseAddress + dosHeader->e_lfanew);
+		auto section = IMAGE_FIRST_SECTION(ntHeaders);
+		for (int i = 0; i < ntHeaders->FileHeader.NumberOfSections; i++, section++)
+		{
+			if (!(section->Characteristics & IMAGE_SCN_CNT_CODE)) continue;
+
+			auto start = (const uint8_t*)(gBaseAddress + section->VirtualAddress);
+			if (auto match = AddressScanner::Find(start, section->Misc.VirtualSize, pattern))
+			{
+				offset = (uint32_t)(match - (const uint8_t*)gBaseAddress) + nOffset;
+				gAddressCache.Add(key, offset);
+				gAddressCache.Save(ADDRESS_CACHE_FILE);
+				return gBaseAddress + offset;
+			}
+		}
 		return 0;
 	}
 }
\ No newline at end of file
@@ -6179,7 +6179,7 @@ namespace Scripting
 	static b8 IS_MOBILE_PHONE_RADIO_ACTIVE() { return NativeInvoke::Invoke< b8>(NATIVE_IS_MOBILE_PHONE_RADIO_ACTIVE); }
 	static b8 DOES_WEB_PAGE_EXIST(const char* webaddress) { return NativeInvoke::Invoke< b8>(NATIVE_DOES_WEB_PAGE_EXIST, webaddress); }
 	static b8 GET_CLOSEST_CAR_NODE(float x, float y, float z, float* pResX, float* pResY, float* pResZ) { return NativeInvoke::Invoke< b8>(NATIVE_GET_CLOSEST_CAR_NODE, x, y, z, pResX, pResY, pResZ); }
-	static b8 GET_CLOSEST_NETWORK_RESTART_NODE(Vector3 v, Vector3* ret, float* heading) { return NativeInvoke::Invoke< b8>(NATIVE_GET_CLOSEST_NETWORK_RESTART_NODE, v, ret, heading); }
+	static b8 GET_CLOSEST_NETWORK_RESTART_NODE(Vector3 v, Vector3* ret, float* heading) { return NativeInvoke::Invoke< b8>(NATIVE_GET_CLOSEST_NETWORK_RESTART_NODE, v.x, v.y, v.z, ret, heading); }
 	static b8 GET_CLOSEST_CAR_NODE_FAVOUR_DIRECTION(int Unk802, float x, float y, float z, float* pX, float* pY, float* pZ, float* heading) { return NativeInvoke::Invoke< b8>(NATIVE_GET_CLOSEST_CAR_NODE_FAVOUR_DIRECTION, Unk802, x, y, z, pX, pY, pZ, heading); }
 	static b8 GET_CLOSEST_CAR_NODE_WITH_HEADING(float x, float y, float z, float* pResX, float* pResY, float* pResZ, float* pHeading) { return NativeInvoke::Invoke< b8>(NATIVE_GET_CLOSEST_CAR_NODE_WITH_HEADING, x, y, z, pResX, pResY, pResZ, pHeading); }
 	static b8 GET_CLOSEST_MAJOR_CAR_NODE(float x, float y, float z, float* pResX, float* pResY, float* pResZ) { return NativeInvoke::Invoke< b8>(NATIVE_GET_CLOSEST_MAJOR_CAR_NODE, x, y, z, pResX, pResY, pResZ); }
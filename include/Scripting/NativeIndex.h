@@ -0,0 +1,719 @@
+// generated by tools/gen_native_names.py from NativeHashes.h, don't edit by hand
+// perfect hash over every native hash, NativeInvoke keys its function pointer cache on the index
+#pragma once
+#include <stdint.h>
+
+namespace NativeNames
+{
+	enum
+	{
+		NumNatives = 2839,
+		NumBuckets = 1024,
+		SlotBits = 12,
+	};
+
+	// sorted
+	inline const uint32_t ms_aHashes[NumNatives] =
+	{
+		0x00031EC6, 0x000A1FCE, 0x00132487, 0x001954A2, 0x001B1E5A, 0x003A7647, 0x003B6B13, 0x00541084,
+		0x005868E2, 0x00710A49, 0x00746EDF, 0x008932D3, 0x008A2256, 0x009641EE, 0x00C87FB8, 0x00FA0E33,
+		0x00FD3647, 0x010C7044, 0x01181CA3, 0x011D360D, 0x013C1EB7, 0x01473ACB, 0x014F234F, 0x015F4F3E,
+		0x01651FBA, 0x016C1B04, 0x016C37CD, 0x01794A3C, 0x01795753, 0x01820DAA, 0x01866CB5, 0x018A0EE0,
+		0x018B2055, 0x018C4131, 0x019A0068, 0x01A05ADD, 0x01A75F0C, 0x01C21158, 0x01C51E90, 0x01E33E33,
+		0x01F35F5C, 0x01F8116C, 0x01FF6618, 0x020106D6, 0x02033258, 0x020E0318, 0x022B2DA9, 0x02326335,
+		0x024859B5, 0x02491769, 0x024C3A6C, 0x02534709, 0x025D2170, 0x0273134E, 0x02794E6B, 0x028227F7,
+		0x02A235D0, 0x02A57428, 0x02BE2D97, 0x02C069E5, 0x02D13D06, 0x02E93A3E, 0x02F65CB2, 0x030E0224,
+		0x03102FEE, 0x031D740F, 0x032F24CB, 0x032F729B, 0x033B52CA, 0x0348074B, 0x035261C6, 0x03622640,
+		0x0365042F, 0x03665B8D, 0x03893A3A, 0x038A7526, 0x03A01B12, 0x03A01F39, 0x03AC3097, 0x03B12ED0,
+		0x03B13377, 0x03B37165, 0x03BA036B, 0x03CA3302, 0x03D16145, 0x03D916E4, 0x03E90416, 0x03EE5F1C,
+		0x03F90052, 0x03FB6DED, 0x040A0537, 0x04161E66, 0x041D045B, 0x04261E4C, 0x0437222B, 0x043C3B0B,
+		0x04485574, 0x046A4720, 0x04783029, 0x047B0898, 0x047D3BD6, 0x04804149, 0x04962F82, 0x049D23F9,
+		0x04C65BEB, 0x04C85E23, 0x04CF0105, 0x04D623FF, 0x04D72200, 0x04E11812, 0x04F12617, 0x04F567FB,
+		0x04F72E4C, 0x04FE5C34, 0x04FF3F49, 0x051742D5, 0x051A131D, 0x05267B97, 0x052803D0, 0x052A30F7,
+		0x056314A9, 0x05745ACA, 0x05766DDE, 0x057A3AC7, 0x05801768, 0x0580462A, 0x05966824, 0x059901B9,
+		0x059E3BEB, 0x05AD758A, 0x05B2442A, 0x05C619D7, 0x05C87C26, 0x05CC3DA1, 0x05D51783, 0x05D70FE8,
+		0x05D800A4, 0x060669FE, 0x06136B6A, 0x061A75D3, 0x061D4B5F, 0x06285788, 0x062A507A, 0x062E0076,
+		0x06441EAF, 0x064621F1, 0x067640F3, 0x068774A4, 0x068F59E3, 0x069433A8, 0x06B30CBF, 0x06B735ED,
+		0x06B840F1, 0x06BE0DD3, 0x06C4113E, 0x06C71148, 0x06CD4EB4, 0x06D651A7, 0x06F271B2, 0x06F54963,
+		0x07025A4A, 0x07092DC4, 0x070B1C45, 0x071542EB, 0x071B6690, 0x07205796, 0x07244253, 0x072516B4,
+		0x073505E0, 0x07370330, 0x0744307B, 0x07533EC9, 0x0754000C, 0x076863C9, 0x076A7E4E, 0x076B4C7C,
+		0x076D157A, 0x077A0221, 0x077B17B5, 0x07827AE1, 0x07A0177D, 0x07B23203, 0x07BC4223, 0x07C76803,
+		0x07CC3F86, 0x07D97F81, 0x07E21C28, 0x07E7104E, 0x07ED1DBF, 0x07EE2A45, 0x07F35BFE, 0x07FD3C35,
+		0x08022967, 0x080B4F21, 0x080F3B37, 0x08181609, 0x081D549C, 0x08240FB7, 0x08274BA4, 0x084F7B9F,
+		0x085E559E, 0x0860560B, 0x086138DE, 0x086452E7, 0x087C5347, 0x0896249A, 0x089C57D7, 0x089E42C1,
+		0x08A015CF, 0x08A308F8, 0x08A453C9, 0x08AB2787, 0x08C6502C, 0x08D25912, 0x08D85CBB, 0x091D1480,
+		0x092829D0, 0x09766174, 0x098D5DA6, 0x0991172D, 0x09A34209, 0x09A558A5, 0x09B85174, 0x09C5648C,
+		0x09C95A65, 0x09DB00B9, 0x09DD61E1, 0x09DE74E5, 0x09E405DB, 0x09E878A4, 0x09FD24F3, 0x09FD7668,
+		0x0A0444B3, 0x0A0F19D1, 0x0A1B465C, 0x0A1D6E36, 0x0A2B76C2, 0x0A2C70AF, 0x0A3D60CE, 0x0A432423,
+		0x0A4608E9, 0x0A462B7A, 0x0A491CFF, 0x0A632BB4, 0x0A74017B, 0x0A76502F, 0x0A7D3AF9, 0x0A7E36E5,
+		0x0A940E03, 0x0A9D695E, 0x0A9F7BA1, 0x0AA202B0, 0x0AA73A12, 0x0AB9317B, 0x0ABE3FA8, 0x0AC92D36,
+		0x0AD54D75, 0x0AF378D5, 0x0B1562DF, 0x0B164EF2, 0x0B177D76, 0x0B2A2801, 0x0B464BE8, 0x0B5704E0,
+		0x0B651AFB, 0x0B6E6107, 0x0B774604, 0x0B823C8D, 0x0B8B3941, 0x0B9B5070, 0x0B9F0356, 0x0BAD1A62,
+		0x0BC86FA7, 0x0BCE3423, 0x0BED1DDE, 0x0C051FE2, 0x0C1C5B1B, 0x0C1C7919, 0x0C26452D, 0x0C2747B9,
+		0x0C2A7847, 0x0C2D2CC5, 0x0C47057F, 0x0C4B7DD3, 0x0C4F5021, 0x0C5A551B, 0x0C607EB8, 0x0C704586,
+		0x0C7B14D9, 0x0C7B7CF4, 0x0CA46B08, 0x0CA539D6, 0x0CA614E6, 0x0CA93513, 0x0CAA42D0, 0x0CC0186A,
+		0x0CCA5CFC, 0x0CD276B4, 0x0CE96445, 0x0CF76EE0, 0x0D192F80, 0x0D374615, 0x0D3A3160, 0x0D6C0836,
+		0x0D721EEA, 0x0D8407E9, 0x0D8A1BCF, 0x0D940AF4, 0x0D970483, 0x0DA146AA, 0x0DA61310, 0x0DBD5654,
+		0x0DBF663C, 0x0DD71BA9, 0x0DDC19F4, 0x0DDD70AE, 0x0DE30821, 0x0E1645CD, 0x0E2438E5, 0x0E390571,
+		0x0E3B49BF, 0x0E633C13, 0x0E635761, 0x0E717E98, 0x0E843CEA, 0x0EA118D0, 0x0EAA4429, 0x0EAD6CFB,
+		0x0EAF6A68, 0x0ECB2DEE, 0x0ED8621F, 0x0EE34390, 0x0EE87310, 0x0F002557, 0x0F0269B5, 0x0F0956CA,
+		0x0F0D2025, 0x0F132F7E, 0x0F13355A, 0x0F1B1AA1, 0x0F227D5A, 0x0F296C2E, 0x0F322A6C, 0x0F3402B8,
+		0x0F4A4FB2, 0x0F4B0239, 0x0F4C513E, 0x0F5D1937, 0x0F634F9D, 0x0F636C38, 0x0F731898, 0x0F7F3837,
+		0x0F9B3A1C, 0x0FB17679, 0x0FB44F54, 0x0FC40275, 0x0FCC0410, 0x0FDA7965, 0x0FEA6230, 0x0FF342B2,
+		0x0FFD1A92, 0x10237666, 0x102A0A6C, 0x103F14E4, 0x10436A86, 0x106811E4, 0x10776AAE, 0x10800FD6,
+		0x108B4A25, 0x10974B70, 0x10A1449C, 0x10A62603, 0x10A75905, 0x10A86CF4, 0x10C75BDA, 0x10CB1413,
+		0x10DF4CED, 0x10F64FBF, 0x10FB7B5F, 0x10FD2442, 0x10FE0FE9, 0x1105259C, 0x1106579B, 0x110957EF,
+		0x1114089D, 0x11162A93, 0x11292C09, 0x112E7FB1, 0x11612815, 0x116D009A, 0x116E5A1F, 0x118174EC,
+		0x118A67C9, 0x118D1AA3, 0x119A668D, 0x11B76EDF, 0x11E22D1B, 0x11E80442, 0x11EE28D5, 0x11F759DE,
+		0x12067E8D, 0x120962E7, 0x120B4F15, 0x120D3155, 0x124D4571, 0x126C0B99, 0x126F1175, 0x127669D3,
+		0x12850007, 0x12865550, 0x1293731D, 0x129A1569, 0x12A619E9, 0x12A86E89, 0x12AA6D71, 0x12AE0E27,
+		0x12B524B7, 0x12B9197E, 0x12C42F66, 0x12D64378, 0x12D67ADA, 0x12D71B44, 0x12ED0BC9, 0x12ED69A6,
+		0x12F20552, 0x13134CCD, 0x13135C95, 0x131A0C84, 0x13244634, 0x13267663, 0x133C257F, 0x135154B0,
+		0x137C35BA, 0x137E6800, 0x13B27FFE, 0x13C75E16, 0x13C91ACD, 0x13D44996, 0x13DE5C59, 0x13E4042D,
+		0x14007AC6, 0x14166075, 0x141B23A9, 0x141D24A6, 0x142A5E83, 0x142E7C40, 0x142F31EF, 0x14334EEE,
+		0x143358D3, 0x144F3CE5, 0x145B13C7, 0x145B50AF, 0x1461418C, 0x14790F9F, 0x14A67125, 0x14AB75AE,
+		0x14B06047, 0x14D242D9, 0x14DD5F87, 0x15012850, 0x150A6532, 0x150B0C33, 0x15101503, 0x15285933,
+		0x152F6314, 0x154932F0, 0x154E450E, 0x15585A65, 0x15652DC1, 0x156D5236, 0x156E12CA, 0x15734852,
+		0x159A4ED4, 0x15B07D4D, 0x15D668D0, 0x15F033A6, 0x15F11BAB, 0x16184716, 0x161B05A9, 0x163A1D77,
+		0x164B7363, 0x168B1717, 0x168B18ED, 0x16AF6DEB, 0x16CB4F86, 0x16D762E5, 0x16DD2D00, 0x16E14EA4,
+		0x17002E03, 0x170F0D58, 0x170F7E75, 0x172376FE, 0x17265607, 0x17572318, 0x176C2DB5, 0x176F4D4C,
+		0x17767D95, 0x178332FF, 0x1788346E, 0x17901684, 0x17920FA7, 0x179848E4, 0x17BC4531, 0x17BC668D,
+		0x17C37E6D, 0x17D72833, 0x17E2319C, 0x17F62193, 0x17FD0934, 0x18136217, 0x1817000B, 0x181F6B00,
+		0x18246AC8, 0x1849408D, 0x1866612D, 0x186D42A4, 0x18740B3D, 0x187B3202, 0x1880639C, 0x188E0FAC,
+		0x189A2BB1, 0x189E32C9, 0x18A22AE4, 0x18A302CD, 0x18BD071B, 0x18C67E6D, 0x18CA2D3A, 0x18D5264D,
+		0x18DB4CAF, 0x18EA4926, 0x18F01E80, 0x18F43649, 0x18F477E1, 0x1905109F, 0x191B7021, 0x191E2F12,
+		0x19211E9D, 0x192E5726, 0x19486759, 0x194F76D4, 0x1958471A, 0x19591255, 0x195C13BC, 0x195D582E,
+		0x19610E35, 0x19836A5B, 0x198B786F, 0x19976813, 0x19A64C5D, 0x19A73E70, 0x19C967B5, 0x19D006EB,
+		0x19D16ACE, 0x19D302AE, 0x19DB19D8, 0x19DD44F2, 0x1A013092, 0x1A02748F, 0x1A081F78, 0x1A0F56C5,
+		0x1A122D03, 0x1A1473B0, 0x1A1A6D83, 0x1A212500, 0x1A2D7640, 0x1A455E51, 0x1A4D0C60, 0x1A6203EA,
+		0x1A7B3125, 0x1A827B2C, 0x1A920C02, 0x1A936344, 0x1AA32729, 0x1AAF54BE, 0x1ABE6A4C, 0x1AD3394A,
+		0x1ADA0C3A, 0x1ADD68E8, 0x1AE118F4, 0x1AE44443, 0x1AEB793A, 0x1B067237, 0x1B0741BA, 0x1B086D33,
+		0x1B0963AF, 0x1B183AFE, 0x1B215A3B, 0x1B305900, 0x1B31390E, 0x1B5B4ED9, 0x1B637A1C, 0x1B64665B,
+		0x1B6716B8, 0x1B731C3F, 0x1B886584, 0x1B8B3973, 0x1B8E7EED, 0x1B8F031D, 0x1B915945, 0x1B9A44D4,
+		0x1B9E5D07, 0x1BA61E20, 0x1BA8350B, 0x1BB41B75, 0x1BC5050E, 0x1BC70617, 0x1BC772AC, 0x1BDA0DA5,
+		0x1BDA1F9A, 0x1BF55D6F, 0x1BF67441, 0x1C00658B, 0x1C132038, 0x1C144E4E, 0x1C2F57FB, 0x1C334022,
+		0x1C35407F, 0x1C4B1189, 0x1C4E7A79, 0x1C5552E9, 0x1C5B7C51, 0x1C623537, 0x1C7C4B89, 0x1C810358,
+		0x1C887939, 0x1C8B73B6, 0x1C9A376D, 0x1CA77E94, 0x1CB2670D, 0x1CB27FE1, 0x1CB80079, 0x1CF773D4,
+		0x1CFD32E5, 0x1D0B131A, 0x1D161BB8, 0x1D1B266B, 0x1D1B6750, 0x1D2F46AE, 0x1D334237, 0x1D3F681D,
+		0x1D6D767E, 0x1D801FC0, 0x1D8800E3, 0x1D8C324A, 0x1D9853EA, 0x1DBD7385, 0x1DC730B8, 0x1DD624A0,
+		0x1DD86C2A, 0x1DD926BA, 0x1DDA54EF, 0x1DDD0073, 0x1DE062FD, 0x1DE37A21, 0x1DEA65DE, 0x1DF623F9,
+		0x1DFF5B06, 0x1E0A7AD8, 0x1E106A88, 0x1E144C8B, 0x1E1B5C26, 0x1E203014, 0x1E2A5820, 0x1E2D5A7B,
+		0x1E352CEF, 0x1E5C50B5, 0x1E805412, 0x1E87298A, 0x1E880709, 0x1E901BB6, 0x1E951606, 0x1E9635A9,
+		0x1EA85697, 0x1EAD1D7D, 0x1EC10CE1, 0x1EE13E29, 0x1EE70376, 0x1EF36397, 0x1EFB0992, 0x1F157FD3,
+		0x1F1C77E1, 0x1F2928A6, 0x1F40505C, 0x1F6A54B6, 0x1F6B3FF0, 0x1F736F00, 0x1F760E1A, 0x1F881A88,
+		0x1F913BC7, 0x1FA41244, 0x1FBD3ACA, 0x1FC06A1B, 0x1FC90C7C, 0x1FC96A99, 0x1FCB5241, 0x1FDD4860,
+		0x1FE21CF0, 0x200A510B, 0x20266A86, 0x202F384E, 0x203A137B, 0x20421014, 0x20430265, 0x204A6AA4,
+		0x205622AC, 0x206420A6, 0x208B4A6A, 0x208C03C9, 0x208F671C, 0x20A04BEE, 0x20A53B7F, 0x20BB5507,
+		0x20BC708E, 0x20C76FD1, 0x20E74A9C, 0x20EC5B84, 0x20FD4F4E, 0x210A0879, 0x210A33B2, 0x210A4F1D,
+		0x2119007F, 0x211D390A, 0x212B4014, 0x213308DB, 0x214C5455, 0x21641887, 0x216804D3, 0x21804D1A,
+		0x2186777E, 0x219A3AF6, 0x21A3110A, 0x21B45EC1, 0x21B8337F, 0x21B85DA9, 0x21C44026, 0x21CC647F,
+		0x21DE7496, 0x21F43531, 0x22087F31, 0x2209116C, 0x2232704D, 0x22417905, 0x22434C20, 0x22442A7F,
+		0x22457083, 0x22463E22, 0x22545844, 0x226A7227, 0x22811897, 0x228F1801, 0x22AA010C, 0x22AA0984,
+		0x22AB641D, 0x22DD329E, 0x22E91F1F, 0x230A740F, 0x232642DE, 0x232800BD, 0x232A52FA, 0x232F1A85,
+		0x23B00129, 0x23B76F88, 0x23C15141, 0x23D60810, 0x23E140A9, 0x23F772E7, 0x24256EFB, 0x24367E48,
+		0x245F424F, 0x246D47CE, 0x24742BB9, 0x2485231E, 0x24885050, 0x24A40229, 0x24B42ED2, 0x24C45D0D,
+		0x24CC682B, 0x24D467CC, 0x24D70069, 0x24DE2039, 0x24DF32CC, 0x25071DF3, 0x250C2D39, 0x25136AC2,
+		0x25204F8B, 0x252138B3, 0x25270A4B, 0x25271044, 0x25442DF7, 0x255059BB, 0x25541DBE, 0x256472F1,
+		0x25714BE4, 0x25750E4F, 0x259E305F, 0x25AC586E, 0x25B87BCA, 0x25BB7D67, 0x25CA45EA, 0x26094A53,
+		0x261F18A3, 0x26274628, 0x26335EE7, 0x264009D3, 0x264C5448, 0x265544F9, 0x265E37E1, 0x265F6FF5,
+		0x266716AC, 0x2667609A, 0x266D0801, 0x266F327C, 0x26747EBE, 0x267D251F, 0x267D5146, 0x26810BE3,
+		0x268F1413, 0x26A1722C, 0x26AA20CF, 0x26BC1939, 0x26E27605, 0x26E66DF3, 0x2702274D, 0x2704460E,
+		0x27045521, 0x270C7AB3, 0x27211B1A, 0x272D15FD, 0x27323E51, 0x27356F3A, 0x273C2D35, 0x27607F64,
+		0x27636B69, 0x27650F37, 0x27722942, 0x278305AE, 0x278F2D0A, 0x27C740D0, 0x27D20F21, 0x27E421EA,
+		0x27F65637, 0x27F87222, 0x27FA32D4, 0x28045C47, 0x28251E62, 0x282D29FE, 0x282D2CAA, 0x282E4EFB,
+		0x283821D2, 0x2854024A, 0x285D1184, 0x287A49A5, 0x2880077C, 0x28897EBD, 0x288E50A3, 0x289D3888,
+		0x28A73BCA, 0x28D17798, 0x28EE78D8, 0x29103E08, 0x29216610, 0x292349C7, 0x29305D67, 0x294C35B0,
+		0x295A652A, 0x295C34B8, 0x295C4C52, 0x295D3A87, 0x2966710D, 0x296B09E8, 0x29827605, 0x298827FC,
+		0x29907BEF, 0x29926B20, 0x299C5EBC, 0x29A75D1F, 0x29AE70A8, 0x29B53DFF, 0x29BF0233, 0x29D37792,
+		0x29D46FF4, 0x29D64E72, 0x29D91F3D, 0x29F02CB1, 0x29FC3E19, 0x2A055AFA, 0x2A171915, 0x2A221E97,
+		0x2A28684C, 0x2A2959DA, 0x2A3A77FD, 0x2A3F654A, 0x2A491A70, 0x2A5262C0, 0x2A58578B, 0x2A611607,
+		0x2A7247EF, 0x2A7413EB, 0x2A7475D8, 0x2A783A43, 0x2A860E89, 0x2AAB340A, 0x2AB06643, 0x2AD2206E,
+		0x2AE87B02, 0x2AE979DC, 0x2AF07CC8, 0x2B0A05E0, 0x2B111E69, 0x2B1B0290, 0x2B2E39BB, 0x2B416A06,
+		0x2B446480, 0x2B4E2A8C, 0x2B5C06E6, 0x2B64229C, 0x2B670CD0, 0x2B7C5CFB, 0x2B856FAA, 0x2B8836A6,
+		0x2B8A0C6B, 0x2B9B35C3, 0x2BA92322, 0x2BB65467, 0x2BB9620F, 0x2BBA7BF0, 0x2BC44D7D, 0x2BC64736,
+		0x2BCD1ECA, 0x2BDF7B7E, 0x2BEE5F97, 0x2BF8368E, 0x2C18736E, 0x2C1B52CE, 0x2C297C5D, 0x2C37408C,
+		0x2C41421A, 0x2C591CCD, 0x2C6564F2, 0x2C6D65AD, 0x2C835642, 0x2C8A5404, 0x2C8C61BA, 0x2C9E0483,
+		0x2CA53AA1, 0x2CAD4E39, 0x2CB303F8, 0x2CB572B5, 0x2CBE4DAF, 0x2CC356D0, 0x2CC70E04, 0x2CCA0D6A,
+		0x2CD33526, 0x2CD52C5C, 0x2CD73270, 0x2CDF628C, 0x2CE231DC, 0x2CEA47E9, 0x2CEC22DA, 0x2CF72EB7,
+		0x2D040DA9, 0x2D1A5F8C, 0x2D1D17C9, 0x2D215414, 0x2D2B208A, 0x2D2F452D, 0x2D371601, 0x2D43113A,
+		0x2D432EAB, 0x2D5611D4, 0x2D7A725D, 0x2D7D5DD2, 0x2D9C3D5E, 0x2DAE50C0, 0x2DD35B3F, 0x2DDE3785,
+		0x2E096356, 0x2E115B4B, 0x2E12687B, 0x2E291239, 0x2E321155, 0x2E4662B3, 0x2E51318F, 0x2E5B068F,
+		0x2E5C36C0, 0x2E5E1600, 0x2E6F4C82, 0x2E746E53, 0x2E815A94, 0x2E831921, 0x2E921B0F, 0x2E9B1F77,
+		0x2E9E149D, 0x2EAA3C4A, 0x2EB751CC, 0x2ED90276, 0x2EE310C5, 0x2EF477FD, 0x2EF60AA6, 0x2EF80425,
+		0x2F0718CA, 0x2F1D6843, 0x2F206763, 0x2F2226E5, 0x2F2405D1, 0x2F2F51E9, 0x2F444F95, 0x2F4B2A8B,
+		0x2F542797, 0x2F58286C, 0x2F7508E7, 0x2F877E8A, 0x2F907FF2, 0x2F9751E2, 0x2F9B0583, 0x2FA55669,
+		0x2FA5601D, 0x2FAE4C6E, 0x2FB14E41, 0x2FC728BB, 0x2FC9782A, 0x2FD83FB5, 0x2FDF565D, 0x2FED14F5,
+		0x2FEE095B, 0x2FF90FF5, 0x2FFA0249, 0x2FFA6C89, 0x301545FD, 0x302E113D, 0x303C3059, 0x30481141,
+		0x30516A11, 0x307A4B8E, 0x308D1778, 0x308E3719, 0x30975326, 0x309860C4, 0x309C265B, 0x30A65021,
+		0x30B1316B, 0x30BA2716, 0x30BE3463, 0x30C54CD2, 0x30CD2F1F, 0x30D17655, 0x30D27EB1, 0x30D373DF,
+		0x30D427B4, 0x30F71BC6, 0x31017E6E, 0x31026CE0, 0x310E75C9, 0x31102E20, 0x311F4FE9, 0x31321D1A,
+		0x31492174, 0x314E106A, 0x314F6DD3, 0x315238D5, 0x3162071D, 0x318F65E6, 0x319E3A87, 0x31A219FA,
+		0x31A77970, 0x31B64D2B, 0x31CD5F18, 0x31D53B3D, 0x31DB4020, 0x31E25160, 0x31FC3392, 0x320E1E3B,
+		0x323806B1, 0x32422759, 0x32486214, 0x324D1594, 0x32501B1E, 0x32517AE2, 0x32563E09, 0x32593711,
+		0x325B1A34, 0x32653482, 0x326B576F, 0x326E2886, 0x32765F37, 0x32795678, 0x32A3647C, 0x32A81853,
+		0x32B4293B, 0x32C24491, 0x32C67003, 0x32C67124, 0x32C75195, 0x32D3165D, 0x32DA5E3A, 0x32E45138,
+		0x32E84B6A, 0x331F7E6F, 0x332F0E9A, 0x33500089, 0x33565078, 0x335D0F34, 0x335E3951, 0x335E603B,
+		0x337957AF, 0x33D756A0, 0x33E0601D, 0x33F4498E, 0x33F8250B, 0x34211CDA, 0x3432536A, 0x34460DD7,
+		0x34574B2A, 0x3458600C, 0x34686B92, 0x346B4FE7, 0x346D76E8, 0x347C4300, 0x347E05F3, 0x348D7AF5,
+		0x348F612D, 0x349D5C27, 0x34AC73D6, 0x34BD72D7, 0x34BF456A, 0x34C751A2, 0x34CB6291, 0x34CC1F23,
+		0x34F128F9, 0x34F9164D, 0x3514533B, 0x351F4C86, 0x35213375, 0x352865D2, 0x352921C4, 0x353317C7,
+		0x353F0568, 0x355F3FEB, 0x356876BF, 0x35694DDC, 0x356C2DDB, 0x358E21C5, 0x35A250C2, 0x35A97B73,
+		0x35CC3267, 0x35E37826, 0x35FA026D, 0x360751AE, 0x360E2977, 0x361A01AD, 0x36273536, 0x362B5D1B,
+		0x362B7D1B, 0x365054A7, 0x36511E0A, 0x36537CE1, 0x3659084A, 0x36600272, 0x36601178, 0x366B0444,
+		0x366B549F, 0x368274DA, 0x369A4540, 0x36A33C21, 0x36AD6480, 0x36B40989, 0x36D51DDF, 0x36D60616,
+		0x36DA42AF, 0x36DF37DB, 0x36F453FF, 0x36F70AF6, 0x36FC5CFB, 0x371467E0, 0x37282D4F, 0x372C0DF1,
+		0x372C7B2A, 0x373B213C, 0x375D6223, 0x375F145D, 0x376917AB, 0x3775138E, 0x378531F8, 0x37871A37,
+		0x37890B14, 0x379930F3, 0x379B0A8F, 0x37A86FBD, 0x37AC2A95, 0x37BF18AC, 0x37C85316, 0x37CD55AA,
+		0x37D022E0, 0x380C142A, 0x381C1F1C, 0x38293796, 0x382A19BE, 0x38330B4A, 0x384B3876, 0x384E3F3A,
+		0x384F104F, 0x38824BFE, 0x38861F3A, 0x388D6B44, 0x38905687, 0x38A10933, 0x38AD2830, 0x38BE5BF6,
+		0x38F61531, 0x391822A7, 0x391B5A76, 0x391E4575, 0x39200B83, 0x39264921, 0x39487FB9, 0x394C1E55,
+		0x394E733E, 0x39551B76, 0x39587D51, 0x396844BE, 0x3970702E, 0x3998154E, 0x399E1A43, 0x39C2663E,
+		0x39D87BD6, 0x39DC5AEB, 0x39DE515D, 0x39E600D0, 0x39E77F70, 0x39ED0C43, 0x39F62BFB, 0x39FD432B,
+		0x3A115D9D, 0x3A2246BB, 0x3A244927, 0x3A2A77F9, 0x3A323C67, 0x3A6B0308, 0x3A774777, 0x3A7B78C5,
+		0x3A820D46, 0x3A8531E8, 0x3A9A0869, 0x3AAD447A, 0x3AAF5BE5, 0x3AB06137, 0x3AC85DB1, 0x3AC90796,
+		0x3ACC1794, 0x3AE77439, 0x3AF307B1, 0x3B007E58, 0x3B0C6738, 0x3B2526E3, 0x3B2E3198, 0x3B4C2E2E,
+		0x3B4F1EBA, 0x3B5D0F27, 0x3B6E1D1E, 0x3B8F5E20, 0x3B977FD4, 0x3BB313CB, 0x3BB57426, 0x3BBE6DBE,
+		0x3BC827E6, 0x3BCA4ACA, 0x3BD729E9, 0x3BDA562E, 0x3BDB4496, 0x3BE7444A, 0x3BF06336, 0x3BF5404E,
+		0x3BF71D5F, 0x3BF93ED7, 0x3C116620, 0x3C156533, 0x3C293296, 0x3C295451, 0x3C2A3334, 0x3C3E5FA0,
+		0x3C64626F, 0x3C714F12, 0x3C756E54, 0x3C78449F, 0x3C7B6092, 0x3C7C3E89, 0x3C85109F, 0x3C997E4C,
+		0x3CA23254, 0x3CAA1340, 0x3CB4693B, 0x3CC5682F, 0x3CCB4248, 0x3CCC5AFD, 0x3CD60F11, 0x3CD830D0,
+		0x3CDA1A07, 0x3CE05E7C, 0x3CEB6C7B, 0x3CEE0376, 0x3CF41D47, 0x3D003090, 0x3D0432F2, 0x3D0A71A2,
+		0x3D0B5E56, 0x3D0F5735, 0x3D385F6D, 0x3D3B5D94, 0x3D562F78, 0x3D703ED7, 0x3D7A673F, 0x3D7B10E7,
+		0x3D91564E, 0x3DA200CB, 0x3DA4533F, 0x3DAB7D72, 0x3DAF3F94, 0x3DBF53E0, 0x3DFE691D, 0x3E0229EB,
+		0x3E1051E0, 0x3E156AFC, 0x3E251ADE, 0x3E441A58, 0x3E5B7E59, 0x3E5F2362, 0x3E6137CB, 0x3E657606,
+		0x3E733990, 0x3E762D9D, 0x3E7D3074, 0x3E8443E0, 0x3E8D7D3F, 0x3E9C7CD3, 0x3EA0648D, 0x3EA116F7,
+		0x3EA5269D, 0x3EBE11B9, 0x3ECC0086, 0x3ED135AD, 0x3EF15B6A, 0x3EFA66E8, 0x3EFC1A7D, 0x3EFE3DC8,
+		0x3F0022F7, 0x3F054F44, 0x3F0A2A72, 0x3F0F4E0C, 0x3F1D4677, 0x3F1F51E0, 0x3F236954, 0x3F296F78,
+		0x3F2D7D06, 0x3F413561, 0x3F4950AC, 0x3F6B5975, 0x3F89280B, 0x3F9B2DD6, 0x3F9F0CF5, 0x3FA46EB8,
+		0x3FA651A7, 0x3FB14EC5, 0x3FB22EE2, 0x3FB72D27, 0x3FB83379, 0x3FBF13BD, 0x3FF16CBC, 0x3FFA65EE,
+		0x3FFF4DE9, 0x40035D5D, 0x40072120, 0x4013147B, 0x404E0056, 0x405B02B7, 0x405B16CF, 0x40602B66,
+		0x406A035E, 0x408E2F70, 0x40A703A6, 0x40A708A6, 0x40CD2BD4, 0x40CF3953, 0x40D01439, 0x40F61D4A,
+		0x40FC5520, 0x41121D51, 0x41286578, 0x412E68D0, 0x41401D46, 0x41596B09, 0x416413F6, 0x417F6EBD,
+		0x418D0889, 0x41AB3C30, 0x41E45BE5, 0x41ED206B, 0x41F27499, 0x41FA2D0C, 0x42180729, 0x422055C7,
+		0x422C1818, 0x422E7AC3, 0x423661A7, 0x42492860, 0x42690F6B, 0x426A4ED8, 0x42941472, 0x42D249E3,
+		0x42D250A7, 0x42DB145F, 0x42F1557D, 0x42F561F2, 0x42FC2C31, 0x4307784F, 0x43167C6E, 0x43197215,
+		0x433E74C6, 0x4342350C, 0x434534BE, 0x434611A3, 0x43475BB3, 0x435054B3, 0x43573596, 0x4371502A,
+		0x4371559F, 0x437D247E, 0x437D3E19, 0x438F6ECB, 0x439C47D5, 0x43A13718, 0x43A67F1B, 0x43C2796B,
+		0x43CC0913, 0x43E41D81, 0x43E42686, 0x43ED66E3, 0x43EF56EE, 0x43F5151F, 0x43F7517D, 0x43F86230,
+		0x440D0A91, 0x4414660B, 0x441B1EAF, 0x442B1C1D, 0x4437501B, 0x44414E60, 0x44474526, 0x4458184A,
+		0x44640C28, 0x446677C6, 0x446E6515, 0x446F74E5, 0x44717CF9, 0x4475789E, 0x447B154B, 0x44881D27,
+		0x448F486A, 0x449264B6, 0x4496175C, 0x44984033, 0x449F4165, 0x44A30283, 0x44AA32A7, 0x44AA71F9,
+		0x44B30452, 0x44BB2306, 0x44C27071, 0x44D349D9, 0x44D56F66, 0x44E14770, 0x44EA2669, 0x44EA47BB,
+		0x45073C46, 0x45345838, 0x453F587D, 0x45472E9D, 0x456C0C43, 0x456C6096, 0x45852A03, 0x458C333D,
+		0x459A7F23, 0x45AA529D, 0x45AB718F, 0x45C344AA, 0x45C63B22, 0x45CE21CA, 0x45D23711, 0x45D71590,
+		0x45DB5FE9, 0x45DF1D92, 0x45DF7CCA, 0x45E45B1D, 0x45E80BF7, 0x45EE4E9A, 0x45F249B7, 0x45F32596,
+		0x45FB5CE1, 0x460837F9, 0x460D2EBB, 0x463832F7, 0x46531797, 0x465574B0, 0x465D424D, 0x466B5AA0,
+		0x4674049B, 0x4678769C, 0x46803CFA, 0x46892D07, 0x46920944, 0x46953225, 0x46B5523B, 0x46C41EA8,
+		0x46CC31B4, 0x46CD1D73, 0x46D01849, 0x46F87F55, 0x470A7CBD, 0x47147EC5, 0x4727446B, 0x472C710B,
+		0x472E65D6, 0x47381E59, 0x475267B0, 0x475D2BEA, 0x47787A40, 0x478976DB, 0x47A21100, 0x47A77D2E,
+		0x47AC289C, 0x47CA7C53, 0x47D9437C, 0x47E03E87, 0x47E50BD3, 0x47E93CB8, 0x47F430BE, 0x47F971E8,
+		0x47FD2517, 0x48032420, 0x4806044A, 0x481E2BE7, 0x48252E33, 0x482B2B74, 0x4832644E, 0x4835637D,
+		0x483A62AB, 0x483E5BE8, 0x484964FE, 0x48543AED, 0x48573CF7, 0x4859273F, 0x486F3D93, 0x48726B45,
+		0x48740598, 0x48850E66, 0x48994D58, 0x489B0BB9, 0x489C3A48, 0x48A723C1, 0x48CE0609, 0x48ED6432,
+		0x4908091D, 0x49105005, 0x49261BA6, 0x49283645, 0x492A71E2, 0x493B655B, 0x495B0B6F, 0x495D445F,
+		0x495D6021, 0x495F399D, 0x49763A4F, 0x497E6745, 0x49850843, 0x498B3BE4, 0x499700EF, 0x499852DB,
+		0x499B6DB6, 0x499C0C01, 0x49A75618, 0x49B6525C, 0x49DA4F9E, 0x49EA22C8, 0x49F619F1, 0x49F86791,
+		0x49FD2621, 0x49FF799A, 0x4A000F52, 0x4A164056, 0x4A1D15D5, 0x4A2C5544, 0x4A2E3BCA, 0x4A3D6D97,
+		0x4A4B0F18, 0x4A4F2699, 0x4A673763, 0x4A7802CB, 0x4A7C19FE, 0x4A802E89, 0x4A8245F1, 0x4A8E429A,
+		0x4A904476, 0x4A906237, 0x4AA762A4, 0x4AA86394, 0x4AB470F3, 0x4AC023C4, 0x4ACB039B, 0x4AD026EE,
+		0x4AD22B80, 0x4ADB10A4, 0x4ADB6F79, 0x4AF14146, 0x4AF643D5, 0x4AF73456, 0x4B2103F0, 0x4B2625BE,
+		0x4B470947, 0x4B5832BE, 0x4B5C4957, 0x4B6135E8, 0x4B6211F2, 0x4B684D0B, 0x4B6C2256, 0x4B6E368D,
+		0x4B7B5F77, 0x4B7C3AEC, 0x4B8B6F24, 0x4B907716, 0x4B920E81, 0x4BAC2912, 0x4BAF0213, 0x4BB9178A,
+		0x4BD4248E, 0x4BF36A32, 0x4C076B40, 0x4C1E3A64, 0x4C1E75DB, 0x4C2621B6, 0x4C2879AD, 0x4C3C1F3C,
+		0x4C5142C0, 0x4C5475E3, 0x4C7B7A29, 0x4C872A85, 0x4C8A7614, 0x4C9B749F, 0x4CA708B9, 0x4CAE3B65,
+		0x4CB729F1, 0x4CC001AC, 0x4CC81FCB, 0x4CD43E46, 0x4CFE3998, 0x4D077DBA, 0x4D155EE8, 0x4D2771CE,
+		0x4D2E58D5, 0x4D317353, 0x4D3547D1, 0x4D417CD3, 0x4D460265, 0x4D4F65AE, 0x4D6665F7, 0x4D6B3E20,
+		0x4D7775BA, 0x4D7D105A, 0x4D7E12A7, 0x4D9C4195, 0x4DA362B0, 0x4DAA221F, 0x4DAF2C87, 0x4DB55DF5,
+		0x4DD43FFD, 0x4DDB5D59, 0x4DDC6FB4, 0x4DE152A0, 0x4DFE09D6, 0x4E2260B9, 0x4E237943, 0x4E26149C,
+		0x4E2C764D, 0x4E323A0A, 0x4E386C7B, 0x4E493AAF, 0x4E4C2F92, 0x4E6120A9, 0x4E61480A, 0x4E637988,
+		0x4E653BCC, 0x4E68316C, 0x4ECB189E, 0x4ECB2267, 0x4ECE1AD2, 0x4ED45146, 0x4ED6764C, 0x4EFE6B67,
+		0x4F0D4AC7, 0x4F0F2AA8, 0x4F256F49, 0x4F29072E, 0x4F37648C, 0x4F5D027C, 0x4F66544E, 0x4F705478,
+		0x4F7F4FAE, 0x4F884E33, 0x4F8B4507, 0x4F9342F3, 0x4FAF2007, 0x4FB069ED, 0x4FB30DB6, 0x4FD34079,
+		0x4FDD00CE, 0x4FE17259, 0x4FE23851, 0x4FE23F25, 0x4FE923DC, 0x4FF71989, 0x502B5185, 0x50307F63,
+		0x50311928, 0x503E2D1E, 0x50424095, 0x504E03FC, 0x505518A2, 0x505D37D8, 0x5062055B, 0x506C2898,
+		0x50801274, 0x5086785F, 0x509D75E8, 0x509F236D, 0x50AD1F3E, 0x50BB02F7, 0x50C13702, 0x50C72493,
+		0x50D15F0D, 0x50DC54B3, 0x50E21E4C, 0x50E33E8F, 0x50EE161F, 0x50FF1428, 0x51112E95, 0x511200C7,
+		0x511454A9, 0x511A2EC9, 0x511A3B01, 0x513D68DB, 0x51453EA2, 0x51517B11, 0x51546112, 0x515C3218,
+		0x51643697, 0x517B226E, 0x517B7068, 0x51870C68, 0x51983F94, 0x51A06698, 0x51AD2993, 0x51C00627,
+		0x51DF00D8, 0x51E14C1B, 0x51F54148, 0x520A745D, 0x52100540, 0x521035AA, 0x5213511B, 0x521D0D5B,
+		0x52202E76, 0x52277FB2, 0x522B182B, 0x52364369, 0x523F11FD, 0x52411DDA, 0x524C4CB5, 0x524F7543,
+		0x52632919, 0x526B048C, 0x526B7BA9, 0x528F5EA7, 0x52C83902, 0x52CE5D9F, 0x52CE650B, 0x52D34ED3,
+		0x52DA430A, 0x52F27084, 0x52F543A3, 0x52FC763A, 0x52FD30EB, 0x52FF28DF, 0x530F4572, 0x53216168,
+		0x53230256, 0x5328068B, 0x53335A45, 0x53456730, 0x53591DD7, 0x536B4F4A, 0x5373544E, 0x537379A8,
+		0x538021CD, 0x5384065B, 0x538514CC, 0x539572F3, 0x53B429F9, 0x53CC1D3C, 0x53F34027, 0x540D127D,
+		0x540F2DF7, 0x542D499E, 0x54320B58, 0x544625D9, 0x546F5326, 0x546F581F, 0x547523EE, 0x547C42B1,
+		0x548E3AFC, 0x54AE4F4B, 0x54AF2F7A, 0x54B054D0, 0x54DD5868, 0x54DD6ACF, 0x54EB576A, 0x54F61C99,
+		0x551C6295, 0x552B2224, 0x554014F1, 0x554053ED, 0x55444602, 0x555213B4, 0x555D3B8C, 0x5567728E,
+		0x55687797, 0x556B0755, 0x55727056, 0x557C076C, 0x557C3641, 0x557C7C4A, 0x558C4259, 0x55916D7A,
+		0x55C84CB7, 0x55D470C2, 0x55D66E24, 0x55DE40EE, 0x55E00E7E, 0x55E0158B, 0x55EB748F, 0x561471FB,
+		0x561509AD, 0x563F4CC2, 0x56507469, 0x56524B94, 0x56553F38, 0x565B0C3E, 0x566D04C2, 0x567B6C56,
+		0x56A70F57, 0x56AD2409, 0x56B8674F, 0x56B95223, 0x56C15139, 0x56F04A05, 0x56F37A81, 0x570F5725,
+		0x571152F5, 0x57297D58, 0x5731084A, 0x57390041, 0x573F5B48, 0x575136AC, 0x575A3431, 0x575E2880,
+		0x577A699E, 0x5785181B, 0x57895F38, 0x57952546, 0x57A236F0, 0x57AC39F5, 0x57AC66E9, 0x57C758F0,
+		0x57DB70CE, 0x57E37103, 0x57F46B33, 0x57F7558B, 0x580E1C3D, 0x58123F7A, 0x581E2306, 0x58296B19,
+		0x583A7A8B, 0x5849311B, 0x58493B8E, 0x584C3830, 0x584D0C79, 0x585157FE, 0x58524B04, 0x5873667B,
+		0x58737620, 0x587E55D3, 0x58802CE5, 0x588A27FB, 0x588E1506, 0x588F6BC0, 0x58A6457C, 0x58AE7C1D,
+		0x58BA4401, 0x58C01823, 0x58C41E8F, 0x58DD4CCC, 0x58E53B06, 0x58E835E4, 0x58F5023F, 0x58F814C4,
+		0x58FB0BC1, 0x590A6F04, 0x590A6FF4, 0x592E0E0F, 0x5935382A, 0x593A553B, 0x59406EB1, 0x59471B11,
+		0x59486829, 0x59523479, 0x596174E5, 0x59884407, 0x5996315E, 0x59A57BA8, 0x59AA0635, 0x59B425DA,
+		0x59C53FBA, 0x59DA4975, 0x59DB1AD1, 0x59DC6B9A, 0x59E3553F, 0x59EE3A11, 0x59F24327, 0x59FD4E83,
+		0x5A07394A, 0x5A196B79, 0x5A1C52C7, 0x5A1D7A2F, 0x5A2F2DD1, 0x5A495ABE, 0x5A535133, 0x5A676BCD,
+		0x5A712F63, 0x5A7D2C3C, 0x5AA025C2, 0x5AA1795C, 0x5AA33E86, 0x5AAC39C1, 0x5AB8289F, 0x5AC43965,
+		0x5ADD1F46, 0x5AE1245E, 0x5AF23F31, 0x5AFA67D7, 0x5AFD2049, 0x5AFE791F, 0x5B1B2699, 0x5B1D57EF,
+		0x5B262142, 0x5B386B6C, 0x5B4452F3, 0x5B576767, 0x5B580DCC, 0x5B7A738C, 0x5BB767AD, 0x5BBC62CB,
+		0x5BC10979, 0x5BC4602D, 0x5BDB7E2C, 0x5BE115FD, 0x5BE1238D, 0x5BE30681, 0x5BEA05E2, 0x5BF03315,
+		0x5BF23AD5, 0x5BF53817, 0x5BF71B87, 0x5C03585C, 0x5C081186, 0x5C083072, 0x5C162D0D, 0x5C3053C0,
+		0x5C3248B5, 0x5C3F7E39, 0x5C422066, 0x5C4B1A8A, 0x5C723F31, 0x5C825D83, 0x5C832C1F, 0x5C8C2E39,
+		0x5C8C7F9E, 0x5C8D66EA, 0x5C9807CA, 0x5C9863F6, 0x5CAD7949, 0x5CC55619, 0x5CCD150B, 0x5CD32071,
+		0x5CD64D63, 0x5CF1303D, 0x5CF149C8, 0x5D1425DF, 0x5D154995, 0x5D1C0A6A, 0x5D251D72, 0x5D2B2A9A,
+		0x5D3241E4, 0x5D4C1D59, 0x5D4D0C86, 0x5D515C4D, 0x5D5A06F7, 0x5D607947, 0x5D622498, 0x5D786EEE,
+		0x5D7C4F08, 0x5D867A02, 0x5D877285, 0x5D900560, 0x5D975A46, 0x5DA1752F, 0x5DB83661, 0x5DB95843,
+		0x5DBB46B5, 0x5DC456DE, 0x5DD231A2, 0x5DDB09F8, 0x5DE43980, 0x5E061170, 0x5E0713B2, 0x5E077484,
+		0x5E0F611E, 0x5E4327D2, 0x5E44065D, 0x5E486AA1, 0x5E4F6DE3, 0x5E5047AC, 0x5E564CFF, 0x5E5E4252,
+		0x5E627D20, 0x5E702E2C, 0x5E756B51, 0x5E7A620E, 0x5E7B0F23, 0x5E7B3816, 0x5E8D08CE, 0x5E8D7E3F,
+		0x5E97106E, 0x5EA253A5, 0x5EA84115, 0x5EAD47E8, 0x5EC2479B, 0x5ECF404A, 0x5ED03255, 0x5ED33D46,
+		0x5EEA3F25, 0x5EEE6ADB, 0x5F00596C, 0x5F02084D, 0x5F182E21, 0x5F2F1680, 0x5F3B6079, 0x5F456B53,
+		0x5F4571E5, 0x5F4B0B22, 0x5F58606A, 0x5F5E7F39, 0x5F643EE6, 0x5F7307F4, 0x5F752F19, 0x5F8C3937,
+		0x5F9218C3, 0x5F9C43D4, 0x5FA96262, 0x5FAD09CA, 0x5FB15E81, 0x5FB31295, 0x5FBC5FFF, 0x5FBE5F52,
+		0x5FD24FEA, 0x5FD47B45, 0x5FDF1493, 0x5FE61572, 0x5FE95249, 0x5FF84497, 0x5FFE33EC, 0x6004431B,
+		0x601A5770, 0x602112FC, 0x602C46E7, 0x60305168, 0x60320FEB, 0x6045426E, 0x60560DAE, 0x60806A0C,
+		0x608237A4, 0x60964DB8, 0x60980323, 0x609D0203, 0x609D07DB, 0x60AD2FE0, 0x60AE0867, 0x60B26D74,
+		0x60C22E93, 0x60C80EC9, 0x60D94FA7, 0x60DC6E25, 0x60E335FA, 0x60EC0540, 0x60EF0519, 0x60F720F6,
+		0x60FB61A7, 0x610157C9, 0x61040B08, 0x61064783, 0x611948A3, 0x611D69BC, 0x612062DB, 0x612C748F,
+		0x613510D0, 0x61487DBF, 0x61497585, 0x614A3353, 0x615959BA, 0x616F492C, 0x61784349, 0x617B191D,
+		0x61822A3C, 0x61965EB3, 0x619D51D3, 0x619E7657, 0x61A812F5, 0x61B830BC, 0x61C65FDE, 0x61C81E88,
+		0x61C921EF, 0x61D07789, 0x61DA102E, 0x61EE5C9A, 0x61F40670, 0x620C26D8, 0x62285CAD, 0x622E3D34,
+		0x62405882, 0x624E5833, 0x6251618F, 0x62687944, 0x62701AF8, 0x627A3586, 0x627F3275, 0x62842540,
+		0x6289239F, 0x62984AB7, 0x62AB2AB4, 0x62B15CD7, 0x62BC0AEE, 0x62E319C6, 0x62EA75E0, 0x62ED1551,
+		0x62EF058E, 0x62FE6290, 0x6314421A, 0x633A012B, 0x6342018A, 0x63576E53, 0x63615A6D, 0x63737D31,
+		0x637E1D42, 0x63A40F58, 0x63A669B6, 0x63A86D87, 0x63AB65DC, 0x63AF5057, 0x63B70F7C, 0x63B87EBE,
+		0x63C00DE7, 0x63C50673, 0x63DA2195, 0x63DE7A05, 0x63E7509E, 0x63F07A46, 0x640E7764, 0x64146142,
+		0x64302F16, 0x64342B55, 0x64655F10, 0x64660709, 0x64793A54, 0x647E2BF7, 0x64861559, 0x64903364,
+		0x649316B7, 0x64961488, 0x64B9757E, 0x64BD4664, 0x64BE2E39, 0x64CA2868, 0x64D35E1D, 0x64DD173C,
+		0x64E06CBB, 0x64E51535, 0x64EF411D, 0x64F37F05, 0x651E50EC, 0x653B5374, 0x65490A3D, 0x65536ECF,
+		0x656F1A7A, 0x65752C65, 0x658028BA, 0x658F21AF, 0x65A34B7A, 0x65A428F2, 0x65A80992, 0x65B05F3F,
+		0x65B83AFB, 0x65BB0060, 0x65D949B7, 0x65D95395, 0x65DE621C, 0x65EB71CC, 0x65EF0CB8, 0x65F874DE,
+		0x661A0CCC, 0x661B239A, 0x662235A5, 0x662E4376, 0x66317064, 0x66385B6C, 0x664D06FF, 0x665F6BB7,
+		0x667517AB, 0x6680196B, 0x66842574, 0x668F64C7, 0x66915CE9, 0x669D053F, 0x66B43B06, 0x66B93E8C,
+		0x66BB737D, 0x66CC16BD, 0x66D53314, 0x66D57CC4, 0x66DD4F67, 0x66E93537, 0x66F445BB, 0x66F47727,
+		0x66F5118F, 0x6702757C, 0x670E3DE3, 0x67114B98, 0x67177EEC, 0x672139F0, 0x673E4CD2, 0x674849B5,
+		0x674D6F8E, 0x675E5940, 0x676B6BCA, 0x676F0004, 0x677861E1, 0x678813A4, 0x67890049, 0x679934F9,
+		0x679A474E, 0x679C4276, 0x67A42263, 0x67B725B2, 0x67C82864, 0x67CC007C, 0x67D83807, 0x67D908DF,
+		0x67DB4150, 0x67F518F0, 0x68083431, 0x68232D31, 0x68251A95, 0x68373878, 0x683927F5, 0x684D1517,
+		0x68664078, 0x686B6395, 0x687107CA, 0x688557E4, 0x68855BE7, 0x68880DCD, 0x68966670, 0x689D0F5F,
+		0x689D5EEE, 0x68AB2DD9, 0x68AB6E72, 0x68B829C7, 0x68C57282, 0x68EA6EBE, 0x68F06A02, 0x68FF7165,
+		0x690D344F, 0x691970FD, 0x69315157, 0x693D7B21, 0x69491CFA, 0x694A0DC1, 0x695C429D, 0x696021E6,
+		0x69604AE2, 0x69715285, 0x69804B35, 0x698F6172, 0x698F762E, 0x69A52C96, 0x69A72C50, 0x69AE0805,
+		0x69B140F6, 0x69B53ADA, 0x69C033D8, 0x69CE154F, 0x69D90F11, 0x69E742FC, 0x69EC0E70, 0x69F02BA0,
+		0x69F11716, 0x69F55DCC, 0x6A0A724C, 0x6A1244E9, 0x6A2E514F, 0x6A3A2C88, 0x6A660231, 0x6A66149A,
+		0x6A6B4F18, 0x6A7236C9, 0x6A733E6C, 0x6A77506A, 0x6A7E47C9, 0x6A90123D, 0x6A9033B3, 0x6A9A3B1F,
+		0x6A9B79D8, 0x6A9E5CE5, 0x6A9F01AF, 0x6AA20B7E, 0x6AA63375, 0x6AC14091, 0x6AC52840, 0x6ADD40EC,
+		0x6ADF2929, 0x6AFF0587, 0x6B032A0B, 0x6B1C6027, 0x6B2838C7, 0x6B2E49CD, 0x6B2F3E97, 0x6B3D5D45,
+		0x6B434D0D, 0x6B4D6FC6, 0x6B6019DB, 0x6B85214E, 0x6B9C6127, 0x6B9C7392, 0x6BA520F0, 0x6BAC2781,
+		0x6BC05942, 0x6BDC40EB, 0x6BE062DF, 0x6C013A17, 0x6C0E191F, 0x6C1344C6, 0x6C213305, 0x6C236A54,
+		0x6C305137, 0x6C321179, 0x6C3B5917, 0x6C403ACC, 0x6C434E0B, 0x6C4568A7, 0x6C507EAC, 0x6C5871D6,
+		0x6C63251D, 0x6C654678, 0x6C6C1CF3, 0x6C6F6052, 0x6C7566F3, 0x6C9F2330, 0x6CA57960, 0x6CAC3D62,
+		0x6CB14354, 0x6CB64BDB, 0x6CC1560F, 0x6CC85D46, 0x6CCB719D, 0x6CE00370, 0x6CE277E7, 0x6CEA50D8,
+		0x6CF248FD, 0x6CF44DD6, 0x6CFC30AD, 0x6CFD0610, 0x6CFD3E5F, 0x6D05484F, 0x6D0E1BCE, 0x6D170B31,
+		0x6D1E5C25, 0x6D21564D, 0x6D302DA9, 0x6D4746D8, 0x6D4E2A4A, 0x6D5F1592, 0x6D631CED, 0x6D6A1261,
+		0x6D717883, 0x6D795EC0, 0x6D823703, 0x6D902EE3, 0x6D9538E1, 0x6DA91393, 0x6DAB7270, 0x6DAB78CD,
+		0x6DB26E07, 0x6DB47487, 0x6DD754DD, 0x6DDD201D, 0x6E0026EF, 0x6E0A438A, 0x6E120246, 0x6E1A0A84,
+		0x6E2B38F3, 0x6E2E55B5, 0x6E354B41, 0x6E3906E4, 0x6E397D96, 0x6E405BD5, 0x6E435BDE, 0x6E4E1BEC,
+		0x6E77153D, 0x6E7C6687, 0x6E856548, 0x6E8B7611, 0x6E8F7FA4, 0x6E904C1A, 0x6EA72622, 0x6EA92FD5,
+		0x6EB3047F, 0x6EB639E8, 0x6ED17CF8, 0x6ED83424, 0x6EEE7E6C, 0x6EF64079, 0x6EF667A4, 0x6F2A5430,
+		0x6F363A21, 0x6F760759, 0x6F766824, 0x6F797AF3, 0x6F9256DF, 0x6FBA4274, 0x6FBE6CE6, 0x6FC54C6B,
+		0x6FC75ABD, 0x6FDA43A3, 0x6FE455D8, 0x6FFE0DFD, 0x700165C2, 0x701F4004, 0x702041F2, 0x70291096,
+		0x704E638F, 0x705231A9, 0x70582D53, 0x705A6ED9, 0x706707E6, 0x709154FC, 0x709D2036, 0x70A62140,
+		0x70AF1D38, 0x70B45E01, 0x70BB021A, 0x70CC1487, 0x70D13342, 0x70E13826, 0x70EA2B89, 0x70F0538F,
+		0x70FE415C, 0x71076BBA, 0x710B2BD3, 0x710E6D16, 0x7110790B, 0x711214F3, 0x71184DA3, 0x71270D73,
+		0x714C1031, 0x716308C6, 0x71755E9B, 0x717B5EFB, 0x718508B4, 0x718939EF, 0x71A05FF1, 0x71A52973,
+		0x71AE1BDC, 0x71AE456A, 0x71B81DE7, 0x71C30148, 0x71C91921, 0x71D72486, 0x71DE26A3, 0x71F001D2,
+		0x71F965B4, 0x720673D9, 0x720E7EA6, 0x72297CDC, 0x72397ECD, 0x72452672, 0x725654F4, 0x728C1CC0,
+		0x72AE63C8, 0x72B16D0D, 0x72B73FBA, 0x72BF79F1, 0x72E93E13, 0x72EC0AA6, 0x72EF466E, 0x72F81072,
+		0x7305301D, 0x731B11A7, 0x73245AB3, 0x73246FC0, 0x73260714, 0x7330132C, 0x733846D5, 0x733B61C6,
+		0x734E3F62, 0x736027E6, 0x736D423E, 0x73700561, 0x73737990, 0x737F24F9, 0x7381337A, 0x73A1443F,
+		0x73AB2028, 0x73B01573, 0x73BD71A9, 0x73CB1489, 0x73D3504A, 0x73D87A5F, 0x73E6005B, 0x73E911E8,
+		0x73F56AC5, 0x73F869CF, 0x740912C2, 0x74093768, 0x740C4C84, 0x742E3376, 0x743F30B3, 0x74576E37,
+		0x74627538, 0x746744D1, 0x746C06E8, 0x746E7171, 0x747E681E, 0x74824ADA, 0x7488454D, 0x748B78B6,
+		0x74AF54F0, 0x74B90C48, 0x74C14D31, 0x74C55395, 0x74C626EB, 0x74CD7D1F, 0x74EC7580, 0x74F97CF8,
+		0x74FC2325, 0x74FF26F9, 0x7505765B, 0x75080482, 0x750C1CD7, 0x751967FD, 0x752643C9, 0x75291BEC,
+		0x75353EA4, 0x75363BB5, 0x7537050D, 0x753714F8, 0x754D0FC4, 0x754E1999, 0x75533E74, 0x755D6DF8,
+		0x755F292D, 0x7563071D, 0x75706300, 0x757A0EB8, 0x759B6BBE, 0x75A648B7, 0x75AC2519, 0x75B024C6,
+		0x75B43A72, 0x75C51A26, 0x75C9772B, 0x75CD1A28, 0x75D21B78, 0x75DC4737, 0x75E005F1, 0x75E32257,
+		0x75E40528, 0x75ED39CF, 0x75F85826, 0x75FC34EF, 0x760E0A0F, 0x76181322, 0x762301C8, 0x76247429,
+		0x763274B7, 0x764236CE, 0x766E78A3, 0x767B7EC9, 0x767E5013, 0x767F1E44, 0x76860554, 0x768B3AC7,
+		0x768F5140, 0x768F640F, 0x76901A85, 0x769F6E66, 0x76A2739D, 0x76A63B4C, 0x76B068CA, 0x76C53927,
+		0x76D72D89, 0x76E738A3, 0x76EB2878, 0x76F25B4B, 0x770600CF, 0x771C2838, 0x771F3D7D, 0x772660D7,
+		0x772B01CC, 0x774426C2, 0x77513211, 0x775F6665, 0x77745390, 0x7781290F, 0x7783449D, 0x778F46E3,
+		0x779F3EC6, 0x77A97169, 0x77D72045, 0x77FD5097, 0x78021D03, 0x782E78BF, 0x78300C0C, 0x783F287A,
+		0x7858750E, 0x787206F8, 0x787A3D4C, 0x787F38B5, 0x788026F4, 0x788F7A03, 0x78A75EF4, 0x78AC735F,
+		0x78B00CB2, 0x78C17971, 0x78CE659D, 0x78D01893, 0x78D17492, 0x78DC034E, 0x78E00C86, 0x78E9500C,
+		0x78F7286F, 0x79103802, 0x791D1778, 0x79274447, 0x7939764F, 0x793F238A, 0x794E4A82, 0x795227EE,
+		0x7953702C, 0x79574B3B, 0x79611458, 0x79660015, 0x796A6B88, 0x79700852, 0x79912ADC, 0x79973C5A,
+		0x79974E04, 0x79A12A52, 0x79A95BF9, 0x79B73666, 0x79BB1D64, 0x79C84DBC, 0x79CA30B1, 0x79CF27AC,
+		0x79E5237B, 0x79EB2BC9, 0x7A0A1063, 0x7A0B156B, 0x7A240412, 0x7A2B266D, 0x7A422E14, 0x7A521650,
+		0x7A583068, 0x7A93645C, 0x7A9B6E17, 0x7AA91131, 0x7AAD273F, 0x7ABD4D4D, 0x7AD71A55, 0x7AE52512,
+		0x7B014306, 0x7B05072C, 0x7B181EB0, 0x7B1A5333, 0x7B1B14BD, 0x7B1F0130, 0x7B2822F7, 0x7B2E70F3,
+		0x7B31633E, 0x7B3F0058, 0x7B44224F, 0x7B4A7CD6, 0x7B567F1A, 0x7B65266B, 0x7B6F4B91, 0x7B732460,
+		0x7B75036E, 0x7B8537F7, 0x7B8B1D10, 0x7B8D68E7, 0x7BAC73DF, 0x7BB35FCF, 0x7BBF3625, 0x7BC85E73,
+		0x7BD06E31, 0x7BDE2CAF, 0x7BEE5003, 0x7BF4652D, 0x7BF7646F, 0x7BFB484F, 0x7C0B46C8, 0x7C156670,
+		0x7C3939E7, 0x7C4C63EF, 0x7C4E54ED, 0x7C515B18, 0x7C5F327E, 0x7C671162, 0x7C6968F8, 0x7C7B1237,
+		0x7CA5476A, 0x7CA8382B, 0x7CAE2557, 0x7CB404D4, 0x7CC63464, 0x7CDD7B0E, 0x7CE83A30, 0x7CF256D0,
+		0x7CF61A81, 0x7CFC39CB, 0x7D037B40, 0x7D070604, 0x7D071EE0, 0x7D0D6779, 0x7D106167, 0x7D15544E,
+		0x7D3C3C9D, 0x7D591EAD, 0x7D635E2C, 0x7D675993, 0x7D6D0A6C, 0x7D76127F, 0x7D7619D2, 0x7D767108,
+		0x7D95313B, 0x7D99343C, 0x7DA237BC, 0x7DA4736D, 0x7DC061F5, 0x7DCA398F, 0x7DD67E15, 0x7DD91295,
+		0x7DE7708E, 0x7DF26C8C, 0x7DF45001, 0x7E0D6CB8, 0x7E113020, 0x7E154274, 0x7E1C01D7, 0x7E2868D4,
+		0x7E2A7743, 0x7E3A7E2A, 0x7E3D3430, 0x7E412AC8, 0x7E4F49B5, 0x7E5C70BF, 0x7E603872, 0x7E656E50,
+		0x7E657B56, 0x7E7E4879, 0x7E81412A, 0x7E8C1C45, 0x7E8C7096, 0x7E8D1DCE, 0x7E8E06F8, 0x7E9E02E1,
+		0x7EA03481, 0x7EAC3387, 0x7EAE7F2F, 0x7EB70379, 0x7EBB00D7, 0x7EC9580E, 0x7ED34379, 0x7ED774FE,
+		0x7ED82ED9, 0x7EDD58E1, 0x7EDE120F, 0x7EED364B, 0x7EF6599D, 0x7EFB5077, 0x7F0040DE, 0x7F206A7F,
+		0x7F2A71FD, 0x7F3222FD, 0x7F371477, 0x7F3A0E22, 0x7F483739, 0x7F4C0E47, 0x7F5D69C4, 0x7F71342D,
+		0x7F7B4FC5, 0x7F853FF4, 0x7F861E46, 0x7F8D3DD9, 0x7FA21A1E, 0x7FA763E8, 0x7FB41425, 0x7FBC713E,
+		0x7FC02528, 0x7FC65855, 0x7FC96DD5, 0x7FF21081, 0x7FF260D0, 0x7FF3248C, 0x7FFE0A12,
+	};
+
+	inline const uint16_t ms_aSeeds[NumBuckets] =
+	{
+		5, 1, 10, 1, 9, 13, 0, 3, 0, 3, 2, 4, 11, 0, 2, 4,
+		2, 0, 1, 1, 2, 16, 5, 2, 2, 0, 2, 5, 0, 1, 4, 2,
+		8, 3, 1, 3, 4, 1, 1, 8, 2, 1, 1, 9, 4, 2, 4, 7,
+		1, 3, 4, 1, 2, 3, 2, 3, 3, 2, 2, 2, 6, 2, 3, 3,
+		1, 4, 2, 1, 1, 1, 4, 1, 10, 8, 1, 0, 2, 3, 2, 5,
+		8, 1, 1, 6, 0, 6, 1, 6, 1, 7, 3, 1, 2, 4, 7, 1,
+		1, 0, 0, 1, 2, 3, 1, 4, 1, 13, 1, 3, 3, 0, 1, 4,
+		11, 1, 3, 1, 2, 1, 2, 7, 3, 2, 3, 1, 3, 5, 2, 4,
+		1, 2, 1, 1, 1, 0, 2, 3, 3, 2, 1, 1, 1, 3, 1, 5,
+		2, 1, 1, 7, 0, 1, 1, 2, 3, 7, 1, 1, 1, 1, 1, 3,
+		7, 0, 4, 1, 3, 3, 5, 3, 3, 7, 2, 0, 2, 1, 6, 7,
+		2, 14, 3, 3, 2, 2, 10, 1, 1, 3, 1, 1, 2, 2, 1, 19,
+		1, 0, 1, 1, 2, 1, 2, 2, 8, 0, 3, 8, 6, 3, 9, 5,
+		1, 1, 2, 1, 2, 3, 1, 1, 4, 1, 11, 3, 2, 1, 1, 1,
+		6, 3, 2, 1, 2, 2, 3, 4, 2, 7, 1, 5, 2, 3, 2, 4,
+		1, 4, 2, 1, 1, 3, 2, 12, 1, 1, 8, 1, 4, 1, 3, 5,
+		1, 0, 10, 3, 0, 4, 3, 2, 2, 0, 1, 1, 14, 5, 6, 1,
+		2, 0, 6, 8, 0, 2, 1, 1, 0, 3, 13, 1, 0, 2, 2, 1,
+		4, 2, 0, 0, 1, 8, 4, 1, 3, 7, 1, 3, 7, 2, 1, 2,
+		7, 2, 4, 1, 4, 3, 1, 3, 5, 9, 2, 1, 4, 4, 7, 1,
+		2, 16, 1, 8, 8, 3, 1, 4, 2, 1, 1, 3, 2, 1, 3, 2,
+		1, 3, 7, 2, 1, 6, 0, 1, 1, 6, 18, 1, 3, 19, 2, 13,
+		4, 1, 16, 3, 2, 4, 0, 1, 14, 9, 4, 5, 1, 0, 0, 1,
+		24, 2, 2, 1, 2, 1, 3, 4, 1, 1, 5, 5, 4, 1, 5, 1,
+		14, 4, 0, 6, 6, 1, 2, 3, 2, 2, 1, 18, 1, 0, 4, 4,
+		6, 0, 5, 4, 4, 1, 1, 5, 6, 21, 5, 0, 1, 1, 5, 2,
+		0, 3, 5, 24, 0, 3, 2, 1, 2, 1, 18, 0, 4, 9, 2, 2,
+		1, 2, 5, 0, 2, 2, 1, 4, 2, 1, 2, 1, 5, 0, 3, 12,
+		0, 4, 13, 2, 11, 1, 9, 1, 1, 1, 1, 11, 1, 4, 7, 16,
+		5, 2, 1, 1, 1, 5, 3, 2, 2, 1, 8, 3, 9, 0, 1, 3,
+		5, 6, 2, 1, 10, 11, 1, 2, 3, 5, 10, 8, 0, 7, 1, 2,
+		2, 1, 3, 1, 4, 1, 0, 2, 1, 5, 4, 2, 0, 1, 2, 4,
+		2, 3, 3, 2, 5, 1, 2, 2, 4, 5, 2, 1, 4, 1, 14, 1,
+		6, 1, 9, 6, 8, 3, 2, 1, 2, 5, 6, 2, 5, 5, 1, 1,
+		1, 1, 2, 1, 36, 4, 1, 13, 1, 10, 10, 1, 2, 0, 1, 4,
+		1, 10, 1, 2, 25, 5, 3, 1, 0, 1, 6, 6, 1, 1, 3, 7,
+		4, 3, 2, 2, 7, 30, 7, 1, 2, 9, 1, 2, 1, 2, 4, 1,
+		2, 3, 24, 4, 3, 1, 1, 1, 7, 4, 5, 5, 14, 16, 0, 3,
+		5, 2, 5, 1, 6, 3, 3, 7, 14, 1, 8, 7, 1, 5, 1, 7,
+		2, 0, 3, 7, 4, 18, 10, 3, 2, 5, 9, 1, 18, 7, 10, 3,
+		1, 3, 3, 5, 5, 1, 1, 2, 7, 4, 7, 5, 12, 1, 10, 12,
+		2, 1, 4, 2, 1, 1, 1, 7, 4, 9, 5, 3, 1, 1, 1, 0,
+		13, 28, 2, 4, 1, 0, 9, 1, 8, 0, 1, 33, 1, 4, 8, 3,
+		16, 3, 4, 1, 1, 5, 0, 3, 1, 0, 3, 26, 2, 6, 2, 5,
+		6, 7, 6, 1, 0, 3, 1, 1, 1, 1, 1, 1, 10, 5, 1, 3,
+		1, 1, 3, 3, 2, 29, 3, 10, 6, 1, 6, 11, 2, 1, 2, 3,
+		1, 4, 42, 6, 2, 6, 9, 8, 2, 22, 26, 1, 5, 5, 3, 2,
+		4, 8, 2, 1, 1, 1, 5, 2, 11, 3, 4, 7, 3, 11, 5, 2,
+		3, 1, 10, 5, 10, 1, 5, 0, 1, 4, 1, 3, 5, 8, 4, 8,
+		2, 2, 18, 1, 4, 11, 1, 1, 1, 5, 1, 1, 10, 1, 2, 1,
+		6, 5, 1, 3, 1, 3, 6, 12, 0, 1, 1, 7, 7, 5, 1, 1,
+		14, 5, 0, 6, 21, 6, 13, 1, 18, 9, 13, 7, 7, 13, 18, 1,
+		1, 1, 7, 5, 1, 10, 2, 1, 1, 14, 6, 9, 3, 1, 14, 4,
+		1, 5, 5, 1, 2, 2, 4, 2, 55, 6, 0, 0, 1, 0, 1, 4,
+		0, 1, 4, 1, 4, 1, 12, 19, 14, 2, 2, 2, 10, 6, 4, 13,
+		2, 0, 0, 1, 19, 13, 2, 1, 2, 1, 2, 3, 1, 4, 1, 2,
+		10, 4, 2, 22, 1, 3, 12, 1, 14, 2, 3, 1, 22, 1, 7, 11,
+		19, 4, 4, 2, 1, 1, 1, 1, 2, 2, 13, 4, 8, 7, 3, 1,
+		6, 1, 0, 2, 6, 3, 7, 2, 18, 6, 4, 5, 5, 2, 2, 4,
+		1, 32, 9, 7, 5, 3, 6, 3, 1, 20, 2, 9, 2, 6, 1, 1,
+		1, 11, 0, 0, 5, 4, 16, 3, 2, 1, 1, 7, 8, 6, 9, 4,
+		13, 3, 4, 12, 13, 3, 3, 2, 9, 8, 1, 3, 7, 0, 14, 4,
+		6, 3, 15, 4, 4, 2, 23, 1, 2, 5, 19, 1, 4, 1, 1, 4,
+		10, 3, 8, 0, 3, 2, 35, 1, 5, 1, 0, 15, 7, 5, 3, 1,
+	};
+
+	// index into ms_aHashes, 0xFFFF for empty slots
+	inline const uint16_t ms_aSlots[1 << SlotBits] =
+	{
+		1736, 2175, 2284, 65535, 618, 2817, 2534, 65535, 2227, 2328, 1757, 2238, 2070, 65535, 2426, 294,
+		118, 535, 65535, 2560, 1810, 2137, 416, 1541, 1750, 792, 1001, 65535, 2589, 1492, 381, 2727,
+		425, 65535, 194, 2768, 2695, 2493, 65535, 65535, 1560, 32, 2153, 65535, 89, 2819, 76, 2035,
+		65535, 65535, 65535, 2141, 316, 65535, 2131, 154, 65535, 65535, 2105, 65535, 2764, 562, 862, 65535,
+		330, 2593, 65535, 545, 772, 264, 65535, 2333, 2200, 1835, 380, 2479, 65535, 2475, 2423, 587,
+		239, 572, 61, 596, 2566, 65535, 2615, 667, 1241, 1601, 2253, 2581, 65535, 2312, 65535, 2221,
+		2147, 65535, 894, 2470, 1733, 1525, 1479, 527, 1973, 65535, 2258, 65535, 2347, 65535, 65535, 2691,
+		743, 2551, 65535, 2359, 716, 65535, 879, 592, 646, 1651, 65535, 65535, 65535, 65535, 1488, 65535,
+		670, 1969, 668, 2569, 65535, 2520, 911, 930, 920, 1046, 2469, 1769, 2439, 65535, 1483, 1590,
+		65535, 65535, 2612, 2791, 1437, 2454, 65535, 652, 2039, 2223, 65535, 556, 65535, 65535, 1006, 65535,
+		1298, 779, 1316, 65535, 1071, 2640, 2433, 855, 65535, 1496, 859, 1667, 65535, 282, 593, 1196,
+		65535, 1234, 65535, 65535, 758, 983, 1660, 2555, 2444, 2757, 1905, 251, 2286, 595, 65, 908,
+		2325, 65535, 2320, 65535, 907, 529, 63, 1063, 2823, 478, 65535, 2294, 65535, 1266, 1183, 533,
+		1875, 321, 852, 65535, 65535, 1913, 65535, 344, 203, 1657, 65535, 1264, 1190, 718, 65535, 65535,
+		2692, 1990, 2030, 961, 65535, 130, 1009, 65535, 2505, 65535, 65535, 65535, 65535, 2300, 1040, 65535,
+		65535, 2662, 65535, 278, 65535, 65535, 65535, 762, 65535, 1025, 2824, 65535, 65535, 362, 475, 1449,
+		2666, 65535, 448, 1656, 65535, 1499, 2271, 65535, 65535, 2299, 2270, 1036, 2112, 65535, 2524, 1801,
+		2287, 85, 65535, 65535, 65535, 785, 65535, 1694, 1243, 1622, 65535, 65535, 65535, 75, 2195, 65535,
+		1141, 1481, 2771, 2821, 1219, 2690, 65535, 9, 830, 1658, 1508, 295, 65535, 1240, 2661, 880,
+		65535, 1958, 952, 65535, 179, 1156, 8, 65535, 65535, 37, 65535, 573, 65535, 65535, 65535, 1471,
+		741, 2103, 2656, 65535, 65535, 2378, 65535, 65535, 2564, 436, 1833, 2397, 65535, 2491, 2113, 1551,
+		710, 65535, 65535, 65535, 65535, 1275, 557, 1084, 78, 65535, 989, 65535, 65535, 2326, 65535, 2562,
+		524, 2010, 19, 336, 445, 200, 65535, 1577, 714, 1029, 2543, 2509, 2706, 65535, 65535, 938,
+		65535, 65535, 443, 2623, 65535, 65535, 1246, 65535, 65535, 65535, 1977, 1294, 2781, 117, 2382, 1278,
+		65535, 925, 2628, 1210, 655, 1675, 65535, 2282, 65535, 1680, 873, 1632, 2293, 1042, 848, 65535,
+		2170, 827, 2742, 65535, 2684, 2176, 65535, 1137, 417, 1027, 1062, 2657, 299, 1807, 1604, 65535,
+		941, 688, 690, 65535, 1591, 2430, 1904, 115, 1509, 65535, 65535, 65535, 2256, 274, 2789, 292,
+		985, 1914, 65535, 2833, 2211, 1635, 933, 228, 65535, 65535, 65535, 2614, 65535, 331, 2124, 1698,
+		993, 65535, 1729, 531, 2130, 1575, 581, 33, 65535, 65535, 2458, 1344, 559, 36, 1300, 65535,
+		65535, 2187, 2521, 831, 65535, 65535, 65535, 1356, 65535, 1168, 2696, 65535, 1893, 793, 2159, 1850,
+		65535, 756, 65535, 2233, 1873, 233, 65535, 2689, 1536, 415, 1830, 2471, 1114, 65535, 2575, 17,
+		966, 2385, 65535, 65535, 65535, 65535, 498, 1047, 1715, 1506, 65535, 1165, 65535, 1546, 1844, 2248,
+		65535, 2629, 65535, 1992, 65535, 1229, 910, 65535, 1944, 234, 437, 65535, 1389, 1221, 65535, 846,
+		65535, 65535, 2391, 2127, 65535, 2219, 65535, 2753, 209, 65535, 2246, 65535, 140, 65535, 141, 1258,
+		999, 65535, 1720, 180, 2110, 1056, 2069, 65535, 1497, 65535, 65535, 460, 1045, 65535, 503, 2288,
+		1802, 1360, 65535, 1014, 1327, 707, 631, 481, 165, 1370, 435, 653, 65535, 2073, 65535, 298,
+		2510, 1623, 2057, 953, 459, 1842, 1791, 817, 2829, 1349, 835, 65535, 1929, 2537, 65535, 20,
+		65535, 221, 2209, 65535, 1067, 431, 2199, 1768, 222, 65535, 65535, 1325, 1087, 1971, 1679, 2255,
+		65535, 1384, 1115, 1498, 633, 65535, 2800, 65535, 237, 1642, 34, 65535, 502, 471, 748, 984,
+		65535, 2533, 65535, 1355, 65535, 1645, 2330, 2024, 776, 1341, 108, 213, 2016, 65535, 1180, 463,
+		1843, 65535, 2765, 65535, 296, 65535, 971, 881, 65535, 1672, 65535, 2634, 65535, 1700, 65535, 65535,
+		642, 104, 65535, 65535, 977, 807, 1119, 65535, 163, 10, 847, 65535, 2792, 1902, 25, 771,
+		206, 65535, 2393, 65535, 683, 2098, 684, 705, 65535, 2436, 65535, 1854, 65535, 65535, 1585, 2231,
+		2075, 65535, 412, 1149, 525, 505, 1813, 2386, 65535, 65535, 510, 65535, 2590, 814, 227, 65535,
+		2164, 65535, 1544, 18, 2486, 65535, 2204, 1348, 2033, 65535, 65535, 1390, 665, 65535, 65535, 1339,
+		164, 639, 2504, 921, 65535, 1663, 65535, 530, 1224, 65535, 65535, 65535, 1482, 65535, 903, 1281,
+		65535, 2583, 1858, 2188, 65535, 1917, 65535, 2011, 2381, 561, 65535, 2341, 2128, 65535, 65535, 261,
+		65535, 2278, 65535, 65535, 1617, 65535, 65535, 65535, 1666, 497, 65535, 65535, 110, 2146, 65535, 549,
+		919, 1556, 2374, 1218, 2738, 906, 1719, 1075, 1474, 2028, 1035, 2502, 1783, 2268, 2171, 2273,
+		399, 430, 1248, 2428, 65535, 2012, 65535, 622, 1037, 1564, 2466, 542, 414, 2779, 2755, 615,
+		65535, 2644, 624, 1120, 214, 65535, 65535, 133, 102, 65535, 65535, 226, 2770, 1670, 2825, 598,
+		1547, 1480, 2632, 726, 355, 48, 65535, 1460, 2275, 1767, 719, 65535, 65535, 65535, 2264, 1903,
+		65535, 65535, 804, 65535, 65535, 65535, 2167, 2648, 1803, 65535, 892, 808, 65535, 2665, 1957, 65535,
+		1117, 65535, 786, 986, 1829, 65535, 1510, 2631, 1450, 1404, 219, 1855, 423, 65535, 1406, 65535,
+		65535, 1162, 65535, 65535, 1323, 65535, 2076, 1624, 65535, 2788, 65535, 272, 65535, 65535, 65535, 845,
+		432, 65535, 2709, 931, 988, 2252, 65535, 65535, 1251, 65535, 65535, 65535, 1853, 65535, 1129, 2174,
+		65535, 65535, 534, 65535, 65535, 1135, 1607, 65535, 204, 1606, 65535, 1155, 1915, 65535, 1941, 1351,
+		1105, 65535, 2205, 2034, 1526, 490, 65535, 516, 1028, 1931, 2545, 65535, 2235, 65535, 65535, 2214,
+		1567, 160, 1876, 2697, 841, 2297, 65535, 2608, 65535, 396, 65535, 765, 607, 248, 65535, 630,
+		65535, 107, 65535, 1199, 889, 260, 458, 2611, 65535, 374, 65535, 2607, 1085, 2786, 2407, 65535,
+		65535, 1686, 1472, 65535, 1978, 899, 212, 65535, 65535, 65535, 65535, 1088, 532, 65535, 1800, 1195,
+		2348, 501, 635, 65535, 427, 199, 2324, 2217, 65535, 2837, 1786, 2157, 571, 1722, 1819, 494,
+		44, 2526, 1491, 926, 1308, 65535, 1878, 2600, 190, 821, 65535, 872, 1815, 65535, 2655, 1847,
+		620, 2042, 526, 70, 65535, 65535, 65535, 169, 65535, 1301, 65535, 65535, 65535, 2104, 65535, 842,
+		170, 1599, 1312, 1306, 126, 65535, 2756, 65535, 350, 802, 65535, 65535, 283, 65535, 599, 59,
+		1778, 38, 1140, 71, 2539, 2014, 65535, 1189, 1175, 800, 65535, 366, 65535, 2329, 326, 1877,
+		1504, 65535, 2186, 65535, 1230, 65535, 1600, 1170, 2388, 65535, 65535, 65535, 1721, 900, 65535, 2584,
+		223, 65535, 2730, 377, 1147, 182, 673, 798, 134, 1421, 65535, 65535, 65535, 1787, 65535, 2596,
+		65535, 65535, 65535, 495, 820, 1960, 65535, 1868, 391, 960, 65535, 65535, 2483, 1271, 65535, 257,
+		2422, 65535, 157, 1678, 1410, 634, 1392, 1685, 65535, 376, 65535, 2031, 1110, 65535, 1743, 2090,
+		2350, 1609, 65535, 1277, 382, 73, 2671, 65535, 874, 1003, 65535, 65535, 1361, 1714, 65535, 1832,
+		375, 65535, 65535, 968, 145, 1859, 1181, 2457, 65535, 65535, 1758, 65535, 2295, 1985, 65535, 1646,
+		65535, 864, 1231, 65535, 2001, 65535, 2317, 65535, 65535, 65535, 1994, 1359, 2213, 2351, 211, 1697,
+		1945, 65535, 65535, 590, 2536, 1343, 778, 440, 2156, 1534, 1613, 1925, 1002, 1456, 1731, 1948,
+		65535, 385, 1730, 2838, 65535, 1738, 2095, 1448, 2820, 65535, 351, 2749, 868, 65535, 386, 1078,
+		65535, 2114, 1805, 470, 65535, 65535, 2762, 444, 2794, 540, 329, 65535, 824, 1998, 1173, 2101,
+		315, 2489, 65535, 2780, 65535, 65535, 112, 352, 2222, 2002, 2772, 308, 65535, 185, 469, 2283,
+		1065, 1226, 1310, 40, 65535, 2392, 65535, 588, 1644, 2415, 552, 1169, 2400, 1201, 65535, 794,
+		65535, 2006, 65535, 2150, 2451, 1824, 1610, 789, 395, 1908, 1961, 699, 65535, 2315, 65535, 1537,
+		612, 2254, 483, 1475, 65535, 1124, 2473, 753, 305, 2321, 65535, 1245, 65535, 65535, 267, 263,
+		957, 812, 105, 1748, 1034, 65535, 65535, 198, 513, 1295, 65535, 659, 2051, 65535, 1532, 1997,
+		2065, 2191, 65535, 1764, 1788, 65535, 1073, 1669, 2572, 65535, 2416, 65535, 1239, 1215, 2769, 2801,
+		320, 2827, 2754, 65535, 1194, 224, 2041, 65535, 1762, 65535, 65535, 113, 500, 65535, 419, 2752,
+		65535, 65535, 1097, 65535, 2352, 2111, 65535, 2432, 1178, 2761, 1928, 1179, 504, 95, 393, 1615,
+		65535, 636, 65535, 65535, 2435, 2678, 65535, 65535, 837, 65535, 65535, 2741, 2616, 1342, 191, 65535,
+		465, 310, 65535, 65535, 1187, 950, 65535, 65535, 65535, 65535, 50, 1932, 1044, 276, 768, 14,
+		65535, 387, 111, 1112, 65535, 65535, 1262, 2461, 65535, 1827, 65535, 1880, 65535, 65535, 65535, 65535,
+		1798, 1597, 1986, 2421, 364, 65535, 514, 685, 2438, 65535, 65535, 1154, 2810, 390, 339, 1354,
+		2178, 2232, 2714, 65535, 813, 905, 65535, 65535, 65535, 972, 65535, 65535, 759, 166, 65535, 1620,
+		52, 994, 370, 65535, 1911, 1142, 1966, 65535, 65535, 65535, 65535, 551, 1602, 65535, 65535, 2511,
+		2224, 2595, 1166, 65535, 740, 65535, 65535, 641, 1535, 143, 65535, 65535, 252, 2387, 262, 65535,
+		2107, 1280, 189, 836, 65535, 65535, 65535, 2664, 1397, 2250, 1836, 1401, 2835, 65535, 1305, 997,
+		1897, 123, 439, 871, 65535, 2013, 247, 1012, 1319, 2353, 65535, 2377, 2734, 65535, 589, 88,
+		2085, 65535, 2337, 1494, 1754, 1950, 700, 65535, 441, 1583, 65535, 1691, 1831, 65535, 2747, 1010,
+		65535, 1545, 1024, 2811, 397, 1049, 662, 2733, 2082, 2401, 1445, 65535, 65535, 2670, 65535, 2464,
+		1851, 1954, 2739, 65535, 65535, 2540, 65535, 2230, 2565, 1076, 1272, 522, 1808, 2155, 1030, 2102,
+		65535, 1313, 1113, 65535, 1435, 65535, 65535, 65535, 2782, 626, 1818, 65535, 159, 65535, 65535, 2713,
+		1382, 65535, 65535, 2357, 616, 725, 1332, 687, 1289, 487, 1689, 2667, 1946, 2151, 65535, 343,
+		1158, 2355, 65535, 2414, 979, 2745, 1687, 65535, 65535, 1912, 2372, 2181, 65535, 1793, 891, 86,
+		238, 156, 1771, 65535, 408, 1784, 2365, 65535, 801, 65535, 1614, 93, 980, 1089, 378, 2304,
+		65535, 2383, 65535, 207, 121, 2094, 65535, 2630, 2620, 65535, 65535, 65535, 553, 1821, 932, 1223,
+		411, 65535, 65535, 65535, 1285, 2108, 65535, 65535, 1549, 1796, 65535, 65535, 823, 1053, 2477, 1068,
+		1374, 1337, 1579, 65535, 991, 65535, 2531, 65535, 2184, 65535, 1779, 65535, 1910, 65535, 2218, 857,
+		144, 1478, 114, 2750, 1974, 896, 1454, 1527, 195, 1470, 2547, 1755, 584, 65535, 519, 1138,
+		139, 1753, 2716, 675, 2553, 65535, 1839, 220, 2816, 65535, 1064, 1785, 65535, 1611, 703, 2122,
+		1467, 1980, 65535, 2154, 2732, 65535, 2419, 137, 2140, 1134, 65535, 65535, 2830, 579, 2093, 65535,
+		65535, 65535, 1126, 1103, 65535, 327, 1775, 1333, 1701, 65535, 65535, 2237, 1385, 65535, 916, 1367,
+		1822, 484, 65535, 1018, 2281, 65535, 1595, 1630, 934, 2806, 65535, 1901, 65535, 2597, 677, 1612,
+		65535, 65535, 747, 65535, 235, 2134, 832, 65535, 1383, 65535, 2046, 65535, 2249, 1789, 65535, 65535,
+		2488, 1369, 56, 1650, 2053, 65535, 1772, 65535, 554, 97, 1079, 2203, 65535, 65535, 65535, 65535,
+		2290, 404, 1426, 65535, 763, 1598, 127, 591, 373, 293, 1228, 1031, 2361, 297, 65535, 273,
+		84, 564, 1864, 1938, 1050, 65535, 744, 2610, 2162, 65535, 1587, 2567, 2197, 1080, 65535, 1209,
+		648, 358, 729, 65535, 109, 216, 1512, 65535, 354, 2135, 770, 218, 65535, 2037, 184, 250,
+		65535, 515, 147, 65535, 65535, 1101, 1972, 1459, 65535, 2050, 65535, 1749, 1502, 2251, 65535, 65535,
+		2285, 2020, 1699, 1208, 2580, 485, 65535, 420, 1263, 2723, 1930, 1020, 65535, 65535, 2731, 2216,
+		568, 1776, 1898, 1008, 65535, 65535, 65535, 888, 65535, 65535, 285, 150, 65535, 853, 2, 738,
+		523, 65535, 736, 708, 65535, 727, 782, 1462, 2529, 2092, 1109, 1458, 64, 65535, 1741, 861,
+		65535, 65535, 1849, 2447, 2380, 2654, 2366, 341, 65535, 65535, 2394, 65535, 65535, 65535, 65535, 65535,
+		2086, 886, 1395, 379, 2548, 65535, 65535, 65535, 1693, 65535, 829, 49, 2617, 1890, 65535, 65535,
+		65535, 528, 51, 1340, 2091, 65535, 1303, 65535, 65535, 1558, 2814, 914, 1059, 1161, 2058, 1586,
+		1244, 65535, 1261, 1964, 65535, 65535, 2298, 1250, 65535, 65535, 2425, 547, 65535, 65535, 1066, 1705,
+		65535, 65535, 1322, 306, 1106, 65535, 65535, 2760, 1, 1683, 2512, 258, 2239, 586, 172, 65535,
+		286, 712, 1107, 65535, 1688, 671, 574, 2700, 65535, 65535, 1505, 65535, 1871, 367, 702, 1593,
+		65535, 1682, 1408, 65535, 1760, 65535, 2588, 57, 2289, 2161, 576, 2499, 66, 2663, 1128, 1096,
+		2517, 65535, 1723, 65535, 287, 65535, 65535, 511, 1522, 65535, 1118, 1882, 65535, 546, 65535, 65535,
+		1856, 2202, 168, 1214, 1983, 1934, 2720, 1336, 1968, 311, 65535, 65535, 2245, 2413, 2606, 65535,
+		202, 496, 16, 2207, 65535, 65535, 65535, 1936, 940, 65535, 1860, 2694, 23, 2618, 1895, 2210,
+		1951, 65535, 976, 65535, 65535, 2766, 2805, 1867, 65535, 426, 65535, 2420, 1653, 992, 791, 2767,
+		65535, 2807, 1533, 11, 2826, 65535, 2179, 1398, 1744, 1318, 1889, 65535, 1531, 65535, 1711, 65535,
+		65535, 65535, 2679, 1742, 65535, 65535, 65535, 1420, 1095, 2000, 472, 774, 2748, 47, 65535, 1473,
+		1763, 787, 2487, 128, 1365, 318, 1039, 1464, 1790, 682, 65535, 1870, 2077, 885, 2710, 2785,
+		1937, 2118, 1204, 464, 65535, 65535, 65535, 1573, 65535, 680, 1570, 1728, 723, 2744, 577, 887,
+		345, 334, 750, 21, 2429, 65535, 2201, 1326, 676, 65535, 2360, 65535, 509, 2683, 65535, 850,
+		2674, 2693, 65535, 161, 65535, 65535, 1362, 65535, 1476, 65535, 570, 1338, 2639, 1580, 403, 2651,
+		2496, 1490, 65535, 65535, 550, 456, 65535, 65535, 65535, 1707, 2194, 2152, 65535, 65535, 777, 65535,
+		1104, 1970, 1423, 1643, 65535, 784, 65535, 2637, 1608, 2180, 244, 65535, 2305, 1378, 371, 65535,
+		499, 65535, 1906, 65535, 1596, 65535, 575, 65535, 2049, 1881, 65535, 65535, 65535, 1735, 543, 65535,
+		1888, 65535, 1943, 65535, 1530, 897, 998, 65535, 65535, 65535, 806, 2182, 681, 1174, 614, 2120,
+		1695, 2804, 1293, 65535, 65535, 1051, 2088, 695, 1270, 746, 65535, 91, 474, 1345, 2332, 606,
+		2084, 942, 2622, 2005, 2116, 2482, 383, 65535, 1069, 1979, 65535, 2476, 566, 155, 1418, 65535,
+		788, 2668, 2276, 65535, 2594, 1254, 65535, 1057, 65535, 2450, 65535, 7, 303, 1690, 1432, 935,
+		2220, 2149, 775, 65535, 698, 1238, 53, 178, 2675, 1518, 1922, 65535, 1953, 2633, 959, 65535,
+		2459, 65535, 2274, 2396, 457, 477, 65535, 751, 31, 1185, 1605, 1834, 1121, 65535, 65535, 313,
+		818, 2327, 65535, 1543, 65535, 583, 65535, 696, 65535, 65535, 2525, 1641, 65535, 65535, 65535, 1098,
+		2411, 2658, 2316, 2808, 65535, 1589, 1021, 65535, 65535, 1996, 65535, 319, 402, 65535, 2344, 269,
+		2568, 1825, 65535, 2795, 1235, 1516, 1578, 65535, 2682, 2177, 686, 1519, 2376, 2123, 2787, 175,
+		65535, 65535, 666, 65535, 1191, 877, 2389, 2212, 116, 1387, 87, 2243, 679, 2026, 1659, 1924,
+		428, 1540, 1444, 65535, 870, 65535, 35, 323, 65535, 1428, 65535, 2259, 2434, 2291, 2602, 65535,
+		2043, 854, 65535, 828, 65535, 65535, 623, 1125, 65535, 2263, 340, 975, 65535, 2728, 2362, 732,
+		512, 65535, 1542, 119, 281, 1296, 65535, 1674, 1151, 506, 65535, 65535, 876, 65535, 1414, 65535,
+		1862, 1926, 174, 1007, 65535, 1160, 1636, 2345, 1718, 1380, 65535, 621, 492, 65535, 65535, 2490,
+		1752, 2375, 735, 65535, 569, 65535, 1995, 1489, 1297, 65535, 2556, 647, 65535, 1206, 65535, 65535,
+		2613, 1363, 1891, 65535, 65535, 197, 131, 2139, 2017, 1811, 1515, 867, 1637, 769, 65535, 245,
+		65535, 65535, 1307, 1956, 2168, 1582, 65535, 875, 2646, 65535, 65535, 1574, 1975, 1879, 67, 65535,
+		2650, 1981, 2309, 2503, 65535, 2132, 1991, 1959, 1211, 1989, 2587, 151, 225, 1664, 760, 1430,
+		1157, 664, 65535, 65535, 65535, 65535, 2784, 797, 2040, 640, 65535, 2068, 12, 2832, 65535, 1804,
+		2373, 2831, 2215, 1708, 2834, 65535, 2573, 65535, 1469, 1703, 65535, 65535, 2059, 1205, 65535, 259,
+		1455, 1434, 65535, 2544, 2532, 65535, 1594, 284, 65535, 81, 453, 2530, 2478, 2729, 1568, 65535,
+		65535, 810, 2799, 1919, 1539, 1184, 637, 2585, 1528, 65535, 2546, 65535, 656, 2404, 2571, 1133,
+		2688, 742, 1417, 1094, 2083, 65535, 65535, 672, 2062, 65535, 2495, 236, 1212, 1186, 65535, 361,
+		2725, 1405, 943, 1442, 1885, 1814, 65535, 1511, 2395, 858, 1371, 65535, 353, 1988, 1054, 2166,
+		2649, 882, 2445, 809, 650, 65535, 65535, 1999, 1217, 41, 2061, 1086, 65535, 580, 65535, 838,
+		981, 2336, 692, 1329, 65535, 1388, 65535, 65535, 2669, 65535, 65535, 242, 1145, 918, 2056, 65535,
+		65535, 1364, 2096, 2724, 701, 338, 29, 65535, 1886, 65535, 65535, 162, 2777, 1717, 856, 65535,
+		461, 232, 1429, 65535, 129, 65535, 2574, 65535, 65535, 560, 424, 704, 663, 0, 2292, 2561,
+		65535, 2301, 1202, 65535, 65535, 65535, 2314, 291, 65535, 65535, 1284, 2809, 65535, 2080, 65535, 2004,
+		65535, 65535, 65535, 65535, 913, 2339, 473, 558, 1684, 65535, 1747, 65535, 65535, 65535, 1524, 65535,
+		65535, 2793, 368, 2501, 65535, 65535, 840, 65535, 325, 2759, 65535, 2746, 65535, 65535, 55, 1150,
+		468, 65535, 2797, 1377, 627, 1463, 2097, 65535, 54, 610, 1552, 65535, 65535, 65535, 65535, 1227,
+		65535, 1795, 1823, 2072, 65535, 2676, 65535, 65535, 65535, 65535, 1232, 2541, 1350, 1631, 1247, 1386,
+		60, 132, 65535, 65535, 1709, 30, 520, 1038, 65535, 28, 2790, 508, 2506, 2586, 1220, 1396,
+		317, 2117, 1576, 1391, 2015, 2497, 65535, 349, 65535, 1887, 2229, 65535, 65535, 3, 188, 1182,
+		2196, 1257, 1164, 929, 601, 65535, 65535, 1766, 2334, 65535, 65535, 2836, 384, 65535, 65535, 1696,
+		1649, 865, 2653, 348, 1940, 65535, 1415, 2726, 65535, 1267, 450, 65535, 1727, 1013, 489, 996,
+		1011, 65535, 65535, 65535, 1927, 691, 96, 65535, 65535, 2257, 1816, 1159, 2803, 645, 1441, 65535,
+		65535, 65535, 2507, 2528, 2462, 65535, 1665, 2206, 65535, 2718, 1661, 65535, 65535, 1621, 314, 65535,
+		1412, 65535, 65535, 1562, 1321, 1288, 860, 65535, 2311, 2773, 65535, 884, 1550, 2645, 2410, 136,
+		280, 1022, 1099, 446, 2370, 65535, 2417, 958, 2481, 2331, 65535, 2129, 2261, 1375, 1553, 816,
+		1237, 2403, 1962, 2828, 619, 1372, 1571, 2535, 65535, 65535, 72, 757, 65535, 65535, 2552, 65535,
+		65535, 1987, 2173, 1487, 65535, 1565, 1806, 65535, 946, 878, 978, 256, 962, 65535, 65535, 65535,
+		65535, 1015, 1052, 65535, 1058, 90, 2027, 2687, 422, 65535, 2559, 65535, 253, 65535, 1304, 65535,
+		1093, 65535, 65535, 65535, 65535, 1857, 2136, 65535, 65535, 2148, 65535, 1907, 65535, 65535, 101, 2074,
+		65535, 65535, 2007, 418, 2023, 1852, 937, 142, 65535, 912, 1676, 65535, 65535, 2818, 2060, 65535,
+		826, 65535, 65535, 1746, 243, 65535, 65535, 1942, 65535, 65535, 2711, 1172, 65535, 2163, 65535, 1291,
+		783, 1279, 65535, 1745, 65535, 65535, 2279, 883, 1407, 65535, 2052, 1485, 65535, 65535, 65535, 1584,
+		1681, 241, 1265, 851, 65535, 152, 2358, 65535, 2702, 1019, 372, 65535, 2018, 65535, 65535, 1765,
+		2485, 1431, 65535, 1082, 65535, 2009, 2721, 65535, 2044, 1828, 405, 2621, 1655, 752, 65535, 799,
+		1276, 2554, 65535, 1108, 482, 65535, 1841, 1346, 1335, 65535, 2260, 65535, 65535, 1023, 2598, 1330,
+		65535, 65535, 2045, 65535, 65535, 65535, 643, 24, 2712, 2527, 745, 538, 65535, 2815, 65535, 301,
+		2599, 1634, 65535, 65535, 2192, 2236, 65535, 734, 1563, 969, 1203, 2494, 1353, 65535, 65535, 628,
+		2472, 2704, 2099, 65535, 2538, 65535, 1935, 65535, 2318, 2601, 954, 939, 2119, 65535, 65535, 65535,
+		2272, 413, 2582, 2340, 539, 322, 2121, 493, 2449, 65535, 1759, 125, 2763, 65535, 2500, 1139,
+		796, 2143, 65535, 277, 951, 678, 193, 1373, 1976, 1517, 122, 1812, 80, 2703, 205, 65535,
+		2460, 1817, 65535, 462, 65535, 1947, 2515, 65535, 661, 2047, 1225, 65535, 65535, 196, 657, 65535,
+		922, 1146, 947, 186, 605, 1984, 2193, 1016, 65535, 65535, 578, 2465, 544, 2054, 1838, 65535,
+		65535, 65535, 2087, 898, 65535, 2513, 2310, 1091, 65535, 2390, 1671, 2418, 2774, 1704, 1820, 1299,
+		65535, 2677, 65535, 548, 65535, 904, 2519, 724, 1503, 65535, 2402, 609, 2626, 1845, 2578, 2081,
+		1588, 65535, 120, 1100, 1627, 100, 2266, 92, 65535, 2183, 990, 2244, 541, 135, 65535, 65535,
+		1447, 65535, 1043, 65535, 1315, 1309, 1557, 2579, 1712, 65535, 1923, 65535, 974, 2440, 2338, 65535,
+		65535, 649, 2242, 1920, 6, 98, 74, 2189, 1000, 1603, 1148, 65535, 2492, 1773, 65535, 65535,
+		149, 65535, 2408, 1662, 1259, 1197, 730, 65535, 466, 65535, 43, 2736, 1466, 1402, 1967, 2775,
+		600, 517, 65535, 65535, 65535, 1677, 65535, 795, 1638, 2474, 720, 1136, 65535, 754, 2032, 65535,
+		65535, 65535, 1381, 917, 2453, 2642, 1273, 2740, 2557, 65535, 2364, 401, 255, 945, 2306, 1566,
+		65535, 2822, 1366, 333, 2100, 2169, 65535, 728, 1352, 65535, 973, 65535, 2369, 65535, 65535, 1127,
+		2463, 65535, 2627, 521, 249, 2605, 65535, 171, 2142, 2228, 1131, 65535, 65535, 65535, 2592, 2624,
+		438, 2441, 65535, 65535, 2604, 995, 65535, 2641, 1446, 158, 1419, 1781, 1188, 398, 2576, 65535,
+		365, 1422, 421, 27, 651, 603, 65535, 2717, 1320, 2225, 65535, 1739, 58, 65535, 1782, 65535,
+		2796, 1132, 608, 2735, 2379, 13, 2549, 65535, 1581, 167, 65535, 964, 625, 65535, 2484, 2652,
+		65535, 65535, 138, 65535, 65535, 452, 65535, 65535, 764, 2296, 895, 1872, 1198, 2647, 2367, 2673,
+		693, 1439, 1193, 2029, 1233, 65535, 65535, 65535, 65535, 2699, 65535, 1569, 65535, 694, 1561, 1192,
+		1652, 2523, 1144, 65535, 927, 65535, 65535, 1242, 65535, 65535, 1260, 923, 2577, 65535, 270, 948,
+		65535, 825, 1041, 65535, 2106, 65535, 65535, 347, 65535, 1648, 1710, 65535, 1548, 65535, 65535, 2467,
+		722, 2680, 2323, 1874, 2751, 65535, 65535, 407, 2021, 65535, 1167, 65535, 65535, 1777, 2363, 1702,
+		65535, 65535, 65535, 65535, 706, 65535, 65535, 39, 737, 2609, 65535, 2240, 153, 65535, 65535, 924,
+		65535, 65535, 65535, 65535, 65535, 65535, 65535, 565, 65535, 65535, 148, 2346, 2722, 65535, 65535, 65535,
+		1521, 1425, 65535, 65535, 713, 2003, 1861, 65535, 357, 2737, 65535, 970, 1403, 2456, 1334, 604,
+		629, 2349, 65535, 65535, 65535, 1734, 987, 1572, 1963, 1918, 65535, 2048, 2455, 1358, 2498, 2518,
+		1443, 2619, 866, 65535, 2424, 176, 65535, 65535, 689, 65535, 65535, 1737, 1074, 1774, 654, 65535,
+		389, 103, 65535, 2570, 65535, 65535, 1317, 65535, 2672, 65535, 902, 1486, 2226, 173, 2319, 1394,
+		780, 1090, 2267, 65535, 1255, 359, 956, 2307, 1004, 1514, 2514, 2802, 594, 2066, 65535, 449,
+		1837, 1633, 2783, 65535, 1493, 1797, 65535, 1884, 2022, 1900, 65535, 1982, 65535, 674, 83, 65535,
+		65535, 1413, 2625, 660, 1865, 2412, 2635, 65535, 183, 406, 62, 454, 65535, 2208, 65535, 271,
+		1756, 369, 819, 231, 1207, 2427, 805, 65535, 2636, 1668, 965, 1424, 1457, 1625, 2715, 65535,
+		360, 65535, 1092, 1846, 1200, 733, 1626, 65535, 455, 2443, 1171, 611, 1692, 1409, 65535, 65535,
+		822, 936, 1724, 1249, 65535, 2144, 5, 1163, 65535, 65535, 65535, 803, 65535, 2172, 863, 1770,
+		488, 65535, 65535, 1081, 266, 1311, 65535, 337, 65535, 201, 2812, 65535, 2302, 217, 1102, 890,
+		124, 1290, 429, 2686, 1840, 613, 65535, 65535, 215, 65535, 963, 949, 1513, 749, 597, 767,
+		442, 65535, 65535, 65535, 2698, 312, 65535, 1592, 65535, 2813, 65535, 2025, 1916, 1324, 342, 288,
+		65535, 65535, 2269, 2776, 2405, 324, 1477, 229, 69, 1256, 1153, 246, 65535, 1555, 65535, 711,
+		335, 65535, 279, 65535, 2313, 2008, 65535, 65535, 2558, 2638, 2406, 2448, 476, 65535, 65535, 302,
+		42, 781, 1501, 208, 65535, 65535, 2019, 65535, 585, 240, 65535, 491, 1411, 811, 65535, 536,
+		65535, 65535, 1116, 82, 1461, 893, 1440, 65535, 1400, 2437, 617, 1952, 1529, 65535, 1357, 1616,
+		1436, 346, 1559, 1673, 106, 2778, 833, 839, 2133, 65535, 65535, 65535, 65535, 65535, 2160, 65535,
+		65535, 2036, 65535, 65535, 22, 1236, 290, 2508, 1005, 2659, 65535, 2468, 65535, 65535, 790, 99,
+		1083, 1222, 177, 1892, 65535, 715, 1495, 65535, 1780, 1152, 356, 1629, 65535, 65535, 65535, 65535,
+		1725, 388, 1554, 1077, 1252, 1909, 65535, 2354, 181, 65535, 2247, 1368, 1538, 65535, 480, 2431,
+		433, 434, 2516, 65535, 1177, 2089, 65535, 65535, 65535, 739, 2705, 2522, 1061, 2798, 2303, 409,
+		2356, 1302, 1453, 1993, 602, 65535, 1331, 537, 2265, 394, 65535, 1438, 65535, 2335, 65535, 77,
+		1794, 65535, 65535, 2038, 1314, 1640, 45, 65535, 65535, 1433, 1216, 1949, 65535, 567, 332, 2743,
+		1899, 2591, 2685, 146, 1863, 2719, 1328, 1033, 65535, 901, 2109, 1399, 65535, 1523, 65535, 2342,
+		65535, 1896, 79, 479, 4, 65535, 65535, 65535, 1716, 2758, 65535, 1347, 2480, 1176, 1468, 65535,
+		68, 65535, 1647, 210, 1026, 187, 65535, 65535, 1123, 1122, 2067, 2707, 65535, 1726, 65535, 2660,
+		65535, 1274, 447, 300, 1848, 1452, 2190, 2701, 909, 65535, 2452, 2125, 65535, 328, 1286, 268,
+		1416, 46, 638, 65535, 2241, 65535, 230, 2078, 773, 1292, 2158, 697, 65535, 2198, 1282, 65535,
+		2145, 1055, 65535, 2308, 1070, 1639, 928, 2708, 65535, 2442, 1465, 1713, 2165, 2262, 65535, 1130,
+		65535, 65535, 254, 65535, 1507, 65535, 65535, 1032, 451, 1732, 555, 65535, 669, 65535, 1761, 2681,
+		363, 192, 65535, 2280, 2399, 2371, 65535, 65535, 65535, 1618, 65535, 65535, 65535, 2446, 65535, 400,
+		563, 1268, 65535, 1939, 1376, 265, 1427, 721, 1883, 967, 1965, 761, 2126, 304, 65535, 2322,
+		65535, 65535, 410, 65535, 65535, 1619, 1740, 849, 65535, 582, 755, 2079, 518, 65535, 65535, 1792,
+		65535, 2550, 467, 1072, 1706, 632, 2115, 2064, 65535, 289, 65535, 65535, 1921, 915, 26, 2277,
+		731, 65535, 843, 65535, 2384, 65535, 275, 766, 2138, 65535, 1017, 507, 1751, 982, 65535, 2368,
+		65535, 1253, 2185, 65535, 65535, 65535, 65535, 1955, 309, 2603, 392, 1283, 15, 644, 1143, 1869,
+		2343, 1060, 1048, 307, 65535, 1628, 1799, 1269, 1451, 1894, 844, 65535, 2542, 65535, 65535, 65535,
+		65535, 1826, 65535, 65535, 869, 486, 658, 815, 65535, 717, 65535, 94, 834, 65535, 65535, 1287,
+		2409, 1809, 65535, 1933, 1654, 1866, 2234, 2643, 65535, 955, 65535, 65535, 2398, 944, 65535, 65535,
+		1520, 65535, 65535, 2563, 1213, 2071, 2055, 1500, 1111, 65535, 2063, 1393, 65535, 709, 1379, 1484,
+	};
+
+	inline uint32_t Mix(uint32_t key, uint32_t seed)
+	{
+		uint32_t h = (key ^ seed) * 0x9E3779B1u;
+		h ^= h >> 15;
+		h *= 0x85EBCA77u;
+		return h >> (32 - SlotBits);
+	}
+
+	// index into ms_aHashes, -1 for hashes that aren't natives
+	inline int32_t FindIndex(uint32_t nHash)
+	{
+		uint16_t index = ms_aSlots[Mix(nHash, ms_aSeeds[nHash % NumBuckets])];
+		if (index == 0xFFFF || ms_aHashes[index] != nHash) return -1;
+		return index;
+	}
+}
@@ -1,4 +1,9 @@
 // native calling code by aru, slightly modified to fit
+#include <utility>
+#include <type_traits>
+#include <cstring>
+#include "NativeIndex.h"
+#include "NativeProfiler.h"
 
 class IVNativeCallContext
 {
@@ -15,7 +20,7 @@ VALIDATE_OFFSET(IVNativeCallContext, m_TemporaryData, 0x20);
 
 class NativeContext : public IVNativeCallContext
 {
-private:
+public:
 	// Configuration
 	enum
 	{
@@ -23,9 +28,36 @@ private:
 		ArgSize = 4,
 	};
 
+private:
 	// Anything temporary that we need
 	unsigned char m_TempStack[MaxNativeParams * ArgSize];
 
+	template <unsigned int Index, typename T>
+	inline void SetArgument(T value)
+	{
+		static_assert(Index < MaxNativeParams, "Natives can't take more than 16 arguments");
+		static_assert(sizeof(T) <= ArgSize, "Native arguments can't be bigger than 4 bytes, pass vectors as x, y, z or by pointer");
+
+		WriteSlot(m_TempStack + ArgSize * Index, value);
+	}
+
+	// Arguments smaller than a slot are widened with the rest of the slot zeroed. Both go through memcpy,
+	// writing the zero as an unsigned int and then the value as a bool or short lets an optimiser that assumes
+	// strict aliasing drop the zeroing, and the native then reads whatever the slot held before
+	template <typename T>
+	static inline void WriteSlot(unsigned char* pSlot, T value)
+	{
+		unsigned int uiSlot = 0;
+		memcpy(&uiSlot, &value, sizeof(T));
+		memcpy(pSlot, &uiSlot, ArgSize);
+	}
+
+	template <typename... Args, size_t... Indices>
+	inline void SetArguments(std::index_sequence<Indices...>, Args... args)
+	{
+		(SetArgument<Indices>(args), ...);
+	}
+
 public:
 	inline NativeContext()
 	{
@@ -37,9 +69,13 @@ public:
 		m_nDataCount = 0;
 	}
 
+	// Used when building a context by hand for NativeInvoke::Invoke2,
+	// NativeInvoke::Invoke lays its arguments out at compile time instead
 	template <typename T>
 	inline void Push(T value)
 	{
+		static_assert(sizeof(T) <= ArgSize, "Native arguments can't be bigger than 4 bytes, pass vectors as x, y, z or by pointer");
+
 		// Have we reached our argument count?
 		if (m_nArgCount == MaxNativeParams)
 		{
@@ -47,29 +83,26 @@ public:
 			return;
 		}
 
-		// Is the argument too big?
-		if (sizeof(T) > ArgSize)
-		{
-			// We only accept 4 byte or less arguments
-			return;
-		}
-		else if (sizeof(T) < ArgSize) // Is the argument too small?
-		{
-			// Reset the argument data
-			*(unsigned int*)(m_TempStack + ArgSize * m_nArgCount) = 0;
-		}
-
-		// Add to argument to the argument stack
-		*(T*)(m_TempStack + ArgSize * m_nArgCount) = value;
+		// Add to argument to the argument stack, zero extended if it's too small
+		WriteSlot(m_TempStack + ArgSize * m_nArgCount, value);
 
 		// Increment the total argument count
 		m_nArgCount++;
 	}
 
-	template <typename T>
-	inline T GetResult()
+	// Replaces whatever was pushed with the whole argument list in one go
+	template <typename... Args>
+	inline void PushArguments(Args... args)
+	{
+		static_assert(sizeof...(Args) <= MaxNativeParams, "Natives can't take more than 16 arguments");
+
+		SetArguments(std::index_sequence_for<Args...>(), args...);
+		m_nArgCount = sizeof...(Args);
+	}
+
+	// Copy back any vector results the native wrote to the temporary data
+	inline void CopyBackVectors()
 	{
-		// Copy back any vector results
 		while (m_nDataCount > 0)
 		{
 			m_nDataCount--;
@@ -79,10 +112,21 @@ public:
 			pVec3->y = pVec4->y;
 			pVec3->z = pVec4->z;
 		}
+	}
 
+	template <typename T>
+	inline T GetReturnValue()
+	{
 		return *(T*)m_TempStack;
 	}
 
+	template <typename T>
+	inline T GetResult()
+	{
+		CopyBackVectors();
+		return GetReturnValue<T>();
+	}
+
 	template<typename T>
 	inline T GetArgument(size_t idx)
 	{
@@ -116,11 +160,36 @@ class NativeInvoke
 private:
 	typedef void(_cdecl* NativeCall)(IVNativeCallContext* pNativeContext);
 
+	// Resolved natives, one slot per native in NativeHashes.h at the index NativeNames::FindIndex
+	// gives it, so only the first call of each native goes through CTheScripts::FindNativeAddress
+	static inline NativeCall ms_aNativeCache[NativeNames::NumNatives];
+
+	static NativeCall GetNative(unsigned int uiHash)
+	{
+		int iIndex = NativeNames::FindIndex(uiHash);
+		if (iIndex < 0)
+		{
+			// Not in NativeHashes.h, there's no slot to keep it in
+			return (NativeCall)CTheScripts::FindNativeAddress(uiHash);
+		}
+
+		NativeCall& pFunc = ms_aNativeCache[iIndex];
+		if (pFunc == NULL)
+		{
+			// Failed lookups aren't cached, the native table might not be filled yet
+			pFunc = (NativeCall)CTheScripts::FindNativeAddress(uiHash);
+		}
+		return pFunc;
+	}
+
 	static bool Invoke(unsigned int uiHash, IVNativeCallContext* pNativeContext)
 	{
-		auto NativeFunc = (NativeCall)CTheScripts::FindNativeAddress(uiHash);
+		auto NativeFunc = GetNative(uiHash);
 		if (NativeFunc != NULL)
 		{
+#ifdef IVSDK_NATIVE_PROFILER
+			NativeProfiler::ScopedCall profile(uiHash);
+#endif
 			NativeFunc(pNativeContext);
 			return true;
 		}
@@ -128,310 +197,77 @@ private:
 	}
 
 public:
-	static inline void Invoke2(NativeContext* cxt, uint32_t Hash)
-	{
-		Invoke(Hash, cxt);
-	}
-
-	template <typename R>
-	static inline R Invoke(uint32_t hash)
-	{
-		NativeContext cxt;
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1>
-	static inline R Invoke(uint32_t hash, T1 p1)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2>
-	static inline R Invoke(uint32_t hash, T1 p1, T2 p2)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3>
-	static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4>
-	static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10, typename T11>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10, T11 p11)
+	// Resolves a list of natives up front, e.g. from gameLoadEvent, so the first call
+	// of each doesn't pay for the lookup. Returns how many of them were found
+	static unsigned int Preload(const unsigned int* pHashes, unsigned int uiCount)
 	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		cxt.Push(p11);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
+		unsigned int uiFound = 0;
+		for (unsigned int i = 0; i < uiCount; i++)
+		{
+			if (GetNative(pHashes[i]) != NULL)
+			{
+				uiFound++;
+			}
+		}
+		return uiFound;
 	}
 
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10, typename T11, typename T12>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10, T11 p11, T12 p12)
+	static inline void Invoke2(NativeContext* cxt, uint32_t Hash)
 	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		cxt.Push(p11);
-		cxt.Push(p12);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
+		Invoke(Hash, cxt);
 	}
 
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10, typename T11, typename T12, typename T13>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10, T11 p11, T12 p12, T13 p13)
-	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		cxt.Push(p11);
-		cxt.Push(p12);
-		cxt.Push(p13);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
+	// Only pointers to non-scalar types (Vector3*, CVector*) can be vector out parameters,
+	// natives without any skip the copy back entirely
+	template <typename... Args>
+	static constexpr bool HasVectorArgument = ((std::is_pointer_v<Args> && !std::is_arithmetic_v<std::remove_pointer_t<Args>>) || ...);
 
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10, typename T11, typename T12, typename T13, typename T14>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10, T11 p11, T12 p12, T13 p13, T14 p14)
+	template <typename R, typename... Args>
+	static inline R Invoke(uint32_t hash, Args... args)
 	{
 		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		cxt.Push(p11);
-		cxt.Push(p12);
-		cxt.Push(p13);
-		cxt.Push(p14);
+		cxt.PushArguments(args...);
 		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
+		if constexpr (HasVectorArgument<Args...>)
+		{
+			cxt.CopyBackVectors();
+		}
+		return cxt.GetReturnValue<R>();
 	}
 
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10, typename T11, typename T12, typename T13, typename T14,
-		typename T15>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10, T11 p11, T12 p12, T13 p13, T14 p14, T15 p15)
+	// Calls one native for every handle in pHandles, the handle is passed as the first argument
+	// followed by args. One context and one native lookup are shared by the whole batch.
+	// pResults receives one return value per handle, pass nullptr when they aren't needed.
+	// Returns false without calling anything if the native couldn't be resolved
+	template <typename R, typename H, typename... Args>
+	static inline bool InvokeBatch(uint32_t hash, const H* pHandles, unsigned int uiCount, R* pResults, Args... args)
 	{
-		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		cxt.Push(p11);
-		cxt.Push(p12);
-		cxt.Push(p13);
-		cxt.Push(p14);
-		cxt.Push(p15);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
-	}
-
+		auto NativeFunc = GetNative(hash);
+		if (NativeFunc == NULL)
+		{
+			return false;
+		}
 
-	template <typename R, typename T1, typename T2, typename T3, typename T4,
-		typename T5, typename T6, typename T7, typename T8, typename T9,
-		typename T10, typename T11, typename T12, typename T13, typename T14,
-		typename T15, typename T16>
-		static inline R Invoke(uint32_t hash, T1 p1, T2 p2, T3 p3, T4 p4, T5 p5, T6 p6, T7 p7, T8 p8,
-			T9 p9, T10 p10, T11 p11, T12 p12, T13 p13, T14 p14, T15 p15, T16 p16)
-	{
 		NativeContext cxt;
-		cxt.Push(p1);
-		cxt.Push(p2);
-		cxt.Push(p3);
-		cxt.Push(p4);
-		cxt.Push(p5);
-		cxt.Push(p6);
-		cxt.Push(p7);
-		cxt.Push(p8);
-		cxt.Push(p9);
-		cxt.Push(p10);
-		cxt.Push(p11);
-		cxt.Push(p12);
-		cxt.Push(p13);
-		cxt.Push(p14);
-		cxt.Push(p15);
-		cxt.Push(p16);
-		Invoke(hash, &cxt);
-		return cxt.GetResult<R>();
+		for (unsigned int i = 0; i < uiCount; i++)
+		{
+			// The return value shares the argument stack, so every argument is written again
+			cxt.PushArguments(pHandles[i], args...);
+			{
+#ifdef IVSDK_NATIVE_PROFILER
+				NativeProfiler::ScopedCall profile(hash);
+#endif
+				NativeFunc(&cxt);
+			}
+			if constexpr (HasVectorArgument<Args...>)
+			{
+				cxt.CopyBackVectors();
+			}
+			if (pResults)
+			{
+				pResults[i] = cxt.GetReturnValue<R>();
+			}
+		}
+		return true;
 	}
 };
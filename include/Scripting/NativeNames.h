@@ -0,0 +1,5731 @@
+// generated by tools/gen_native_names.py from NativeHashes.h and BaseScripting.h, don't edit by hand
+// hash -> name and argument count for every native, for logging, profiling and debugging
+// Scripting.h doesn't pull this in, include Scripting/NativeNames.h where you need it
+#pragma once
+#include "NativeIndex.h"
+
+namespace NativeNames
+{
+	enum
+	{
+		UnknownArgs = 0xFF,	// no wrapper in BaseScripting.h to count them from
+	};
+
+	struct tNativeInfo
+	{
+		uint16_t m_nNameOffset;
+		uint8_t m_nNamePool;
+		uint8_t m_nArgs;
+	};
+
+	// same order as ms_aHashes
+	inline const tNativeInfo ms_aNatives[NumNatives] =
+	{
+		{ 0, 0, 0 },	// 0x00031EC6
+		{ 29, 0, 255 },	// 0x000A1FCE
+		{ 59, 0, 3 },	// 0x00132487
+		{ 89, 0, 4 },	// 0x001954A2
+		{ 120, 0, 1 },	// 0x001B1E5A
+		{ 156, 0, 2 },	// 0x003A7647
+		{ 179, 0, 1 },	// 0x003B6B13
+		{ 208, 0, 255 },	// 0x00541084
+		{ 241, 0, 2 },	// 0x005868E2
+		{ 263, 0, 1 },	// 0x00710A49
+		{ 281, 0, 0 },	// 0x00746EDF
+		{ 307, 0, 255 },	// 0x008932D3
+		{ 331, 0, 6 },	// 0x008A2256
+		{ 352, 0, 255 },	// 0x009641EE
+		{ 391, 0, 1 },	// 0x00C87FB8
+		{ 409, 0, 1 },	// 0x00FA0E33
+		{ 440, 0, 4 },	// 0x00FD3647
+		{ 487, 0, 1 },	// 0x010C7044
+		{ 521, 0, 2 },	// 0x01181CA3
+		{ 559, 0, 2 },	// 0x011D360D
+		{ 589, 0, 255 },	// 0x013C1EB7
+		{ 610, 0, 1 },	// 0x01473ACB
+		{ 630, 0, 6 },	// 0x014F234F
+		{ 657, 0, 0 },	// 0x015F4F3E
+		{ 676, 0, 1 },	// 0x01651FBA
+		{ 715, 0, 1 },	// 0x016C1B04
+		{ 735, 0, 2 },	// 0x016C37CD
+		{ 758, 0, 3 },	// 0x01794A3C
+		{ 779, 0, 11 },	// 0x01795753
+		{ 812, 0, 2 },	// 0x01820DAA
+		{ 836, 0, 6 },	// 0x01866CB5
+		{ 866, 0, 0 },	// 0x018A0EE0
+		{ 893, 0, 1 },	// 0x018B2055
+		{ 915, 0, 1 },	// 0x018C4131
+		{ 948, 0, 6 },	// 0x019A0068
+		{ 968, 0, 255 },	// 0x01A05ADD
+		{ 995, 0, 3 },	// 0x01A75F0C
+		{ 1018, 0, 2 },	// 0x01C21158
+		{ 1042, 0, 1 },	// 0x01C51E90
+		{ 1067, 0, 2 },	// 0x01E33E33
+		{ 1102, 0, 255 },	// 0x01F35F5C
+		{ 1130, 0, 2 },	// 0x01F8116C
+		{ 1154, 0, 1 },	// 0x01FF6618
+		{ 1186, 0, 1 },	// 0x020106D6
+		{ 1203, 0, 1 },	// 0x02033258
+		{ 1231, 0, 7 },	// 0x020E0318
+		{ 1276, 0, 1 },	// 0x022B2DA9
+		{ 1291, 0, 2 },	// 0x02326335
+		{ 1314, 0, 2 },	// 0x024859B5
+		{ 1329, 0, 255 },	// 0x02491769
+		{ 1369, 0, 1 },	// 0x024C3A6C
+		{ 1394, 0, 9 },	// 0x02534709
+		{ 1420, 0, 2 },	// 0x025D2170
+		{ 1448, 0, 2 },	// 0x0273134E
+		{ 1492, 0, 3 },	// 0x02794E6B
+		{ 1525, 0, 2 },	// 0x028227F7
+		{ 1548, 0, 1 },	// 0x02A235D0
+		{ 1573, 0, 2 },	// 0x02A57428
+		{ 1596, 0, 255 },	// 0x02BE2D97
+		{ 1625, 0, 2 },	// 0x02C069E5
+		{ 1640, 0, 2 },	// 0x02D13D06
+		{ 1656, 0, 2 },	// 0x02E93A3E
+		{ 1679, 0, 255 },	// 0x02F65CB2
+		{ 1715, 0, 14 },	// 0x030E0224
+		{ 1748, 0, 1 },	// 0x03102FEE
+		{ 1782, 0, 255 },	// 0x031D740F
+		{ 1811, 0, 1 },	// 0x032F24CB
+		{ 1837, 0, 1 },	// 0x032F729B
+		{ 1865, 0, 2 },	// 0x033B52CA
+		{ 1891, 0, 1 },	// 0x0348074B
+		{ 1915, 0, 3 },	// 0x035261C6
+		{ 1960, 0, 1 },	// 0x03622640
+		{ 1987, 0, 2 },	// 0x0365042F
+		{ 2023, 0, 255 },	// 0x03665B8D
+		{ 2047, 0, 0 },	// 0x03893A3A
+		{ 2070, 0, 2 },	// 0x038A7526
+		{ 2088, 0, 3 },	// 0x03A01B12
+		{ 2108, 0, 9 },	// 0x03A01F39
+		{ 2129, 0, 0 },	// 0x03AC3097
+		{ 2147, 0, 1 },	// 0x03B12ED0
+		{ 2186, 0, 1 },	// 0x03B13377
+		{ 2205, 0, 3 },	// 0x03B37165
+		{ 2243, 0, 1 },	// 0x03BA036B
+		{ 2268, 0, 255 },	// 0x03CA3302
+		{ 2317, 0, 2 },	// 0x03D16145
+		{ 2330, 0, 3 },	// 0x03D916E4
+		{ 2347, 0, 4 },	// 0x03E90416
+		{ 2367, 0, 6 },	// 0x03EE5F1C
+		{ 2381, 0, 0 },	// 0x03F90052
+		{ 2413, 0, 2 },	// 0x03FB6DED
+		{ 2435, 0, 4 },	// 0x040A0537
+		{ 2471, 0, 0 },	// 0x04161E66
+		{ 2493, 0, 1 },	// 0x041D045B
+		{ 2515, 0, 255 },	// 0x04261E4C
+		{ 2545, 0, 8 },	// 0x0437222B
+		{ 2570, 0, 0 },	// 0x043C3B0B
+		{ 2608, 0, 4 },	// 0x04485574
+		{ 2634, 0, 2 },	// 0x046A4720
+		{ 2648, 0, 255 },	// 0x04783029
+		{ 2673, 0, 0 },	// 0x047B0898
+		{ 2692, 0, 255 },	// 0x047D3BD6
+		{ 2728, 0, 1 },	// 0x04804149
+		{ 2768, 0, 6 },	// 0x04962F82
+		{ 2793, 0, 1 },	// 0x049D23F9
+		{ 2810, 0, 0 },	// 0x04C65BEB
+		{ 2839, 0, 2 },	// 0x04C85E23
+		{ 2856, 0, 2 },	// 0x04CF0105
+		{ 2873, 0, 255 },	// 0x04D623FF
+		{ 2908, 0, 1 },	// 0x04D72200
+		{ 2926, 0, 0 },	// 0x04E11812
+		{ 2955, 0, 255 },	// 0x04F12617
+		{ 2972, 0, 2 },	// 0x04F567FB
+		{ 2992, 0, 6 },	// 0x04F72E4C
+		{ 3019, 0, 1 },	// 0x04FE5C34
+		{ 3047, 0, 4 },	// 0x04FF3F49
+		{ 3063, 0, 1 },	// 0x051742D5
+		{ 3088, 0, 0 },	// 0x051A131D
+		{ 3110, 0, 255 },	// 0x05267B97
+		{ 3145, 0, 255 },	// 0x052803D0
+		{ 3198, 0, 1 },	// 0x052A30F7
+		{ 3215, 0, 3 },	// 0x056314A9
+		{ 3249, 0, 1 },	// 0x05745ACA
+		{ 3268, 0, 1 },	// 0x05766DDE
+		{ 3294, 0, 2 },	// 0x057A3AC7
+		{ 3311, 0, 1 },	// 0x05801768
+		{ 3332, 0, 2 },	// 0x0580462A
+		{ 3353, 0, 3 },	// 0x05966824
+		{ 3376, 0, 2 },	// 0x059901B9
+		{ 3403, 0, 255 },	// 0x059E3BEB
+		{ 3433, 0, 3 },	// 0x05AD758A
+		{ 3453, 0, 2 },	// 0x05B2442A
+		{ 3472, 0, 2 },	// 0x05C619D7
+		{ 3498, 0, 2 },	// 0x05C87C26
+		{ 3512, 0, 2 },	// 0x05CC3DA1
+		{ 3552, 0, 255 },	// 0x05D51783
+		{ 3581, 0, 3 },	// 0x05D70FE8
+		{ 3611, 0, 2 },	// 0x05D800A4
+		{ 3635, 0, 1 },	// 0x060669FE
+		{ 3657, 0, 1 },	// 0x06136B6A
+		{ 3681, 0, 2 },	// 0x061A75D3
+		{ 3713, 0, 1 },	// 0x061D4B5F
+		{ 3717, 0, 255 },	// 0x06285788
+		{ 3735, 0, 255 },	// 0x062A507A
+		{ 3763, 0, 2 },	// 0x062E0076
+		{ 3790, 0, 3 },	// 0x06441EAF
+		{ 3808, 0, 1 },	// 0x064621F1
+		{ 3829, 0, 255 },	// 0x067640F3
+		{ 3834, 0, 255 },	// 0x068774A4
+		{ 3862, 0, 255 },	// 0x068F59E3
+		{ 3878, 0, 3 },	// 0x069433A8
+		{ 3899, 0, 3 },	// 0x06B30CBF
+		{ 3936, 0, 2 },	// 0x06B735ED
+		{ 3952, 0, 5 },	// 0x06B840F1
+		{ 3986, 0, 1 },	// 0x06BE0DD3
+		{ 4012, 0, 3 },	// 0x06C4113E
+		{ 4050, 0, 1 },	// 0x06C71148
+		{ 4073, 0, 2 },	// 0x06CD4EB4
+		{ 4100, 0, 4 },	// 0x06D651A7
+		{ 4120, 0, 1 },	// 0x06F271B2
+		{ 4161, 0, 2 },	// 0x06F54963
+		{ 4209, 0, 1 },	// 0x07025A4A
+		{ 4227, 0, 1 },	// 0x07092DC4
+		{ 4250, 0, 1 },	// 0x070B1C45
+		{ 4285, 0, 2 },	// 0x071542EB
+		{ 4314, 0, 2 },	// 0x071B6690
+		{ 4348, 0, 255 },	// 0x07205796
+		{ 4376, 0, 0 },	// 0x07244253
+		{ 4387, 0, 1 },	// 0x072516B4
+		{ 4424, 0, 1 },	// 0x073505E0
+		{ 4458, 0, 255 },	// 0x07370330
+		{ 4491, 0, 3 },	// 0x0744307B
+		{ 4512, 0, 5 },	// 0x07533EC9
+		{ 4527, 0, 2 },	// 0x0754000C
+		{ 4548, 0, 2 },	// 0x076863C9
+		{ 4584, 0, 2 },	// 0x076A7E4E
+		{ 4610, 0, 255 },	// 0x076B4C7C
+		{ 4623, 0, 255 },	// 0x076D157A
+		{ 4651, 0, 3 },	// 0x077A0221
+		{ 4694, 0, 9 },	// 0x077B17B5
+		{ 4712, 0, 1 },	// 0x07827AE1
+		{ 4736, 0, 1 },	// 0x07A0177D
+		{ 4752, 0, 2 },	// 0x07B23203
+		{ 4781, 0, 6 },	// 0x07BC4223
+		{ 4826, 0, 4 },	// 0x07C76803
+		{ 4844, 0, 0 },	// 0x07CC3F86
+		{ 4865, 0, 255 },	// 0x07D97F81
+		{ 4896, 0, 7 },	// 0x07E21C28
+		{ 4931, 0, 0 },	// 0x07E7104E
+		{ 4971, 0, 1 },	// 0x07ED1DBF
+		{ 4990, 0, 2 },	// 0x07EE2A45
+		{ 5019, 0, 3 },	// 0x07F35BFE
+		{ 5037, 0, 1 },	// 0x07FD3C35
+		{ 5067, 0, 4 },	// 0x08022967
+		{ 5086, 0, 255 },	// 0x080B4F21
+		{ 5101, 0, 1 },	// 0x080F3B37
+		{ 5122, 0, 0 },	// 0x08181609
+		{ 5155, 0, 4 },	// 0x081D549C
+		{ 5175, 0, 2 },	// 0x08240FB7
+		{ 5204, 0, 1 },	// 0x08274BA4
+		{ 5222, 0, 255 },	// 0x084F7B9F
+		{ 5249, 0, 1 },	// 0x085E559E
+		{ 5283, 0, 5 },	// 0x0860560B
+		{ 5309, 0, 0 },	// 0x086138DE
+		{ 5324, 0, 2 },	// 0x086452E7
+		{ 5352, 0, 1 },	// 0x087C5347
+		{ 5370, 0, 255 },	// 0x0896249A
+		{ 5391, 0, 0 },	// 0x089C57D7
+		{ 5406, 0, 9 },	// 0x089E42C1
+		{ 5430, 0, 1 },	// 0x08A015CF
+		{ 5451, 0, 1 },	// 0x08A308F8
+		{ 5479, 0, 2 },	// 0x08A453C9
+		{ 5499, 0, 1 },	// 0x08AB2787
+		{ 5527, 0, 2 },	// 0x08C6502C
+		{ 5560, 0, 255 },	// 0x08D25912
+		{ 5592, 0, 1 },	// 0x08D85CBB
+		{ 5609, 0, 2 },	// 0x091D1480
+		{ 5632, 0, 255 },	// 0x092829D0
+		{ 5655, 0, 1 },	// 0x09766174
+		{ 5685, 0, 4 },	// 0x098D5DA6
+		{ 5704, 0, 255 },	// 0x0991172D
+		{ 5742, 0, 2 },	// 0x09A34209
+		{ 5767, 0, 255 },	// 0x09A558A5
+		{ 5807, 0, 0 },	// 0x09B85174
+		{ 5820, 0, 2 },	// 0x09C5648C
+		{ 5855, 0, 2 },	// 0x09C95A65
+		{ 5868, 0, 1 },	// 0x09DB00B9
+		{ 5879, 0, 3 },	// 0x09DD61E1
+		{ 5906, 0, 1 },	// 0x09DE74E5
+		{ 5935, 0, 1 },	// 0x09E405DB
+		{ 5967, 0, 2 },	// 0x09E878A4
+		{ 6016, 0, 255 },	// 0x09FD24F3
+		{ 6036, 0, 0 },	// 0x09FD7668
+		{ 6055, 0, 1 },	// 0x0A0444B3
+		{ 6099, 0, 1 },	// 0x0A0F19D1
+		{ 6115, 0, 2 },	// 0x0A1B465C
+		{ 6137, 0, 0 },	// 0x0A1D6E36
+		{ 6165, 0, 255 },	// 0x0A2B76C2
+		{ 6197, 0, 4 },	// 0x0A2C70AF
+		{ 6225, 0, 2 },	// 0x0A3D60CE
+		{ 6240, 0, 2 },	// 0x0A432423
+		{ 6269, 0, 0 },	// 0x0A4608E9
+		{ 6306, 0, 2 },	// 0x0A462B7A
+		{ 6334, 0, 3 },	// 0x0A491CFF
+		{ 6340, 0, 2 },	// 0x0A632BB4
+		{ 6361, 0, 0 },	// 0x0A74017B
+		{ 6388, 0, 9 },	// 0x0A76502F
+		{ 6408, 0, 1 },	// 0x0A7D3AF9
+		{ 6437, 0, 7 },	// 0x0A7E36E5
+		{ 6470, 0, 0 },	// 0x0A940E03
+		{ 6491, 0, 2 },	// 0x0A9D695E
+		{ 6523, 0, 0 },	// 0x0A9F7BA1
+		{ 6540, 0, 5 },	// 0x0AA202B0
+		{ 6562, 0, 1 },	// 0x0AA73A12
+		{ 6589, 0, 1 },	// 0x0AB9317B
+		{ 6619, 0, 2 },	// 0x0ABE3FA8
+		{ 6637, 0, 8 },	// 0x0AC92D36
+		{ 6659, 0, 1 },	// 0x0AD54D75
+		{ 6683, 0, 255 },	// 0x0AF378D5
+		{ 6708, 0, 2 },	// 0x0B1562DF
+		{ 6733, 0, 2 },	// 0x0B164EF2
+		{ 6769, 0, 1 },	// 0x0B177D76
+		{ 6790, 0, 1 },	// 0x0B2A2801
+		{ 6803, 0, 2 },	// 0x0B464BE8
+		{ 6835, 0, 2 },	// 0x0B5704E0
+		{ 6857, 0, 1 },	// 0x0B651AFB
+		{ 6882, 0, 2 },	// 0x0B6E6107
+		{ 6922, 0, 1 },	// 0x0B774604
+		{ 6952, 0, 2 },	// 0x0B823C8D
+		{ 6979, 0, 2 },	// 0x0B8B3941
+		{ 6995, 0, 2 },	// 0x0B9B5070
+		{ 7013, 0, 2 },	// 0x0B9F0356
+		{ 7041, 0, 2 },	// 0x0BAD1A62
+		{ 7069, 0, 0 },	// 0x0BC86FA7
+		{ 7098, 0, 2 },	// 0x0BCE3423
+		{ 7124, 0, 3 },	// 0x0BED1DDE
+		{ 7154, 0, 2 },	// 0x0C051FE2
+		{ 7177, 0, 255 },	// 0x0C1C5B1B
+		{ 7203, 0, 0 },	// 0x0C1C7919
+		{ 7231, 0, 6 },	// 0x0C26452D
+		{ 7260, 0, 4 },	// 0x0C2747B9
+		{ 7280, 0, 2 },	// 0x0C2A7847
+		{ 7305, 0, 255 },	// 0x0C2D2CC5
+		{ 7338, 0, 1 },	// 0x0C47057F
+		{ 7359, 0, 2 },	// 0x0C4B7DD3
+		{ 7377, 0, 2 },	// 0x0C4F5021
+		{ 7404, 0, 1 },	// 0x0C5A551B
+		{ 7424, 0, 1 },	// 0x0C607EB8
+		{ 7446, 0, 2 },	// 0x0C704586
+		{ 7464, 0, 2 },	// 0x0C7B14D9
+		{ 7491, 0, 1 },	// 0x0C7B7CF4
+		{ 7521, 0, 1 },	// 0x0CA46B08
+		{ 7541, 0, 4 },	// 0x0CA539D6
+		{ 7578, 0, 1 },	// 0x0CA614E6
+		{ 7594, 0, 2 },	// 0x0CA93513
+		{ 7624, 0, 3 },	// 0x0CAA42D0
+		{ 7642, 0, 1 },	// 0x0CC0186A
+		{ 7658, 0, 2 },	// 0x0CCA5CFC
+		{ 7691, 0, 1 },	// 0x0CD276B4
+		{ 7704, 0, 1 },	// 0x0CE96445
+		{ 7733, 0, 2 },	// 0x0CF76EE0
+		{ 7747, 0, 1 },	// 0x0D192F80
+		{ 7790, 0, 2 },	// 0x0D374615
+		{ 7822, 0, 4 },	// 0x0D3A3160
+		{ 7831, 0, 1 },	// 0x0D6C0836
+		{ 7856, 0, 0 },	// 0x0D721EEA
+		{ 7877, 0, 9 },	// 0x0D8407E9
+		{ 7895, 0, 2 },	// 0x0D8A1BCF
+		{ 7917, 0, 6 },	// 0x0D940AF4
+		{ 7951, 0, 2 },	// 0x0D970483
+		{ 7969, 0, 0 },	// 0x0DA146AA
+		{ 7985, 0, 7 },	// 0x0DA61310
+		{ 8008, 0, 8 },	// 0x0DBD5654
+		{ 8039, 0, 3 },	// 0x0DBF663C
+		{ 8061, 0, 2 },	// 0x0DD71BA9
+		{ 8107, 0, 2 },	// 0x0DDC19F4
+		{ 8135, 0, 6 },	// 0x0DDD70AE
+		{ 8156, 0, 0 },	// 0x0DE30821
+		{ 8195, 0, 1 },	// 0x0E1645CD
+		{ 8215, 0, 1 },	// 0x0E2438E5
+		{ 8235, 0, 2 },	// 0x0E390571
+		{ 8259, 0, 1 },	// 0x0E3B49BF
+		{ 8271, 0, 1 },	// 0x0E633C13
+		{ 8290, 0, 2 },	// 0x0E635761
+		{ 8309, 0, 255 },	// 0x0E717E98
+		{ 8336, 0, 0 },	// 0x0E843CEA
+		{ 8354, 0, 2 },	// 0x0EA118D0
+		{ 8400, 0, 1 },	// 0x0EAA4429
+		{ 8410, 0, 4 },	// 0x0EAD6CFB
+		{ 8431, 0, 2 },	// 0x0EAF6A68
+		{ 8450, 0, 2 },	// 0x0ECB2DEE
+		{ 8469, 0, 1 },	// 0x0ED8621F
+		{ 8495, 0, 2 },	// 0x0EE34390
+		{ 8526, 0, 5 },	// 0x0EE87310
+		{ 8539, 0, 3 },	// 0x0F002557
+		{ 8552, 0, 0 },	// 0x0F0269B5
+		{ 8570, 0, 1 },	// 0x0F0956CA
+		{ 8595, 0, 0 },	// 0x0F0D2025
+		{ 8611, 0, 15 },	// 0x0F132F7E
+		{ 8632, 0, 1 },	// 0x0F13355A
+		{ 8661, 0, 1 },	// 0x0F1B1AA1
+		{ 8682, 0, 13 },	// 0x0F227D5A
+		{ 8700, 0, 6 },	// 0x0F296C2E
+		{ 8732, 0, 255 },	// 0x0F322A6C
+		{ 8755, 0, 5 },	// 0x0F3402B8
+		{ 8775, 0, 2 },	// 0x0F4A4FB2
+		{ 8799, 0, 7 },	// 0x0F4B0239
+		{ 8816, 0, 2 },	// 0x0F4C513E
+		{ 8844, 0, 2 },	// 0x0F5D1937
+		{ 8856, 0, 2 },	// 0x0F634F9D
+		{ 8881, 0, 4 },	// 0x0F636C38
+		{ 8904, 0, 5 },	// 0x0F731898
+		{ 8926, 0, 1 },	// 0x0F7F3837
+		{ 8942, 0, 1 },	// 0x0F9B3A1C
+		{ 8958, 0, 1 },	// 0x0FB17679
+		{ 8995, 0, 1 },	// 0x0FB44F54
+		{ 9015, 0, 1 },	// 0x0FC40275
+		{ 9035, 0, 255 },	// 0x0FCC0410
+		{ 9055, 0, 2 },	// 0x0FDA7965
+		{ 9068, 0, 2 },	// 0x0FEA6230
+		{ 9089, 0, 1 },	// 0x0FF342B2
+		{ 9105, 0, 1 },	// 0x0FFD1A92
+		{ 9126, 0, 2 },	// 0x10237666
+		{ 9141, 0, 255 },	// 0x102A0A6C
+		{ 9152, 0, 1 },	// 0x103F14E4
+		{ 9180, 0, 2 },	// 0x10436A86
+		{ 9211, 0, 1 },	// 0x106811E4
+		{ 9245, 0, 2 },	// 0x10776AAE
+		{ 9274, 0, 1 },	// 0x10800FD6
+		{ 9298, 0, 255 },	// 0x108B4A25
+		{ 9331, 0, 6 },	// 0x10974B70
+		{ 9365, 0, 255 },	// 0x10A1449C
+		{ 9371, 0, 6 },	// 0x10A62603
+		{ 9411, 0, 4 },	// 0x10A75905
+		{ 9436, 0, 1 },	// 0x10A86CF4
+		{ 9452, 0, 1 },	// 0x10C75BDA
+		{ 9466, 0, 9 },	// 0x10CB1413
+		{ 9498, 0, 0 },	// 0x10DF4CED
+		{ 9526, 0, 2 },	// 0x10F64FBF
+		{ 9559, 0, 9 },	// 0x10FB7B5F
+		{ 9583, 0, 2 },	// 0x10FD2442
+		{ 9602, 0, 255 },	// 0x10FE0FE9
+		{ 9632, 0, 0 },	// 0x1105259C
+		{ 9653, 0, 2 },	// 0x1106579B
+		{ 9676, 0, 2 },	// 0x110957EF
+		{ 9701, 0, 1 },	// 0x1114089D
+		{ 9720, 0, 0 },	// 0x11162A93
+		{ 9746, 0, 255 },	// 0x11292C09
+		{ 9778, 0, 3 },	// 0x112E7FB1
+		{ 9799, 0, 4 },	// 0x11612815
+		{ 9820, 0, 255 },	// 0x116D009A
+		{ 9838, 0, 0 },	// 0x116E5A1F
+		{ 9870, 0, 4 },	// 0x118174EC
+		{ 9893, 0, 4 },	// 0x118A67C9
+		{ 9915, 0, 2 },	// 0x118D1AA3
+		{ 9931, 0, 2 },	// 0x119A668D
+		{ 9959, 0, 8 },	// 0x11B76EDF
+		{ 9972, 0, 255 },	// 0x11E22D1B
+		{ 9997, 0, 255 },	// 0x11E80442
+		{ 10025, 0, 255 },	// 0x11EE28D5
+		{ 10062, 0, 2 },	// 0x11F759DE
+		{ 10082, 0, 1 },	// 0x12067E8D
+		{ 10111, 0, 1 },	// 0x120962E7
+		{ 10141, 0, 4 },	// 0x120B4F15
+		{ 10164, 0, 1 },	// 0x120D3155
+		{ 10209, 0, 255 },	// 0x124D4571
+		{ 10234, 0, 255 },	// 0x126C0B99
+		{ 10269, 0, 1 },	// 0x126F1175
+		{ 10285, 0, 2 },	// 0x127669D3
+		{ 10323, 0, 2 },	// 0x12850007
+		{ 10344, 0, 255 },	// 0x12865550
+		{ 10373, 0, 1 },	// 0x1293731D
+		{ 10391, 0, 1 },	// 0x129A1569
+		{ 10407, 0, 2 },	// 0x12A619E9
+		{ 10434, 0, 0 },	// 0x12A86E89
+		{ 10453, 0, 2 },	// 0x12AA6D71
+		{ 10472, 0, 1 },	// 0x12AE0E27
+		{ 10487, 0, 4 },	// 0x12B524B7
+		{ 10501, 0, 5 },	// 0x12B9197E
+		{ 10527, 0, 0 },	// 0x12C42F66
+		{ 10563, 0, 4 },	// 0x12D64378
+		{ 10593, 0, 1 },	// 0x12D67ADA
+		{ 10637, 0, 1 },	// 0x12D71B44
+		{ 10664, 0, 3 },	// 0x12ED0BC9
+		{ 10690, 0, 1 },	// 0x12ED69A6
+		{ 10712, 0, 2 },	// 0x12F20552
+		{ 10745, 0, 1 },	// 0x13134CCD
+		{ 10761, 0, 0 },	// 0x13135C95
+		{ 10797, 0, 2 },	// 0x131A0C84
+		{ 10814, 0, 0 },	// 0x13244634
+		{ 10849, 0, 2 },	// 0x13267663
+		{ 10882, 0, 0 },	// 0x133C257F
+		{ 10903, 0, 1 },	// 0x135154B0
+		{ 10932, 0, 6 },	// 0x137C35BA
+		{ 10947, 0, 1 },	// 0x137E6800
+		{ 10975, 0, 2 },	// 0x13B27FFE
+		{ 11010, 0, 1 },	// 0x13C75E16
+		{ 11043, 0, 8 },	// 0x13C91ACD
+		{ 11089, 0, 2 },	// 0x13D44996
+		{ 11127, 0, 2 },	// 0x13DE5C59
+		{ 11161, 0, 14 },	// 0x13E4042D
+		{ 11193, 0, 6 },	// 0x14007AC6
+		{ 11227, 0, 2 },	// 0x14166075
+		{ 11257, 0, 1 },	// 0x141B23A9
+		{ 11290, 0, 1 },	// 0x141D24A6
+		{ 11325, 0, 2 },	// 0x142A5E83
+		{ 11346, 0, 255 },	// 0x142E7C40
+		{ 11372, 0, 8 },	// 0x142F31EF
+		{ 11398, 0, 1 },	// 0x14334EEE
+		{ 11410, 0, 6 },	// 0x143358D3
+		{ 11441, 0, 2 },	// 0x144F3CE5
+		{ 11463, 0, 2 },	// 0x145B13C7
+		{ 11480, 0, 0 },	// 0x145B50AF
+		{ 11520, 0, 2 },	// 0x1461418C
+		{ 11569, 0, 1 },	// 0x14790F9F
+		{ 11592, 0, 1 },	// 0x14A67125
+		{ 11611, 0, 1 },	// 0x14AB75AE
+		{ 11643, 0, 2 },	// 0x14B06047
+		{ 11657, 0, 2 },	// 0x14D242D9
+		{ 11676, 0, 4 },	// 0x14DD5F87
+		{ 11694, 0, 3 },	// 0x15012850
+		{ 11738, 0, 2 },	// 0x150A6532
+		{ 11768, 0, 255 },	// 0x150B0C33
+		{ 11784, 0, 2 },	// 0x15101503
+		{ 11807, 0, 3 },	// 0x15285933
+		{ 11825, 0, 4 },	// 0x152F6314
+		{ 11837, 0, 255 },	// 0x154932F0
+		{ 11859, 0, 2 },	// 0x154E450E
+		{ 11890, 0, 1 },	// 0x15585A65
+		{ 11912, 0, 1 },	// 0x15652DC1
+		{ 11945, 0, 2 },	// 0x156D5236
+		{ 11976, 0, 9 },	// 0x156E12CA
+		{ 12001, 0, 2 },	// 0x15734852
+		{ 12033, 0, 1 },	// 0x159A4ED4
+		{ 12073, 0, 3 },	// 0x15B07D4D
+		{ 12108, 0, 1 },	// 0x15D668D0
+		{ 12116, 0, 2 },	// 0x15F033A6
+		{ 12134, 0, 1 },	// 0x15F11BAB
+		{ 12166, 0, 3 },	// 0x16184716
+		{ 12189, 0, 15 },	// 0x161B05A9
+		{ 12221, 0, 2 },	// 0x163A1D77
+		{ 12249, 0, 255 },	// 0x164B7363
+		{ 12277, 0, 3 },	// 0x168B1717
+		{ 12306, 0, 4 },	// 0x168B18ED
+		{ 12328, 0, 0 },	// 0x16AF6DEB
+		{ 12354, 0, 2 },	// 0x16CB4F86
+		{ 12372, 0, 0 },	// 0x16D762E5
+		{ 12384, 0, 2 },	// 0x16DD2D00
+		{ 12398, 0, 255 },	// 0x16E14EA4
+		{ 12423, 0, 2 },	// 0x17002E03
+		{ 12456, 0, 255 },	// 0x170F0D58
+		{ 12480, 0, 1 },	// 0x170F7E75
+		{ 12502, 0, 3 },	// 0x172376FE
+		{ 12534, 0, 2 },	// 0x17265607
+		{ 12556, 0, 255 },	// 0x17572318
+		{ 12588, 0, 1 },	// 0x176C2DB5
+		{ 12614, 0, 1 },	// 0x176F4D4C
+		{ 12636, 0, 1 },	// 0x17767D95
+		{ 12667, 0, 8 },	// 0x178332FF
+		{ 12715, 0, 0 },	// 0x1788346E
+		{ 12745, 0, 5 },	// 0x17901684
+		{ 12770, 0, 1 },	// 0x17920FA7
+		{ 12784, 0, 255 },	// 0x179848E4
+		{ 12811, 0, 5 },	// 0x17BC4531
+		{ 12838, 0, 1 },	// 0x17BC668D
+		{ 12855, 0, 1 },	// 0x17C37E6D
+		{ 12885, 0, 1 },	// 0x17D72833
+		{ 12905, 0, 2 },	// 0x17E2319C
+		{ 12928, 0, 2 },	// 0x17F62193
+		{ 12965, 0, 255 },	// 0x17FD0934
+		{ 12989, 0, 0 },	// 0x18136217
+		{ 13011, 0, 0 },	// 0x1817000B
+		{ 13028, 0, 2 },	// 0x181F6B00
+		{ 13045, 0, 0 },	// 0x18246AC8
+		{ 13077, 0, 10 },	// 0x1849408D
+		{ 13098, 0, 2 },	// 0x1866612D
+		{ 13122, 0, 5 },	// 0x186D42A4
+		{ 13156, 0, 3 },	// 0x18740B3D
+		{ 13184, 0, 0 },	// 0x187B3202
+		{ 13216, 0, 4 },	// 0x1880639C
+		{ 13237, 0, 11 },	// 0x188E0FAC
+		{ 13253, 0, 1 },	// 0x189A2BB1
+		{ 13268, 0, 2 },	// 0x189E32C9
+		{ 13300, 0, 255 },	// 0x18A22AE4
+		{ 13329, 0, 255 },	// 0x18A302CD
+		{ 13348, 0, 3 },	// 0x18BD071B
+		{ 13363, 0, 255 },	// 0x18C67E6D
+		{ 13386, 0, 0 },	// 0x18CA2D3A
+		{ 13413, 0, 8 },	// 0x18D5264D
+		{ 13429, 0, 3 },	// 0x18DB4CAF
+		{ 13463, 0, 5 },	// 0x18EA4926
+		{ 13493, 0, 0 },	// 0x18F01E80
+		{ 13514, 0, 1 },	// 0x18F43649
+		{ 13533, 0, 2 },	// 0x18F477E1
+		{ 13546, 0, 1 },	// 0x1905109F
+		{ 13563, 0, 3 },	// 0x191B7021
+		{ 13584, 0, 5 },	// 0x191E2F12
+		{ 13612, 0, 1 },	// 0x19211E9D
+		{ 13641, 0, 1 },	// 0x192E5726
+		{ 13670, 0, 5 },	// 0x19486759
+		{ 13708, 0, 4 },	// 0x194F76D4
+		{ 13725, 0, 2 },	// 0x1958471A
+		{ 13743, 0, 6 },	// 0x19591255
+		{ 13769, 0, 3 },	// 0x195C13BC
+		{ 13800, 0, 4 },	// 0x195D582E
+		{ 13824, 0, 255 },	// 0x19610E35
+		{ 13864, 0, 2 },	// 0x19836A5B
+		{ 13895, 0, 2 },	// 0x198B786F
+		{ 13930, 0, 0 },	// 0x19976813
+		{ 13943, 0, 2 },	// 0x19A64C5D
+		{ 13961, 0, 255 },	// 0x19A73E70
+		{ 14001, 0, 4 },	// 0x19C967B5
+		{ 14017, 0, 2 },	// 0x19D006EB
+		{ 14031, 0, 7 },	// 0x19D16ACE
+		{ 14060, 0, 2 },	// 0x19D302AE
+		{ 14086, 0, 4 },	// 0x19DB19D8
+		{ 14116, 0, 2 },	// 0x19DD44F2
+		{ 14137, 0, 1 },	// 0x1A013092
+		{ 14165, 0, 2 },	// 0x1A02748F
+		{ 14198, 0, 1 },	// 0x1A081F78
+		{ 14232, 0, 7 },	// 0x1A0F56C5
+		{ 14254, 0, 255 },	// 0x1A122D03
+		{ 14296, 0, 1 },	// 0x1A1473B0
+		{ 14333, 0, 2 },	// 0x1A1A6D83
+		{ 14361, 0, 1 },	// 0x1A212500
+		{ 14376, 0, 2 },	// 0x1A2D7640
+		{ 14401, 0, 5 },	// 0x1A455E51
+		{ 14430, 0, 6 },	// 0x1A4D0C60
+		{ 14455, 0, 2 },	// 0x1A6203EA
+		{ 14474, 0, 255 },	// 0x1A7B3125
+		{ 14510, 0, 2 },	// 0x1A827B2C
+		{ 14541, 0, 4 },	// 0x1A920C02
+		{ 14567, 0, 255 },	// 0x1A936344
+		{ 14602, 0, 1 },	// 0x1AA32729
+		{ 14621, 0, 2 },	// 0x1AAF54BE
+		{ 14654, 0, 3 },	// 0x1ABE6A4C
+		{ 14674, 0, 2 },	// 0x1AD3394A
+		{ 14701, 0, 3 },	// 0x1ADA0C3A
+		{ 14718, 0, 2 },	// 0x1ADD68E8
+		{ 14740, 0, 0 },	// 0x1AE118F4
+		{ 14761, 0, 6 },	// 0x1AE44443
+		{ 14784, 0, 1 },	// 0x1AEB793A
+		{ 14803, 0, 2 },	// 0x1B067237
+		{ 14825, 0, 1 },	// 0x1B0741BA
+		{ 14854, 0, 1 },	// 0x1B086D33
+		{ 14890, 0, 0 },	// 0x1B0963AF
+		{ 14921, 0, 1 },	// 0x1B183AFE
+		{ 14956, 0, 0 },	// 0x1B215A3B
+		{ 14976, 0, 1 },	// 0x1B305900
+		{ 15004, 0, 7 },	// 0x1B31390E
+		{ 15034, 0, 0 },	// 0x1B5B4ED9
+		{ 15054, 0, 7 },	// 0x1B637A1C
+		{ 15063, 0, 2 },	// 0x1B64665B
+		{ 15076, 0, 0 },	// 0x1B6716B8
+		{ 15105, 0, 255 },	// 0x1B731C3F
+		{ 15130, 0, 1 },	// 0x1B886584
+		{ 15170, 0, 2 },	// 0x1B8B3973
+		{ 15196, 0, 0 },	// 0x1B8E7EED
+		{ 15211, 0, 1 },	// 0x1B8F031D
+		{ 15258, 0, 255 },	// 0x1B915945
+		{ 15296, 0, 11 },	// 0x1B9A44D4
+		{ 15322, 0, 1 },	// 0x1B9E5D07
+		{ 15348, 0, 255 },	// 0x1BA61E20
+		{ 15352, 0, 1 },	// 0x1BA8350B
+		{ 15368, 0, 2 },	// 0x1BB41B75
+		{ 15393, 0, 1 },	// 0x1BC5050E
+		{ 15426, 0, 2 },	// 0x1BC70617
+		{ 15454, 0, 1 },	// 0x1BC772AC
+		{ 15473, 0, 2 },	// 0x1BDA0DA5
+		{ 15500, 0, 0 },	// 0x1BDA1F9A
+		{ 15538, 0, 0 },	// 0x1BF55D6F
+		{ 15545, 0, 7 },	// 0x1BF67441
+		{ 15583, 0, 255 },	// 0x1C00658B
+		{ 15601, 0, 1 },	// 0x1C132038
+		{ 15638, 0, 2 },	// 0x1C144E4E
+		{ 15663, 0, 2 },	// 0x1C2F57FB
+		{ 15680, 0, 1 },	// 0x1C334022
+		{ 15705, 0, 2 },	// 0x1C35407F
+		{ 15723, 0, 0 },	// 0x1C4B1189
+		{ 15758, 0, 5 },	// 0x1C4E7A79
+		{ 15797, 0, 1 },	// 0x1C5552E9
+		{ 15819, 0, 2 },	// 0x1C5B7C51
+		{ 15844, 0, 2 },	// 0x1C623537
+		{ 15863, 0, 4 },	// 0x1C7C4B89
+		{ 15900, 0, 7 },	// 0x1C810358
+		{ 15925, 0, 4 },	// 0x1C887939
+		{ 15946, 0, 1 },	// 0x1C8B73B6
+		{ 15971, 0, 2 },	// 0x1C9A376D
+		{ 16002, 0, 0 },	// 0x1CA77E94
+		{ 16030, 0, 2 },	// 0x1CB2670D
+		{ 16059, 0, 2 },	// 0x1CB27FE1
+		{ 16075, 0, 0 },	// 0x1CB80079
+		{ 16100, 0, 0 },	// 0x1CF773D4
+		{ 16124, 0, 255 },	// 0x1CFD32E5
+		{ 16150, 0, 2 },	// 0x1D0B131A
+		{ 16171, 0, 255 },	// 0x1D161BB8
+		{ 16189, 0, 1 },	// 0x1D1B266B
+		{ 16207, 0, 255 },	// 0x1D1B6750
+		{ 16240, 0, 2 },	// 0x1D2F46AE
+		{ 16262, 0, 1 },	// 0x1D334237
+		{ 16286, 0, 1 },	// 0x1D3F681D
+		{ 16304, 0, 1 },	// 0x1D6D767E
+		{ 16331, 0, 255 },	// 0x1D801FC0
+		{ 16346, 0, 2 },	// 0x1D8800E3
+		{ 16365, 0, 0 },	// 0x1D8C324A
+		{ 16378, 0, 0 },	// 0x1D9853EA
+		{ 16392, 0, 1 },	// 0x1DBD7385
+		{ 16419, 0, 0 },	// 0x1DC730B8
+		{ 16444, 0, 3 },	// 0x1DD624A0
+		{ 16474, 0, 255 },	// 0x1DD86C2A
+		{ 16497, 0, 0 },	// 0x1DD926BA
+		{ 16526, 0, 6 },	// 0x1DDA54EF
+		{ 16548, 0, 1 },	// 0x1DDD0073
+		{ 16576, 0, 1 },	// 0x1DE062FD
+		{ 16596, 0, 255 },	// 0x1DE37A21
+		{ 16623, 0, 1 },	// 0x1DEA65DE
+		{ 16648, 0, 2 },	// 0x1DF623F9
+		{ 16666, 0, 1 },	// 0x1DFF5B06
+		{ 16703, 0, 0 },	// 0x1E0A7AD8
+		{ 16734, 0, 2 },	// 0x1E106A88
+		{ 16758, 0, 255 },	// 0x1E144C8B
+		{ 16786, 0, 255 },	// 0x1E1B5C26
+		{ 16814, 0, 2 },	// 0x1E203014
+		{ 16826, 0, 1 },	// 0x1E2A5820
+		{ 16845, 0, 4 },	// 0x1E2D5A7B
+		{ 16865, 0, 2 },	// 0x1E352CEF
+		{ 16879, 0, 2 },	// 0x1E5C50B5
+		{ 16911, 0, 2 },	// 0x1E805412
+		{ 16946, 0, 1 },	// 0x1E87298A
+		{ 16964, 0, 255 },	// 0x1E880709
+		{ 16999, 0, 2 },	// 0x1E901BB6
+		{ 17039, 0, 255 },	// 0x1E951606
+		{ 17062, 0, 4 },	// 0x1E9635A9
+		{ 17084, 0, 0 },	// 0x1EA85697
+		{ 17108, 0, 2 },	// 0x1EAD1D7D
+		{ 17138, 0, 1 },	// 0x1EC10CE1
+		{ 17142, 0, 2 },	// 0x1EE13E29
+		{ 17160, 0, 0 },	// 0x1EE70376
+		{ 17182, 0, 2 },	// 0x1EF36397
+		{ 17214, 0, 1 },	// 0x1EFB0992
+		{ 17229, 0, 2 },	// 0x1F157FD3
+		{ 17241, 0, 0 },	// 0x1F1C77E1
+		{ 17301, 0, 1 },	// 0x1F2928A6
+		{ 17328, 0, 0 },	// 0x1F40505C
+		{ 17348, 0, 2 },	// 0x1F6A54B6
+		{ 17370, 0, 8 },	// 0x1F6B3FF0
+		{ 17408, 0, 7 },	// 0x1F736F00
+		{ 17432, 0, 12 },	// 0x1F760E1A
+		{ 17464, 0, 5 },	// 0x1F881A88
+		{ 17500, 0, 5 },	// 0x1F913BC7
+		{ 17527, 0, 3 },	// 0x1FA41244
+		{ 17549, 0, 2 },	// 0x1FBD3ACA
+		{ 17571, 0, 1 },	// 0x1FC06A1B
+		{ 17594, 0, 6 },	// 0x1FC90C7C
+		{ 17642, 0, 1 },	// 0x1FC96A99
+		{ 17665, 0, 6 },	// 0x1FCB5241
+		{ 17701, 0, 5 },	// 0x1FDD4860
+		{ 17735, 0, 4 },	// 0x1FE21CF0
+		{ 17765, 0, 0 },	// 0x200A510B
+		{ 17794, 0, 2 },	// 0x20266A86
+		{ 17815, 0, 2 },	// 0x202F384E
+		{ 17835, 0, 5 },	// 0x203A137B
+		{ 17855, 0, 255 },	// 0x20421014
+		{ 17864, 0, 2 },	// 0x20430265
+		{ 17895, 0, 1 },	// 0x204A6AA4
+		{ 17911, 0, 1 },	// 0x205622AC
+		{ 17930, 0, 1 },	// 0x206420A6
+		{ 17945, 0, 2 },	// 0x208B4A6A
+		{ 17973, 0, 2 },	// 0x208C03C9
+		{ 17991, 0, 0 },	// 0x208F671C
+		{ 18030, 0, 6 },	// 0x20A04BEE
+		{ 18071, 0, 1 },	// 0x20A53B7F
+		{ 18100, 0, 255 },	// 0x20BB5507
+		{ 18144, 0, 1 },	// 0x20BC708E
+		{ 18175, 0, 1 },	// 0x20C76FD1
+		{ 18204, 0, 1 },	// 0x20E74A9C
+		{ 18216, 0, 1 },	// 0x20EC5B84
+		{ 18261, 0, 1 },	// 0x20FD4F4E
+		{ 18279, 0, 1 },	// 0x210A0879
+		{ 18302, 0, 1 },	// 0x210A33B2
+		{ 18325, 0, 1 },	// 0x210A4F1D
+		{ 18345, 0, 1 },	// 0x2119007F
+		{ 18359, 0, 1 },	// 0x211D390A
+		{ 18376, 0, 1 },	// 0x212B4014
+		{ 18388, 0, 1 },	// 0x213308DB
+		{ 18411, 0, 1 },	// 0x214C5455
+		{ 18437, 0, 1 },	// 0x21641887
+		{ 18468, 0, 255 },	// 0x216804D3
+		{ 18492, 0, 255 },	// 0x21804D1A
+		{ 18512, 0, 255 },	// 0x2186777E
+		{ 18531, 0, 0 },	// 0x219A3AF6
+		{ 18557, 0, 2 },	// 0x21A3110A
+		{ 18580, 0, 0 },	// 0x21B45EC1
+		{ 18605, 0, 2 },	// 0x21B8337F
+		{ 18650, 0, 255 },	// 0x21B85DA9
+		{ 18697, 0, 8 },	// 0x21C44026
+		{ 18710, 0, 2 },	// 0x21CC647F
+		{ 18739, 0, 5 },	// 0x21DE7496
+		{ 18768, 0, 2 },	// 0x21F43531
+		{ 18787, 0, 255 },	// 0x22087F31
+		{ 18814, 0, 255 },	// 0x2209116C
+		{ 18837, 0, 2 },	// 0x2232704D
+		{ 18864, 0, 9 },	// 0x22417905
+		{ 18887, 0, 1 },	// 0x22434C20
+		{ 18908, 0, 255 },	// 0x22442A7F
+		{ 18931, 0, 2 },	// 0x22457083
+		{ 18949, 0, 255 },	// 0x22463E22
+		{ 18998, 0, 1 },	// 0x22545844
+		{ 19014, 0, 3 },	// 0x226A7227
+		{ 19042, 0, 1 },	// 0x22811897
+		{ 19067, 0, 2 },	// 0x228F1801
+		{ 19091, 0, 2 },	// 0x22AA010C
+		{ 19109, 0, 255 },	// 0x22AA0984
+		{ 19123, 0, 0 },	// 0x22AB641D
+		{ 19153, 0, 2 },	// 0x22DD329E
+		{ 19180, 0, 2 },	// 0x22E91F1F
+		{ 19203, 0, 5 },	// 0x230A740F
+		{ 19224, 0, 6 },	// 0x232642DE
+		{ 19236, 0, 1 },	// 0x232800BD
+		{ 19257, 0, 1 },	// 0x232A52FA
+		{ 19278, 0, 2 },	// 0x232F1A85
+		{ 19298, 0, 1 },	// 0x23B00129
+		{ 19327, 0, 1 },	// 0x23B76F88
+		{ 19359, 0, 1 },	// 0x23C15141
+		{ 19374, 0, 0 },	// 0x23D60810
+		{ 19400, 0, 3 },	// 0x23E140A9
+		{ 19424, 0, 7 },	// 0x23F772E7
+		{ 19455, 0, 1 },	// 0x24256EFB
+		{ 19483, 0, 4 },	// 0x24367E48
+		{ 19502, 0, 4 },	// 0x245F424F
+		{ 19529, 0, 0 },	// 0x246D47CE
+		{ 19556, 0, 255 },	// 0x24742BB9
+		{ 19574, 0, 2 },	// 0x2485231E
+		{ 19598, 0, 1 },	// 0x24885050
+		{ 19619, 0, 2 },	// 0x24A40229
+		{ 19640, 0, 2 },	// 0x24B42ED2
+		{ 19661, 0, 2 },	// 0x24C45D0D
+		{ 19673, 0, 255 },	// 0x24CC682B
+		{ 19677, 0, 1 },	// 0x24D467CC
+		{ 19692, 0, 2 },	// 0x24D70069
+		{ 19729, 0, 2 },	// 0x24DE2039
+		{ 19753, 0, 1 },	// 0x24DF32CC
+		{ 19773, 0, 2 },	// 0x25071DF3
+		{ 19797, 0, 1 },	// 0x250C2D39
+		{ 19810, 0, 0 },	// 0x25136AC2
+		{ 19840, 0, 255 },	// 0x25204F8B
+		{ 19858, 0, 1 },	// 0x252138B3
+		{ 19870, 0, 255 },	// 0x25270A4B
+		{ 19888, 0, 1 },	// 0x25271044
+		{ 19911, 0, 3 },	// 0x25442DF7
+		{ 19928, 0, 2 },	// 0x255059BB
+		{ 19963, 0, 2 },	// 0x25541DBE
+		{ 19987, 0, 2 },	// 0x256472F1
+		{ 20029, 0, 2 },	// 0x25714BE4
+		{ 20051, 0, 2 },	// 0x25750E4F
+		{ 20080, 0, 255 },	// 0x259E305F
+		{ 20089, 0, 1 },	// 0x25AC586E
+		{ 20113, 0, 3 },	// 0x25B87BCA
+		{ 20135, 0, 4 },	// 0x25BB7D67
+		{ 20151, 0, 255 },	// 0x25CA45EA
+		{ 20175, 0, 1 },	// 0x26094A53
+		{ 20201, 0, 3 },	// 0x261F18A3
+		{ 20230, 0, 9 },	// 0x26274628
+		{ 20241, 0, 1 },	// 0x26335EE7
+		{ 20260, 0, 2 },	// 0x264009D3
+		{ 20279, 0, 4 },	// 0x264C5448
+		{ 20293, 0, 255 },	// 0x265544F9
+		{ 20313, 0, 2 },	// 0x265E37E1
+		{ 20341, 0, 1 },	// 0x265F6FF5
+		{ 20353, 0, 1 },	// 0x266716AC
+		{ 20358, 0, 2 },	// 0x2667609A
+		{ 20383, 0, 2 },	// 0x266D0801
+		{ 20408, 0, 2 },	// 0x266F327C
+		{ 20441, 0, 1 },	// 0x26747EBE
+		{ 20467, 0, 2 },	// 0x267D251F
+		{ 20493, 0, 1 },	// 0x267D5146
+		{ 20507, 0, 8 },	// 0x26810BE3
+		{ 20534, 0, 2 },	// 0x268F1413
+		{ 20576, 0, 2 },	// 0x26A1722C
+		{ 20622, 0, 1 },	// 0x26AA20CF
+		{ 20668, 0, 1 },	// 0x26BC1939
+		{ 20685, 0, 6 },	// 0x26E27605
+		{ 20704, 0, 4 },	// 0x26E66DF3
+		{ 20731, 0, 4 },	// 0x2702274D
+		{ 20754, 0, 0 },	// 0x2704460E
+		{ 20777, 0, 5 },	// 0x27045521
+		{ 20806, 0, 1 },	// 0x270C7AB3
+		{ 20838, 0, 1 },	// 0x27211B1A
+		{ 20881, 0, 2 },	// 0x272D15FD
+		{ 20890, 0, 1 },	// 0x27323E51
+		{ 20919, 0, 0 },	// 0x27356F3A
+		{ 20945, 0, 9 },	// 0x273C2D35
+		{ 20970, 0, 2 },	// 0x27607F64
+		{ 21009, 0, 4 },	// 0x27636B69
+		{ 21031, 0, 1 },	// 0x27650F37
+		{ 21074, 0, 5 },	// 0x27722942
+		{ 21085, 0, 1 },	// 0x278305AE
+		{ 21098, 0, 2 },	// 0x278F2D0A
+		{ 21115, 0, 4 },	// 0x27C740D0
+		{ 21135, 0, 1 },	// 0x27D20F21
+		{ 21153, 0, 1 },	// 0x27E421EA
+		{ 21173, 0, 0 },	// 0x27F65637
+		{ 21203, 0, 6 },	// 0x27F87222
+		{ 21224, 0, 1 },	// 0x27FA32D4
+		{ 21250, 0, 2 },	// 0x28045C47
+		{ 21275, 0, 2 },	// 0x28251E62
+		{ 21301, 0, 0 },	// 0x282D29FE
+		{ 21339, 0, 2 },	// 0x282D2CAA
+		{ 21363, 0, 1 },	// 0x282E4EFB
+		{ 21381, 0, 255 },	// 0x283821D2
+		{ 21410, 0, 0 },	// 0x2854024A
+		{ 21440, 0, 255 },	// 0x285D1184
+		{ 21484, 0, 6 },	// 0x287A49A5
+		{ 21515, 0, 2 },	// 0x2880077C
+		{ 21546, 0, 2 },	// 0x28897EBD
+		{ 21567, 0, 2 },	// 0x288E50A3
+		{ 21593, 0, 8 },	// 0x289D3888
+		{ 21611, 0, 1 },	// 0x28A73BCA
+		{ 21627, 0, 1 },	// 0x28D17798
+		{ 21651, 0, 9 },	// 0x28EE78D8
+		{ 21666, 0, 1 },	// 0x29103E08
+		{ 21677, 0, 4 },	// 0x29216610
+		{ 21700, 0, 0 },	// 0x292349C7
+		{ 21736, 0, 2 },	// 0x29305D67
+		{ 21754, 0, 0 },	// 0x294C35B0
+		{ 21794, 0, 0 },	// 0x295A652A
+		{ 21820, 0, 4 },	// 0x295C34B8
+		{ 21844, 0, 2 },	// 0x295C4C52
+		{ 21864, 0, 3 },	// 0x295D3A87
+		{ 21888, 0, 2 },	// 0x2966710D
+		{ 21909, 0, 1 },	// 0x296B09E8
+		{ 21926, 0, 2 },	// 0x29827605
+		{ 21956, 0, 2 },	// 0x298827FC
+		{ 21974, 0, 2 },	// 0x29907BEF
+		{ 22005, 0, 1 },	// 0x29926B20
+		{ 22035, 0, 1 },	// 0x299C5EBC
+		{ 22063, 0, 0 },	// 0x29A75D1F
+		{ 22085, 0, 2 },	// 0x29AE70A8
+		{ 22117, 0, 2 },	// 0x29B53DFF
+		{ 22140, 0, 255 },	// 0x29BF0233
+		{ 22176, 0, 2 },	// 0x29D37792
+		{ 22196, 0, 1 },	// 0x29D46FF4
+		{ 22225, 0, 1 },	// 0x29D64E72
+		{ 22280, 0, 1 },	// 0x29D91F3D
+		{ 22302, 0, 4 },	// 0x29F02CB1
+		{ 22331, 0, 7 },	// 0x29FC3E19
+		{ 22347, 0, 0 },	// 0x2A055AFA
+		{ 22373, 0, 1 },	// 0x2A171915
+		{ 22391, 0, 8 },	// 0x2A221E97
+		{ 22405, 0, 1 },	// 0x2A28684C
+		{ 22427, 0, 12 },	// 0x2A2959DA
+		{ 22457, 0, 0 },	// 0x2A3A77FD
+		{ 22471, 0, 4 },	// 0x2A3F654A
+		{ 22501, 0, 1 },	// 0x2A491A70
+		{ 22529, 0, 1 },	// 0x2A5262C0
+		{ 22556, 0, 2 },	// 0x2A58578B
+		{ 22576, 0, 1 },	// 0x2A611607
+		{ 22598, 0, 1 },	// 0x2A7247EF
+		{ 22623, 0, 2 },	// 0x2A7413EB
+		{ 22642, 0, 4 },	// 0x2A7475D8
+		{ 22670, 0, 0 },	// 0x2A783A43
+		{ 22683, 0, 1 },	// 0x2A860E89
+		{ 22729, 0, 1 },	// 0x2AAB340A
+		{ 22741, 0, 5 },	// 0x2AB06643
+		{ 22762, 0, 0 },	// 0x2AD2206E
+		{ 22782, 0, 2 },	// 0x2AE87B02
+		{ 22795, 0, 2 },	// 0x2AE979DC
+		{ 22815, 0, 3 },	// 0x2AF07CC8
+		{ 22846, 0, 255 },	// 0x2B0A05E0
+		{ 22864, 0, 255 },	// 0x2B111E69
+		{ 22887, 0, 1 },	// 0x2B1B0290
+		{ 22906, 0, 3 },	// 0x2B2E39BB
+		{ 22918, 0, 2 },	// 0x2B416A06
+		{ 22947, 0, 0 },	// 0x2B446480
+		{ 22981, 0, 255 },	// 0x2B4E2A8C
+		{ 23005, 0, 4 },	// 0x2B5C06E6
+		{ 23026, 0, 0 },	// 0x2B64229C
+		{ 23073, 0, 1 },	// 0x2B670CD0
+		{ 23101, 0, 2 },	// 0x2B7C5CFB
+		{ 23140, 0, 1 },	// 0x2B856FAA
+		{ 23170, 0, 2 },	// 0x2B8836A6
+		{ 23203, 0, 0 },	// 0x2B8A0C6B
+		{ 23230, 0, 2 },	// 0x2B9B35C3
+		{ 23259, 0, 255 },	// 0x2BA92322
+		{ 23308, 0, 4 },	// 0x2BB65467
+		{ 23335, 0, 4 },	// 0x2BB9620F
+		{ 23352, 0, 0 },	// 0x2BBA7BF0
+		{ 23389, 0, 1 },	// 0x2BC44D7D
+		{ 23416, 0, 0 },	// 0x2BC64736
+		{ 23433, 0, 0 },	// 0x2BCD1ECA
+		{ 23455, 0, 5 },	// 0x2BDF7B7E
+		{ 23480, 0, 6 },	// 0x2BEE5F97
+		{ 23516, 0, 2 },	// 0x2BF8368E
+		{ 23546, 0, 3 },	// 0x2C18736E
+		{ 23569, 0, 6 },	// 0x2C1B52CE
+		{ 23597, 0, 255 },	// 0x2C297C5D
+		{ 23602, 0, 7 },	// 0x2C37408C
+		{ 23639, 0, 1 },	// 0x2C41421A
+		{ 23657, 0, 2 },	// 0x2C591CCD
+		{ 23676, 0, 2 },	// 0x2C6564F2
+		{ 23708, 0, 6 },	// 0x2C6D65AD
+		{ 23729, 0, 255 },	// 0x2C835642
+		{ 23752, 0, 3 },	// 0x2C8A5404
+		{ 23762, 0, 2 },	// 0x2C8C61BA
+		{ 23792, 0, 2 },	// 0x2C9E0483
+		{ 23818, 0, 1 },	// 0x2CA53AA1
+		{ 23837, 0, 4 },	// 0x2CAD4E39
+		{ 23871, 0, 255 },	// 0x2CB303F8
+		{ 23887, 0, 255 },	// 0x2CB572B5
+		{ 23923, 0, 8 },	// 0x2CBE4DAF
+		{ 23945, 0, 8 },	// 0x2CC356D0
+		{ 23966, 0, 1 },	// 0x2CC70E04
+		{ 23985, 0, 2 },	// 0x2CCA0D6A
+		{ 24005, 0, 255 },	// 0x2CD33526
+		{ 24050, 0, 2 },	// 0x2CD52C5C
+		{ 24061, 0, 1 },	// 0x2CD73270
+		{ 24097, 0, 2 },	// 0x2CDF628C
+		{ 24114, 0, 0 },	// 0x2CE231DC
+		{ 24133, 0, 0 },	// 0x2CEA47E9
+		{ 24172, 0, 2 },	// 0x2CEC22DA
+		{ 24188, 0, 2 },	// 0x2CF72EB7
+		{ 24218, 0, 255 },	// 0x2D040DA9
+		{ 24240, 0, 11 },	// 0x2D1A5F8C
+		{ 24287, 0, 255 },	// 0x2D1D17C9
+		{ 24314, 0, 255 },	// 0x2D215414
+		{ 24344, 0, 7 },	// 0x2D2B208A
+		{ 24355, 0, 255 },	// 0x2D2F452D
+		{ 24372, 0, 1 },	// 0x2D371601
+		{ 24387, 0, 2 },	// 0x2D43113A
+		{ 24420, 0, 4 },	// 0x2D432EAB
+		{ 24440, 0, 5 },	// 0x2D5611D4
+		{ 24462, 0, 5 },	// 0x2D7A725D
+		{ 24476, 0, 255 },	// 0x2D7D5DD2
+		{ 24494, 0, 3 },	// 0x2D9C3D5E
+		{ 24519, 0, 255 },	// 0x2DAE50C0
+		{ 24556, 0, 4 },	// 0x2DD35B3F
+		{ 24574, 0, 2 },	// 0x2DDE3785
+		{ 24598, 0, 255 },	// 0x2E096356
+		{ 24623, 0, 1 },	// 0x2E115B4B
+		{ 24636, 0, 2 },	// 0x2E12687B
+		{ 24648, 0, 1 },	// 0x2E291239
+		{ 24666, 0, 2 },	// 0x2E321155
+		{ 24700, 0, 0 },	// 0x2E4662B3
+		{ 24733, 0, 4 },	// 0x2E51318F
+		{ 24758, 0, 2 },	// 0x2E5B068F
+		{ 24775, 0, 2 },	// 0x2E5C36C0
+		{ 24804, 0, 0 },	// 0x2E5E1600
+		{ 24831, 0, 0 },	// 0x2E6F4C82
+		{ 24842, 0, 255 },	// 0x2E746E53
+		{ 24847, 0, 1 },	// 0x2E815A94
+		{ 24876, 0, 3 },	// 0x2E831921
+		{ 24895, 0, 255 },	// 0x2E921B0F
+		{ 24917, 0, 2 },	// 0x2E9B1F77
+		{ 24943, 0, 2 },	// 0x2E9E149D
+		{ 24958, 0, 3 },	// 0x2EAA3C4A
+		{ 24999, 0, 1 },	// 0x2EB751CC
+		{ 25046, 0, 2 },	// 0x2ED90276
+		{ 25070, 0, 4 },	// 0x2EE310C5
+		{ 25094, 0, 2 },	// 0x2EF477FD
+		{ 25112, 0, 2 },	// 0x2EF60AA6
+		{ 25140, 0, 0 },	// 0x2EF80425
+		{ 25170, 0, 1 },	// 0x2F0718CA
+		{ 25196, 0, 6 },	// 0x2F1D6843
+		{ 25207, 0, 1 },	// 0x2F206763
+		{ 25218, 0, 1 },	// 0x2F2226E5
+		{ 25244, 0, 8 },	// 0x2F2405D1
+		{ 25282, 0, 2 },	// 0x2F2F51E9
+		{ 25297, 0, 2 },	// 0x2F444F95
+		{ 25338, 0, 2 },	// 0x2F4B2A8B
+		{ 25368, 0, 1 },	// 0x2F542797
+		{ 25397, 0, 0 },	// 0x2F58286C
+		{ 25437, 0, 1 },	// 0x2F7508E7
+		{ 25478, 0, 6 },	// 0x2F877E8A
+		{ 25500, 0, 0 },	// 0x2F907FF2
+		{ 25537, 0, 1 },	// 0x2F9751E2
+		{ 25550, 0, 255 },	// 0x2F9B0583
+		{ 25574, 0, 6 },	// 0x2FA55669
+		{ 25604, 0, 2 },	// 0x2FA5601D
+		{ 25631, 0, 1 },	// 0x2FAE4C6E
+		{ 25652, 0, 2 },	// 0x2FB14E41
+		{ 25670, 0, 4 },	// 0x2FC728BB
+		{ 25694, 0, 1 },	// 0x2FC9782A
+		{ 25715, 0, 2 },	// 0x2FD83FB5
+		{ 25748, 0, 0 },	// 0x2FDF565D
+		{ 25787, 0, 2 },	// 0x2FED14F5
+		{ 25828, 0, 1 },	// 0x2FEE095B
+		{ 25848, 0, 3 },	// 0x2FF90FF5
+		{ 25865, 0, 255 },	// 0x2FFA0249
+		{ 25889, 0, 2 },	// 0x2FFA6C89
+		{ 25929, 0, 255 },	// 0x301545FD
+		{ 25955, 0, 2 },	// 0x302E113D
+		{ 25979, 0, 2 },	// 0x303C3059
+		{ 26003, 0, 2 },	// 0x30481141
+		{ 26032, 0, 0 },	// 0x30516A11
+		{ 26065, 0, 2 },	// 0x307A4B8E
+		{ 26090, 0, 3 },	// 0x308D1778
+		{ 26106, 0, 0 },	// 0x308E3719
+		{ 26135, 0, 7 },	// 0x30975326
+		{ 26154, 0, 9 },	// 0x309860C4
+		{ 26177, 0, 2 },	// 0x309C265B
+		{ 26200, 0, 2 },	// 0x30A65021
+		{ 26229, 0, 255 },	// 0x30B1316B
+		{ 26245, 0, 12 },	// 0x30BA2716
+		{ 26280, 0, 2 },	// 0x30BE3463
+		{ 26301, 0, 2 },	// 0x30C54CD2
+		{ 26334, 0, 1 },	// 0x30CD2F1F
+		{ 26355, 0, 0 },	// 0x30D17655
+		{ 26372, 0, 8 },	// 0x30D27EB1
+		{ 26394, 0, 1 },	// 0x30D373DF
+		{ 26420, 0, 2 },	// 0x30D427B4
+		{ 26450, 0, 1 },	// 0x30F71BC6
+		{ 26470, 0, 2 },	// 0x31017E6E
+		{ 26489, 0, 255 },	// 0x31026CE0
+		{ 26514, 0, 1 },	// 0x310E75C9
+		{ 26525, 0, 1 },	// 0x31102E20
+		{ 26554, 0, 5 },	// 0x311F4FE9
+		{ 26578, 0, 1 },	// 0x31321D1A
+		{ 26606, 0, 1 },	// 0x31492174
+		{ 26633, 0, 0 },	// 0x314E106A
+		{ 26660, 0, 3 },	// 0x314F6DD3
+		{ 26690, 0, 2 },	// 0x315238D5
+		{ 26717, 0, 1 },	// 0x3162071D
+		{ 26755, 0, 0 },	// 0x318F65E6
+		{ 26779, 0, 2 },	// 0x319E3A87
+		{ 26796, 0, 2 },	// 0x31A219FA
+		{ 26810, 0, 0 },	// 0x31A77970
+		{ 26841, 0, 5 },	// 0x31B64D2B
+		{ 26898, 0, 2 },	// 0x31CD5F18
+		{ 26927, 0, 1 },	// 0x31D53B3D
+		{ 26961, 0, 1 },	// 0x31DB4020
+		{ 26993, 0, 4 },	// 0x31E25160
+		{ 27021, 0, 2 },	// 0x31FC3392
+		{ 27060, 0, 7 },	// 0x320E1E3B
+		{ 27109, 0, 0 },	// 0x323806B1
+		{ 27125, 0, 1 },	// 0x32422759
+		{ 27141, 0, 1 },	// 0x32486214
+		{ 27158, 0, 1 },	// 0x324D1594
+		{ 27175, 0, 1 },	// 0x32501B1E
+		{ 27185, 0, 8 },	// 0x32517AE2
+		{ 27210, 0, 2 },	// 0x32563E09
+		{ 27244, 0, 2 },	// 0x32593711
+		{ 27264, 0, 2 },	// 0x325B1A34
+		{ 27300, 0, 2 },	// 0x32653482
+		{ 27328, 0, 2 },	// 0x326B576F
+		{ 27358, 0, 2 },	// 0x326E2886
+		{ 27380, 0, 1 },	// 0x32765F37
+		{ 27408, 0, 0 },	// 0x32795678
+		{ 27430, 0, 0 },	// 0x32A3647C
+		{ 27452, 0, 1 },	// 0x32A81853
+		{ 27464, 0, 2 },	// 0x32B4293B
+		{ 27479, 0, 2 },	// 0x32C24491
+		{ 27509, 0, 2 },	// 0x32C67003
+		{ 27533, 0, 2 },	// 0x32C67124
+		{ 27558, 0, 1 },	// 0x32C75195
+		{ 27580, 0, 1 },	// 0x32D3165D
+		{ 27609, 0, 8 },	// 0x32DA5E3A
+		{ 27623, 0, 5 },	// 0x32E45138
+		{ 27649, 0, 1 },	// 0x32E84B6A
+		{ 27669, 0, 4 },	// 0x331F7E6F
+		{ 27701, 0, 1 },	// 0x332F0E9A
+		{ 27727, 0, 0 },	// 0x33500089
+		{ 27755, 0, 0 },	// 0x33565078
+		{ 27785, 0, 1 },	// 0x335D0F34
+		{ 27805, 0, 5 },	// 0x335E3951
+		{ 27819, 0, 1 },	// 0x335E603B
+		{ 27846, 0, 5 },	// 0x337957AF
+		{ 27874, 0, 7 },	// 0x33D756A0
+		{ 27908, 0, 255 },	// 0x33E0601D
+		{ 27937, 0, 255 },	// 0x33F4498E
+		{ 27971, 0, 2 },	// 0x33F8250B
+		{ 27997, 0, 0 },	// 0x34211CDA
+		{ 28024, 0, 255 },	// 0x3432536A
+		{ 28062, 0, 2 },	// 0x34460DD7
+		{ 28082, 0, 9 },	// 0x34574B2A
+		{ 28118, 0, 255 },	// 0x3458600C
+		{ 28163, 0, 2 },	// 0x34686B92
+		{ 28186, 0, 255 },	// 0x346B4FE7
+		{ 28218, 0, 1 },	// 0x346D76E8
+		{ 28242, 0, 255 },	// 0x347C4300
+		{ 28273, 0, 2 },	// 0x347E05F3
+		{ 28293, 0, 1 },	// 0x348D7AF5
+		{ 28307, 0, 0 },	// 0x348F612D
+		{ 28319, 0, 1 },	// 0x349D5C27
+		{ 28344, 0, 2 },	// 0x34AC73D6
+		{ 28376, 0, 2 },	// 0x34BD72D7
+		{ 28408, 0, 2 },	// 0x34BF456A
+		{ 28421, 0, 1 },	// 0x34C751A2
+		{ 28442, 0, 1 },	// 0x34CB6291
+		{ 28461, 0, 1 },	// 0x34CC1F23
+		{ 28472, 0, 1 },	// 0x34F128F9
+		{ 28488, 0, 0 },	// 0x34F9164D
+		{ 28517, 0, 1 },	// 0x3514533B
+		{ 28548, 0, 1 },	// 0x351F4C86
+		{ 28567, 0, 2 },	// 0x35213375
+		{ 28588, 0, 6 },	// 0x352865D2
+		{ 28606, 0, 1 },	// 0x352921C4
+		{ 28636, 0, 2 },	// 0x353317C7
+		{ 28667, 0, 2 },	// 0x353F0568
+		{ 28700, 0, 4 },	// 0x355F3FEB
+		{ 28746, 0, 2 },	// 0x356876BF
+		{ 28772, 0, 0 },	// 0x35694DDC
+		{ 28781, 0, 255 },	// 0x356C2DDB
+		{ 28801, 0, 1 },	// 0x358E21C5
+		{ 28817, 0, 3 },	// 0x35A250C2
+		{ 28845, 0, 4 },	// 0x35A97B73
+		{ 28870, 0, 1 },	// 0x35CC3267
+		{ 28896, 0, 1 },	// 0x35E37826
+		{ 28911, 0, 1 },	// 0x35FA026D
+		{ 28945, 0, 0 },	// 0x360751AE
+		{ 28966, 0, 1 },	// 0x360E2977
+		{ 28996, 0, 1 },	// 0x361A01AD
+		{ 29026, 0, 8 },	// 0x36273536
+		{ 29043, 0, 2 },	// 0x362B5D1B
+		{ 29076, 0, 1 },	// 0x362B7D1B
+		{ 29099, 0, 1 },	// 0x365054A7
+		{ 29115, 0, 0 },	// 0x36511E0A
+		{ 29144, 0, 8 },	// 0x36537CE1
+		{ 29184, 0, 1 },	// 0x3659084A
+		{ 29201, 0, 255 },	// 0x36600272
+		{ 29218, 0, 2 },	// 0x36601178
+		{ 29253, 0, 0 },	// 0x366B0444
+		{ 29271, 0, 2 },	// 0x366B549F
+		{ 29297, 0, 4 },	// 0x368274DA
+		{ 29326, 0, 5 },	// 0x369A4540
+		{ 29359, 0, 2 },	// 0x36A33C21
+		{ 29381, 0, 1 },	// 0x36AD6480
+		{ 29402, 0, 0 },	// 0x36B40989
+		{ 29438, 0, 10 },	// 0x36D51DDF
+		{ 29468, 0, 2 },	// 0x36D60616
+		{ 29499, 0, 4 },	// 0x36DA42AF
+		{ 29530, 0, 4 },	// 0x36DF37DB
+		{ 29554, 0, 255 },	// 0x36F453FF
+		{ 29594, 0, 6 },	// 0x36F70AF6
+		{ 29608, 0, 0 },	// 0x36FC5CFB
+		{ 29635, 0, 7 },	// 0x371467E0
+		{ 29669, 0, 0 },	// 0x37282D4F
+		{ 29698, 0, 0 },	// 0x372C0DF1
+		{ 29725, 0, 2 },	// 0x372C7B2A
+		{ 29744, 0, 7 },	// 0x373B213C
+		{ 29783, 0, 4 },	// 0x375D6223
+		{ 29802, 0, 1 },	// 0x375F145D
+		{ 29831, 0, 10 },	// 0x376917AB
+		{ 29852, 0, 255 },	// 0x3775138E
+		{ 29875, 0, 2 },	// 0x378531F8
+		{ 29929, 0, 1 },	// 0x37871A37
+		{ 29944, 0, 1 },	// 0x37890B14
+		{ 29964, 0, 0 },	// 0x379930F3
+		{ 29997, 0, 255 },	// 0x379B0A8F
+		{ 30023, 0, 1 },	// 0x37A86FBD
+		{ 30057, 0, 1 },	// 0x37AC2A95
+		{ 30096, 0, 1 },	// 0x37BF18AC
+		{ 30117, 0, 255 },	// 0x37C85316
+		{ 30138, 0, 255 },	// 0x37CD55AA
+		{ 30177, 0, 0 },	// 0x37D022E0
+		{ 30197, 0, 1 },	// 0x380C142A
+		{ 30219, 0, 255 },	// 0x381C1F1C
+		{ 30237, 0, 2 },	// 0x38293796
+		{ 30260, 0, 1 },	// 0x382A19BE
+		{ 30299, 0, 2 },	// 0x38330B4A
+		{ 30317, 0, 2 },	// 0x384B3876
+		{ 30333, 0, 3 },	// 0x384E3F3A
+		{ 30363, 0, 3 },	// 0x384F104F
+		{ 30398, 0, 255 },	// 0x38824BFE
+		{ 30447, 0, 1 },	// 0x38861F3A
+		{ 30475, 0, 255 },	// 0x388D6B44
+		{ 30491, 0, 1 },	// 0x38905687
+		{ 30520, 0, 0 },	// 0x38A10933
+		{ 30567, 0, 1 },	// 0x38AD2830
+		{ 30586, 0, 0 },	// 0x38BE5BF6
+		{ 30607, 0, 0 },	// 0x38F61531
+		{ 30629, 0, 255 },	// 0x391822A7
+		{ 30649, 0, 1 },	// 0x391B5A76
+		{ 30683, 0, 0 },	// 0x391E4575
+		{ 30709, 0, 3 },	// 0x39200B83
+		{ 30731, 0, 255 },	// 0x39264921
+		{ 30758, 0, 0 },	// 0x39487FB9
+		{ 30777, 0, 1 },	// 0x394C1E55
+		{ 30805, 0, 2 },	// 0x394E733E
+		{ 30828, 0, 2 },	// 0x39551B76
+		{ 30836, 0, 1 },	// 0x39587D51
+		{ 30861, 0, 0 },	// 0x396844BE
+		{ 30883, 0, 255 },	// 0x3970702E
+		{ 30885, 0, 1 },	// 0x3998154E
+		{ 30920, 0, 0 },	// 0x399E1A43
+		{ 30958, 0, 8 },	// 0x39C2663E
+		{ 30986, 0, 1 },	// 0x39D87BD6
+		{ 31009, 0, 5 },	// 0x39DC5AEB
+		{ 31032, 0, 1 },	// 0x39DE515D
+		{ 31047, 0, 1 },	// 0x39E600D0
+		{ 31071, 0, 5 },	// 0x39E77F70
+		{ 31120, 0, 9 },	// 0x39ED0C43
+		{ 31132, 0, 3 },	// 0x39F62BFB
+		{ 31143, 0, 0 },	// 0x39FD432B
+		{ 31167, 0, 0 },	// 0x3A115D9D
+		{ 31183, 0, 1 },	// 0x3A2246BB
+		{ 31216, 0, 255 },	// 0x3A244927
+		{ 31238, 0, 10 },	// 0x3A2A77F9
+		{ 31263, 0, 1 },	// 0x3A323C67
+		{ 31298, 0, 1 },	// 0x3A6B0308
+		{ 31330, 0, 255 },	// 0x3A774777
+		{ 31341, 0, 2 },	// 0x3A7B78C5
+		{ 31368, 0, 1 },	// 0x3A820D46
+		{ 31393, 0, 2 },	// 0x3A8531E8
+		{ 31406, 0, 2 },	// 0x3A9A0869
+		{ 31427, 0, 3 },	// 0x3AAD447A
+		{ 31469, 0, 1 },	// 0x3AAF5BE5
+		{ 31493, 0, 2 },	// 0x3AB06137
+		{ 31517, 0, 3 },	// 0x3AC85DB1
+		{ 31537, 0, 255 },	// 0x3AC90796
+		{ 31577, 0, 2 },	// 0x3ACC1794
+		{ 31597, 0, 3 },	// 0x3AE77439
+		{ 31623, 0, 255 },	// 0x3AF307B1
+		{ 31644, 0, 255 },	// 0x3B007E58
+		{ 31688, 0, 0 },	// 0x3B0C6738
+		{ 31713, 0, 8 },	// 0x3B2526E3
+		{ 31723, 0, 0 },	// 0x3B2E3198
+		{ 31759, 0, 1 },	// 0x3B4C2E2E
+		{ 31769, 0, 2 },	// 0x3B4F1EBA
+		{ 31789, 0, 255 },	// 0x3B5D0F27
+		{ 31816, 0, 2 },	// 0x3B6E1D1E
+		{ 31842, 0, 255 },	// 0x3B8F5E20
+		{ 31867, 0, 4 },	// 0x3B977FD4
+		{ 31885, 0, 255 },	// 0x3BB313CB
+		{ 31921, 0, 255 },	// 0x3BB57426
+		{ 31947, 0, 2 },	// 0x3BBE6DBE
+		{ 31993, 0, 4 },	// 0x3BC827E6
+		{ 32018, 0, 7 },	// 0x3BCA4ACA
+		{ 32048, 0, 1 },	// 0x3BD729E9
+		{ 32071, 0, 4 },	// 0x3BDA562E
+		{ 32093, 0, 2 },	// 0x3BDB4496
+		{ 32111, 0, 8 },	// 0x3BE7444A
+		{ 32148, 0, 2 },	// 0x3BF06336
+		{ 32196, 0, 1 },	// 0x3BF5404E
+		{ 32215, 0, 2 },	// 0x3BF71D5F
+		{ 32257, 0, 2 },	// 0x3BF93ED7
+		{ 32283, 0, 1 },	// 0x3C116620
+		{ 32312, 0, 1 },	// 0x3C156533
+		{ 32347, 0, 2 },	// 0x3C293296
+		{ 32386, 0, 2 },	// 0x3C295451
+		{ 32420, 0, 4 },	// 0x3C2A3334
+		{ 32440, 0, 6 },	// 0x3C3E5FA0
+		{ 32467, 0, 0 },	// 0x3C64626F
+		{ 32485, 0, 1 },	// 0x3C714F12
+		{ 32535, 0, 2 },	// 0x3C756E54
+		{ 32551, 0, 1 },	// 0x3C78449F
+		{ 32564, 0, 9 },	// 0x3C7B6092
+		{ 32584, 0, 2 },	// 0x3C7C3E89
+		{ 32609, 0, 2 },	// 0x3C85109F
+		{ 32630, 0, 1 },	// 0x3C997E4C
+		{ 32653, 0, 0 },	// 0x3CA23254
+		{ 32686, 0, 1 },	// 0x3CAA1340
+		{ 32712, 0, 10 },	// 0x3CB4693B
+		{ 32762, 0, 255 },	// 0x3CC5682F
+		{ 32801, 0, 0 },	// 0x3CCB4248
+		{ 32829, 0, 255 },	// 0x3CCC5AFD
+		{ 32858, 0, 0 },	// 0x3CD60F11
+		{ 32869, 0, 2 },	// 0x3CD830D0
+		{ 32900, 0, 1 },	// 0x3CDA1A07
+		{ 32916, 0, 3 },	// 0x3CE05E7C
+		{ 32928, 0, 6 },	// 0x3CEB6C7B
+		{ 32971, 0, 3 },	// 0x3CEE0376
+		{ 32994, 0, 255 },	// 0x3CF41D47
+		{ 33018, 0, 8 },	// 0x3D003090
+		{ 33041, 0, 1 },	// 0x3D0432F2
+		{ 33064, 0, 1 },	// 0x3D0A71A2
+		{ 33102, 0, 2 },	// 0x3D0B5E56
+		{ 33141, 0, 6 },	// 0x3D0F5735
+		{ 33158, 0, 1 },	// 0x3D385F6D
+		{ 33175, 0, 2 },	// 0x3D3B5D94
+		{ 33198, 0, 1 },	// 0x3D562F78
+		{ 33206, 0, 255 },	// 0x3D703ED7
+		{ 33221, 0, 7 },	// 0x3D7A673F
+		{ 33260, 0, 1 },	// 0x3D7B10E7
+		{ 33290, 0, 255 },	// 0x3D91564E
+		{ 33311, 0, 255 },	// 0x3DA200CB
+		{ 33335, 0, 2 },	// 0x3DA4533F
+		{ 33374, 0, 6 },	// 0x3DAB7D72
+		{ 33400, 0, 2 },	// 0x3DAF3F94
+		{ 33430, 0, 2 },	// 0x3DBF53E0
+		{ 33465, 0, 0 },	// 0x3DFE691D
+		{ 33484, 0, 0 },	// 0x3E0229EB
+		{ 33501, 0, 1 },	// 0x3E1051E0
+		{ 33511, 0, 2 },	// 0x3E156AFC
+		{ 33526, 0, 1 },	// 0x3E251ADE
+		{ 33541, 0, 6 },	// 0x3E441A58
+		{ 33571, 0, 1 },	// 0x3E5B7E59
+		{ 33594, 0, 1 },	// 0x3E5F2362
+		{ 33621, 0, 4 },	// 0x3E6137CB
+		{ 33649, 0, 2 },	// 0x3E657606
+		{ 33678, 0, 2 },	// 0x3E733990
+		{ 33694, 0, 255 },	// 0x3E762D9D
+		{ 33729, 0, 4 },	// 0x3E7D3074
+		{ 33748, 0, 255 },	// 0x3E8443E0
+		{ 33773, 0, 1 },	// 0x3E8D7D3F
+		{ 33811, 0, 1 },	// 0x3E9C7CD3
+		{ 33853, 0, 0 },	// 0x3EA0648D
+		{ 33889, 0, 4 },	// 0x3EA116F7
+		{ 33903, 0, 1 },	// 0x3EA5269D
+		{ 33931, 0, 2 },	// 0x3EBE11B9
+		{ 33954, 0, 2 },	// 0x3ECC0086
+		{ 33980, 0, 1 },	// 0x3ED135AD
+		{ 34005, 0, 2 },	// 0x3EF15B6A
+		{ 34025, 0, 2 },	// 0x3EFA66E8
+		{ 34044, 0, 10 },	// 0x3EFC1A7D
+		{ 34062, 0, 2 },	// 0x3EFE3DC8
+		{ 34088, 0, 2 },	// 0x3F0022F7
+		{ 34124, 0, 4 },	// 0x3F054F44
+		{ 34149, 0, 1 },	// 0x3F0A2A72
+		{ 34190, 0, 2 },	// 0x3F0F4E0C
+		{ 34215, 0, 0 },	// 0x3F1D4677
+		{ 34247, 0, 0 },	// 0x3F1F51E0
+		{ 34294, 0, 1 },	// 0x3F236954
+		{ 34317, 0, 2 },	// 0x3F296F78
+		{ 34339, 0, 6 },	// 0x3F2D7D06
+		{ 34366, 0, 2 },	// 0x3F413561
+		{ 34384, 0, 2 },	// 0x3F4950AC
+		{ 34400, 0, 1 },	// 0x3F6B5975
+		{ 34427, 0, 4 },	// 0x3F89280B
+		{ 34460, 0, 1 },	// 0x3F9B2DD6
+		{ 34481, 0, 0 },	// 0x3F9F0CF5
+		{ 34505, 0, 1 },	// 0x3FA46EB8
+		{ 34531, 0, 2 },	// 0x3FA651A7
+		{ 34563, 0, 1 },	// 0x3FB14EC5
+		{ 34588, 0, 10 },	// 0x3FB22EE2
+		{ 34602, 0, 2 },	// 0x3FB72D27
+		{ 34620, 0, 1 },	// 0x3FB83379
+		{ 34656, 0, 255 },	// 0x3FBF13BD
+		{ 34672, 0, 3 },	// 0x3FF16CBC
+		{ 34691, 0, 3 },	// 0x3FFA65EE
+		{ 34716, 0, 1 },	// 0x3FFF4DE9
+		{ 34746, 0, 1 },	// 0x40035D5D
+		{ 34768, 0, 0 },	// 0x40072120
+		{ 34804, 0, 0 },	// 0x4013147B
+		{ 34812, 0, 1 },	// 0x404E0056
+		{ 34848, 0, 255 },	// 0x405B02B7
+		{ 34853, 0, 1 },	// 0x405B16CF
+		{ 34873, 0, 255 },	// 0x40602B66
+		{ 34903, 0, 6 },	// 0x406A035E
+		{ 34930, 0, 1 },	// 0x408E2F70
+		{ 34957, 0, 2 },	// 0x40A703A6
+		{ 34984, 0, 2 },	// 0x40A708A6
+		{ 35009, 0, 1 },	// 0x40CD2BD4
+		{ 35042, 0, 9 },	// 0x40CF3953
+		{ 35082, 0, 2 },	// 0x40D01439
+		{ 35119, 0, 3 },	// 0x40F61D4A
+		{ 35150, 0, 255 },	// 0x40FC5520
+		{ 35179, 0, 255 },	// 0x41121D51
+		{ 35227, 0, 0 },	// 0x41286578
+		{ 35244, 0, 1 },	// 0x412E68D0
+		{ 35261, 0, 255 },	// 0x41401D46
+		{ 35283, 0, 1 },	// 0x41596B09
+		{ 35298, 0, 3 },	// 0x416413F6
+		{ 35332, 0, 2 },	// 0x417F6EBD
+		{ 35354, 0, 1 },	// 0x418D0889
+		{ 35370, 0, 2 },	// 0x41AB3C30
+		{ 35387, 0, 1 },	// 0x41E45BE5
+		{ 35411, 0, 4 },	// 0x41ED206B
+		{ 35439, 0, 6 },	// 0x41F27499
+		{ 35457, 0, 2 },	// 0x41FA2D0C
+		{ 35471, 0, 0 },	// 0x42180729
+		{ 35493, 0, 0 },	// 0x422055C7
+		{ 35525, 0, 1 },	// 0x422C1818
+		{ 35546, 0, 16 },	// 0x422E7AC3
+		{ 35561, 0, 1 },	// 0x423661A7
+		{ 35585, 0, 5 },	// 0x42492860
+		{ 35604, 0, 1 },	// 0x42690F6B
+		{ 35627, 0, 2 },	// 0x426A4ED8
+		{ 35650, 0, 6 },	// 0x42941472
+		{ 35675, 0, 255 },	// 0x42D249E3
+		{ 35716, 0, 1 },	// 0x42D250A7
+		{ 35744, 0, 3 },	// 0x42DB145F
+		{ 35768, 0, 0 },	// 0x42F1557D
+		{ 35796, 0, 4 },	// 0x42F561F2
+		{ 35816, 0, 255 },	// 0x42FC2C31
+		{ 35833, 0, 0 },	// 0x4307784F
+		{ 35851, 0, 3 },	// 0x43167C6E
+		{ 35877, 0, 5 },	// 0x43197215
+		{ 35902, 0, 5 },	// 0x433E74C6
+		{ 35928, 0, 255 },	// 0x4342350C
+		{ 35953, 0, 255 },	// 0x434534BE
+		{ 35976, 0, 12 },	// 0x434611A3
+		{ 35995, 0, 6 },	// 0x43475BB3
+		{ 36017, 0, 2 },	// 0x435054B3
+		{ 36033, 0, 5 },	// 0x43573596
+		{ 36056, 0, 1 },	// 0x4371502A
+		{ 36075, 0, 1 },	// 0x4371559F
+		{ 36109, 0, 3 },	// 0x437D247E
+		{ 36123, 0, 1 },	// 0x437D3E19
+		{ 36148, 0, 12 },	// 0x438F6ECB
+		{ 36170, 0, 1 },	// 0x439C47D5
+		{ 36208, 0, 3 },	// 0x43A13718
+		{ 36227, 0, 0 },	// 0x43A67F1B
+		{ 36257, 0, 255 },	// 0x43C2796B
+		{ 36290, 0, 1 },	// 0x43CC0913
+		{ 36311, 0, 2 },	// 0x43E41D81
+		{ 36341, 0, 2 },	// 0x43E42686
+		{ 36356, 0, 2 },	// 0x43ED66E3
+		{ 36375, 0, 1 },	// 0x43EF56EE
+		{ 36405, 0, 1 },	// 0x43F5151F
+		{ 36426, 0, 1 },	// 0x43F7517D
+		{ 36445, 0, 0 },	// 0x43F86230
+		{ 36472, 0, 2 },	// 0x440D0A91
+		{ 36504, 0, 1 },	// 0x4414660B
+		{ 36534, 0, 2 },	// 0x441B1EAF
+		{ 36556, 0, 5 },	// 0x442B1C1D
+		{ 36581, 0, 3 },	// 0x4437501B
+		{ 36602, 0, 2 },	// 0x44414E60
+		{ 36620, 0, 1 },	// 0x44474526
+		{ 36648, 0, 2 },	// 0x4458184A
+		{ 36687, 0, 4 },	// 0x44640C28
+		{ 36711, 0, 1 },	// 0x446677C6
+		{ 36732, 0, 1 },	// 0x446E6515
+		{ 36754, 0, 2 },	// 0x446F74E5
+		{ 36772, 0, 2 },	// 0x44717CF9
+		{ 36789, 0, 2 },	// 0x4475789E
+		{ 36812, 0, 2 },	// 0x447B154B
+		{ 36828, 0, 2 },	// 0x44881D27
+		{ 36852, 0, 1 },	// 0x448F486A
+		{ 36881, 0, 0 },	// 0x449264B6
+		{ 36911, 0, 4 },	// 0x4496175C
+		{ 36930, 0, 2 },	// 0x44984033
+		{ 36964, 0, 7 },	// 0x449F4165
+		{ 37003, 0, 8 },	// 0x44A30283
+		{ 37022, 0, 0 },	// 0x44AA32A7
+		{ 37052, 0, 2 },	// 0x44AA71F9
+		{ 37076, 0, 1 },	// 0x44B30452
+		{ 37103, 0, 255 },	// 0x44BB2306
+		{ 37137, 0, 1 },	// 0x44C27071
+		{ 37148, 0, 2 },	// 0x44D349D9
+		{ 37166, 0, 2 },	// 0x44D56F66
+		{ 37182, 0, 3 },	// 0x44E14770
+		{ 37208, 0, 3 },	// 0x44EA2669
+		{ 37229, 0, 5 },	// 0x44EA47BB
+		{ 37278, 0, 255 },	// 0x45073C46
+		{ 37305, 0, 255 },	// 0x45345838
+		{ 37331, 0, 1 },	// 0x453F587D
+		{ 37361, 0, 7 },	// 0x45472E9D
+		{ 37381, 0, 0 },	// 0x456C0C43
+		{ 37418, 0, 2 },	// 0x456C6096
+		{ 37441, 0, 1 },	// 0x45852A03
+		{ 37471, 0, 2 },	// 0x458C333D
+		{ 37491, 0, 255 },	// 0x459A7F23
+		{ 37521, 0, 1 },	// 0x45AA529D
+		{ 37555, 0, 1 },	// 0x45AB718F
+		{ 37597, 0, 0 },	// 0x45C344AA
+		{ 37615, 0, 1 },	// 0x45C63B22
+		{ 37639, 0, 2 },	// 0x45CE21CA
+		{ 37670, 0, 2 },	// 0x45D23711
+		{ 37699, 0, 2 },	// 0x45D71590
+		{ 37717, 0, 2 },	// 0x45DB5FE9
+		{ 37734, 0, 255 },	// 0x45DF1D92
+		{ 37769, 0, 2 },	// 0x45DF7CCA
+		{ 37791, 0, 1 },	// 0x45E45B1D
+		{ 37825, 0, 1 },	// 0x45E80BF7
+		{ 37858, 0, 3 },	// 0x45EE4E9A
+		{ 37873, 0, 0 },	// 0x45F249B7
+		{ 37889, 0, 2 },	// 0x45F32596
+		{ 37916, 0, 1 },	// 0x45FB5CE1
+		{ 37937, 0, 2 },	// 0x460837F9
+		{ 37953, 0, 5 },	// 0x460D2EBB
+		{ 37966, 0, 3 },	// 0x463832F7
+		{ 37992, 0, 1 },	// 0x46531797
+		{ 38008, 0, 0 },	// 0x465574B0
+		{ 38029, 0, 2 },	// 0x465D424D
+		{ 38062, 0, 5 },	// 0x466B5AA0
+		{ 38094, 0, 255 },	// 0x4674049B
+		{ 38100, 0, 2 },	// 0x4678769C
+		{ 38111, 0, 2 },	// 0x46803CFA
+		{ 38127, 0, 1 },	// 0x46892D07
+		{ 38148, 0, 1 },	// 0x46920944
+		{ 38177, 0, 1 },	// 0x46953225
+		{ 38192, 0, 2 },	// 0x46B5523B
+		{ 38209, 0, 2 },	// 0x46C41EA8
+		{ 38227, 0, 0 },	// 0x46CC31B4
+		{ 38239, 0, 5 },	// 0x46CD1D73
+		{ 38272, 0, 3 },	// 0x46D01849
+		{ 38304, 0, 255 },	// 0x46F87F55
+		{ 38321, 0, 1 },	// 0x470A7CBD
+		{ 38341, 0, 1 },	// 0x47147EC5
+		{ 38363, 0, 2 },	// 0x4727446B
+		{ 38394, 0, 1 },	// 0x472C710B
+		{ 38434, 0, 2 },	// 0x472E65D6
+		{ 38465, 0, 1 },	// 0x47381E59
+		{ 38480, 0, 2 },	// 0x475267B0
+		{ 38510, 0, 0 },	// 0x475D2BEA
+		{ 38537, 0, 5 },	// 0x47787A40
+		{ 38575, 0, 1 },	// 0x478976DB
+		{ 38592, 0, 2 },	// 0x47A21100
+		{ 38610, 0, 5 },	// 0x47A77D2E
+		{ 38633, 0, 2 },	// 0x47AC289C
+		{ 38660, 0, 2 },	// 0x47CA7C53
+		{ 38671, 0, 1 },	// 0x47D9437C
+		{ 38707, 0, 1 },	// 0x47E03E87
+		{ 38728, 0, 1 },	// 0x47E50BD3
+		{ 38742, 0, 0 },	// 0x47E93CB8
+		{ 38765, 0, 1 },	// 0x47F430BE
+		{ 38796, 0, 2 },	// 0x47F971E8
+		{ 38820, 0, 2 },	// 0x47FD2517
+		{ 38845, 0, 255 },	// 0x48032420
+		{ 38872, 0, 0 },	// 0x4806044A
+		{ 38890, 0, 7 },	// 0x481E2BE7
+		{ 38924, 0, 5 },	// 0x48252E33
+		{ 38952, 0, 9 },	// 0x482B2B74
+		{ 38984, 0, 1 },	// 0x4832644E
+		{ 39011, 0, 255 },	// 0x4835637D
+		{ 39038, 0, 11 },	// 0x483A62AB
+		{ 39082, 0, 2 },	// 0x483E5BE8
+		{ 39092, 0, 1 },	// 0x484964FE
+		{ 39113, 0, 4 },	// 0x48543AED
+		{ 39143, 0, 0 },	// 0x48573CF7
+		{ 39171, 0, 2 },	// 0x4859273F
+		{ 39193, 0, 1 },	// 0x486F3D93
+		{ 39210, 0, 0 },	// 0x48726B45
+		{ 39231, 0, 1 },	// 0x48740598
+		{ 39250, 0, 2 },	// 0x48850E66
+		{ 39279, 0, 255 },	// 0x48994D58
+		{ 39292, 0, 0 },	// 0x489B0BB9
+		{ 39320, 0, 1 },	// 0x489C3A48
+		{ 39359, 0, 0 },	// 0x48A723C1
+		{ 39383, 0, 3 },	// 0x48CE0609
+		{ 39404, 0, 1 },	// 0x48ED6432
+		{ 39434, 0, 255 },	// 0x4908091D
+		{ 39467, 0, 2 },	// 0x49105005
+		{ 39486, 0, 255 },	// 0x49261BA6
+		{ 39492, 0, 255 },	// 0x49283645
+		{ 39509, 0, 4 },	// 0x492A71E2
+		{ 39538, 0, 1 },	// 0x493B655B
+		{ 39570, 0, 2 },	// 0x495B0B6F
+		{ 39587, 0, 1 },	// 0x495D445F
+		{ 39627, 0, 1 },	// 0x495D6021
+		{ 39643, 0, 2 },	// 0x495F399D
+		{ 39661, 0, 5 },	// 0x49763A4F
+		{ 39690, 0, 0 },	// 0x497E6745
+		{ 39717, 0, 4 },	// 0x49850843
+		{ 39739, 0, 7 },	// 0x498B3BE4
+		{ 39781, 0, 2 },	// 0x499700EF
+		{ 39809, 0, 1 },	// 0x499852DB
+		{ 39819, 0, 3 },	// 0x499B6DB6
+		{ 39855, 0, 2 },	// 0x499C0C01
+		{ 39886, 0, 1 },	// 0x49A75618
+		{ 39901, 0, 2 },	// 0x49B6525C
+		{ 39916, 0, 4 },	// 0x49DA4F9E
+		{ 39939, 0, 2 },	// 0x49EA22C8
+		{ 39961, 0, 3 },	// 0x49F619F1
+		{ 39981, 0, 2 },	// 0x49F86791
+		{ 40007, 0, 0 },	// 0x49FD2621
+		{ 40046, 0, 1 },	// 0x49FF799A
+		{ 40093, 0, 1 },	// 0x4A000F52
+		{ 40108, 0, 0 },	// 0x4A164056
+		{ 40130, 0, 1 },	// 0x4A1D15D5
+		{ 40146, 0, 4 },	// 0x4A2C5544
+		{ 40167, 0, 2 },	// 0x4A2E3BCA
+		{ 40188, 0, 4 },	// 0x4A3D6D97
+		{ 40228, 0, 255 },	// 0x4A4B0F18
+		{ 40254, 0, 1 },	// 0x4A4F2699
+		{ 40275, 0, 7 },	// 0x4A673763
+		{ 40287, 0, 1 },	// 0x4A7802CB
+		{ 40311, 0, 1 },	// 0x4A7C19FE
+		{ 40333, 0, 1 },	// 0x4A802E89
+		{ 40351, 0, 0 },	// 0x4A8245F1
+		{ 40380, 0, 6 },	// 0x4A8E429A
+		{ 40410, 0, 5 },	// 0x4A904476
+		{ 40428, 0, 1 },	// 0x4A906237
+		{ 40447, 0, 2 },	// 0x4AA762A4
+		{ 40480, 0, 1 },	// 0x4AA86394
+		{ 40504, 0, 1 },	// 0x4AB470F3
+		{ 40521, 0, 2 },	// 0x4AC023C4
+		{ 40546, 0, 2 },	// 0x4ACB039B
+		{ 40564, 0, 255 },	// 0x4AD026EE
+		{ 40607, 0, 0 },	// 0x4AD22B80
+		{ 40640, 0, 3 },	// 0x4ADB10A4
+		{ 40674, 0, 2 },	// 0x4ADB6F79
+		{ 40698, 0, 0 },	// 0x4AF14146
+		{ 40727, 0, 255 },	// 0x4AF643D5
+		{ 40739, 0, 2 },	// 0x4AF73456
+		{ 40763, 0, 0 },	// 0x4B2103F0
+		{ 40772, 0, 2 },	// 0x4B2625BE
+		{ 40799, 0, 1 },	// 0x4B470947
+		{ 40835, 0, 255 },	// 0x4B5832BE
+		{ 40859, 0, 1 },	// 0x4B5C4957
+		{ 40891, 0, 4 },	// 0x4B6135E8
+		{ 40921, 0, 0 },	// 0x4B6211F2
+		{ 40941, 0, 5 },	// 0x4B684D0B
+		{ 40960, 0, 2 },	// 0x4B6C2256
+		{ 40976, 0, 5 },	// 0x4B6E368D
+		{ 41009, 0, 0 },	// 0x4B7B5F77
+		{ 41037, 0, 5 },	// 0x4B7C3AEC
+		{ 41075, 0, 1 },	// 0x4B8B6F24
+		{ 41097, 0, 0 },	// 0x4B907716
+		{ 41128, 0, 2 },	// 0x4B920E81
+		{ 41155, 0, 1 },	// 0x4BAC2912
+		{ 41176, 0, 1 },	// 0x4BAF0213
+		{ 41207, 0, 2 },	// 0x4BB9178A
+		{ 41236, 0, 9 },	// 0x4BD4248E
+		{ 41254, 0, 0 },	// 0x4BF36A32
+		{ 41275, 0, 3 },	// 0x4C076B40
+		{ 41295, 0, 6 },	// 0x4C1E3A64
+		{ 41322, 0, 2 },	// 0x4C1E75DB
+		{ 41338, 0, 3 },	// 0x4C2621B6
+		{ 41368, 0, 1 },	// 0x4C2879AD
+		{ 41384, 0, 6 },	// 0x4C3C1F3C
+		{ 41401, 0, 2 },	// 0x4C5142C0
+		{ 41414, 0, 1 },	// 0x4C5475E3
+		{ 41433, 0, 1 },	// 0x4C7B7A29
+		{ 41464, 0, 255 },	// 0x4C872A85
+		{ 41497, 0, 2 },	// 0x4C8A7614
+		{ 41524, 0, 1 },	// 0x4C9B749F
+		{ 41565, 0, 4 },	// 0x4CA708B9
+		{ 41585, 0, 2 },	// 0x4CAE3B65
+		{ 41597, 0, 2 },	// 0x4CB729F1
+		{ 41621, 0, 2 },	// 0x4CC001AC
+		{ 41652, 0, 3 },	// 0x4CC81FCB
+		{ 41667, 0, 2 },	// 0x4CD43E46
+		{ 41691, 0, 1 },	// 0x4CFE3998
+		{ 41727, 0, 3 },	// 0x4D077DBA
+		{ 41761, 0, 2 },	// 0x4D155EE8
+		{ 41810, 0, 255 },	// 0x4D2771CE
+		{ 41833, 0, 3 },	// 0x4D2E58D5
+		{ 41856, 0, 15 },	// 0x4D317353
+		{ 41872, 0, 6 },	// 0x4D3547D1
+		{ 41898, 0, 2 },	// 0x4D417CD3
+		{ 41913, 0, 1 },	// 0x4D460265
+		{ 41938, 0, 7 },	// 0x4D4F65AE
+		{ 41959, 0, 1 },	// 0x4D6665F7
+		{ 41988, 0, 6 },	// 0x4D6B3E20
+		{ 42035, 0, 255 },	// 0x4D7775BA
+		{ 42059, 0, 2 },	// 0x4D7D105A
+		{ 42077, 0, 1 },	// 0x4D7E12A7
+		{ 42099, 0, 4 },	// 0x4D9C4195
+		{ 42140, 0, 6 },	// 0x4DA362B0
+		{ 42168, 0, 4 },	// 0x4DAA221F
+		{ 42191, 0, 2 },	// 0x4DAF2C87
+		{ 42211, 0, 6 },	// 0x4DB55DF5
+		{ 42237, 0, 3 },	// 0x4DD43FFD
+		{ 42260, 0, 0 },	// 0x4DDB5D59
+		{ 42284, 0, 5 },	// 0x4DDC6FB4
+		{ 42310, 0, 6 },	// 0x4DE152A0
+		{ 42324, 0, 2 },	// 0x4DFE09D6
+		{ 42335, 0, 2 },	// 0x4E2260B9
+		{ 42352, 0, 1 },	// 0x4E237943
+		{ 42377, 0, 0 },	// 0x4E26149C
+		{ 42396, 0, 2 },	// 0x4E2C764D
+		{ 42434, 0, 0 },	// 0x4E323A0A
+		{ 42468, 0, 1 },	// 0x4E386C7B
+		{ 42508, 0, 0 },	// 0x4E493AAF
+		{ 42539, 0, 1 },	// 0x4E4C2F92
+		{ 42566, 0, 255 },	// 0x4E6120A9
+		{ 42608, 0, 1 },	// 0x4E61480A
+		{ 42625, 0, 1 },	// 0x4E637988
+		{ 42647, 0, 2 },	// 0x4E653BCC
+		{ 42667, 0, 1 },	// 0x4E68316C
+		{ 42688, 0, 4 },	// 0x4ECB189E
+		{ 42719, 0, 1 },	// 0x4ECB2267
+		{ 42735, 0, 0 },	// 0x4ECE1AD2
+		{ 42757, 0, 2 },	// 0x4ED45146
+		{ 42774, 0, 0 },	// 0x4ED6764C
+		{ 42801, 0, 255 },	// 0x4EFE6B67
+		{ 42826, 0, 1 },	// 0x4F0D4AC7
+		{ 42846, 0, 0 },	// 0x4F0F2AA8
+		{ 42859, 0, 4 },	// 0x4F256F49
+		{ 42882, 0, 2 },	// 0x4F29072E
+		{ 42915, 0, 2 },	// 0x4F37648C
+		{ 42949, 0, 2 },	// 0x4F5D027C
+		{ 42968, 0, 1 },	// 0x4F66544E
+		{ 42993, 0, 2 },	// 0x4F705478
+		{ 43008, 0, 5 },	// 0x4F7F4FAE
+		{ 43040, 0, 1 },	// 0x4F884E33
+		{ 43075, 0, 1 },	// 0x4F8B4507
+		{ 43088, 0, 0 },	// 0x4F9342F3
+		{ 43111, 0, 1 },	// 0x4FAF2007
+		{ 43142, 0, 1 },	// 0x4FB069ED
+		{ 43168, 0, 1 },	// 0x4FB30DB6
+		{ 43205, 0, 5 },	// 0x4FD34079
+		{ 43237, 0, 255 },	// 0x4FDD00CE
+		{ 43259, 0, 0 },	// 0x4FE17259
+		{ 43289, 0, 4 },	// 0x4FE23851
+		{ 43313, 0, 2 },	// 0x4FE23F25
+		{ 43334, 0, 1 },	// 0x4FE923DC
+		{ 43351, 0, 0 },	// 0x4FF71989
+		{ 43379, 0, 1 },	// 0x502B5185
+		{ 43393, 0, 9 },	// 0x50307F63
+		{ 43413, 0, 4 },	// 0x50311928
+		{ 43430, 0, 1 },	// 0x503E2D1E
+		{ 43459, 0, 2 },	// 0x50424095
+		{ 43486, 0, 1 },	// 0x504E03FC
+		{ 43535, 0, 3 },	// 0x505518A2
+		{ 43547, 0, 1 },	// 0x505D37D8
+		{ 43584, 0, 1 },	// 0x5062055B
+		{ 43602, 0, 3 },	// 0x506C2898
+		{ 43646, 0, 2 },	// 0x50801274
+		{ 43677, 0, 1 },	// 0x5086785F
+		{ 43689, 0, 0 },	// 0x509D75E8
+		{ 43708, 0, 3 },	// 0x509F236D
+		{ 43737, 0, 1 },	// 0x50AD1F3E
+		{ 43763, 0, 1 },	// 0x50BB02F7
+		{ 43788, 0, 255 },	// 0x50C13702
+		{ 43817, 0, 0 },	// 0x50C72493
+		{ 43840, 0, 2 },	// 0x50D15F0D
+		{ 43857, 0, 0 },	// 0x50DC54B3
+		{ 43876, 0, 2 },	// 0x50E21E4C
+		{ 43895, 0, 255 },	// 0x50E33E8F
+		{ 43928, 0, 6 },	// 0x50EE161F
+		{ 43951, 0, 0 },	// 0x50FF1428
+		{ 43965, 0, 1 },	// 0x51112E95
+		{ 43996, 0, 3 },	// 0x511200C7
+		{ 44016, 0, 2 },	// 0x511454A9
+		{ 44032, 0, 0 },	// 0x511A2EC9
+		{ 44055, 0, 3 },	// 0x511A3B01
+		{ 44073, 0, 0 },	// 0x513D68DB
+		{ 44091, 0, 1 },	// 0x51453EA2
+		{ 44127, 0, 4 },	// 0x51517B11
+		{ 44156, 0, 2 },	// 0x51546112
+		{ 44172, 0, 10 },	// 0x515C3218
+		{ 44196, 0, 1 },	// 0x51643697
+		{ 44219, 0, 2 },	// 0x517B226E
+		{ 44250, 0, 2 },	// 0x517B7068
+		{ 44267, 0, 1 },	// 0x51870C68
+		{ 44283, 0, 255 },	// 0x51983F94
+		{ 44297, 0, 4 },	// 0x51A06698
+		{ 44309, 0, 2 },	// 0x51AD2993
+		{ 44338, 0, 10 },	// 0x51C00627
+		{ 44378, 0, 1 },	// 0x51DF00D8
+		{ 44407, 0, 1 },	// 0x51E14C1B
+		{ 44429, 0, 2 },	// 0x51F54148
+		{ 44476, 0, 1 },	// 0x520A745D
+		{ 44513, 0, 2 },	// 0x52100540
+		{ 44529, 0, 2 },	// 0x521035AA
+		{ 44552, 0, 2 },	// 0x5213511B
+		{ 44567, 0, 1 },	// 0x521D0D5B
+		{ 44590, 0, 9 },	// 0x52202E76
+		{ 44623, 0, 0 },	// 0x52277FB2
+		{ 44635, 0, 4 },	// 0x522B182B
+		{ 44672, 0, 0 },	// 0x52364369
+		{ 44696, 0, 1 },	// 0x523F11FD
+		{ 44722, 0, 1 },	// 0x52411DDA
+		{ 44734, 0, 2 },	// 0x524C4CB5
+		{ 44751, 0, 0 },	// 0x524F7543
+		{ 44773, 0, 1 },	// 0x52632919
+		{ 44785, 0, 2 },	// 0x526B048C
+		{ 44811, 0, 1 },	// 0x526B7BA9
+		{ 44836, 0, 7 },	// 0x528F5EA7
+		{ 44861, 0, 1 },	// 0x52C83902
+		{ 44890, 0, 7 },	// 0x52CE5D9F
+		{ 44914, 0, 1 },	// 0x52CE650B
+		{ 44948, 0, 6 },	// 0x52D34ED3
+		{ 44973, 0, 4 },	// 0x52DA430A
+		{ 45000, 0, 2 },	// 0x52F27084
+		{ 45022, 0, 2 },	// 0x52F543A3
+		{ 45038, 0, 255 },	// 0x52FC763A
+		{ 45047, 0, 4 },	// 0x52FD30EB
+		{ 45070, 0, 2 },	// 0x52FF28DF
+		{ 45097, 0, 0 },	// 0x530F4572
+		{ 45115, 0, 0 },	// 0x53216168
+		{ 45142, 0, 2 },	// 0x53230256
+		{ 45154, 0, 0 },	// 0x5328068B
+		{ 45176, 0, 2 },	// 0x53335A45
+		{ 45204, 0, 1 },	// 0x53456730
+		{ 45230, 0, 1 },	// 0x53591DD7
+		{ 45249, 0, 255 },	// 0x536B4F4A
+		{ 45266, 0, 2 },	// 0x5373544E
+		{ 45277, 0, 2 },	// 0x537379A8
+		{ 45287, 0, 0 },	// 0x538021CD
+		{ 45307, 0, 1 },	// 0x5384065B
+		{ 45330, 0, 1 },	// 0x538514CC
+		{ 45343, 0, 4 },	// 0x539572F3
+		{ 45361, 0, 5 },	// 0x53B429F9
+		{ 45387, 0, 1 },	// 0x53CC1D3C
+		{ 45424, 0, 3 },	// 0x53F34027
+		{ 45447, 0, 1 },	// 0x540D127D
+		{ 45481, 0, 1 },	// 0x540F2DF7
+		{ 45508, 0, 3 },	// 0x542D499E
+		{ 45537, 0, 3 },	// 0x54320B58
+		{ 45554, 0, 1 },	// 0x544625D9
+		{ 45580, 0, 1 },	// 0x546F5326
+		{ 45603, 0, 255 },	// 0x546F581F
+		{ 45638, 0, 0 },	// 0x547523EE
+		{ 45666, 0, 2 },	// 0x547C42B1
+		{ 45700, 0, 2 },	// 0x548E3AFC
+		{ 45721, 0, 255 },	// 0x54AE4F4B
+		{ 45751, 0, 2 },	// 0x54AF2F7A
+		{ 45777, 0, 2 },	// 0x54B054D0
+		{ 45820, 0, 1 },	// 0x54DD5868
+		{ 45858, 0, 255 },	// 0x54DD6ACF
+		{ 45895, 0, 1 },	// 0x54EB576A
+		{ 45914, 0, 255 },	// 0x54F61C99
+		{ 45938, 0, 0 },	// 0x551C6295
+		{ 45958, 0, 0 },	// 0x552B2224
+		{ 45976, 0, 2 },	// 0x554014F1
+		{ 46009, 0, 2 },	// 0x554053ED
+		{ 46045, 0, 2 },	// 0x55444602
+		{ 46068, 0, 1 },	// 0x555213B4
+		{ 46108, 0, 4 },	// 0x555D3B8C
+		{ 46135, 0, 255 },	// 0x5567728E
+		{ 46169, 0, 2 },	// 0x55687797
+		{ 46209, 0, 1 },	// 0x556B0755
+		{ 46235, 0, 1 },	// 0x55727056
+		{ 46260, 0, 1 },	// 0x557C076C
+		{ 46285, 0, 1 },	// 0x557C3641
+		{ 46312, 0, 1 },	// 0x557C7C4A
+		{ 46350, 0, 1 },	// 0x558C4259
+		{ 46370, 0, 255 },	// 0x55916D7A
+		{ 46405, 0, 0 },	// 0x55C84CB7
+		{ 46419, 0, 2 },	// 0x55D470C2
+		{ 46431, 0, 0 },	// 0x55D66E24
+		{ 46450, 0, 2 },	// 0x55DE40EE
+		{ 46470, 0, 1 },	// 0x55E00E7E
+		{ 46483, 0, 6 },	// 0x55E0158B
+		{ 46510, 0, 255 },	// 0x55EB748F
+		{ 46535, 0, 2 },	// 0x561471FB
+		{ 46562, 0, 2 },	// 0x561509AD
+		{ 46587, 0, 1 },	// 0x563F4CC2
+		{ 46614, 0, 4 },	// 0x56507469
+		{ 46644, 0, 9 },	// 0x56524B94
+		{ 46682, 0, 6 },	// 0x56553F38
+		{ 46698, 0, 1 },	// 0x565B0C3E
+		{ 46714, 0, 255 },	// 0x566D04C2
+		{ 46741, 0, 4 },	// 0x567B6C56
+		{ 46761, 0, 3 },	// 0x56A70F57
+		{ 46783, 0, 5 },	// 0x56AD2409
+		{ 46814, 0, 1 },	// 0x56B8674F
+		{ 46834, 0, 0 },	// 0x56B95223
+		{ 46859, 0, 2 },	// 0x56C15139
+		{ 46883, 0, 3 },	// 0x56F04A05
+		{ 46901, 0, 3 },	// 0x56F37A81
+		{ 46921, 0, 1 },	// 0x570F5725
+		{ 46937, 0, 2 },	// 0x571152F5
+		{ 46960, 0, 2 },	// 0x57297D58
+		{ 46989, 0, 1 },	// 0x5731084A
+		{ 47011, 0, 4 },	// 0x57390041
+		{ 47039, 0, 1 },	// 0x573F5B48
+		{ 47068, 0, 1 },	// 0x575136AC
+		{ 47082, 0, 255 },	// 0x575A3431
+		{ 47102, 0, 2 },	// 0x575E2880
+		{ 47118, 0, 10 },	// 0x577A699E
+		{ 47139, 0, 3 },	// 0x5785181B
+		{ 47153, 0, 1 },	// 0x57895F38
+		{ 47182, 0, 1 },	// 0x57952546
+		{ 47214, 0, 255 },	// 0x57A236F0
+		{ 47241, 0, 255 },	// 0x57AC39F5
+		{ 47270, 0, 4 },	// 0x57AC66E9
+		{ 47312, 0, 4 },	// 0x57C758F0
+		{ 47343, 0, 255 },	// 0x57DB70CE
+		{ 47371, 0, 1 },	// 0x57E37103
+		{ 47393, 0, 1 },	// 0x57F46B33
+		{ 47414, 0, 1 },	// 0x57F7558B
+		{ 47435, 0, 255 },	// 0x580E1C3D
+		{ 47459, 0, 2 },	// 0x58123F7A
+		{ 47491, 0, 2 },	// 0x581E2306
+		{ 47514, 0, 1 },	// 0x58296B19
+		{ 47548, 0, 1 },	// 0x583A7A8B
+		{ 47572, 0, 1 },	// 0x5849311B
+		{ 47594, 0, 5 },	// 0x58493B8E
+		{ 47612, 0, 0 },	// 0x584C3830
+		{ 47626, 0, 8 },	// 0x584D0C79
+		{ 47645, 0, 1 },	// 0x585157FE
+		{ 47700, 0, 1 },	// 0x58524B04
+		{ 47716, 0, 0 },	// 0x5873667B
+		{ 47748, 0, 1 },	// 0x58737620
+		{ 47773, 0, 0 },	// 0x587E55D3
+		{ 47797, 0, 0 },	// 0x58802CE5
+		{ 47819, 0, 2 },	// 0x588A27FB
+		{ 47863, 0, 11 },	// 0x588E1506
+		{ 47883, 0, 1 },	// 0x588F6BC0
+		{ 47902, 0, 2 },	// 0x58A6457C
+		{ 47928, 0, 255 },	// 0x58AE7C1D
+		{ 47946, 0, 1 },	// 0x58BA4401
+		{ 47975, 0, 255 },	// 0x58C01823
+		{ 48005, 0, 10 },	// 0x58C41E8F
+		{ 48025, 0, 6 },	// 0x58DD4CCC
+		{ 48054, 0, 2 },	// 0x58E53B06
+		{ 48074, 0, 0 },	// 0x58E835E4
+		{ 48111, 0, 5 },	// 0x58F5023F
+		{ 48131, 0, 4 },	// 0x58F814C4
+		{ 48156, 0, 2 },	// 0x58FB0BC1
+		{ 48195, 0, 255 },	// 0x590A6F04
+		{ 48200, 0, 1 },	// 0x590A6FF4
+		{ 48216, 0, 1 },	// 0x592E0E0F
+		{ 48261, 0, 6 },	// 0x5935382A
+		{ 48287, 0, 255 },	// 0x593A553B
+		{ 48322, 0, 1 },	// 0x59406EB1
+		{ 48356, 0, 1 },	// 0x59471B11
+		{ 48374, 0, 1 },	// 0x59486829
+		{ 48392, 0, 8 },	// 0x59523479
+		{ 48409, 0, 2 },	// 0x596174E5
+		{ 48429, 0, 1 },	// 0x59884407
+		{ 48456, 0, 1 },	// 0x5996315E
+		{ 48483, 0, 6 },	// 0x59A57BA8
+		{ 48500, 0, 255 },	// 0x59AA0635
+		{ 48532, 0, 2 },	// 0x59B425DA
+		{ 48548, 0, 0 },	// 0x59C53FBA
+		{ 48582, 0, 1 },	// 0x59DA4975
+		{ 48600, 0, 10 },	// 0x59DB1AD1
+		{ 48648, 0, 1 },	// 0x59DC6B9A
+		{ 48669, 0, 1 },	// 0x59E3553F
+		{ 48686, 0, 0 },	// 0x59EE3A11
+		{ 48706, 0, 0 },	// 0x59F24327
+		{ 48734, 0, 1 },	// 0x59FD4E83
+		{ 48746, 0, 6 },	// 0x5A07394A
+		{ 48782, 0, 6 },	// 0x5A196B79
+		{ 48824, 0, 1 },	// 0x5A1C52C7
+		{ 48867, 0, 2 },	// 0x5A1D7A2F
+		{ 48895, 0, 1 },	// 0x5A2F2DD1
+		{ 48934, 0, 4 },	// 0x5A495ABE
+		{ 48959, 0, 0 },	// 0x5A535133
+		{ 48986, 0, 2 },	// 0x5A676BCD
+		{ 49031, 0, 2 },	// 0x5A712F63
+		{ 49055, 0, 255 },	// 0x5A7D2C3C
+		{ 49093, 0, 2 },	// 0x5AA025C2
+		{ 49113, 0, 2 },	// 0x5AA1795C
+		{ 49127, 0, 0 },	// 0x5AA33E86
+		{ 49158, 0, 1 },	// 0x5AAC39C1
+		{ 49188, 0, 2 },	// 0x5AB8289F
+		{ 49212, 0, 1 },	// 0x5AC43965
+		{ 49245, 0, 255 },	// 0x5ADD1F46
+		{ 49249, 0, 1 },	// 0x5AE1245E
+		{ 49274, 0, 1 },	// 0x5AF23F31
+		{ 49292, 0, 1 },	// 0x5AFA67D7
+		{ 49322, 0, 2 },	// 0x5AFD2049
+		{ 49343, 0, 2 },	// 0x5AFE791F
+		{ 49363, 0, 4 },	// 0x5B1B2699
+		{ 49381, 0, 0 },	// 0x5B1D57EF
+		{ 49403, 0, 0 },	// 0x5B262142
+		{ 49425, 0, 6 },	// 0x5B386B6C
+		{ 49460, 0, 1 },	// 0x5B4452F3
+		{ 49487, 0, 3 },	// 0x5B576767
+		{ 49505, 0, 4 },	// 0x5B580DCC
+		{ 49531, 0, 1 },	// 0x5B7A738C
+		{ 49551, 0, 6 },	// 0x5BB767AD
+		{ 49576, 0, 1 },	// 0x5BBC62CB
+		{ 49610, 0, 2 },	// 0x5BC10979
+		{ 49640, 0, 5 },	// 0x5BC4602D
+		{ 49669, 0, 2 },	// 0x5BDB7E2C
+		{ 49694, 0, 1 },	// 0x5BE115FD
+		{ 49722, 0, 11 },	// 0x5BE1238D
+		{ 49739, 0, 2 },	// 0x5BE30681
+		{ 49764, 0, 255 },	// 0x5BEA05E2
+		{ 49785, 0, 3 },	// 0x5BF03315
+		{ 49810, 0, 0 },	// 0x5BF23AD5
+		{ 49842, 0, 1 },	// 0x5BF53817
+		{ 49868, 0, 255 },	// 0x5BF71B87
+		{ 49900, 0, 0 },	// 0x5C03585C
+		{ 49939, 0, 5 },	// 0x5C081186
+		{ 49962, 0, 1 },	// 0x5C083072
+		{ 49975, 0, 1 },	// 0x5C162D0D
+		{ 50010, 0, 1 },	// 0x5C3053C0
+		{ 50061, 0, 2 },	// 0x5C3248B5
+		{ 50075, 0, 0 },	// 0x5C3F7E39
+		{ 50108, 0, 1 },	// 0x5C422066
+		{ 50137, 0, 255 },	// 0x5C4B1A8A
+		{ 50155, 0, 5 },	// 0x5C723F31
+		{ 50182, 0, 1 },	// 0x5C825D83
+		{ 50198, 0, 1 },	// 0x5C832C1F
+		{ 50221, 0, 1 },	// 0x5C8C2E39
+		{ 50249, 0, 2 },	// 0x5C8C7F9E
+		{ 50284, 0, 1 },	// 0x5C8D66EA
+		{ 50311, 0, 4 },	// 0x5C9807CA
+		{ 50331, 0, 0 },	// 0x5C9863F6
+		{ 50359, 0, 3 },	// 0x5CAD7949
+		{ 50381, 0, 2 },	// 0x5CC55619
+		{ 50398, 0, 7 },	// 0x5CCD150B
+		{ 50423, 0, 2 },	// 0x5CD32071
+		{ 50446, 0, 2 },	// 0x5CD64D63
+		{ 50469, 0, 2 },	// 0x5CF1303D
+		{ 50490, 0, 5 },	// 0x5CF149C8
+		{ 50509, 0, 0 },	// 0x5D1425DF
+		{ 50529, 0, 2 },	// 0x5D154995
+		{ 50558, 0, 0 },	// 0x5D1C0A6A
+		{ 50578, 0, 5 },	// 0x5D251D72
+		{ 50603, 0, 1 },	// 0x5D2B2A9A
+		{ 50622, 0, 6 },	// 0x5D3241E4
+		{ 50639, 0, 3 },	// 0x5D4C1D59
+		{ 50653, 0, 4 },	// 0x5D4D0C86
+		{ 50671, 0, 4 },	// 0x5D515C4D
+		{ 50702, 0, 9 },	// 0x5D5A06F7
+		{ 50730, 0, 0 },	// 0x5D607947
+		{ 50756, 0, 1 },	// 0x5D622498
+		{ 50777, 0, 1 },	// 0x5D786EEE
+		{ 50798, 0, 2 },	// 0x5D7C4F08
+		{ 50811, 0, 1 },	// 0x5D867A02
+		{ 50829, 0, 7 },	// 0x5D877285
+		{ 50856, 0, 2 },	// 0x5D900560
+		{ 50893, 0, 0 },	// 0x5D975A46
+		{ 50912, 0, 2 },	// 0x5DA1752F
+		{ 50934, 0, 0 },	// 0x5DB83661
+		{ 50955, 0, 0 },	// 0x5DB95843
+		{ 50981, 0, 2 },	// 0x5DBB46B5
+		{ 50998, 0, 2 },	// 0x5DC456DE
+		{ 51034, 0, 2 },	// 0x5DD231A2
+		{ 51059, 0, 1 },	// 0x5DDB09F8
+		{ 51091, 0, 0 },	// 0x5DE43980
+		{ 51111, 0, 2 },	// 0x5E061170
+		{ 51138, 0, 0 },	// 0x5E0713B2
+		{ 51157, 0, 6 },	// 0x5E077484
+		{ 51185, 0, 2 },	// 0x5E0F611E
+		{ 51202, 0, 0 },	// 0x5E4327D2
+		{ 51231, 0, 255 },	// 0x5E44065D
+		{ 51271, 0, 1 },	// 0x5E486AA1
+		{ 51286, 0, 2 },	// 0x5E4F6DE3
+		{ 51306, 0, 1 },	// 0x5E5047AC
+		{ 51324, 0, 2 },	// 0x5E564CFF
+		{ 51346, 0, 2 },	// 0x5E5E4252
+		{ 51366, 0, 2 },	// 0x5E627D20
+		{ 51386, 0, 2 },	// 0x5E702E2C
+		{ 51397, 0, 3 },	// 0x5E756B51
+		{ 51428, 0, 2 },	// 0x5E7A620E
+		{ 51442, 0, 0 },	// 0x5E7B0F23
+		{ 51487, 0, 1 },	// 0x5E7B3816
+		{ 51514, 0, 2 },	// 0x5E8D08CE
+		{ 51562, 0, 1 },	// 0x5E8D7E3F
+		{ 51591, 0, 2 },	// 0x5E97106E
+		{ 51601, 0, 0 },	// 0x5EA253A5
+		{ 51618, 0, 2 },	// 0x5EA84115
+		{ 51643, 0, 2 },	// 0x5EAD47E8
+		{ 51669, 0, 8 },	// 0x5EC2479B
+		{ 51694, 0, 0 },	// 0x5ECF404A
+		{ 51719, 0, 255 },	// 0x5ED03255
+		{ 51737, 0, 3 },	// 0x5ED33D46
+		{ 51762, 0, 0 },	// 0x5EEA3F25
+		{ 51787, 0, 255 },	// 0x5EEE6ADB
+		{ 51809, 0, 1 },	// 0x5F00596C
+		{ 51824, 0, 255 },	// 0x5F02084D
+		{ 51874, 0, 4 },	// 0x5F182E21
+		{ 51893, 0, 2 },	// 0x5F2F1680
+		{ 51917, 0, 2 },	// 0x5F3B6079
+		{ 51944, 0, 2 },	// 0x5F456B53
+		{ 51960, 0, 0 },	// 0x5F4571E5
+		{ 51984, 0, 1 },	// 0x5F4B0B22
+		{ 52003, 0, 2 },	// 0x5F58606A
+		{ 52033, 0, 3 },	// 0x5F5E7F39
+		{ 52058, 0, 0 },	// 0x5F643EE6
+		{ 52079, 0, 1 },	// 0x5F7307F4
+		{ 52118, 0, 0 },	// 0x5F752F19
+		{ 52133, 0, 255 },	// 0x5F8C3937
+		{ 52169, 0, 1 },	// 0x5F9218C3
+		{ 52196, 0, 1 },	// 0x5F9C43D4
+		{ 52220, 0, 1 },	// 0x5FA96262
+		{ 52249, 0, 255 },	// 0x5FAD09CA
+		{ 52271, 0, 1 },	// 0x5FB15E81
+		{ 52301, 0, 255 },	// 0x5FB31295
+		{ 52317, 0, 1 },	// 0x5FBC5FFF
+		{ 52340, 0, 1 },	// 0x5FBE5F52
+		{ 52364, 0, 1 },	// 0x5FD24FEA
+		{ 52383, 0, 255 },	// 0x5FD47B45
+		{ 52410, 0, 1 },	// 0x5FDF1493
+		{ 52432, 0, 6 },	// 0x5FE61572
+		{ 52453, 0, 3 },	// 0x5FE95249
+		{ 52473, 0, 2 },	// 0x5FF84497
+		{ 52487, 0, 2 },	// 0x5FFE33EC
+		{ 52510, 0, 255 },	// 0x6004431B
+		{ 52527, 0, 0 },	// 0x601A5770
+		{ 52552, 0, 255 },	// 0x602112FC
+		{ 52587, 0, 2 },	// 0x602C46E7
+		{ 52604, 0, 1 },	// 0x60305168
+		{ 52619, 0, 0 },	// 0x60320FEB
+		{ 52649, 0, 3 },	// 0x6045426E
+		{ 52661, 0, 0 },	// 0x60560DAE
+		{ 52683, 0, 255 },	// 0x60806A0C
+		{ 52701, 0, 3 },	// 0x608237A4
+		{ 52720, 0, 7 },	// 0x60964DB8
+		{ 52737, 0, 255 },	// 0x60980323
+		{ 52760, 0, 0 },	// 0x609D0203
+		{ 52791, 0, 2 },	// 0x609D07DB
+		{ 52809, 0, 2 },	// 0x60AD2FE0
+		{ 52826, 0, 3 },	// 0x60AE0867
+		{ 52849, 0, 1 },	// 0x60B26D74
+		{ 52877, 0, 4 },	// 0x60C22E93
+		{ 52889, 0, 2 },	// 0x60C80EC9
+		{ 52908, 0, 1 },	// 0x60D94FA7
+		{ 52936, 0, 3 },	// 0x60DC6E25
+		{ 52960, 0, 2 },	// 0x60E335FA
+		{ 52997, 0, 1 },	// 0x60EC0540
+		{ 53022, 0, 2 },	// 0x60EF0519
+		{ 53057, 0, 255 },	// 0x60F720F6
+		{ 53083, 0, 0 },	// 0x60FB61A7
+		{ 53108, 0, 9 },	// 0x610157C9
+		{ 53134, 0, 0 },	// 0x61040B08
+		{ 53155, 0, 2 },	// 0x61064783
+		{ 53181, 0, 2 },	// 0x611948A3
+		{ 53196, 0, 0 },	// 0x611D69BC
+		{ 53215, 0, 2 },	// 0x612062DB
+		{ 53245, 0, 3 },	// 0x612C748F
+		{ 53262, 0, 1 },	// 0x613510D0
+		{ 53291, 0, 2 },	// 0x61487DBF
+		{ 53320, 0, 2 },	// 0x61497585
+		{ 53335, 0, 0 },	// 0x614A3353
+		{ 53352, 0, 1 },	// 0x615959BA
+		{ 53381, 0, 1 },	// 0x616F492C
+		{ 53393, 0, 2 },	// 0x61784349
+		{ 53415, 0, 0 },	// 0x617B191D
+		{ 53441, 0, 2 },	// 0x61822A3C
+		{ 53469, 0, 3 },	// 0x61965EB3
+		{ 53481, 0, 2 },	// 0x619D51D3
+		{ 53506, 0, 5 },	// 0x619E7657
+		{ 53537, 0, 1 },	// 0x61A812F5
+		{ 53575, 0, 1 },	// 0x61B830BC
+		{ 53602, 0, 0 },	// 0x61C65FDE
+		{ 53619, 0, 9 },	// 0x61C81E88
+		{ 53640, 0, 1 },	// 0x61C921EF
+		{ 53663, 0, 2 },	// 0x61D07789
+		{ 53687, 0, 0 },	// 0x61DA102E
+		{ 53705, 0, 2 },	// 0x61EE5C9A
+		{ 53719, 0, 2 },	// 0x61F40670
+		{ 53734, 0, 2 },	// 0x620C26D8
+		{ 53759, 0, 1 },	// 0x62285CAD
+		{ 53776, 0, 0 },	// 0x622E3D34
+		{ 53821, 0, 0 },	// 0x62405882
+		{ 53843, 0, 4 },	// 0x624E5833
+		{ 53879, 0, 6 },	// 0x6251618F
+		{ 53909, 0, 2 },	// 0x62687944
+		{ 53938, 0, 4 },	// 0x62701AF8
+		{ 53974, 0, 0 },	// 0x627A3586
+		{ 53988, 0, 1 },	// 0x627F3275
+		{ 54005, 0, 2 },	// 0x62842540
+		{ 54028, 0, 0 },	// 0x6289239F
+		{ 54050, 0, 0 },	// 0x62984AB7
+		{ 54057, 0, 255 },	// 0x62AB2AB4
+		{ 54102, 0, 1 },	// 0x62B15CD7
+		{ 54124, 0, 1 },	// 0x62BC0AEE
+		{ 54148, 0, 0 },	// 0x62E319C6
+		{ 54162, 0, 1 },	// 0x62EA75E0
+		{ 54183, 0, 1 },	// 0x62ED1551
+		{ 54196, 0, 1 },	// 0x62EF058E
+		{ 54217, 0, 1 },	// 0x62FE6290
+		{ 54231, 0, 2 },	// 0x6314421A
+		{ 54253, 0, 3 },	// 0x633A012B
+		{ 54282, 0, 0 },	// 0x6342018A
+		{ 54295, 0, 0 },	// 0x63576E53
+		{ 54315, 0, 255 },	// 0x63615A6D
+		{ 54363, 0, 1 },	// 0x63737D31
+		{ 54381, 0, 1 },	// 0x637E1D42
+		{ 54404, 0, 1 },	// 0x63A40F58
+		{ 54424, 0, 0 },	// 0x63A669B6
+		{ 54445, 0, 2 },	// 0x63A86D87
+		{ 54463, 0, 0 },	// 0x63AB65DC
+		{ 54500, 0, 0 },	// 0x63AF5057
+		{ 54523, 0, 0 },	// 0x63B70F7C
+		{ 54553, 0, 2 },	// 0x63B87EBE
+		{ 54583, 0, 10 },	// 0x63C00DE7
+		{ 54600, 0, 0 },	// 0x63C50673
+		{ 54646, 0, 0 },	// 0x63DA2195
+		{ 54678, 0, 2 },	// 0x63DE7A05
+		{ 54703, 0, 1 },	// 0x63E7509E
+		{ 54735, 0, 2 },	// 0x63F07A46
+		{ 54757, 0, 255 },	// 0x640E7764
+		{ 54787, 0, 9 },	// 0x64146142
+		{ 54805, 0, 255 },	// 0x64302F16
+		{ 54822, 0, 0 },	// 0x64342B55
+		{ 54853, 0, 0 },	// 0x64655F10
+		{ 54887, 0, 255 },	// 0x64660709
+		{ 54904, 0, 255 },	// 0x64793A54
+		{ 54930, 0, 3 },	// 0x647E2BF7
+		{ 54968, 0, 3 },	// 0x64861559
+		{ 54983, 0, 2 },	// 0x64903364
+		{ 55008, 0, 1 },	// 0x649316B7
+		{ 55031, 0, 1 },	// 0x64961488
+		{ 55053, 0, 2 },	// 0x64B9757E
+		{ 55077, 0, 1 },	// 0x64BD4664
+		{ 55104, 0, 1 },	// 0x64BE2E39
+		{ 55136, 0, 1 },	// 0x64CA2868
+		{ 55170, 0, 6 },	// 0x64D35E1D
+		{ 55191, 0, 255 },	// 0x64DD173C
+		{ 55203, 0, 1 },	// 0x64E06CBB
+		{ 55239, 0, 255 },	// 0x64E51535
+		{ 55279, 0, 2 },	// 0x64EF411D
+		{ 55299, 0, 2 },	// 0x64F37F05
+		{ 55316, 0, 1 },	// 0x651E50EC
+		{ 55333, 0, 1 },	// 0x653B5374
+		{ 55362, 0, 2 },	// 0x65490A3D
+		{ 55412, 0, 9 },	// 0x65536ECF
+		{ 55451, 0, 1 },	// 0x656F1A7A
+		{ 55484, 0, 5 },	// 0x65752C65
+		{ 55509, 0, 5 },	// 0x658028BA
+		{ 55531, 0, 1 },	// 0x658F21AF
+		{ 55553, 0, 1 },	// 0x65A34B7A
+		{ 55579, 0, 5 },	// 0x65A428F2
+		{ 55617, 0, 1 },	// 0x65A80992
+		{ 55632, 0, 0 },	// 0x65B05F3F
+		{ 55663, 0, 0 },	// 0x65B83AFB
+		{ 55690, 0, 2 },	// 0x65BB0060
+		{ 55712, 0, 1 },	// 0x65D949B7
+		{ 55738, 0, 255 },	// 0x65D95395
+		{ 55770, 0, 1 },	// 0x65DE621C
+		{ 55789, 0, 4 },	// 0x65EB71CC
+		{ 55811, 0, 1 },	// 0x65EF0CB8
+		{ 55834, 0, 1 },	// 0x65F874DE
+		{ 55848, 0, 1 },	// 0x661A0CCC
+		{ 55870, 0, 4 },	// 0x661B239A
+		{ 55903, 0, 255 },	// 0x662235A5
+		{ 55936, 0, 1 },	// 0x662E4376
+		{ 55950, 0, 1 },	// 0x66317064
+		{ 55975, 0, 255 },	// 0x66385B6C
+		{ 56003, 0, 4 },	// 0x664D06FF
+		{ 56019, 0, 1 },	// 0x665F6BB7
+		{ 56049, 0, 2 },	// 0x667517AB
+		{ 56075, 0, 6 },	// 0x6680196B
+		{ 56106, 0, 5 },	// 0x66842574
+		{ 56136, 0, 2 },	// 0x668F64C7
+		{ 56183, 0, 0 },	// 0x66915CE9
+		{ 56195, 0, 0 },	// 0x669D053F
+		{ 56215, 0, 2 },	// 0x66B43B06
+		{ 56236, 0, 2 },	// 0x66B93E8C
+		{ 56266, 0, 0 },	// 0x66BB737D
+		{ 56300, 0, 3 },	// 0x66CC16BD
+		{ 56310, 0, 1 },	// 0x66D53314
+		{ 56336, 0, 2 },	// 0x66D57CC4
+		{ 56346, 0, 2 },	// 0x66DD4F67
+		{ 56364, 0, 1 },	// 0x66E93537
+		{ 56392, 0, 3 },	// 0x66F445BB
+		{ 56419, 0, 2 },	// 0x66F47727
+		{ 56437, 0, 1 },	// 0x66F5118F
+		{ 56453, 0, 2 },	// 0x6702757C
+		{ 56468, 0, 0 },	// 0x670E3DE3
+		{ 56495, 0, 0 },	// 0x67114B98
+		{ 56522, 0, 0 },	// 0x67177EEC
+		{ 56532, 0, 2 },	// 0x672139F0
+		{ 56566, 0, 3 },	// 0x673E4CD2
+		{ 56587, 0, 1 },	// 0x674849B5
+		{ 56627, 0, 2 },	// 0x674D6F8E
+		{ 56643, 0, 10 },	// 0x675E5940
+		{ 56664, 0, 7 },	// 0x676B6BCA
+		{ 56685, 0, 1 },	// 0x676F0004
+		{ 56700, 0, 2 },	// 0x677861E1
+		{ 56715, 0, 255 },	// 0x678813A4
+		{ 56751, 0, 2 },	// 0x67890049
+		{ 56801, 0, 2 },	// 0x679934F9
+		{ 56829, 0, 3 },	// 0x679A474E
+		{ 56852, 0, 255 },	// 0x679C4276
+		{ 56879, 0, 1 },	// 0x67A42263
+		{ 56898, 0, 255 },	// 0x67B725B2
+		{ 56915, 0, 4 },	// 0x67C82864
+		{ 56941, 0, 2 },	// 0x67CC007C
+		{ 56958, 0, 2 },	// 0x67D83807
+		{ 56993, 0, 6 },	// 0x67D908DF
+		{ 57013, 0, 2 },	// 0x67DB4150
+		{ 57041, 0, 5 },	// 0x67F518F0
+		{ 57071, 0, 1 },	// 0x68083431
+		{ 57098, 0, 2 },	// 0x68232D31
+		{ 57112, 0, 7 },	// 0x68251A95
+		{ 57156, 0, 255 },	// 0x68373878
+		{ 57196, 0, 5 },	// 0x683927F5
+		{ 57226, 0, 3 },	// 0x684D1517
+		{ 57249, 0, 1 },	// 0x68664078
+		{ 57268, 0, 3 },	// 0x686B6395
+		{ 57282, 0, 5 },	// 0x687107CA
+		{ 57313, 0, 1 },	// 0x688557E4
+		{ 57354, 0, 1 },	// 0x68855BE7
+		{ 57378, 0, 2 },	// 0x68880DCD
+		{ 57415, 0, 5 },	// 0x68966670
+		{ 57456, 0, 4 },	// 0x689D0F5F
+		{ 57477, 0, 1 },	// 0x689D5EEE
+		{ 57500, 0, 2 },	// 0x68AB2DD9
+		{ 57525, 0, 1 },	// 0x68AB6E72
+		{ 57548, 0, 1 },	// 0x68B829C7
+		{ 57568, 0, 4 },	// 0x68C57282
+		{ 57594, 0, 0 },	// 0x68EA6EBE
+		{ 57621, 0, 0 },	// 0x68F06A02
+		{ 57645, 0, 1 },	// 0x68FF7165
+		{ 57658, 0, 2 },	// 0x690D344F
+		{ 57673, 0, 0 },	// 0x691970FD
+		{ 57714, 0, 2 },	// 0x69315157
+		{ 57742, 0, 2 },	// 0x693D7B21
+		{ 57762, 0, 2 },	// 0x69491CFA
+		{ 57784, 0, 2 },	// 0x694A0DC1
+		{ 57795, 0, 2 },	// 0x695C429D
+		{ 57817, 0, 1 },	// 0x696021E6
+		{ 57848, 0, 0 },	// 0x69604AE2
+		{ 57878, 0, 11 },	// 0x69715285
+		{ 57902, 0, 1 },	// 0x69804B35
+		{ 57942, 0, 0 },	// 0x698F6172
+		{ 57971, 0, 0 },	// 0x698F762E
+		{ 58000, 0, 1 },	// 0x69A52C96
+		{ 58039, 0, 1 },	// 0x69A72C50
+		{ 58064, 0, 255 },	// 0x69AE0805
+		{ 58071, 0, 2 },	// 0x69B140F6
+		{ 58102, 0, 1 },	// 0x69B53ADA
+		{ 58117, 0, 1 },	// 0x69C033D8
+		{ 58152, 0, 7 },	// 0x69CE154F
+		{ 58186, 0, 0 },	// 0x69D90F11
+		{ 58213, 0, 1 },	// 0x69E742FC
+		{ 58228, 0, 2 },	// 0x69EC0E70
+		{ 58249, 0, 2 },	// 0x69F02BA0
+		{ 58270, 0, 2 },	// 0x69F11716
+		{ 58294, 0, 0 },	// 0x69F55DCC
+		{ 58323, 0, 2 },	// 0x6A0A724C
+		{ 58365, 0, 1 },	// 0x6A1244E9
+		{ 58393, 0, 2 },	// 0x6A2E514F
+		{ 58419, 0, 255 },	// 0x6A3A2C88
+		{ 58440, 0, 255 },	// 0x6A660231
+		{ 58460, 0, 0 },	// 0x6A66149A
+		{ 58497, 0, 1 },	// 0x6A6B4F18
+		{ 58510, 0, 4 },	// 0x6A7236C9
+		{ 58539, 0, 1 },	// 0x6A733E6C
+		{ 58588, 0, 4 },	// 0x6A77506A
+		{ 58616, 0, 4 },	// 0x6A7E47C9
+		{ 58634, 0, 2 },	// 0x6A90123D
+		{ 58653, 0, 2 },	// 0x6A9033B3
+		{ 58671, 0, 1 },	// 0x6A9A3B1F
+		{ 58691, 0, 1 },	// 0x6A9B79D8
+		{ 58700, 0, 255 },	// 0x6A9E5CE5
+		{ 58722, 0, 2 },	// 0x6A9F01AF
+		{ 58746, 0, 6 },	// 0x6AA20B7E
+		{ 58780, 0, 255 },	// 0x6AA63375
+		{ 58806, 0, 2 },	// 0x6AC14091
+		{ 58835, 0, 0 },	// 0x6AC52840
+		{ 58858, 0, 10 },	// 0x6ADD40EC
+		{ 58870, 0, 0 },	// 0x6ADF2929
+		{ 58893, 0, 1 },	// 0x6AFF0587
+		{ 58923, 0, 0 },	// 0x6B032A0B
+		{ 58938, 0, 0 },	// 0x6B1C6027
+		{ 58954, 0, 2 },	// 0x6B2838C7
+		{ 58983, 0, 2 },	// 0x6B2E49CD
+		{ 59008, 0, 0 },	// 0x6B2F3E97
+		{ 59031, 0, 1 },	// 0x6B3D5D45
+		{ 59048, 0, 0 },	// 0x6B434D0D
+		{ 59081, 0, 0 },	// 0x6B4D6FC6
+		{ 59093, 0, 0 },	// 0x6B6019DB
+		{ 59114, 0, 2 },	// 0x6B85214E
+		{ 59129, 0, 2 },	// 0x6B9C6127
+		{ 59157, 0, 255 },	// 0x6B9C7392
+		{ 59174, 0, 1 },	// 0x6BA520F0
+		{ 59198, 0, 2 },	// 0x6BAC2781
+		{ 59235, 0, 2 },	// 0x6BC05942
+		{ 59274, 0, 1 },	// 0x6BDC40EB
+		{ 59290, 0, 1 },	// 0x6BE062DF
+		{ 59305, 0, 255 },	// 0x6C013A17
+		{ 59345, 0, 255 },	// 0x6C0E191F
+		{ 59359, 0, 255 },	// 0x6C1344C6
+		{ 59390, 0, 0 },	// 0x6C213305
+		{ 59416, 0, 4 },	// 0x6C236A54
+		{ 59446, 0, 1 },	// 0x6C305137
+		{ 59469, 0, 1 },	// 0x6C321179
+		{ 59509, 0, 0 },	// 0x6C3B5917
+		{ 59537, 0, 2 },	// 0x6C403ACC
+		{ 59551, 0, 0 },	// 0x6C434E0B
+		{ 59589, 0, 0 },	// 0x6C4568A7
+		{ 59610, 0, 255 },	// 0x6C507EAC
+		{ 59634, 0, 5 },	// 0x6C5871D6
+		{ 59657, 0, 2 },	// 0x6C63251D
+		{ 59675, 0, 1 },	// 0x6C654678
+		{ 59711, 0, 2 },	// 0x6C6C1CF3
+		{ 59738, 0, 6 },	// 0x6C6F6052
+		{ 59743, 0, 255 },	// 0x6C7566F3
+		{ 59774, 0, 2 },	// 0x6C9F2330
+		{ 59802, 0, 1 },	// 0x6CA57960
+		{ 59821, 0, 3 },	// 0x6CAC3D62
+		{ 59837, 0, 3 },	// 0x6CB14354
+		{ 59859, 0, 255 },	// 0x6CB64BDB
+		{ 59887, 0, 4 },	// 0x6CC1560F
+		{ 59911, 0, 0 },	// 0x6CC85D46
+		{ 59935, 0, 5 },	// 0x6CCB719D
+		{ 59964, 0, 2 },	// 0x6CE00370
+		{ 59985, 0, 2 },	// 0x6CE277E7
+		{ 60019, 0, 5 },	// 0x6CEA50D8
+		{ 60043, 0, 2 },	// 0x6CF248FD
+		{ 60075, 0, 3 },	// 0x6CF44DD6
+		{ 60099, 0, 1 },	// 0x6CFC30AD
+		{ 60124, 0, 1 },	// 0x6CFD0610
+		{ 60150, 0, 255 },	// 0x6CFD3E5F
+		{ 60167, 0, 2 },	// 0x6D05484F
+		{ 60187, 0, 6 },	// 0x6D0E1BCE
+		{ 60219, 0, 255 },	// 0x6D170B31
+		{ 60267, 0, 2 },	// 0x6D1E5C25
+		{ 60295, 0, 2 },	// 0x6D21564D
+		{ 60312, 0, 0 },	// 0x6D302DA9
+		{ 60347, 0, 7 },	// 0x6D4746D8
+		{ 60393, 0, 4 },	// 0x6D4E2A4A
+		{ 60416, 0, 255 },	// 0x6D5F1592
+		{ 60461, 0, 3 },	// 0x6D631CED
+		{ 60489, 0, 2 },	// 0x6D6A1261
+		{ 60510, 0, 8 },	// 0x6D717883
+		{ 60531, 0, 255 },	// 0x6D795EC0
+		{ 60573, 0, 0 },	// 0x6D823703
+		{ 60599, 0, 4 },	// 0x6D902EE3
+		{ 60625, 0, 3 },	// 0x6D9538E1
+		{ 60647, 0, 2 },	// 0x6DA91393
+		{ 60677, 0, 2 },	// 0x6DAB7270
+		{ 60709, 0, 1 },	// 0x6DAB78CD
+		{ 60727, 0, 2 },	// 0x6DB26E07
+		{ 60759, 0, 8 },	// 0x6DB47487
+		{ 60776, 0, 255 },	// 0x6DD754DD
+		{ 60812, 0, 2 },	// 0x6DDD201D
+		{ 60867, 0, 1 },	// 0x6E0026EF
+		{ 60903, 0, 2 },	// 0x6E0A438A
+		{ 60922, 0, 1 },	// 0x6E120246
+		{ 60957, 0, 255 },	// 0x6E1A0A84
+		{ 60974, 0, 0 },	// 0x6E2B38F3
+		{ 60993, 0, 2 },	// 0x6E2E55B5
+		{ 61018, 0, 2 },	// 0x6E354B41
+		{ 61055, 0, 7 },	// 0x6E3906E4
+		{ 61098, 0, 1 },	// 0x6E397D96
+		{ 61115, 0, 7 },	// 0x6E405BD5
+		{ 61139, 0, 255 },	// 0x6E435BDE
+		{ 61164, 0, 0 },	// 0x6E4E1BEC
+		{ 61196, 0, 2 },	// 0x6E77153D
+		{ 61243, 0, 2 },	// 0x6E7C6687
+		{ 61282, 0, 9 },	// 0x6E856548
+		{ 61306, 0, 255 },	// 0x6E8B7611
+		{ 61338, 0, 4 },	// 0x6E8F7FA4
+		{ 61358, 0, 2 },	// 0x6E904C1A
+		{ 61385, 0, 1 },	// 0x6EA72622
+		{ 61420, 0, 1 },	// 0x6EA92FD5
+		{ 0, 1, 0 },	// 0x6EB3047F
+		{ 27, 1, 6 },	// 0x6EB639E8
+		{ 72, 1, 7 },	// 0x6ED17CF8
+		{ 111, 1, 0 },	// 0x6ED83424
+		{ 135, 1, 1 },	// 0x6EEE7E6C
+		{ 186, 1, 2 },	// 0x6EF64079
+		{ 211, 1, 2 },	// 0x6EF667A4
+		{ 245, 1, 1 },	// 0x6F2A5430
+		{ 276, 1, 2 },	// 0x6F363A21
+		{ 310, 1, 0 },	// 0x6F760759
+		{ 327, 1, 9 },	// 0x6F766824
+		{ 369, 1, 0 },	// 0x6F797AF3
+		{ 410, 1, 5 },	// 0x6F9256DF
+		{ 434, 1, 255 },	// 0x6FBA4274
+		{ 460, 1, 255 },	// 0x6FBE6CE6
+		{ 482, 1, 1 },	// 0x6FC54C6B
+		{ 514, 1, 2 },	// 0x6FC75ABD
+		{ 551, 1, 1 },	// 0x6FDA43A3
+		{ 575, 1, 2 },	// 0x6FE455D8
+		{ 603, 1, 1 },	// 0x6FFE0DFD
+		{ 618, 1, 2 },	// 0x700165C2
+		{ 652, 1, 1 },	// 0x701F4004
+		{ 671, 1, 2 },	// 0x702041F2
+		{ 682, 1, 2 },	// 0x70291096
+		{ 705, 1, 0 },	// 0x704E638F
+		{ 736, 1, 6 },	// 0x705231A9
+		{ 756, 1, 2 },	// 0x70582D53
+		{ 781, 1, 1 },	// 0x705A6ED9
+		{ 811, 1, 255 },	// 0x706707E6
+		{ 838, 1, 4 },	// 0x709154FC
+		{ 866, 1, 5 },	// 0x709D2036
+		{ 902, 1, 2 },	// 0x70A62140
+		{ 936, 1, 1 },	// 0x70AF1D38
+		{ 967, 1, 4 },	// 0x70B45E01
+		{ 993, 1, 1 },	// 0x70BB021A
+		{ 1017, 1, 2 },	// 0x70CC1487
+		{ 1037, 1, 2 },	// 0x70D13342
+		{ 1072, 1, 4 },	// 0x70E13826
+		{ 1090, 1, 1 },	// 0x70EA2B89
+		{ 1128, 1, 5 },	// 0x70F0538F
+		{ 1166, 1, 0 },	// 0x70FE415C
+		{ 1202, 1, 1 },	// 0x71076BBA
+		{ 1213, 1, 2 },	// 0x710B2BD3
+		{ 1231, 1, 1 },	// 0x710E6D16
+		{ 1253, 1, 2 },	// 0x7110790B
+		{ 1282, 1, 2 },	// 0x711214F3
+		{ 1304, 1, 1 },	// 0x71184DA3
+		{ 1323, 1, 5 },	// 0x71270D73
+		{ 1345, 1, 1 },	// 0x714C1031
+		{ 1377, 1, 1 },	// 0x716308C6
+		{ 1399, 1, 1 },	// 0x71755E9B
+		{ 1420, 1, 4 },	// 0x717B5EFB
+		{ 1443, 1, 1 },	// 0x718508B4
+		{ 1473, 1, 2 },	// 0x718939EF
+		{ 1503, 1, 2 },	// 0x71A05FF1
+		{ 1525, 1, 4 },	// 0x71A52973
+		{ 1554, 1, 2 },	// 0x71AE1BDC
+		{ 1575, 1, 0 },	// 0x71AE456A
+		{ 1604, 1, 2 },	// 0x71B81DE7
+		{ 1621, 1, 5 },	// 0x71C30148
+		{ 1647, 1, 1 },	// 0x71C91921
+		{ 1674, 1, 2 },	// 0x71D72486
+		{ 1698, 1, 255 },	// 0x71DE26A3
+		{ 1736, 1, 7 },	// 0x71F001D2
+		{ 1758, 1, 1 },	// 0x71F965B4
+		{ 1790, 1, 2 },	// 0x720673D9
+		{ 1826, 1, 0 },	// 0x720E7EA6
+		{ 1848, 1, 5 },	// 0x72297CDC
+		{ 1874, 1, 0 },	// 0x72397ECD
+		{ 1889, 1, 1 },	// 0x72452672
+		{ 1926, 1, 10 },	// 0x725654F4
+		{ 1958, 1, 1 },	// 0x728C1CC0
+		{ 1989, 1, 2 },	// 0x72AE63C8
+		{ 2006, 1, 0 },	// 0x72B16D0D
+		{ 2026, 1, 1 },	// 0x72B73FBA
+		{ 2047, 1, 2 },	// 0x72BF79F1
+		{ 2057, 1, 4 },	// 0x72E93E13
+		{ 2079, 1, 2 },	// 0x72EC0AA6
+		{ 2125, 1, 0 },	// 0x72EF466E
+		{ 2154, 1, 6 },	// 0x72F81072
+		{ 2188, 1, 12 },	// 0x7305301D
+		{ 2207, 1, 2 },	// 0x731B11A7
+		{ 2239, 1, 2 },	// 0x73245AB3
+		{ 2260, 1, 2 },	// 0x73246FC0
+		{ 2285, 1, 2 },	// 0x73260714
+		{ 2303, 1, 1 },	// 0x7330132C
+		{ 2330, 1, 1 },	// 0x733846D5
+		{ 2356, 1, 255 },	// 0x733B61C6
+		{ 2383, 1, 255 },	// 0x734E3F62
+		{ 2408, 1, 0 },	// 0x736027E6
+		{ 2461, 1, 2 },	// 0x736D423E
+		{ 2493, 1, 0 },	// 0x73700561
+		{ 2510, 1, 0 },	// 0x73737990
+		{ 2541, 1, 7 },	// 0x737F24F9
+		{ 2578, 1, 6 },	// 0x7381337A
+		{ 2600, 1, 0 },	// 0x73A1443F
+		{ 2659, 1, 5 },	// 0x73AB2028
+		{ 2677, 1, 3 },	// 0x73B01573
+		{ 2687, 1, 4 },	// 0x73BD71A9
+		{ 2709, 1, 1 },	// 0x73CB1489
+		{ 2744, 1, 2 },	// 0x73D3504A
+		{ 2763, 1, 0 },	// 0x73D87A5F
+		{ 2778, 1, 255 },	// 0x73E6005B
+		{ 2798, 1, 0 },	// 0x73E911E8
+		{ 2817, 1, 1 },	// 0x73F56AC5
+		{ 2852, 1, 255 },	// 0x73F869CF
+		{ 2887, 1, 7 },	// 0x740912C2
+		{ 2912, 1, 255 },	// 0x74093768
+		{ 2937, 1, 255 },	// 0x740C4C84
+		{ 2964, 1, 255 },	// 0x742E3376
+		{ 2992, 1, 5 },	// 0x743F30B3
+		{ 3025, 1, 2 },	// 0x74576E37
+		{ 3070, 1, 255 },	// 0x74627538
+		{ 3095, 1, 4 },	// 0x746744D1
+		{ 3107, 1, 6 },	// 0x746C06E8
+		{ 3135, 1, 255 },	// 0x746E7171
+		{ 3152, 1, 3 },	// 0x747E681E
+		{ 3178, 1, 2 },	// 0x74824ADA
+		{ 3203, 1, 2 },	// 0x7488454D
+		{ 3227, 1, 1 },	// 0x748B78B6
+		{ 3250, 1, 6 },	// 0x74AF54F0
+		{ 3289, 1, 3 },	// 0x74B90C48
+		{ 3303, 1, 3 },	// 0x74C14D31
+		{ 3326, 1, 2 },	// 0x74C55395
+		{ 3347, 1, 3 },	// 0x74C626EB
+		{ 3378, 1, 4 },	// 0x74CD7D1F
+		{ 3397, 1, 5 },	// 0x74EC7580
+		{ 3421, 1, 1 },	// 0x74F97CF8
+		{ 3461, 1, 1 },	// 0x74FC2325
+		{ 3480, 1, 1 },	// 0x74FF26F9
+		{ 3499, 1, 2 },	// 0x7505765B
+		{ 3527, 1, 5 },	// 0x75080482
+		{ 3552, 1, 255 },	// 0x750C1CD7
+		{ 3575, 1, 2 },	// 0x751967FD
+		{ 3595, 1, 2 },	// 0x752643C9
+		{ 3612, 1, 0 },	// 0x75291BEC
+		{ 3632, 1, 3 },	// 0x75353EA4
+		{ 3650, 1, 1 },	// 0x75363BB5
+		{ 3664, 1, 255 },	// 0x7537050D
+		{ 3680, 1, 1 },	// 0x753714F8
+		{ 3705, 1, 0 },	// 0x754D0FC4
+		{ 3735, 1, 1 },	// 0x754E1999
+		{ 3762, 1, 6 },	// 0x75533E74
+		{ 3788, 1, 255 },	// 0x755D6DF8
+		{ 3818, 1, 1 },	// 0x755F292D
+		{ 3857, 1, 0 },	// 0x7563071D
+		{ 3881, 1, 0 },	// 0x75706300
+		{ 3888, 1, 0 },	// 0x757A0EB8
+		{ 3906, 1, 1 },	// 0x759B6BBE
+		{ 3947, 1, 255 },	// 0x75A648B7
+		{ 3952, 1, 1 },	// 0x75AC2519
+		{ 3968, 1, 2 },	// 0x75B024C6
+		{ 4000, 1, 3 },	// 0x75B43A72
+		{ 4035, 1, 6 },	// 0x75C51A26
+		{ 4059, 1, 1 },	// 0x75C9772B
+		{ 4088, 1, 1 },	// 0x75CD1A28
+		{ 4121, 1, 1 },	// 0x75D21B78
+		{ 4138, 1, 3 },	// 0x75DC4737
+		{ 4162, 1, 1 },	// 0x75E005F1
+		{ 4175, 1, 255 },	// 0x75E32257
+		{ 4205, 1, 2 },	// 0x75E40528
+		{ 4221, 1, 255 },	// 0x75ED39CF
+		{ 4237, 1, 1 },	// 0x75F85826
+		{ 4287, 1, 3 },	// 0x75FC34EF
+		{ 4342, 1, 0 },	// 0x760E0A0F
+		{ 4359, 1, 255 },	// 0x76181322
+		{ 4364, 1, 2 },	// 0x762301C8
+		{ 4387, 1, 2 },	// 0x76247429
+		{ 4424, 1, 3 },	// 0x763274B7
+		{ 4448, 1, 0 },	// 0x764236CE
+		{ 4468, 1, 255 },	// 0x766E78A3
+		{ 4498, 1, 3 },	// 0x767B7EC9
+		{ 4517, 1, 255 },	// 0x767E5013
+		{ 4543, 1, 1 },	// 0x767F1E44
+		{ 4582, 1, 1 },	// 0x76860554
+		{ 4632, 1, 4 },	// 0x768B3AC7
+		{ 4662, 1, 1 },	// 0x768F5140
+		{ 4682, 1, 1 },	// 0x768F640F
+		{ 4701, 1, 1 },	// 0x76901A85
+		{ 4736, 1, 4 },	// 0x769F6E66
+		{ 4748, 1, 2 },	// 0x76A2739D
+		{ 4768, 1, 4 },	// 0x76A63B4C
+		{ 4786, 1, 0 },	// 0x76B068CA
+		{ 4811, 1, 0 },	// 0x76C53927
+		{ 4837, 1, 6 },	// 0x76D72D89
+		{ 4866, 1, 1 },	// 0x76E738A3
+		{ 4887, 1, 1 },	// 0x76EB2878
+		{ 4913, 1, 6 },	// 0x76F25B4B
+		{ 4929, 1, 1 },	// 0x770600CF
+		{ 4968, 1, 1 },	// 0x771C2838
+		{ 4988, 1, 2 },	// 0x771F3D7D
+		{ 5016, 1, 2 },	// 0x772660D7
+		{ 5047, 1, 0 },	// 0x772B01CC
+		{ 5073, 1, 2 },	// 0x774426C2
+		{ 5098, 1, 255 },	// 0x77513211
+		{ 5120, 1, 0 },	// 0x775F6665
+		{ 5145, 1, 0 },	// 0x77745390
+		{ 5159, 1, 2 },	// 0x7781290F
+		{ 5176, 1, 1 },	// 0x7783449D
+		{ 5205, 1, 15 },	// 0x778F46E3
+		{ 5234, 1, 0 },	// 0x779F3EC6
+		{ 5270, 1, 1 },	// 0x77A97169
+		{ 5306, 1, 1 },	// 0x77D72045
+		{ 5338, 1, 1 },	// 0x77FD5097
+		{ 5354, 1, 0 },	// 0x78021D03
+		{ 5371, 1, 10 },	// 0x782E78BF
+		{ 5403, 1, 3 },	// 0x78300C0C
+		{ 5416, 1, 3 },	// 0x783F287A
+		{ 5459, 1, 1 },	// 0x7858750E
+		{ 5488, 1, 255 },	// 0x787206F8
+		{ 5494, 1, 2 },	// 0x787A3D4C
+		{ 5511, 1, 1 },	// 0x787F38B5
+		{ 5522, 1, 7 },	// 0x788026F4
+		{ 5567, 1, 1 },	// 0x788F7A03
+		{ 5592, 1, 5 },	// 0x78A75EF4
+		{ 5619, 1, 0 },	// 0x78AC735F
+		{ 5638, 1, 2 },	// 0x78B00CB2
+		{ 5656, 1, 2 },	// 0x78C17971
+		{ 5670, 1, 2 },	// 0x78CE659D
+		{ 5687, 1, 1 },	// 0x78D01893
+		{ 5709, 1, 255 },	// 0x78D17492
+		{ 5744, 1, 1 },	// 0x78DC034E
+		{ 5771, 1, 2 },	// 0x78E00C86
+		{ 5804, 1, 255 },	// 0x78E9500C
+		{ 5828, 1, 0 },	// 0x78F7286F
+		{ 5842, 1, 1 },	// 0x79103802
+		{ 5868, 1, 2 },	// 0x791D1778
+		{ 5887, 1, 2 },	// 0x79274447
+		{ 5910, 1, 6 },	// 0x7939764F
+		{ 5934, 1, 1 },	// 0x793F238A
+		{ 5968, 1, 2 },	// 0x794E4A82
+		{ 5996, 1, 255 },	// 0x795227EE
+		{ 6032, 1, 2 },	// 0x7953702C
+		{ 6059, 1, 1 },	// 0x79574B3B
+		{ 6082, 1, 0 },	// 0x79611458
+		{ 6097, 1, 1 },	// 0x79660015
+		{ 6114, 1, 1 },	// 0x796A6B88
+		{ 6132, 1, 2 },	// 0x79700852
+		{ 6163, 1, 2 },	// 0x79912ADC
+		{ 6195, 1, 2 },	// 0x79973C5A
+		{ 6224, 1, 1 },	// 0x79974E04
+		{ 6267, 1, 2 },	// 0x79A12A52
+		{ 6292, 1, 0 },	// 0x79A95BF9
+		{ 6317, 1, 255 },	// 0x79B73666
+		{ 6363, 1, 14 },	// 0x79BB1D64
+		{ 6402, 1, 0 },	// 0x79C84DBC
+		{ 6414, 1, 255 },	// 0x79CA30B1
+		{ 6448, 1, 0 },	// 0x79CF27AC
+		{ 6473, 1, 1 },	// 0x79E5237B
+		{ 6510, 1, 2 },	// 0x79EB2BC9
+		{ 6523, 1, 6 },	// 0x7A0A1063
+		{ 6555, 1, 1 },	// 0x7A0B156B
+		{ 6573, 1, 1 },	// 0x7A240412
+		{ 6591, 1, 0 },	// 0x7A2B266D
+		{ 6607, 1, 1 },	// 0x7A422E14
+		{ 6628, 1, 255 },	// 0x7A521650
+		{ 6656, 1, 1 },	// 0x7A583068
+		{ 6680, 1, 2 },	// 0x7A93645C
+		{ 6716, 1, 2 },	// 0x7A9B6E17
+		{ 6745, 1, 2 },	// 0x7AA91131
+		{ 6772, 1, 2 },	// 0x7AAD273F
+		{ 6798, 1, 6 },	// 0x7ABD4D4D
+		{ 6836, 1, 2 },	// 0x7AD71A55
+		{ 6863, 1, 1 },	// 0x7AE52512
+		{ 6882, 1, 2 },	// 0x7B014306
+		{ 6902, 1, 255 },	// 0x7B05072C
+		{ 6932, 1, 1 },	// 0x7B181EB0
+		{ 6949, 1, 2 },	// 0x7B1A5333
+		{ 6974, 1, 0 },	// 0x7B1B14BD
+		{ 6986, 1, 1 },	// 0x7B1F0130
+		{ 7003, 1, 4 },	// 0x7B2822F7
+		{ 7029, 1, 255 },	// 0x7B2E70F3
+		{ 7060, 1, 255 },	// 0x7B31633E
+		{ 7092, 1, 5 },	// 0x7B3F0058
+		{ 7120, 1, 2 },	// 0x7B44224F
+		{ 7135, 1, 2 },	// 0x7B4A7CD6
+		{ 7181, 1, 1 },	// 0x7B567F1A
+		{ 7199, 1, 255 },	// 0x7B65266B
+		{ 7228, 1, 0 },	// 0x7B6F4B91
+		{ 7250, 1, 4 },	// 0x7B732460
+		{ 7290, 1, 2 },	// 0x7B75036E
+		{ 7313, 1, 1 },	// 0x7B8537F7
+		{ 7335, 1, 1 },	// 0x7B8B1D10
+		{ 7359, 1, 2 },	// 0x7B8D68E7
+		{ 7369, 1, 2 },	// 0x7BAC73DF
+		{ 7400, 1, 6 },	// 0x7BB35FCF
+		{ 7422, 1, 1 },	// 0x7BBF3625
+		{ 7434, 1, 255 },	// 0x7BC85E73
+		{ 7467, 1, 1 },	// 0x7BD06E31
+		{ 7501, 1, 1 },	// 0x7BDE2CAF
+		{ 7523, 1, 2 },	// 0x7BEE5003
+		{ 7547, 1, 2 },	// 0x7BF4652D
+		{ 7559, 1, 1 },	// 0x7BF7646F
+		{ 7578, 1, 2 },	// 0x7BFB484F
+		{ 7605, 1, 2 },	// 0x7C0B46C8
+		{ 7637, 1, 2 },	// 0x7C156670
+		{ 7683, 1, 1 },	// 0x7C3939E7
+		{ 7714, 1, 3 },	// 0x7C4C63EF
+		{ 7732, 1, 6 },	// 0x7C4E54ED
+		{ 7761, 1, 0 },	// 0x7C515B18
+		{ 7780, 1, 0 },	// 0x7C5F327E
+		{ 7822, 1, 4 },	// 0x7C671162
+		{ 7843, 1, 3 },	// 0x7C6968F8
+		{ 7856, 1, 2 },	// 0x7C7B1237
+		{ 7877, 1, 1 },	// 0x7CA5476A
+		{ 7883, 1, 2 },	// 0x7CA8382B
+		{ 7906, 1, 2 },	// 0x7CAE2557
+		{ 7959, 1, 255 },	// 0x7CB404D4
+		{ 7991, 1, 3 },	// 0x7CC63464
+		{ 8019, 1, 255 },	// 0x7CDD7B0E
+		{ 8046, 1, 2 },	// 0x7CE83A30
+		{ 8067, 1, 1 },	// 0x7CF256D0
+		{ 8091, 1, 4 },	// 0x7CF61A81
+		{ 8129, 1, 2 },	// 0x7CFC39CB
+		{ 8163, 1, 2 },	// 0x7D037B40
+		{ 8178, 1, 255 },	// 0x7D070604
+		{ 8193, 1, 255 },	// 0x7D071EE0
+		{ 8223, 1, 0 },	// 0x7D0D6779
+		{ 8258, 1, 255 },	// 0x7D106167
+		{ 8290, 1, 1 },	// 0x7D15544E
+		{ 8304, 1, 10 },	// 0x7D3C3C9D
+		{ 8329, 1, 7 },	// 0x7D591EAD
+		{ 8355, 1, 0 },	// 0x7D635E2C
+		{ 8377, 1, 255 },	// 0x7D675993
+		{ 8392, 1, 3 },	// 0x7D6D0A6C
+		{ 8426, 1, 1 },	// 0x7D76127F
+		{ 8439, 1, 0 },	// 0x7D7619D2
+		{ 8459, 1, 2 },	// 0x7D767108
+		{ 8503, 1, 1 },	// 0x7D95313B
+		{ 8516, 1, 1 },	// 0x7D99343C
+		{ 8550, 1, 1 },	// 0x7DA237BC
+		{ 8571, 1, 2 },	// 0x7DA4736D
+		{ 8595, 1, 1 },	// 0x7DC061F5
+		{ 8616, 1, 9 },	// 0x7DCA398F
+		{ 8628, 1, 8 },	// 0x7DD67E15
+		{ 8652, 1, 2 },	// 0x7DD91295
+		{ 8671, 1, 5 },	// 0x7DE7708E
+		{ 8713, 1, 0 },	// 0x7DF26C8C
+		{ 8731, 1, 255 },	// 0x7DF45001
+		{ 8751, 1, 1 },	// 0x7E0D6CB8
+		{ 8775, 1, 1 },	// 0x7E113020
+		{ 8790, 1, 0 },	// 0x7E154274
+		{ 8823, 1, 2 },	// 0x7E1C01D7
+		{ 8848, 1, 7 },	// 0x7E2868D4
+		{ 8862, 1, 7 },	// 0x7E2A7743
+		{ 8888, 1, 0 },	// 0x7E3A7E2A
+		{ 8901, 1, 3 },	// 0x7E3D3430
+		{ 8916, 1, 0 },	// 0x7E412AC8
+		{ 8961, 1, 2 },	// 0x7E4F49B5
+		{ 8984, 1, 255 },	// 0x7E5C70BF
+		{ 9013, 1, 255 },	// 0x7E603872
+		{ 9035, 1, 2 },	// 0x7E656E50
+		{ 9062, 1, 1 },	// 0x7E657B56
+		{ 9082, 1, 3 },	// 0x7E7E4879
+		{ 9108, 1, 9 },	// 0x7E81412A
+		{ 9129, 1, 2 },	// 0x7E8C1C45
+		{ 9149, 1, 0 },	// 0x7E8C7096
+		{ 9168, 1, 4 },	// 0x7E8D1DCE
+		{ 9196, 1, 0 },	// 0x7E8E06F8
+		{ 9215, 1, 2 },	// 0x7E9E02E1
+		{ 9237, 1, 6 },	// 0x7EA03481
+		{ 9255, 1, 1 },	// 0x7EAC3387
+		{ 9274, 1, 2 },	// 0x7EAE7F2F
+		{ 9312, 1, 2 },	// 0x7EB70379
+		{ 9345, 1, 0 },	// 0x7EBB00D7
+		{ 9386, 1, 255 },	// 0x7EC9580E
+		{ 9401, 1, 1 },	// 0x7ED34379
+		{ 9432, 1, 1 },	// 0x7ED774FE
+		{ 9452, 1, 2 },	// 0x7ED82ED9
+		{ 9475, 1, 255 },	// 0x7EDD58E1
+		{ 9508, 1, 255 },	// 0x7EDE120F
+		{ 9540, 1, 1 },	// 0x7EED364B
+		{ 9549, 1, 4 },	// 0x7EF6599D
+		{ 9592, 1, 1 },	// 0x7EFB5077
+		{ 9606, 1, 2 },	// 0x7F0040DE
+		{ 9623, 1, 2 },	// 0x7F206A7F
+		{ 9645, 1, 2 },	// 0x7F2A71FD
+		{ 9671, 1, 0 },	// 0x7F3222FD
+		{ 9685, 1, 6 },	// 0x7F371477
+		{ 9704, 1, 5 },	// 0x7F3A0E22
+		{ 9726, 1, 1 },	// 0x7F483739
+		{ 9757, 1, 255 },	// 0x7F4C0E47
+		{ 9777, 1, 4 },	// 0x7F5D69C4
+		{ 9810, 1, 1 },	// 0x7F71342D
+		{ 9821, 1, 2 },	// 0x7F7B4FC5
+		{ 9846, 1, 0 },	// 0x7F853FF4
+		{ 9876, 1, 3 },	// 0x7F861E46
+		{ 9895, 1, 7 },	// 0x7F8D3DD9
+		{ 9931, 1, 1 },	// 0x7FA21A1E
+		{ 9952, 1, 1 },	// 0x7FA763E8
+		{ 9978, 1, 0 },	// 0x7FB41425
+		{ 9989, 1, 6 },	// 0x7FBC713E
+		{ 10027, 1, 1 },	// 0x7FC02528
+		{ 10058, 1, 1 },	// 0x7FC65855
+		{ 10078, 1, 1 },	// 0x7FC96DD5
+		{ 10104, 1, 2 },	// 0x7FF21081
+		{ 10122, 1, 1 },	// 0x7FF260D0
+		{ 10142, 1, 10 },	// 0x7FF3248C
+		{ 10171, 1, 255 },	// 0x7FFE0A12
+	};
+
+	inline const char ms_sNamePool0[] =
+		"NETWORK_RETURN_TO_RENDEZVOUS\0"
+		"SET_CHAR_ANIM_BLEND_OUT_DELTA\0"
+		"SET_RICH_PRESENCE_TEMPLATESP1\0"
+		"REGISTER_PLAYER_RESPAWN_COORDS\0"
+		"PLAY_SCRIPTED_CONVERSATION_FRONTEND\0"
+		"SET_CHAR_DUCKING_TIMED\0"
+		"RENDER_WEAPON_PICKUPS_BIGGER\0"
+		"GET_NUMBER_LINES_WITH_SUBSTRINGS\0"
+		"IS_CAR_IN_GARAGE_AREA\0"
+		"SET_FREE_RESPRAYS\0"
+		"WANTED_STARS_ARE_FLASHING\0"
+		"REPORT_SUSPECT_ARRESTED\0"
+		"SWITCH_PED_PATHS_OFF\0"
+		"COUNT_SCRIPT_CAMS_BY_TYPE_AND_OR_STATE\0"
+		"GET_CINEMATIC_CAM\0"
+		"MARK_MODEL_AS_NO_LONGER_NEEDED\0"
+		"PRINT_STRING_WITH_SUBSTRING_GIVEN_HASH_KEY_NOW\0"
+		"SET_PARKED_CAR_DENSITY_MULTIPLIER\0"
+		"ACTIVATE_DAMAGE_TRACKER_ON_NETWORK_ID\0"
+		"TASK_SHUFFLE_TO_NEXT_CAR_SEAT\0"
+		"FIND_TRAIN_DIRECTION\0"
+		"CAM_SEQUENCE_REMOVE\0"
+		"LOCATE_CHAR_IN_CAR_CHAR_3D\0"
+		"FLUSH_PATROL_ROUTE\0"
+		"SET_PLAYERS_DROP_MONEY_IN_NETWORK_GAME\0"
+		"CLOSE_SEQUENCE_TASK\0"
+		"IS_BUTTON_JUST_PRESSED\0"
+		"GET_MAX_AMMO_IN_CLIP\0"
+		"TASK_GUARD_SPHERE_DEFENSIVE_AREA\0"
+		"EXPLODE_CAR_IN_CUTSCENE\0"
+		"IS_COP_PED_IN_AREA_3D_NO_SAVE\0"
+		"SYNCH_RECORDING_WITH_WATER\0"
+		"GET_CURRENT_COP_MODEL\0"
+		"DISABLE_CAR_GENERATORS_WITH_HELI\0"
+		"CREATE_MONEY_PICKUP\0"
+		"CONVERT_METRES_TO_FEET_INT\0"
+		"GET_TEXTURE_RESOLUTION\0"
+		"SET_TRAIN_AUDIO_ROLLOFF\0"
+		"FORCE_GAME_TELESCOPE_CAM\0"
+		"START_PLAYBACK_RECORDED_CAR_LOOPED\0"
+		"NETWORK_GET_MET_PLAYER_NAME\0"
+		"SET_CHAR_DECISION_MAKER\0"
+		"SET_STREAMING_REQUEST_LIST_TIME\0"
+		"IS_PED_IN_COMBAT\0"
+		"SET_NEXT_DESIRED_MOVE_STATE\0"
+		"ADD_TICKER_TO_PREVIOUS_BRIEF_WITH_UNDERSCORE\0"
+		"GET_GAME_TIMER\0"
+		"POINT_FIXED_CAM_AT_OBJ\0"
+		"SOUND_CAR_HORN\0"
+		"START_PLAYBACK_RECORDED_CAR_WITH_OFFSET\0"
+		"HAS_CAR_BEEN_DROPPED_OFF\0"
+		"TASK_PLAY_ANIM_UPPER_BODY\0"
+		"HAS_PLAYER_COLLECTED_PICKUP\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_MOVEMENT_STYLE\0"
+		"SET_VOICE_ID_FROM_HEAD_COMPONENT\0"
+		"GET_INTERIOR_FROM_CHAR\0"
+		"CAN_PLAYER_START_MISSION\0"
+		"SET_VEHICLE_DIRT_LEVEL\0"
+		"GET_LENGTH_OF_LITERAL_STRING\0"
+		"SET_TEXT_SCALE\0"
+		"SET_CAR_VISIBLE\0"
+		"SET_TRAIN_CRUISE_SPEED\0"
+		"SET_FOLLOW_VEHICLE_PITCH_LIMIT_DOWN\0"
+		"TASK_GUARD_ANGLED_DEFENSIVE_AREA\0"
+		"SET_CAM_INTERP_CUSTOM_SPEED_GRAPH\0"
+		"NETWORK_GET_HOST_SERVER_NAME\0"
+		"IS_AMBIENT_SPEECH_PLAYING\0"
+		"GET_CHAR_MELEE_ACTION_FLAG2\0"
+		"ACTIVATE_HELI_SPEED_CHEAT\0"
+		"DONT_SUPPRESS_CAR_MODEL\0"
+		"FIND_NEAREST_ENTITIES_WITH_SPECIAL_ATTRIBUTE\0"
+		"REMOVE_ALL_PICKUPS_OF_TYPE\0"
+		"ADD_PICKUP_TO_INTERIOR_ROOM_BY_NAME\0"
+		"NETWORK_GET_SERVER_NAME\0"
+		"START_NEW_WIDGET_COMBO\0"
+		"REMOVE_CAR_WINDOW\0"
+		"ADD_STUCK_CAR_CHECK\0"
+		"PRINT_WITH_6_NUMBERS\0"
+		"GET_AUDIO_ROOM_ID\0"
+		"SET_CAMERA_BEGIN_CAM_COMMANDS_REQUIRED\0"
+		"IS_PED_PINNED_DOWN\0"
+		"GET_POSITION_OF_CAR_RECORDING_AT_TIME\0"
+		"SET_MAX_FIRE_GENERATIONS\0"
+		"GET_RANDOM_NETWORK_RESTART_NODE_USING_GROUP_LIST\0"
+		"IS_CAR_MODEL\0"
+		"SET_RELATIONSHIP\0"
+		"GIVE_WEAPON_TO_CHAR\0"
+		"PLAY_CAR_ANIM\0"
+		"ACTIVATE_SCRIPT_POPULATION_ZONE\0"
+		"IS_CHAR_TOUCHING_CHAR\0"
+		"TASK_PLAY_ANIM_READY_TO_BE_EXECUTED\0"
+		"GET_SCREEN_FADE_ALPHA\0"
+		"REQUEST_CAR_RECORDING\0"
+		"NETWORK_GET_HOST_AVERAGE_RANK\0"
+		"LOCATE_CHAR_ANY_MEANS_3D\0"
+		"NETWORK_GET_NUM_UNFILLED_RESERVATIONS\0"
+		"SET_CAR_ANIM_CURRENT_TIME\0"
+		"IS_CHAR_ARMED\0"
+		"NETWORK_IS_FRIEND_ONLINE\0"
+		"GET_SIMPLE_BLIP_ID\0"
+		"SET_MONEY_CARRIED_BY_PED_WITH_MODEL\0"
+		"SCRIPT_IS_MOVING_MOBILE_PHONE_OFFSCREEN\0"
+		"TASK_CHAR_SLIDE_TO_COORD\0"
+		"SET_TEXT_JUSTIFY\0"
+		"GET_CUTSCENE_SECTION_PLAYING\0"
+		"SET_GROUP_LEADER\0"
+		"SET_CHAR_VISIBLE\0"
+		"GET_IS_STICKY_BOMB_STUCK_TO_OBJECT\0"
+		"DO_SCREEN_FADE_IN\0"
+		"NETWORK_IS_NETWORK_AVAILABLE\0"
+		"OBFUSCATE_STRING\0"
+		"ADD_BLIP_FOR_PICKUP\0"
+		"TASK_GO_TO_COORD_ANY_MEANS\0"
+		"NETWORK_PLAYER_HAS_KEYBOARD\0"
+		"POINT_FIXED_CAM\0"
+		"SET_MULTIPLAYER_HUD_CASH\0"
+		"GET_ID_OF_THIS_THREAD\0"
+		"GET_STRING_WIDTH_WITH_TEXT_AND_INT\0"
+		"GET_FRAGMENT_DAMAGE_HEALTH_OF_CLOSEST_OBJECT_OF_TYPE\0"
+		"IS_THREAD_ACTIVE\0"
+		"FIND_NEAREST_COLLECTABLE_BIN_BAGS\0"
+		"TASK_CLEAR_LOOK_AT\0"
+		"CHANGE_PICKUP_BLIP_SPRITE\0"
+		"GET_CHAR_HEADING\0"
+		"IS_PED_A_MISSION_PED\0"
+		"SET_BLIP_AS_FRIENDLY\0"
+		"TURN_OFF_VEHICLE_EXTRA\0"
+		"SET_EVERYONE_IGNORE_PLAYER\0"
+		"GET_BLIP_INFO_ID_PICKUP_INDEX\0"
+		"IS_CHAR_FACING_CHAR\0"
+		"SET_PLANE_THROTTLE\0"
+		"SET_CHAR_WANTED_BY_POLICE\0"
+		"DETACH_OBJECT\0"
+		"SET_IGNORE_LOW_PRIORITY_SHOCKING_EVENTS\0"
+		"DISABLE_PLAYER_VEHICLE_ENTRY\0"
+		"SET_RICH_PRESENCE_TEMPLATEMP6\0"
+		"SET_PED_IS_BLIND_RAGING\0"
+		"SWITCH_GARBAGE_TRUCKS\0"
+		"SET_GFWL_HAS_SAFE_HOUSE\0"
+		"GET_CHAR_HIGHEST_PRIORITY_EVENT\0"
+		"COS\0"
+		"GET_CONTROL_VALUE\0"
+		"GET_DAMAGE_TO_PED_BODY_PART\0"
+		"COPY_COMBAT_DECISION_MAKER\0"
+		"CHANGE_CAR_COLOUR\0"
+		"IS_CHAR_SITTING_IDLE\0"
+		"ABSF\0"
+		"GET_STATIC_EMITTER_PLAYTIME\0"
+		"SET_CAR_FOV_MIN\0"
+		"TASK_FALL_AND_GET_UP\0"
+		"TASK_WARP_CHAR_INTO_CAR_AS_PASSENGER\0"
+		"PLAYSTATS_FLOAT\0"
+		"TASK_COMBAT_HATED_TARGETS_IN_AREA\0"
+		"UNLOCK_GENERIC_NEWS_STORY\0"
+		"GET_NUMBER_OF_CHAR_TEXTURE_VARIATIONS\0"
+		"SET_WIDESCREEN_BORDERS\0"
+		"IS_VEHICLE_TOUCHING_OBJECT\0"
+		"GET_OBJECT_VELOCITY\0"
+		"SET_PLAYER_CONTROL_ON_IN_MISSION_CLEANUP\0"
+		"SET_ONSCREEN_COUNTER_FLASH_WHEN_FIRST_DISPLAYED\0"
+		"IS_CHAR_GESTURING\0"
+		"SET_LOCAL_PLAYER_VOICE\0"
+		"GET_GROUP_CHAR_DUCKS_WHEN_AIMED_AT\0"
+		"DISPLAY_HELP_TEXT_THIS_FRAME\0"
+		"SET_CAR_DISTANCE_AHEAD_MULTIPLIER\0"
+		"SET_VEHICLE_RENDER_SCORCHED\0"
+		"CLEAR_HELP\0"
+		"SET_HEALTH_PICKUP_NETWORK_REGEN_TIME\0"
+		"SET_RANDOM_CAR_DENSITY_MULTIPLIER\0"
+		"SET_DISPLAY_PLAYER_NAME_AND_ICON\0"
+		"DAMAGE_PED_BODY_PART\0"
+		"GET_HUD_COLOUR\0"
+		"DECREMENT_FLOAT_STAT\0"
+		"ADD_OBJECT_TO_INTERIOR_ROOM_BY_NAME\0"
+		"SET_CHAR_BULLETPROOF_VEST\0"
+		"REPORT_CRIME\0"
+		"PRINT_HELP_WITH_TWO_NUMBERS\0"
+		"SET_CHAR_NOT_DAMAGED_BY_RELATIONSHIP_GROUP\0"
+		"START_KILL_FRENZY\0"
+		"STOP_PED_MOBILE_RINGING\0"
+		"GIVE_PED_HELMET\0"
+		"SET_OBJECT_USED_IN_POOL_GAME\0"
+		"SET_USES_COLLISION_OF_CLOSEST_OBJECT_OF_TYPE\0"
+		"SET_CHAR_VELOCITY\0"
+		"IS_IN_SPECTATOR_MODE\0"
+		"REPORT_POLICE_SPOTTING_SUSPECT\0"
+		"TASK_GUARD_ASSIGNED_DEFENSIVE_AREA\0"
+		"MARK_MISSION_TRAINS_AS_NO_LONGER_NEEDED\0"
+		"DISABLE_PAUSE_MENU\0"
+		"SET_ROOM_FOR_VIEWPORT_BY_KEY\0"
+		"PLAYSTATS_INT_INT\0"
+		"NETWORK_START_EXTENDED_SEARCH\0"
+		"TASK_SHOOT_AT_CHAR\0"
+		"COMPARE_STRING\0"
+		"IS_PED_DOING_DRIVEBY\0"
+		"NETWORK_STORE_SINGLE_PLAYER_GAME\0"
+		"SET_OBJECT_ROTATION\0"
+		"SET_RENDER_TRAIN_AS_DERAILED\0"
+		"IS_PLAYER_PLAYING\0"
+		"WAS_PED_KILLED_BY_HEADSHOT\0"
+		"ALLOW_GAME_TO_PAUSE_FOR_STREAMING\0"
+		"ATTACH_PED_TO_SHIMMY_EDGE\0"
+		"GET_ROUTE_SIZE\0"
+		"SET_NETWORK_ID_STOP_CLONING\0"
+		"CELL_CAM_SET_ZOOM\0"
+		"GET_CAR_SIREN_HEALTH\0"
+		"IS_CAM_SHAKING\0"
+		"ATTACH_OBJECT_TO_OBJECT\0"
+		"FREEZE_RADIO_STATION\0"
+		"GET_CHAR_MELEE_ACTION_FLAG1\0"
+		"SET_CHAR_MAX_HEALTH\0"
+		"SET_ALLOW_DUMMY_CONVERSIONS\0"
+		"HAS_RELOADED_WITH_MOTION_CONTROL\0"
+		"FIND_TIME_POSITION_IN_RECORDING\0"
+		"CLEAR_THIS_PRINT\0"
+		"SET_VEHICLE_STEER_BIAS\0"
+		"GET_ASCII_JUST_PRESSED\0"
+		"SET_RICH_PRESENCE_TEMPLATESP2\0"
+		"TASK_SWIM_TO_COORD\0"
+		"DEFINE_PED_GENERATION_CONSTRAINT_AREA\0"
+		"SET_CAM_INHERIT_ROLL_PED\0"
+		"CALCULATE_TRAVEL_DISTANCE_BETWEEN_NODES\0"
+		"DO_AUTO_SAVE\0"
+		"SET_PLAYER_CAN_BE_HASSLED_BY_GANGS\0"
+		"GET_CAR_ROLL\0"
+		"STOP_SOUND\0"
+		"GET_HEADING_FROM_VECTOR_2D\0"
+		"SET_TOTAL_NUMBER_OF_MISSIONS\0"
+		"MARK_SCRIPT_AS_NO_LONGER_NEEDED\0"
+		"IS_THIS_HELP_MESSAGE_WITH_NUMBER_BEING_DISPLAYED\0"
+		"GET_WEB_PAGE_HEIGHT\0"
+		"IS_FRONTEND_FADING\0"
+		"SEARCH_CRITERIA_REJECT_PEDS_WITH_FLAG_FALSE\0"
+		"IS_CHAR_VISIBLE\0"
+		"CLEAR_ADDITIONAL_TEXT\0"
+		"NETWORK_LIMIT_TO_16_PLAYERS\0"
+		"GET_RANDOM_NETWORK_RESTART_NODE\0"
+		"TASK_ENTER_CAR_AS_PASSENGER\0"
+		"GET_CHAR_MODEL\0"
+		"DONT_ABORT_CAR_CONVERSATIONS\0"
+		"GET_TASK_PLACE_CAR_BOMB_UNSUCCESSFUL\0"
+		"TASK_TURN_CHAR_TO_FACE_CHAR\0"
+		"PRINT\0"
+		"GET_NUM_CAR_LIVERIES\0"
+		"CLEAR_PED_NON_REMOVAL_AREA\0"
+		"TRIGGER_PTFX_ON_PED\0"
+		"SET_TIME_OF_NEXT_APPOINTMENT\0"
+		"GET_RANDOM_CAR_IN_SPHERE_NO_SAVE\0"
+		"IS_SCREEN_FADING_OUT\0"
+		"CHANGE_BLIP_NAME_FROM_TEXT_FILE\0"
+		"GET_HOURS_OF_DAY\0"
+		"TASK_AIM_GUN_AT_COORD\0"
+		"SET_CAR_DENSITY_MULTIPLIER\0"
+		"CLEAR_CHAR_LAST_DAMAGE_ENTITY\0"
+		"TASK_CLIMB_LADDER\0"
+		"LOCATE_CHAR_IN_CAR_3D\0"
+		"SET_TEXT_USE_UNDERSCORE\0"
+		"GET_MODEL_PED_IS_HOLDING\0"
+		"NETWORK_SET_PLAYER_MUTED\0"
+		"SET_DEFAULT_TARGET_SCORING_FUNCTION\0"
+		"DISPLAY_PLAYER_NAMES\0"
+		"GET_GAME_CAM\0"
+		"HAS_OBJECT_BEEN_DAMAGED_BY_CHAR\0"
+		"ATTACH_ANIMS_TO_MODEL\0"
+		"CAN_THE_STAT_HAVE_STRING\0"
+		"SET_PED_DONT_USE_VEHICLE_SPECIFIC_ANIMS\0"
+		"MARK_CHAR_AS_NO_LONGER_NEEDED\0"
+		"SET_CAR_COLOUR_COMBINATION\0"
+		"GET_OBJECT_MASS\0"
+		"FORCE_TIME_OF_DAY\0"
+		"SET_CAR_ALWAYS_CREATE_SKIDS\0"
+		"TASK_USE_MOBILE_PHONE_TIMED\0"
+		"NETWORK_HAVE_ACCEPTED_INVITE\0"
+		"IS_PED_ATTACHED_TO_OBJECT\0"
+		"ADD_LINE_TO_MOBILE_PHONE_CALL\0"
+		"REGISTER_BEST_POSITION\0"
+		"GET_WEB_PAGE_LINK_AT_POSN\0"
+		"CLEAR_PED_NON_CREATION_AREA\0"
+		"LOCATE_CHAR_IN_CAR_OBJECT_3D\0"
+		"CLEAR_AREA_OF_CHARS\0"
+		"SET_CHAR_DROWNS_IN_WATER\0"
+		"DISABLE_STICKY_BOMB_ACTIVE_SOUND\0"
+		"PLAY_STREAM_FROM_PED\0"
+		"SET_VEHICLE_ALPHA\0"
+		"VEHICLE_DOES_PROVIDE_COVER\0"
+		"DOES_VIEWPORT_EXIST\0"
+		"REMOVE_USER_3D_MARKER\0"
+		"ENABLE_PED_HELMET\0"
+		"LOAD_COMBAT_DECISION_MAKER\0"
+		"SET_PHYS_CCD_HANDLES_ROTATION\0"
+		"SWITCH_POLICE_HELIS\0"
+		"PRINT_STRING_WITH_LITERAL_STRING_NOW\0"
+		"IS_CHAR_STOPPED\0"
+		"SET_OBJECT_RECORDS_COLLISIONS\0"
+		"SET_CAR_ENGINE_ON\0"
+		"FORCE_NOISE_OFF\0"
+		"SET_CHAR_DIES_INSTANTLY_IN_WATER\0"
+		"IS_CAR_STUCK\0"
+		"FORCE_ALL_VEHICLE_LIGHTS_OFF\0"
+		"SET_VEH_ALARM\0"
+		"SKIP_TO_END_AND_STOP_PLAYBACK_RECORDED_CAR\0"
+		"SET_POLICE_FOCUS_WILL_TRACK_CAR\0"
+		"SET_MASK\0"
+		"CELL_CAM_IS_CHAR_VISIBLE\0"
+		"CLEAR_NEWS_SCROLLBAR\0"
+		"START_PTFX_ON_OBJ\0"
+		"GET_SCREEN_RESOLUTION\0"
+		"CREATE_CARS_ON_GENERATORS_IN_AREA\0"
+		"CAM_SEQUENCE_WAIT\0"
+		"GET_FRAME_COUNT\0"
+		"DISPLAY_TEXT_SUBSTRING\0"
+		"SET_CHAR_ANGLED_DEFENSIVE_AREA\0"
+		"SET_MENU_COLUMN_WIDTH\0"
+		"SET_CHAR_USES_DEAFULT_ANIM_GROUP_WHEN_FLEEING\0"
+		"SET_PLAYER_NEVER_GETS_TIRED\0"
+		"CREATE_MISSION_TRAIN\0"
+		"GET_CURRENT_SCRIPTED_CONVERSATION_LINE\0"
+		"PLANE_STARTS_IN_AIR\0"
+		"IS_THIS_MODEL_A_PED\0"
+		"GET_KEY_FOR_CAR_IN_ROOM\0"
+		"DELETE_CHAR\0"
+		"REMOVE_SCRIPT_FIRE\0"
+		"IS_CONTROL_PRESSED\0"
+		"SET_CAR_ON_GROUND_PROPERLY\0"
+		"RETUNE_RADIO_DOWN\0"
+		"SET_SPECIFIC_PASSENGER_INDEX_TO_USE_IN_GROUPS\0"
+		"STOP_PTFX\0"
+		"SET_CAR_DOOR_LATCHED\0"
+		"SET_PLAYBACK_SPEED\0"
+		"GET_MOUSE_POSITION\0"
+		"REPORT_TAGGED_RADIO_TRACK\0"
+		"HAS_CAR_BEEN_DAMAGED_BY_WEAPON\0"
+		"SET_VIEWPORT\0"
+		"DISPLAY_TEXT\0"
+		"GET_IS_WIDESCREEN\0"
+		"DOES_CAR_HAVE_HYDRAULICS\0"
+		"STREAM_CUTSCENE\0"
+		"CREATE_CAR_GENERATOR\0"
+		"SET_CINEMATIC_BUTTON_ENABLED\0"
+		"SET_HIDE_WEAPON_ICON\0"
+		"TASK_HELI_MISSION\0"
+		"TASK_START_SCENARIO_AT_POSITION\0"
+		"GET_MENU_ITEM_ACCEPTED\0"
+		"EXTEND_PATROL_ROUTE\0"
+		"ARE_ANY_CHARS_NEAR_CHAR\0"
+		"GET_CLOSEST_CHAR\0"
+		"SET_CHAR_NEVER_LEAVES_GROUP\0"
+		"GET_TEXTURE\0"
+		"SET_CHAR_CAN_SMASH_GLASS\0"
+		"GET_PICKUP_COORDINATES\0"
+		"GET_OBJECT_QUATERNION\0"
+		"TASK_SHAKE_FIST\0"
+		"PLAYSTATS_CHEAT\0"
+		"RESET_NUM_OF_MODELS_KILLED_BY_PLAYER\0"
+		"IS_CHAR_ON_ANY_BIKE\0"
+		"IS_CHAR_IN_ANY_HELI\0"
+		"MUTE_STATIC_EMITTER\0"
+		"FIX_CAR_TYRE\0"
+		"ALLOW_REACTION_ANIMS\0"
+		"IS_CAR_IN_WATER\0"
+		"SWITCH_RANDOM_TRAINS\0"
+		"GET_CAR_LIVERY\0"
+		"SHIFT_LEFT\0"
+		"GET_CHAR_MELEE_ACTION_FLAG0\0"
+		"SET_STAT_FRONTEND_DISPLAY_TYPE\0"
+		"HAS_OBJECT_COLLIDED_WITH_ANYTHING\0"
+		"GET_KEY_FOR_VIEWPORT_IN_ROOM\0"
+		"SET_LOBBY_MUTE_OVERRIDE\0"
+		"GET_FIRST_N_CHARACTERS_OF_STRING\0"
+		"SET_STATE_OF_CLOSEST_DOOR_OF_TYPE\0"
+		"ATAN2\0"
+		"UPDATE_PED_PHYSICAL_ATTACHMENT_POSITION\0"
+		"DISPLAY_TEXT_WITH_STRING\0"
+		"IS_CHAR_ON_FOOT\0"
+		"SCRIPT_ASSERT\0"
+		"TASK_GO_TO_COORD_WHILE_SHOOTING\0"
+		"NETWORK_GET_NUMBER_OF_GAMES\0"
+		"ADD_PED_TO_MISSION_DELETION_LIST\0"
+		"TASK_PLAY_ANIM_ON_CLONE\0"
+		"SET_CAR_LANE_SHIFT\0"
+		"GET_CURRENT_STATION_FOR_TRAIN\0"
+		"GET_CURRENT_LANGUAGE\0"
+		"SET_CHAR_GESTURE_GROUP\0"
+		"SET_ALL_RANDOM_PEDS_FLEE\0"
+		"TASK_LEAVE_ANY_CAR\0"
+		"GET_TIME_SINCE_LAST_DEATH\0"
+		"GET_CHAR_MOVEMENT_ANIMS_BLOCKED\0"
+		"GET_CAR_SPEED_VECTOR\0"
+		"TASK_CAR_TEMP_ACTION\0"
+		"COMPARE_TWO_DATES\0"
+		"GET_PLAYERSETTINGS_MODEL_CHOICE\0"
+		"GET_CHAR_ANIM_IS_EVENT\0"
+		"CLEAR_AREA_OF_OBJECTS\0"
+		"UNOBFUSCATE_INT\0"
+		"HAS_CAR_BEEN_DAMAGED_BY_CAR\0"
+		"SLIDE_OBJECT\0"
+		"RESET_ACHIEVEMENTS_AWARD\0"
+		"GET_DESTROYER_OF_NETWORK_ID\0"
+		"IS_SPHERE_VISIBLE_TO_ANOTHER_MACHINE\0"
+		"HAS_CHAR_GOT_WEAPON\0"
+		"GET_PLAYERS_LAST_CAR_NO_SAVE\0"
+		"NETWORK_IS_PLAYER_MUTED_BY_ME\0"
+		"IS_SITTING_OBJECT_NEAR\0"
+		"SET_INTERP_IN_OUT_VEHICLE_ENABLED_THIS_FRAME\0"
+		"GET_PED_MODEL_FROM_INDEX\0"
+		"GET_TIME_SINCE_PLAYER_HIT_BUILDING\0"
+		"SET_ROMANS_MOOD\0"
+		"TASK_COMBAT_HATED_TARGETS_AROUND_CHAR\0"
+		"SET_CHAR_IN_CUTSCENE\0"
+		"SET_PED_WINDY_CLOTHING_SCALE\0"
+		"DELETE_CHECKPOINT\0"
+		"IS_CAR_SIREN_ON\0"
+		"SET_BLIP_THROTTLE_RANDOMLY\0"
+		"SKIP_RADIO_FORWARD\0"
+		"STORE_WANTED_LEVEL\0"
+		"IS_PLAYER_DEAD\0"
+		"ROTATE_OBJECT\0"
+		"DRAW_CURVED_WINDOW_NOTEXT\0"
+		"MISSION_AUDIO_BANK_NO_LONGER_NEEDED\0"
+		"SET_CAR_COORDINATES_NO_OFFSET\0"
+		"SET_STAT_FRONTEND_VISIBLE_AFTER_INCREMENTED\0"
+		"IS_SCRIPTED_SPEECH_PLAYING\0"
+		"REQUEST_COLLISION_AT_POSN\0"
+		"CLEAR_ROOM_FOR_OBJECT\0"
+		"SET_CAM_POINT_OFFSET_IS_RELATIVE\0"
+		"CREATE_VIEWPORT\0"
+		"RESET_CAM_SPLINE_CUSTOM_SPEED_GRAPH\0"
+		"TASK_COMBAT_ROLL\0"
+		"NETWORK_GET_NUM_UNACCEPTED_INVITES\0"
+		"SET_PLAYER_CONTROL_FOR_TEXT_CHAT\0"
+		"PLAY_STREAM_FRONTEND\0"
+		"HAS_NETWORK_PLAYER_LEFT_GAME\0"
+		"SET_CAR_PROOFS\0"
+		"SET_PTFX_CAM_INSIDE_VEHICLE\0"
+		"SET_IK_DISABLED_FOR_NETWORK_PLAYER\0"
+		"SET_TIME_CYCLE_FAR_CLIP_DISABLED\0"
+		"GET_RANDOM_CAR_FRONT_BUMPER_IN_SPHERE_NO_SAVE\0"
+		"ADD_NEW_FRONTEND_CONVERSATION_SPEAKER\0"
+		"COPY_SHARED_COMBAT_DECISION_MAKER\0"
+		"SWITCH_PED_TO_RAGDOLL_WITH_FALL\0"
+		"GET_STATE_OF_CLOSEST_DOOR_OF_TYPE\0"
+		"SET_GROUP_CHAR_DECISION_MAKER\0"
+		"IS_CAR_STOPPED_AT_TRAFFIC_LIGHTS\0"
+		"NETWORK_SET_LOCAL_PLAYER_IS_TYPING\0"
+		"SET_CHAR_WATCH_MELEE\0"
+		"GET_TIME_TIL_NEXT_STATION\0"
+		"TASK_SEEK_COVER_TO_COORDS\0"
+		"DESTROY_CAM\0"
+		"TASK_SEEK_COVER_TO_COVER_POINT\0"
+		"ENABLE_GPS_IN_VEHICLE\0"
+		"SET_OBJECT_SCALE\0"
+		"NETWORK_GET_PLAYER_ID_OF_NEXT_TEXT_CHAT\0"
+		"SET_PED_WITH_BRAIN_CAN_BE_CONVERTED_TO_DUMMY_PED\0"
+		"SET_POLICE_RADAR_BLIPS\0"
+		"OPEN_SEQUENCE_TASK\0"
+		"IS_GAME_KEYBOARD_NAV_UP_PRESSED\0"
+		"CLOSE_MIC_PED\0"
+		"INCREMENT_INT_STAT\0"
+		"SET_BITS_IN_RANGE\0"
+		"TASK_COMBAT_HATED_TARGETS_AROUND_CHAR_TIMED\0"
+		"SET_BLIP_MARKER_LONG_DISTANCE\0"
+		"GET_LINE_HEIGHT\0"
+		"BLOCK_PEEKING_IN_COVER\0"
+		"CHECK_STUCK_TIMER\0"
+		"SET_CAM_POS\0"
+		"GET_NEXT_BLIP_INFO_ID\0"
+		"SET_CHAR_SUFFERS_CRITICAL_HITS\0"
+		"SET_TEXT_PROPORTIONAL\0"
+		"RESERVE_NETWORK_MISSION_VEHICLES\0"
+		"HAS_CHAR_SPOTTED_CHAR_IN_FRONT\0"
+		"PRINT_WITH_6_NUMBERS_NOW\0"
+		"PRINT_HELP_WITH_STRING_NO_SOUND\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_NUM_PEDS\0"
+		"SET_HEADING_LIMIT_FOR_ATTACHED_PED\0"
+		"GET_TXD\0"
+		"REMOVE_PED_HELMET\0"
+		"CLEAR_OBJECT_LAST_WEAPON_DAMAGE\0"
+		"TURN_CAR_TO_FACE_COORD\0"
+		"ATTACH_OBJECT_TO_CAR_PHYSICALLY\0"
+		"SET_CHAR_IS_TARGET_PRIORITY\0"
+		"GET_WIDTH_OF_LITERAL_STRING\0"
+		"GENERATE_RANDOM_INT_IN_RANGE\0"
+		"SET_OBJECT_ANIM_SPEED\0"
+		"HIDE_HELP_TEXT_THIS_FRAME\0"
+		"SET_STREAM_PARAMS\0"
+		"CLEAR_BRIEF\0"
+		"GET_CAR_SPEED\0"
+		"GET_STRING_FROM_HASH_KEY\0"
+		"COPY_GROUP_COMBAT_DECISION_MAKER\0"
+		"REMOVE_PROJTEX_IN_RANGE\0"
+		"IS_ANY_SPEECH_PLAYING\0"
+		"WARP_CHAR_INTO_CAR_AS_PASSENGER\0"
+		"GET_PLAYER_MAX_ARMOUR\0"
+		"GET_PLAYER_TO_PLACE_BOMB_IN_CAR\0"
+		"HAS_CONTROL_OF_NETWORK_ID\0"
+		"IS_THIS_MODEL_A_PLANE\0"
+		"NETWORK_SET_SCRIPT_LOBBY_STATE\0"
+		"TASK_CAR_MISSION_PED_TARGET_NOT_AGAINST_TRAFFIC\0"
+		"FINISH_STREAMING_REQUEST_LIST\0"
+		"RESURRECT_NETWORK_PLAYER\0"
+		"DISPLAY_RADAR\0"
+		"GET_PED_STEERS_AROUND_PEDS\0"
+		"LOCATE_CHAR_IN_CAR_CHAR_2D\0"
+		"IS_VEH_DRIVEABLE\0"
+		"IS_SPECIFIC_CAM_INTERPOLATING\0"
+		"DELETE_WIDGET_GROUP\0"
+		"SET_PETROL_TANK_HEALTH\0"
+		"ENABLE_DISABLED_ATTRACTORS_ON_OBJECT\0"
+		"NETWORK_GET_FRIEND_NAME\0"
+		"SET_TIME_ONE_DAY_BACK\0"
+		"IS_LOOK_INVERTED\0"
+		"SET_CAM_FAR_CLIP\0"
+		"GET_AUDIBLE_MUSIC_TRACK_TEXT_ID\0"
+		"DRAW_TOPLEVEL_SPRITE\0"
+		"BLOCK_COWERING_IN_COVER\0"
+		"FORCE_SPAWN_SCENARIO_PEDS_IN_AREA\0"
+		"TASK_LEAVE_CAR_IN_DIRECTION\0"
+		"FLUSH_ALL_PLAYER_RESPAWN_COORDS\0"
+		"TASK_SMART_FLEE_CHAR\0"
+		"SET_SCREEN_FADE\0"
+		"IS_CAR_ON_FIRE\0"
+		"COPY_SHARED_CHAR_DECISION_MAKER\0"
+		"GET_NUMBER_OF_WEB_PAGE_LINKS\0"
+		"CALCULATE_CHECKSUM\0"
+		"BREAK_CAR_DOOR\0"
+		"NETWORK_SEND_TEXT_CHAT\0"
+		"IS_IN_PLAYER_SETTINGS_MENU\0"
+		"ADD_COVER_POINT\0"
+		"REGISTER_HOST_BROADCAST_VARIABLES\0"
+		"LOCATE_CHAR_ANY_MEANS_CHAR_2D\0"
+		"WAS_CUTSCENE_SKIPPED\0"
+		"SET_FILTER_MENU_ON\0"
+		"GET_PED_TYPE\0"
+		"TASK_LEAVE_GROUP\0"
+		"GET_MODEL_DIMENSIONS\0"
+		"LOCATE_CHAR_ON_FOOT_CHAR_2D\0"
+		"DISABLE_LOCAL_PLAYER_PICKUPS\0"
+		"ADD_STRING_TO_NEWS_SCROLLBAR\0"
+		"PRINT_STRING_WITH_TWO_LITERAL_STRINGS\0"
+		"CONTROL_CAR_DOOR\0"
+		"SET_CHAR_ACCURACY\0"
+		"TASK_GO_STRAIGHT_TO_COORD\0"
+		"GET_RANDOM_CAR_MODEL_IN_MEMORY\0"
+		"TRIGGER_VIGILANTE_CRIME\0"
+		"GET_TIME_SINCE_PLAYER_DROVE_ON_PAVEMENT\0"
+		"PRINT_HELP_FOREVER_WITH_NUMBER\0"
+		"ADD_PICKUP_TO_INTERIOR_ROOM_BY_KEY\0"
+		"GET_IS_HIDEF\0"
+		"ADD_BLIP_FOR_CHAR\0"
+		"DISABLE_HELI_CHASE_CAM_BONNET_NITRO_FIX\0"
+		"SET_TEXT_COLOUR\0"
+		"SET_TEXT_WRAP\0"
+		"IS_ANY_CHAR_SHOOTING_IN_AREA\0"
+		"SET_CAR_RANDOM_ROUTE_SEED\0"
+		"ALLOCATE_SCRIPT_TO_RANDOM_PED\0"
+		"SET_OBJECT_DRAW_LAST\0"
+		"CLEAR_CHAR_LAST_DAMAGE_BONE\0"
+		"SET_CHAR_STAY_IN_CAR_WHEN_JACKED\0"
+		"SET_GUNSHOT_SENSE_RANGE_FOR_RIOT2\0"
+		"SWITCH_PED_TO_RAGDOLL\0"
+		"TASK_PLAY_ANIM_WITH_FLAGS_AND_START_PHASE\0"
+		"DISABLE_DEBUG_CAM_AND_PLAYER_WARPING\0"
+		"GET_CHAR_DRAWABLE_VARIATION\0"
+		"IS_CAR_UPRIGHT\0"
+		"BLOCK_CHAR_AMBIENT_ANIMS\0"
+		"LOCATE_CHAR_ANY_MEANS_CAR_2D\0"
+		"PRINT_WITH_3_NUMBERS_NOW\0"
+		"SET_PLAYER_CONTROL\0"
+		"NETWORK_GET_UNACCEPTED_INVITER_NAME\0"
+		"SET_CHAR_PROVIDE_COVERING_FIRE\0"
+		"CREATE_RANDOM_FEMALE_CHAR\0"
+		"GET_PLAYER_RADIO_STATION_NAME_ROLL\0"
+		"TASK_SHIMMY_LET_GO\0"
+		"SET_CHAR_GET_OUT_UPSIDE_DOWN_CAR\0"
+		"HIGHLIGHT_MENU_ITEM\0"
+		"SET_OBJECT_RENDER_SCORCHED\0"
+		"ADD_AMMO_TO_CHAR\0"
+		"HAS_CHAR_SPOTTED_CHAR\0"
+		"IS_CAM_INTERPOLATING\0"
+		"GET_SAFE_PICKUP_COORDS\0"
+		"SET_IN_MP_TUTORIAL\0"
+		"GET_CAR_CHAR_IS_USING\0"
+		"SCRIPT_IS_USING_MOBILE_PHONE\0"
+		"ADD_NEXT_MESSAGE_TO_PREVIOUS_BRIEFS\0"
+		"REGISTER_ODDJOB_MISSION_PASSED\0"
+		"NETWORK_SHOW_MET_PLAYER_PROFILE_UI\0"
+		"LOCK_LAZLOW_STATION\0"
+		"GET_CURRENT_BASIC_COP_MODEL\0"
+		"TASK_FOLLOW_NAV_MESH_TO_COORD\0"
+		"SWITCH_OFF_WAYPOINT\0"
+		"HINT_CAM\0"
+		"SET_INT_STAT\0"
+		"NETWORK_IS_SESSION_ADVERTISE\0"
+		"GET_BLIP_INFO_ID_DISPLAY\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_NUM_CARS\0"
+		"SET_CAR_STAY_IN_SLOW_LANE\0"
+		"IS_IN_LAN_MODE\0"
+		"FORCE_GENERATE_PARKED_CARS_TOO_CLOSE_TO_OTHERS\0"
+		"GET_SPEECH_FOR_EMERGENCY_SERVICE_CALL\0"
+		"SET_OBJECT_PHYSICS_PARAMS\0"
+		"NETWORK_ADVERTISE_SESSION\0"
+		"EXP\0"
+		"SET_RANDOM_SEED\0"
+		"COPY_CHAR_DECISION_MAKER\0"
+		"SHUTDOWN_AND_LAUNCH_NETWORK_GAME\0"
+		"GET_NETWORK_ID_FROM_VEHICLE\0"
+		"SET_GAME_CAM_PITCH\0"
+		"IS_CAR_PASSENGER_SEAT_FREE\0"
+		"CLEAR_NETWORK_RESTART_NODE_GROUP_LIST\0"
+		"TIMERC\0"
+		"TASK_FOLLOW_NAV_MESH_TO_COORD_NO_STOP\0"
+		"MP_GET_PROP_SETUP\0"
+		"IS_CHAR_TRYING_TO_ENTER_A_LOCKED_CAR\0"
+		"BLOCK_CHAR_GESTURE_ANIMS\0"
+		"GET_OBJECT_SPEED\0"
+		"PRINT_HELP_OVER_FRONTEND\0"
+		"SET_CHAR_AS_ENEMY\0"
+		"TRIGGER_LOADING_MUSIC_ON_NEXT_FADE\0"
+		"SET_EXTRA_POLICE_STATION_RESTART_POINT\0"
+		"SET_SLEEP_MODE_ACTIVE\0"
+		"CAM_SET_INTERP_GRAPH_ROT\0"
+		"ADD_ARMOUR_TO_CHAR\0"
+		"SET_OBJECT_INITIAL_ROTATION_VELOCITY\0"
+		"SET_VIEWPORT_DESTINATION\0"
+		"SET_CAM_POINT_OFFSET\0"
+		"CLEAR_THIS_PRINT_BIG_NOW\0"
+		"TASK_LEAVE_CAR_DONT_CLOSE_DOOR\0"
+		"NETWORK_HOST_GAME_SUCCEEDED\0"
+		"TASK_SET_CHAR_DECISION_MAKER\0"
+		"GET_CAM_FAR_DOF\0"
+		"IS_LAZLOW_STATION_LOCKED\0"
+		"IS_NETWORK_GAME_RUNNING\0"
+		"GET_NO_OF_PLAYERS_IN_TEAM\0"
+		"IS_VEH_WINDOW_INTACT\0"
+		"SET_PLAYER_AS_COP\0"
+		"DOES_SCRIPT_EXIST\0"
+		"SET_CHAR_WILL_TRY_TO_LEAVE_WATER\0"
+		"SET_OBJECT_INVINCIBLE\0"
+		"IS_KEYBOARD_KEY_PRESSED\0"
+		"HAVE_ANIMS_LOADED\0"
+		"GET_CURRENT_TAXI_CAR_MODEL\0"
+		"GET_FLOAT_STAT\0"
+		"CHANGE_BLIP_COLOUR\0"
+		"CLEAR_PRINTS\0"
+		"IS_PC_VERSION\0"
+		"IS_CHAR_SITTING_IN_ANY_CAR\0"
+		"CAN_REGISTER_MISSION_PED\0"
+		"HAS_CHAR_BEEN_DAMAGED_BY_CHAR\0"
+		"SHOW_BLIP_ON_ALTIMETER\0"
+		"PRIORITIZE_STREAMING_REQUEST\0"
+		"LOCATE_CHAR_IN_CAR_2D\0"
+		"SET_LOCAL_PLAYER_PAIN_VOICE\0"
+		"DOES_WEB_PAGE_EXIST\0"
+		"GET_CHAR_ANIM_BLEND_AMOUNT\0"
+		"DETACH_CAM_FROM_VIEWPORT\0"
+		"IS_CAR_TYRE_BURST\0"
+		"STORE_SCRIPT_VALUES_FOR_NETWORK_GAME\0"
+		"NETWORK_FINISH_EXTENDED_SEARCH\0"
+		"SET_ROOM_FOR_CAR_BY_KEY\0"
+		"GET_NUMBER_OF_FIRES_IN_AREA\0"
+		"NETWORK_RESTORE_GAME_CONFIG\0"
+		"STORE_SCORE\0"
+		"CAN_FONT_BE_LOADED\0"
+		"IS_HELI_PART_BROKEN\0"
+		"OPEN_CAR_DOOR\0"
+		"SET_LOAD_COLLISION_FOR_CAR_FLAG\0"
+		"SET_CHAR_DROWNS_IN_SINKING_VEHICLE\0"
+		"DISPLAY_AREA_NAME\0"
+		"SET_DANCE_SHAKE_ACTIVE_THIS_UPDATE\0"
+		"SET_PED_PATH_WILL_AVOID_DYNAMIC_OBJECTS\0"
+		"GET_MOBILE_PHONE_SCALE\0"
+		"TASK_CAR_DRIVE_WANDER\0"
+		"ENABLE_END_CREDITS_FADE\0"
+		"SET_PED_DONT_DO_EVASIVE_DIVES\0"
+		"SIN\0"
+		"IS_OBJECT_UPRIGHT\0"
+		"IS_PAY_N_SPRAY_ACTIVE\0"
+		"SET_CHAR_WILL_MOVE_WHEN_INJURED\0"
+		"FORCE_HIGH_LOD\0"
+		"TASK_COMBAT\0"
+		"FLUSH_ALL_OUT_OF_DATE_RADAR_BLIPS_FROM_MISSION_CLEANUP_LIST\0"
+		"HAS_CHAR_BEEN_PHOTOGRAPHED\0"
+		"SECUROM_SPOT_CHECK2\0"
+		"SET_TEXT_LINE_DISPLAY\0"
+		"GET_NTH_CLOSEST_CAR_NODE_WITH_HEADING\0"
+		"CREATE_PICKUP_WITH_AMMO\0"
+		"ATTACH_OBJECT_TO_PED_PHYSICALLY\0"
+		"DOES_OBJECT_OF_TYPE_EXIST_AT_COORDS\0"
+		"GET_CAR_DEFORMATION_AT_POS\0"
+		"TASK_OPEN_DRIVER_DOOR\0"
+		"GET_SEQUENCE_PROGRESS\0"
+		"SET_IGNORE_NO_GPS_FLAG\0"
+		"HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_DAMAGED_BY_CHAR\0"
+		"SET_ENABLE_RC_DETONATE\0"
+		"DISPLAY_TEXT_WITH_LITERAL_SUBSTRING\0"
+		"TASK_PUT_CHAR_DIRECTLY_INTO_COVER\0"
+		"SET_ROTATION_FOR_ATTACHED_PED\0"
+		"CAN_REGISTER_MISSION_VEHICLE\0"
+		"FREEZE_CHAR_POSITION\0"
+		"SET_NM_MESSAGE_BOOL\0"
+		"GENERATE_DIRECTIONS\0"
+		"PRINTINT\0"
+		"GET_VEHICLE_PLAYER_WOULD_ENTER\0"
+		"SET_TEXT_CENTRE\0"
+		"CLEAR_WANTED_LEVEL\0"
+		"GET_FRAME_TIME\0"
+		"SET_CAM_INHERIT_ROLL_OBJECT\0"
+		"ENABLE_SAVE_HOUSE\0"
+		"NETWORK_RETURN_TO_RENDEZVOUS_SUCCEEDED\0"
+		"SET_VISIBILITY_OF_CLOSEST_OBJECT_OF_TYPE\0"
+		"GET_CURRENT_POLICE_CAR_MODEL\0"
+		"SET_PED_HELI_PILOT_RESPECTS_MINIMUMM_HEIGHT\0"
+		"SET_FOLLOW_VEHICLE_CAM_SUBMODE\0"
+		"MARK_CAR_AS_NO_LONGER_NEEDED\0"
+		"FLASH_ROUTE\0"
+		"SEARCH_CRITERIA_CONSIDER_PEDS_WITH_FLAG_TRUE\0"
+		"GET_NETWORK_TIMER\0"
+		"HAS_CHAR_BEEN_ARRESTED\0"
+		"SET_CAR_AS_MISSION_CAR\0"
+		"IS_CHAR_IN_ANY_BOAT\0"
+		"REMOVE_PICKUP\0"
+		"RELEASE_SOUND_ID\0"
+		"UNPOINT_CAM\0"
+		"REMOVE_STUCK_CAR_CHECK\0"
+		"FORCE_CHAR_TO_DROP_WEAPON\0"
+		"DOES_PED_EXIST_WITH_NETWORK_ID\0"
+		"MP_SET_PREFERENCE_VALUE\0"
+		"ADD_BLIP_FOR_RADIUS\0"
+		"UNOBFUSCATE_STRING\0"
+		"IS_THIS_A_MINIGAME_SCRIPT\0"
+		"ATTACH_CAM_TO_VIEWPORT\0"
+		"DISABLE_END_CREDITS_FADE\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_WEAPON_ACCURACY\0"
+		"GET_NUMBER_OF_ACTIVE_STICKY_BOMBS_OWNED_BY_PED\0"
+		"TRIGGER_PTFX\0"
+		"STORE_CAR_CHAR_IS_IN_NO_SAVE\0"
+		"PLACE_OBJECT_RELATIVE_TO_CAR\0"
+		"GET_BUFFERED_ASCII\0"
+		"FIND_POSITION_IN_RECORDING\0"
+		"START_PTFX_ON_PED_BONE\0"
+		"INCREASE_PLAYER_MAX_ARMOUR\0"
+		"DRAW_SPRITE_FRONT_BUFF\0"
+		"IS_CHAR_IN_ANY_TRAIN\0"
+		"GET_MENU_ITEM_SELECTED\0"
+		"GET_DRIVER_OF_CAR\0"
+		"GET_SORTED_NETWORK_RESTART_NODE_USING_GROUP_LIST\0"
+		"PLAYER_HAS_CHAR\0"
+		"SET_CUTSCENE_EXTRA_ROOM_POS\0"
+		"IS_PED_HOLDING_AN_OBJECT\0"
+		"MAKE_OBJECT_TARGETTABLE\0"
+		"CREATE_NM_MESSAGE\0"
+		"GET_CAM_STATE\0"
+		"CAN_START_MISSION_PASSED_TUNE\0"
+		"SET_GROUP_SEPARATION_RANGE\0"
+		"SET_SEQUENCE_TO_REPEAT\0"
+		"PRINT_WITH_2_NUMBERS\0"
+		"DRAW_WINDOW\0"
+		"IS_EPISODE_AVAILABLE\0"
+		"CLEAR_ALL_CHAR_PROPS\0"
+		"CHANGE_PLAYER_MODEL\0"
+		"IS_STREAMING_ADDITIONAL_TEXT\0"
+		"NETWORK_IS_PLAYER_BLOCKED_BY_ME\0"
+		"IS_CHAR_IN_AIR\0"
+		"NETWORK_FIND_GAME_PENDING\0"
+		"GET_AMMO_IN_CHAR_WEAPON\0"
+		"GET_DISTANCE_BETWEEN_COORDS_3D\0"
+		"PAUSE_PLAYBACK_RECORDED_CAR\0"
+		"CLEAR_AREA_OF_CARS\0"
+		"SET_CHAR_ANIM_CURRENT_TIME\0"
+		"SIMULATE_UPDATE_LOAD_SCENE\0"
+		"START_SCRIPT_FIRE\0"
+		"REMOVE_WEAPON_FROM_CHAR\0"
+		"SET_MOBILE_RING_TYPE\0"
+		"SET_OBJECT_COLLISION\0"
+		"SET_VEH_HAZARDLIGHTS\0"
+		"DROP_OBJECT\0"
+		"TAN\0"
+		"SET_TIME_SCALE\0"
+		"HAS_POOL_OBJECT_COLLIDED_WITH_OBJECT\0"
+		"SET_CAN_BURST_CAR_TYRES\0"
+		"IS_CAR_STREET_RACER\0"
+		"CAM_SET_DOLLY_ZOOM_LOCK\0"
+		"REMOVE_GROUP\0"
+		"GET_PLAYER_RADIO_STATION_NAME\0"
+		"STRING_DIFFERENCE\0"
+		"DELETE_MENU\0"
+		"GET_PLAYER_COLOUR\0"
+		"GET_SCREEN_VIEWPORT_ID\0"
+		"GET_NAME_OF_ZONE\0"
+		"SKIP_TIME_IN_PLAYBACK_RECORDED_CAR\0"
+		"SET_FREEBIES_IN_VEHICLE\0"
+		"GRAB_NEARBY_OBJECT_WITH_SPECIAL_ATTRIBUTE\0"
+		"GET_INTERIOR_FROM_CAR\0"
+		"SET_HAS_BEEN_OWNED_BY_PLAYER\0"
+		"TO_FLOAT\0"
+		"SET_DITCH_POLICE_MODELS\0"
+		"GET_EXTRA_CAR_COLOURS\0"
+		"FIRE_PED_WEAPON\0"
+		"GET_FILTER_SAVE_SETTING\0"
+		"NETWORK_IS_COMMON_EPISODE\0"
+		"TASK_START_SCENARIO_IN_PLACE\0"
+		"DRAW_MOVIE\0"
+		"CAM_SEQUENCE_START\0"
+		"SET_CHAR_KEEP_TASK\0"
+		"TASK_SIT_DOWN\0"
+		"TOGGLE_CHAR_DUCKING\0"
+		"SET_CHAR_MELEE_ACTION_FLAG2\0"
+		"FLASH_RADAR\0"
+		"WAIT\0"
+		"SET_ROOM_FOR_CAR_BY_NAME\0"
+		"GET_KEY_FOR_CHAR_IN_ROOM\0"
+		"SET_NETWORK_VEHICLE_RESPOT_TIMER\0"
+		"PLAYSTATS_MISSION_STARTED\0"
+		"GET_HELP_MESSAGE_BOX_SIZE\0"
+		"DELETE_WIDGET\0"
+		"DRAW_CHECKPOINT_WITH_ALPHA\0"
+		"SET_CHAR_USES_UPPERBODY_DAMAGE_ANIMS_ONLY\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_NAVIGATION_STYLE\0"
+		"CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_VEHICLE\0"
+		"IS_GARAGE_CLOSED\0"
+		"TASK_LOOK_AT_COORD\0"
+		"GET_OBJECT_ANIM_TOTAL_TIME\0"
+		"CREATE_CHAR_INSIDE_CAR\0"
+		"NETWORK_HAS_STRICT_NAT\0"
+		"GET_CLOSEST_STEALABLE_OBJECT\0"
+		"SET_TRAIN_IS_STOPPED_AT_STATION\0"
+		"SEARCH_CRITERIA_REJECT_PEDS_WITH_FLAG_TRUE\0"
+		"DIM_BLIP\0"
+		"IS_MOUSE_BUTTON_JUST_PRESSED\0"
+		"STOP_MOBILE_PHONE_RINGING\0"
+		"TASK_PLAY_ANIM_SECONDARY\0"
+		"VEHICLE_CAN_BE_TARGETTED_BY_HS_MISSILE\0"
+		"OVERRIDE_NEXT_RESTART\0"
+		"SET_PLAYERSETTINGS_MODEL_VARIATIONS_CHOICE\0"
+		"CLEAR_AREA\0"
+		"UNATTACH_CAM\0"
+		"SET_CAR_TRACTION\0"
+		"TASK_LOOK_AT_OBJECT\0"
+		"ADD_WIDGET_STRING\0"
+		"GET_CURRENT_WEATHER\0"
+		"NETWORK_GET_NUM_PARTY_MEMBERS\0"
+		"GET_CLOSEST_CAR_NODE\0"
+		"SAVE_STRING_TO_DEBUG_FILE\0"
+		"GET_ROOM_KEY_FROM_PICKUP\0"
+		"SET_NETWORK_PLAYER_AS_VIP\0"
+		"NETWORK_GET_RENDEZVOUS_HOST_PLAYER_ID\0"
+		"NETWORK_GET_FIND_RESULT\0"
+		"CAM_SEQUENCE_STOP\0"
+		"GET_NUMBER_OF_FIRES_IN_RANGE\0"
+		"NETWORK_PLAYER_HAS_COMM_PRIVS\0"
+		"GET_NUMBER_OF_STICKY_BOMBS_STUCK_TO_VEHICLE\0"
+		"GET_VIEWPORT_POSITION_OF_COORD\0"
+		"SET_CAR_ONLY_DAMAGED_BY_PLAYER\0"
+		"LOAD_ADDITIONAL_TEXT\0"
+		"START_SCRIPT_CONVERSATION\0"
+		"IS_CAR_IN_AREA_3D\0"
+		"IS_CHAR_IN_TAXI\0"
+		"SET_GPS_TEST_IN_3D_FLAG\0"
+		"TASK_PLAY_ANIM\0"
+		"TASK_COWER\0"
+		"GET_INTERIOR_AT_COORDS\0"
+		"AMBIENT_AUDIO_BANK_NO_LONGER_NEEDED\0"
+		"STOP_CAR_BREAKING\0"
+		"SKIP_TO_NEXT_SCRIPTED_CONVERSATION_LINE\0"
+		"MAKE_PLAYER_GANG_REAPPEAR\0"
+		"GET_CAR_ANIM_TOTAL_TIME\0"
+		"FREEZE_CAR_POSITION\0"
+		"SET_SCRIPT_MIC_POSITION\0"
+		"ATTACH_CAM_TO_OBJECT\0"
+		"ENABLE_DEBUG_CAM\0"
+		"INCREMENT_INT_STAT_NO_MESSAGE\0"
+		"SET_CAM_NEAR_CLIP\0"
+		"SET_ROOM_FOR_DUMMY_CHAR_BY_KEY\0"
+		"REQUEST_CONTROL_OF_NETWORK_ID\0"
+		"SET_TAXI_GARAGE_RADIO_STATE\0"
+		"NETWORK_GET_GAME_MODE\0"
+		"SET_CHAR_FIRE_DAMAGE_MULTIPLIER\0"
+		"SET_PLAYER_FAST_RELOAD\0"
+		"GET_IS_STICKY_BOMB_STUCK_TO_VEHICLE\0"
+		"GET_CAR_MODEL_VALUE\0"
+		"IS_PLAYER_READY_FOR_CUTSCENE\0"
+		"SET_THIS_SCRIPT_CAN_REMOVE_BLIPS_CREATED_BY_ANY_SCRIPT\0"
+		"SET_FAKE_WANTED_LEVEL\0"
+		"GET_OBJECT_ANIM_CURRENT_TIME\0"
+		"DRAW_CHECKPOINT\0"
+		"GET_RETURN_TO_FILTER_MENU\0"
+		"HAS_SCRIPT_LOADED\0"
+		"LOCATE_CAR_3D\0"
+		"SET_TEXT_INPUT_ACTIVE\0"
+		"TASK_GO_TO_COORD_WHILE_AIMING\0"
+		"IS_PARTY_MODE\0"
+		"SET_MISSION_TRAIN_COORDINATES\0"
+		"PAUSE_SCRIPTED_CONVERSATION\0"
+		"SET_DEAD_PEDS_DROP_WEAPONS\0"
+		"SET_CHAR_INVINCIBLE\0"
+		"DOES_TEXT_LABEL_EXIST\0"
+		"RESET_VISIBLE_PED_DAMAGE\0"
+		"SET_CHAR_COLLISION\0"
+		"GET_DEAD_CHAR_PICKUP_COORDS\0"
+		"UNPAUSE_GAME\0"
+		"SEARCH_CRITERIA_CONSIDER_PEDS_WITH_FLAG_FALSE\0"
+		"IS_CAR_DEAD\0"
+		"ADD_HOSPITAL_RESTART\0"
+		"RELEASE_TIME_OF_DAY\0"
+		"SET_CAM_NAME\0"
+		"SET_CHAR_SHOOT_RATE\0"
+		"SET_PLAYER_CONTROL_FOR_NETWORK\0"
+		"GET_ENGINE_HEALTH\0"
+		"SET_PLAYER_MP_MODIFIER\0"
+		"SET_TEXT_RENDER_ID\0"
+		"PRINT_BIG_Q\0"
+		"SET_CHAR_READY_TO_BE_STUNNED\0"
+		"PLAYER_IS_INTERACTING_WITH_GARAGE\0"
+		"ADD_SPAWN_BLOCKING_DISC\0"
+		"GET_CHAR_COORDINATES\0"
+		"IMPROVE_LOW_PERFORMANCE_MISSION_PER_FRAME_FLAG\0"
+		"PLAYER_HAS_GREYED_OUT_STARS\0"
+		"HIDE_CHAR_WEAPON_FOR_SCRIPTED_CUTSCENE\0"
+		"DOES_CAR_HAVE_STUCK_CAR_CHECK\0"
+		"PRELOAD_STREAM_WITH_START_OFFSET\0"
+		"GET_CUTSCENE_AUDIO_TIME_MS\0"
+		"SET_VEHICLE_CAN_BE_TARGETTED\0"
+		"SET_PED_FORCE_VISUALISE_HEAD_DAMAGE_FROM_BULLETS\0"
+		"PRINT_STRING_IN_STRING_NOW\0"
+		"GET_WATER_HEIGHT\0"
+		"UNMARK_ALL_ROAD_NODES_AS_DONT_WANDER\0"
+		"REMOVE_CHAR_DEFENSIVE_AREA\0"
+		"GET_MISSION_FLAG\0"
+		"TERMINATE_THIS_SCRIPT\0"
+		"TASK_SEEK_COVER_FROM_POS\0"
+		"REMOVE_CARS_FROM_GENERATORS_IN_AREA\0"
+		"SET_RICH_PRESENCE_TEMPLATEMP4\0"
+		"TASK_DRIVE_POINT_ROUTE\0"
+		"ADD_BLIP_FOR_GANG_TERRITORY\0"
+		"SQRT\0"
+		"GET_RANDOM_CAR_BACK_BUMPER_IN_SPHERE\0"
+		"SET_HOST_MATCH_ON\0"
+		"SET_OBJECT_DYNAMIC\0"
+		"INCREMENT_FLOAT_STAT_NO_MESSAGE\0"
+		"IS_OBJECT_IN_AREA_2D\0"
+		"GET_PETROL_TANK_HEALTH\0"
+		"PRINT_BIG\0"
+		"SKIP_IN_PLAYBACK_RECORDED_CAR\0"
+		"SET_CHAR_WILL_DO_DRIVEBYS\0"
+		"HAS_SOUND_FINISHED\0"
+		"GET_OFFSETS_FOR_ATTACH_CAR_TO_CAR\0"
+		"GET_CLOSEST_CAR\0"
+		"SET_PED_INSTANT_BLENDS_WEAPON_ANIMS\0"
+		"TASK_SIT_DOWN_ON_SEAT\0"
+		"PRINT_WITH_5_NUMBERS\0"
+		"FORCE_NO_CAM_PAUSE\0"
+		"FINISH_WIDGET_COMBO\0"
+		"SET_PED_SKIPS_COMPLEX_COVER_COLLISION_CHECKS\0"
+		"DETACH_PED\0"
+		"NETWORK_SHOW_MET_PLAYER_FEEDBACK_UI\0"
+		"SMASH_CAR_WINDOW\0"
+		"RELEASE_PATH_NODES\0"
+		"TERMINATE_ALL_SCRIPTS_FOR_NETWORK_GAME\0"
+		"IS_GROUP_LEADER\0"
+		"SET_CAM_SPLINE_SPEED_CONSTANT\0"
+		"SHAKE_PAD_IN_CUTSCENE\0"
+		"GET_RANDOM_CAR_NODE_INCLUDE_SWITCHED_OFF_NODES\0"
+		"DRAW_SPRITE_WITH_UV_COORDS\0"
+		"GET_CAR_OBJECT_IS_ATTACHED_TO\0"
+		"DAMAGE_CAR\0"
+		"GET_VEHICLE_GEAR\0"
+		"LOAD_TEXT_FONT\0"
+		"SET_CHAR_DROPS_WEAPONS_WHEN_DEAD\0"
+		"GET_CAR_COORDINATES\0"
+		"CAM_IS_SPHERE_VISIBLE\0"
+		"SET_TEXT_EDGE\0"
+		"START_OBJECT_FIRE\0"
+		"TASK_SEEK_COVER_FROM_PED\0"
+		"SET_DANCE_SHAKE_INACTIVE_IMMEDIATELY\0"
+		"TASK_LOOK_AT_CHAR\0"
+		"SET_OBJECT_AS_STEALABLE\0"
+		"SET_HINT_ADVANCED_PARAMS\0"
+		"DISPLAY_AMMO\0"
+		"ANCHOR_BOAT\0"
+		"IS_CAR_UPSIDEDOWN\0"
+		"SET_OBJECT_ONLY_DAMAGED_BY_PLAYER\0"
+		"CLEAR_SCRIPTED_CONVERSION_CENTRE\0"
+		"GET_CHAR_ANIM_TOTAL_TIME\0"
+		"GET_CURRENT_DATE\0"
+		"SET_CHAR_CANT_BE_DRAGGED_OUT\0"
+		"IS_THIS_MACHINE_THE_SERVER\0"
+		"STOP_MOVIE\0"
+		"ACOS\0"
+		"IS_PLAYER_PERFORMING_STOPPIE\0"
+		"ADD_NEEDED_AT_POSN\0"
+		"COUNT_PICKUPS_OF_TYPE\0"
+		"SET_ROOM_FOR_CHAR_BY_NAME\0"
+		"SET_CAR_LIVERY\0"
+		"GET_COORDINATES_FOR_NETWORK_RESTART_NODE\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_NUM_PARKED_CARS\0"
+		"SET_BLIP_AS_SHORT_RANGE\0"
+		"TELEPORT_NETWORK_PLAYER\0"
+		"GET_CAM_NEAR_CLIP\0"
+		"SET_CHAR_MELEE_ACTION_FLAG1\0"
+		"NETWORK_GET_MAX_PRIVATE_SLOTS\0"
+		"UNLOCK_MISSION_NEWS_STORY\0"
+		"CREATE_CAR\0"
+		"PRINTFLOAT\0"
+		"HAS_PICKUP_BEEN_COLLECTED\0"
+		"GET_CLOSEST_CAR_NODE_FAVOUR_DIRECTION\0"
+		"UNLOCK_RAGDOLL\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_SIGHT_RANGE\0"
+		"PLAY_AUDIO_EVENT_FROM_VEHICLE\0"
+		"NETWORK_SET_TALKER_PROXIMITY\0"
+		"DONT_DISPLAY_LOADING_ON_FADE_THIS_FRAME\0"
+		"RESERVE_NETWORK_MISSION_OBJECTS_FOR_HOST\0"
+		"SMASH_GLASS_ON_OBJECT\0"
+		"RELEASE_SCRIPT_CONTROLLED_MICROPHONE\0"
+		"SET_HINT_FOV\0"
+		"WHAT_WILL_PLAYER_PICKUP\0"
+		"SAY_AMBIENT_SPEECH_WITH_VOICE\0"
+		"SET_NETWORK_ID_CAN_MIGRATE\0"
+		"CREATE_HTML_VIEWPORT\0"
+		"CHANGE_BLIP_ALPHA\0"
+		"CREATE_RANDOM_MALE_CHAR\0"
+		"REMOVE_PTFX_FROM_PED\0"
+		"SET_CHAR_WILL_USE_CARS_IN_COMBAT\0"
+		"GET_GFWL_IS_RETURNING_TO_SINGLE_PLAYER\0"
+		"FORCE_PED_TO_FLEE_WHILST_DRIVING_VEHICLE\0"
+		"CREATE_MOBILE_PHONE\0"
+		"GET_GROUP_MEMBER\0"
+		"GET_VEHICLE_ENGINE_REVS\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_LOW_HEALTH\0"
+		"GET_NTH_INTEGER_IN_STRING\0"
+		"REQUEST_INTERIOR_MODELS\0"
+		"GET_NUMBER_OF_FOLLOWERS\0"
+		"GET_TRAIN_PLAYER_WOULD_ENTER\0"
+		"GET_CURRENT_POPULATION_ZONE_TYPE\0"
+		"IS_CHAR_TOUCHING_VEHICLE\0"
+		"COPY_ANIMATIONS\0"
+		"NETWORK_CHECK_INVITE_ARRIVAL\0"
+		"FIRE_SINGLE_BULLET\0"
+		"DRAW_COLOURED_CYLINDER\0"
+		"IS_CHAR_SITTING_IN_CAR\0"
+		"HAS_CHAR_BEEN_DAMAGED_BY_CAR\0"
+		"GET_BLIP_SPRITE\0"
+		"TASK_PLAY_ANIM_WITH_ADVANCED_FLAGS\0"
+		"SET_FREE_HEALTH_CARE\0"
+		"SET_CHAR_CAN_BE_KNOCKED_OFF_BIKE\0"
+		"IS_PLAYER_CONTROL_ON\0"
+		"FAKE_DEATHARREST\0"
+		"DRAW_LIGHT_WITH_RANGE\0"
+		"NETWORK_STORE_GAME_CONFIG\0"
+		"IS_PLAYER_FREE_AIMING_AT_CHAR\0"
+		"GET_SCRIPT_DRAW_CAM\0"
+		"SET_CAR_WATERTIGHT\0"
+		"SET_CAR_ALLOWED_TO_DROWN\0"
+		"FORCE_WIND\0"
+		"CLEAR_CAR_LAST_WEAPON_DAMAGE\0"
+		"DISPLAY_TEXT_WITH_FLOAT\0"
+		"CHANGE_PICKUP_BLIP_PRIORITY\0"
+		"NETWORK_SET_TEAM_ONLY_CHAT\0"
+		"NETWORK_GET_NEXT_TEXT_CHAT\0"
+		"SET_RICH_PRESENCE_TEMPLATEMP5\0"
+		"BLOCK_PED_WEAPON_SWITCHING\0"
+		"HAS_OBJECT_FRAGMENT_ROOT_BEEN_DAMAGED\0"
+		"IS_REPLAY_SYSTEM_SAVING\0"
+		"TASK_TOGGLE_DUCK\0"
+		"OBFUSCATE_INT\0"
+		"DELETE_ALL_HTML_SCRIPT_OBJECTS\0"
+		"HAS_FRAGMENT_ROOT_OF_CLOSEST_OBJECT_OF_TYPE_BEEN_DAMAGED\0"
+		"CREATE_RANDOM_CHAR_AS_DRIVER\0"
+		"SET_CAMERA_AUTO_SCRIPT_ACTIVATION\0"
+		"SET_FOLLOW_PED_PITCH_LIMIT_DOWN\0"
+		"SET_PLAYER_CONTROL_ADVANCED\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_FIRE_RATE\0"
+		"GET_NEXT_CLOSEST_CAR_NODE_WITH_HEADING_ON_ISLAND\0"
+		"IS_HINT_RUNNING\0"
+		"IS_PAIN_PLAYING\0"
+		"SET_MOVIE_VOLUME\0"
+		"IS_CHAR_SHOOTING\0"
+		"SETTIMERA\0"
+		"TASK_FLEE_CHAR_ANY_MEANS\0"
+		"REGISTER_WORLD_POINT_SCRIPT_BRAIN\0"
+		"SET_CAR_IN_CUTSCENE\0"
+		"GET_CHAR_MOVE_ANIM_SPEED_MULTIPLIER\0"
+		"IS_CHAR_RESPONDING_TO_EVENT\0"
+		"TASK_PERFORM_SEQUENCE_LOCALLY\0"
+		"GET_CAR_UPRIGHT_VALUE\0"
+		"HAS_ACHIEVEMENT_BEEN_PASSED\0"
+		"GET_PLAYER_RADIO_MODE\0"
+		"GET_TEXT_INPUT_ACTIVE\0"
+		"DISABLE_GPS\0"
+		"SET_SWIM_SPEED\0"
+		"GET_TEXTURE_FROM_STREAMED_TXD\0"
+		"CELL_CAM_SET_CENTRE_POS\0"
+		"CAM_SET_INTERP_STATE_SRC\0"
+		"MUTE_POSITIONED_RADIO\0"
+		"FORCE_INITIAL_PLAYER_STATION\0"
+		"ADD_EXPLOSION\0"
+		"SET_MENU_ITEM_WITH_NUMBER\0"
+		"IS_BLIP_SHORT_RANGE\0"
+		"SAVE_SCRIPT_ARRAY_IN_SCRATCHPAD\0"
+		"GET_STRING_FROM_TEXT_FILE\0"
+		"NETWORK_GET_NUM_PLAYERS_MET\0"
+		"PROCESS_MISSION_DELETION_LIST\0"
+		"GENERATE_RANDOM_INT\0"
+		"CREATE_PLAYER\0"
+		"REQUEST_MISSION_AUDIO_BANK\0"
+		"DISPLAY_TEXT_WITH_2_NUMBERS\0"
+		"TASK_CHAR_SLIDE_TO_COORD_HDG_RATE\0"
+		"GET_STRING_WIDTH_WITH_NUMBER\0"
+		"LOCK_PLAYER_SETTINGS_GENRE_CHANGE\0"
+		"ALLOW_TARGET_WHEN_INJURED\0"
+		"MAKE_PLAYER_GANG_DISAPPEAR\0"
+		"NETWORK_GET_UNACCEPTED_INVITE_EPISODE\0"
+		"GET_CHAR_SWIM_STATE\0"
+		"TASK_PLAY_ANIM_SECONDARY_UPPER_BODY\0"
+		"SET_CHAR_COORDINATES_DONT_CLEAR_PLAYER_TASKS\0"
+		"SET_LOUD_VEHICLE_RADIO\0"
+		"SET_CHAR_MOVEMENT_ANIMS_BLOCKED\0"
+		"PROSTITUTE_CAM_ACTIVATE\0"
+		"GET_STAT_FRONTEND_DISPLAY_TYPE\0"
+		"REGISTER_FLOAT_STAT\0"
+		"IS_CAM_ACTIVE\0"
+		"CAM_RESTORE\0"
+		"SET_PLAYER_IS_IN_STADIUM\0"
+		"LISTEN_TO_PLAYER_GROUP_COMMANDS\0"
+		"SET_PED_PATH_MAY_USE_CLIMBOVERS\0"
+		"SNAPSHOT_CAM\0"
+		"CLEAR_ONSCREEN_TIMER\0"
+		"SWITCH_MAD_DRIVERS\0"
+		"DETACH_CAR\0"
+		"SET_BRIANS_MOOD\0"
+		"GET_IS_DISPLAYINGSAVEMESSAGE\0"
+		"ALLOW_THIS_SCRIPT_TO_BE_PAUSED\0"
+		"BEGIN_CAM_COMMANDS\0"
+		"SWITCH_OBJECT_BRAINS\0"
+		"SET_OBJECT_PROOFS\0"
+		"SET_SCRIPT_LIMIT_TO_GANG_SIZE\0"
+		"SET_UPSIDEDOWN_CAR_NOT_DAMAGED\0"
+		"GET_PLANE_UNDERCARRIAGE_POSITION\0"
+		"SET_CHAR_COORDINATES_DONT_WARP_GANG_NO_OFFSET\0"
+		"SET_GPS_VOICE_FOR_VEHICLE\0"
+		"TIMESTEP\0"
+		"LOAD_ALL_PATH_NODES\0"
+		"IS_CHAR_ON_FIRE\0"
+		"CHANGE_TERRITORY_BLIP_SCALE\0"
+		"EXTINGUISH_FIRE_AT_POINT\0"
+		"SET_ENABLE_NEAR_CLIP_SCAN\0"
+		"SET_RADAR_ZOOM\0"
+		"SET_CREDITS_TO_RENDER_BEFORE_FADE\0"
+		"NETWORK_JOIN_SUMMONS\0"
+		"SET_FOLLOW_PED_PITCH_LIMIT_UP\0"
+		"UNPAUSE_PLAYBACK_RECORDED_CAR\0"
+		"TASK_CAR_MISSION\0"
+		"ALLOW_LOCKON_TO_FRIENDLY_PLAYERS\0"
+		"ENABLE_SCENE_STREAMING\0"
+		"IS_PED_IN_GROUP\0"
+		"NETWORK_EXPAND_TO_32_PLAYERS\0"
+		"TASK_FOLLOW_NAV_MESH_AND_SLIDE_TO_COORD\0"
+		"DONT_REMOVE_CHAR\0"
+		"GET_ASPECT_RATIO\0"
+		"FIND_PRIMARY_POPULATION_ZONE_GROUP\0"
+		"IS_AUTO_AIMING_ON\0"
+		"GET_CUTSCENE_PED_POSITION\0"
+		"SET_OBJECT_ANIM_CURRENT_TIME\0"
+		"DISPLAY_TEXT_WITH_STRING_AND_INT\0"
+		"TASK_PERFORM_SEQUENCE\0"
+		"TASK_SHIMMY_CLIMB_UP\0"
+		"SEND_CLIENT_BROADCAST_VARIABLES_NOW\0"
+		"TASK_CAR_MISSION_COORS_TARGET\0"
+		"PRINT_HELP_FOREVER_WITH_STRING\0"
+		"CREATE_RANDOM_CAR_FOR_CAR_PARK\0"
+		"ADD_SPAWN_BLOCKING_AREA\0"
+		"GET_NTH_CLOSEST_WATER_NODE_WITH_HEADING\0"
+		"LOCATE_CAR_2D\0"
+		"USE_PREVIOUS_FONT_SETTINGS\0"
+		"GET_CLOSEST_CAR_NODE_WITH_HEADING\0"
+		"NETWORK_CLEAR_INVITE_ARRIVAL\0"
+		"START_MOBILE_PHONE_RINGING\0"
+		"SET_OBJECT_VISIBLE\0"
+		"GET_OFFSET_FROM_CAR_GIVEN_WORLD_COORDS\0"
+		"CREATE_RANDOM_CHAR\0"
+		"IS_PLAYBACK_GOING_ON_FOR_CAR\0"
+		"ATTACH_PED_TO_OBJECT\0"
+		"MP_GET_VARIATION_SETUP\0"
+		"SET_ACTIVATE_OBJECT_PHYSICS_AS_SOON_AS_IT_IS_UNFROZEN\0"
+		"SET_MOVIE_TIME\0"
+		"TRAIN_LEAVE_STATION\0"
+		"NETWORK_CHANGE_GAME_MODE_PENDING\0"
+		"SET_PLAYER_SETTINGS_GENRE\0"
+		"REMOVE_FAKE_NETWORK_NAME_FROM_PED\0"
+		"MARK_MISSION_TRAIN_AS_NO_LONGER_NEEDED\0"
+		"IS_CAR_IN_AIR_PROPER\0"
+		"IS_THIS_PED_A_PLAYER\0"
+		"RESTORE_SCRIPT_VALUES_FOR_NETWORK_GAME\0"
+		"IS_JAPANESE_VERSION\0"
+		"GENERATE_RANDOM_FLOAT\0"
+		"START_PTFX_ON_PED\0"
+		"MAKE_PLAYER_FIRE_PROOF\0"
+		"SET_THIS_MACHINE_RUNNING_SERVER_SCRIPT\0"
+		"SET_CHAR_BLEEDING\0"
+		"GET_TIME_OF_DAY\0"
+		"UPDATE_NETWORK_RELATIVE_SCORE\0"
+		"DISPLAY_ONSCREEN_TIMER_WITH_STRING\0"
+		"TASK_FOLLOW_NAV_MESH_AND_SLIDE_TO_COORD_HDG_RATE\0"
+		"IS_PLAYER_SCRIPT_CONTROL_ON\0"
+		"REPORT_DISPATCH\0"
+		"GET_STAT_FRONTEND_VISIBILITY\0"
+		"DISPLAY_LOADING_THIS_FRAME_WITH_SCRIPT_SPRITES\0"
+		"UNINHERIT_CAM_ROLL\0"
+		"DESTROY_MOBILE_PHONE\0"
+		"IS_MEMORY_CARD_IN_USE\0"
+		"GET_PED_CLIMB_STATE\0"
+		"SET_CAM_SPLINE_CUSTOM_SPEED_GRAPH\0"
+		"NETWORK_HOST_GAME_PENDING\0"
+		"SET_VARIABLE_ON_SOUND\0"
+		"REQUEST_ALL_SLODS_IN_WORLD\0"
+		"IS_NUMLOCK_ENABLED\0"
+		"IS_SCRIPT_FIRE_EXTINGUISHED\0"
+		"SET_CAR_CAN_BE_DAMAGED\0"
+		"SET_BIT\0"
+		"DOES_OBJECT_HAVE_PHYSICS\0"
+		"GET_PLAYER_HAS_TRACKS\0"
+		"M\0"
+		"NETWORK_SET_HEALTH_RETICULE_OPTION\0"
+		"SET_ALL_CAR_GENERATORS_BACK_TO_ACTIVE\0"
+		"TASK_CAR_MISSION_PED_TARGET\0"
+		"SET_DEBUG_TEXT_VISIBLE\0"
+		"SET_CAM_DOF_FOCUSPOINT\0"
+		"PRELOAD_STREAM\0"
+		"IS_MOUSE_BUTTON_PRESSED\0"
+		"DISPLAY_TEXT_WITH_TWO_SUBSTRINGS_GIVEN_HASH_KEYS\0"
+		"DRAW_CORONA\0"
+		"LOAD_SCENE\0"
+		"GET_CURRENT_DAY_OF_WEEK\0"
+		"RELEASE_WEATHER\0"
+		"NETWORK_SET_TEXT_CHAT_RECIPIENTS\0"
+		"DISABLE_PLAYER_SPRINT\0"
+		"TRIGGER_PTFX_ON_OBJ_BONE\0"
+		"SWITCH_ARROW_ABOVE_BLIPPED_PICKUPS\0"
+		"SET_STAT_FRONTEND_NEVER_VISIBLE\0"
+		"START_PTFX\0"
+		"GET_CHAR_TEXTURE_VARIATION\0"
+		"SET_MULTIPLAYER_HUD_TIME\0"
+		"SET_GANG_CAR\0"
+		"SET_CONVERTIBLE_ROOF\0"
+		"SET_CAR_NOT_DAMAGED_BY_RELATIONSHIP_GROUP\0"
+		"DOES_WIDGET_GROUP_EXIST\0"
+		"IS_CHAR_TOUCHING_OBJECT\0"
+		"GET_CHAR_PROP_INDEX\0"
+		"UNSET_CHAR_MELEE_MOVEMENT_CONSTAINT_BOX\0"
+		"CHANGE_BLIP_DISPLAY\0"
+		"WARP_CHAR_FROM_CAR_TO_CAR\0"
+		"CHANGE_BLIP_ROTATION\0"
+		"GET_TIME_SINCE_PLAYER_DROVE_AGAINST_TRAFFIC\0"
+		"HAS_DEATHARREST_EXECUTED\0"
+		"DRAW_RECT\0"
+		"ALLOW_ONE_TIME_ONLY_COMMANDS_TO_RUN\0"
+		"SETTIMERB\0"
+		"ADD_CAM_SPLINE_NODE\0"
+		"GET_VEHICLE_COMPONENT_INFO\0"
+		"GIVE_PED_HELMET_WITH_OPTS\0"
+		"SET_HELI_FORCE_ENGINE_ON\0"
+		"GET_CHAR_VELOCITY\0"
+		"GET_NUMBER_OF_INJURED_PEDS_IN_RANGE\0"
+		"SET_PLAYER_DISABLE_CROUCH\0"
+		"SET_PED_HEEDS_THE_EVERYONE_IGNORE_PLAYER_FLAG\0"
+		"GET_DEAD_CAR_COORDINATES\0"
+		"ADD_STUCK_CAR_CHECK_WITH_WARP\0"
+		"GET_FIRST_BLIP_INFO_ID\0"
+		"PRINT_WITH_NUMBER_NOW\0"
+		"GET_CAR_FORWARD_Y\0"
+		"TASK_CAR_MISSION_NOT_AGAINST_TRAFFIC\0"
+		"SET_PED_WONT_ATTACK_PLAYER_WITHOUT_WANTED_LEVEL\0"
+		"IS_PLAYER_CLIMBING\0"
+		"CLEAR_GROUP_DECISION_MAKER_EVENT_RESPONSE\0"
+		"SET_PED_DIES_WHEN_INJURED\0"
+		"CLEAR_CHAR_TASKS_IMMEDIATELY\0"
+		"IS_GAME_KEYBOARD_NAV_RIGHT_PRESSED\0"
+		"GET_NUMBER_OF_CHAR_DRAWABLE_VARIATIONS\0"
+		"REGISTER_STRING_FOR_FRONTEND_STAT\0"
+		"SET_CHAR_ANIM_SPEED\0"
+		"LOCATE_CHAR_ON_FOOT_CAR_3D\0"
+		"ACTIVATE_FRONTEND\0"
+		"SET_CAMERA_CONTROLS_DISABLED_WITH_PLAYER_CONTROLS\0"
+		"GET_CHAR_ARMOUR\0"
+		"POP_CAR_BOOT\0"
+		"TRIGGER_PTFX_ON_VEH\0"
+		"CAM_SET_INTERP_GRAPH_POS\0"
+		"GET_OBJECT_TURN_MASS\0"
+		"SET_TIMECYCLE_MODIFIER\0"
+		"IS_SCRIPTED_CONVERSATION_ONGOING\0"
+		"NETWORK_DID_INVITE_FRIEND\0"
+		"TASK_CAR_MISSION_COORS_TARGET_NOT_AGAINST_TRAFFIC\0"
+		"DESTROY_PED_GENERATION_CONSTRAINT_AREA\0"
+		"GET_IS_DEPOSIT_ANIM_RUNNING\0"
+		"GET_LOCAL_PLAYER_WEAPON_STAT\0"
+		"PLAY_MOVIE\0"
+		"GET_PHYSICAL_SCREEN_RESOLUTION\0"
+		"SET_GRAVITY_OFF\0"
+		"EVOLVE_PTFX\0"
+		"TASK_SMART_FLEE_POINT_PREFERRING_PAVEMENTS\0"
+		"SET_FAKE_WANTED_CIRCLE\0"
+		"SET_CAR_FOV_START_SPEED\0"
+		"LOCATE_CHAR_ON_FOOT_3D\0"
+		"HAS_CAR_BEEN_RESPRAYED\0"
+		"ADD_TO_PREVIOUS_BRIEF_WITH_UNDERSCORE\0"
+		"DOES_PLAYER_HAVE_CONTROL_OF_NETWORK_ID\0"
+		"DRAW_WINDOW_TEXT\0"
+		"DOES_GROUP_EXIST\0"
+		"POINT_FIXED_CAM_AT_PED\0"
+		"FIX_CAR\0"
+		"START_CAR_FIRE\0"
+		"GET_NEXT_CLOSEST_CAR_NODE_WITH_HEADING\0"
+		"SET_RAILTRACK_RESISTANCE_MULT\0"
+		"SET_BLIP_COORDINATES\0"
+		"DISABLE_INTERMEZZO_CAMS\0"
+		"REMOVE_CHAR_FROM_CAR_MAINTAIN_POSITION\0"
+		"SET_PED_NON_CREATION_AREA\0"
+		"SET_ROOM_FOR_VIEWPORT_BY_NAME\0"
+		"SET_PED_GENERATES_DEAD_BODY_EVENTS\0"
+		"GET_MINUTES_OF_DAY\0"
+		"UNLOAD_TEXT_FONT\0"
+		"TASK_DEAD\0"
+		"GET_CHAR_SPEED\0"
+		"IS_PED_RAGDOLL\0"
+		"LOCATE_CHAR_ANY_MEANS_CHAR_3D\0"
+		"UNFREEZE_RADIO_STATION\0"
+		"CHANGE_PICKUP_BLIP_DISPLAY\0"
+		"TASK_GUARD_CURRENT_POSITION\0"
+		"MODIFY_CHAR_MOVE_BLEND_RATIO\0"
+		"SET_PLAYER_TEAM\0"
+		"GET_LEVEL_DESIGN_COORDS_FOR_OBJECT\0"
+		"ADD_BLIP_FOR_COORD\0"
+		"WAS_PED_SKELETON_UPDATED\0"
+		"HAS_POOL_OBJECT_COLLIDED_WITH_CUSHION\0"
+		"RESERVE_NETWORK_MISSION_VEHICLES_FOR_HOST\0"
+		"ENABLE_SCRIPT_CONTROLLED_MICROPHONE\0"
+		"TASK_GOTO_CAR\0"
+		"SET_ALL_CARS_CAN_BE_DAMAGED\0"
+		"ACTIVATE_SCRIPTED_CAMS\0"
+		"ADD_TO_HTML_SCRIPT_OBJECT\0"
+		"SET_MINIGAME_IN_PROGRESS\0"
+		"OBFUSCATE_INT_ARRAY\0"
+		"BLOCK_CHAR_HEAD_IK\0"
+		"ATTACH_PED_TO_CAR\0"
+		"SET_DRAW_PLAYER_COMPONENT\0"
+		"SET_SCENARIO_PED_DENSITY_MULTIPLIER\0"
+		"NETWORK_CHANGE_GAME_MODE\0"
+		"SET_ALWAYS_DISPLAY_WEAPON_PICKUP_MESSAGE\0"
+		"SET_MISSION_PICKUP_SOUND\0"
+		"NETWORK_STRING_VERIFY_SUCCEEDED\0"
+		"CLEAR_SHAKE_PLAYERPAD_WHEN_CONTROLLER_DISABLED\0"
+		"CLEAR_ONSCREEN_COUNTER\0"
+		"SET_NM_MESSAGE_STRING\0"
+		"IS_CHAR_IN_AREA_ON_FOOT_2D\0"
+		"SET_ENGINE_HEALTH\0"
+		"SET_TRAIN_SPEED\0"
+		"SET_START_FROM_FILTER_MENU\0"
+		"PRINT_STRING_WITH_LITERAL_STRING\0"
+		"SET_TEXT_VIEWPORT_ID\0"
+		"READ_KILL_FRENZY_STATUS\0"
+		"SET_MISSION_RESPECT_TOTAL\0"
+		"SET_CAN_TARGET_CHAR_WITHOUT_LOS\0"
+		"REMOVE_PTFX_FROM_VEHICLE\0"
+		"TASK_DRIVE_BY\0"
+		"GET_TRAIN_CABOOSE\0"
+		"SUPPRESS_FADE_IN_AFTER_DEATH_ARREST\0"
+		"SET_CAR_FOV_MAX\0"
+		"CLEAR_RELATIONSHIP\0"
+		"GET_CURRENT_WEATHER_FULL\0"
+		"GET_CHAR_READY_TO_BE_EXECUTED\0"
+		"SET_IN_SPECTATOR_MODE\0"
+		"IS_FOLLOW_VEHICLE_CAM_OFFSET_ACTIVE\0"
+		"PRINTNL\0"
+		"GET_DISPLAY_NAME_FROM_VEHICLE_MODEL\0"
+		"VMAG\0"
+		"CLEAR_ROOM_FOR_CHAR\0"
+		"GET_TIME_SINCE_PLAYER_HIT_PED\0"
+		"GET_CLOSEST_MAJOR_CAR_NODE\0"
+		"NETWORK_PLAYER_HAS_HEADSET\0"
+		"INCREASE_PLAYER_MAX_HEALTH\0"
+		"SET_NEEDS_TO_BE_HOTWIRED\0"
+		"HAS_CAR_STOPPED_BECAUSE_OF_LIGHT\0"
+		"ADD_GROUP_DECISION_MAKER_EVENT_RESPONSE\0"
+		"SET_WEAPON_PICKUP_NETWORK_REGEN_TIME\0"
+		"SET_SCRIPTED_CONVERSION_CENTRE\0"
+		"SET_CAR_FOV_START_SPEED_BOAT\0"
+		"SET_CHAR_WALK_ALONGSIDE_LEADER_WHEN_APPROPRIATE\0"
+		"CLOSE_DEBUG_FILE\0"
+		"CLEAR_TEXT_LABEL\0"
+		"GET_MOUSE_SENSITIVITY\0"
+		"ENABLE_SHADOWS\0"
+		"ADD_LINE_TO_SCRIPTED_CONVERSATION\0"
+		"TASK_USE_MOBILE_PHONE\0"
+		"SET_NO_RESPRAYS\0"
+		"GET_PLAYER_GROUP\0"
+		"TASK_EVERYONE_LEAVE_CAR\0"
+		"SET_OBJECT_INITIAL_VELOCITY\0"
+		"CREATE_CHECKPOINT\0"
+		"PLAYSTATS_INT\0"
+		"FORCE_POPULATION_INIT\0"
+		"SET_RICH_PRESENCE_TEMPLATEPARTY\0"
+		"START_GPS_RACE_TRACK\0"
+		"ADD_STUNT_JUMP\0"
+		"SET_CAM_IN_FRONT_OF_PED\0"
+		"ADD_POLICE_RESTART\0"
+		"SET_SNIPER_ZOOM_FACTOR\0"
+		"SET_AMBIENT_VOICE_NAME\0"
+		"IS_CHAR_SHOOTING_IN_AREA\0"
+		"GET_FIRST_N_CHARACTERS_OF_LITERAL_STRING\0"
+		"DO_SCREEN_FADE_OUT_UNHACKED\0"
+		"CLEAR_CHAR_RELATIONSHIP\0"
+		"CAN_REGISTER_MISSION_OBJECT\0"
+		"GET_TEAM_RGB_COLOUR\0"
+		"UPDATE_PTFX_TINT\0"
+		"REMOVE_SCRIPT_MIC\0"
+		"IS_MONEY_PICKUP_AT_COORDS\0"
+		"PRINT_WITH_2_NUMBERS_BIG\0"
+		"GET_SOUND_LEVEL_AT_COORDS\0"
+		"GET_MODEL_NAME_FOR_DEBUG\0"
+		"GET_STRING_FROM_STRING\0"
+		"APPLY_FORCE_TO_CAR\0"
+		"GET_PED_BONE_POSITION\0"
+		"IS_CHAR_IN_ZONE\0"
+		"SET_VEHICLE_QUATERNION\0"
+		"REMOVE_COVER_POINT\0"
+		"SET_CLEAR_HELP_IN_MISSION_CLEANUP\0"
+		"SET_CHAR_AMMO\0"
+		"PLAYSTATS_MISSION_PASSED\0"
+		"APPLY_FORCE_TO_OBJECT\0"
+		"SET_CAM_INTERP_DETAIL_ROT_STYLE_QUATS\0"
+		"SET_PHONE_HUD_ITEM\0"
+		"RESTART_SCRIPTED_CONVERSATION\0"
+		"GET_TIME_SINCE_PLAYER_HIT_OBJECT\0"
+		"IS_THIS_MODEL_A_BOAT\0"
+		"REGISTER_MULTIPLAYER_GAME_WIN\0"
+		"SET_CAM_ACTIVE\0"
+		"SET_VIEWPORT_SHAPE\0"
+		"SET_SUPPRESS_HEADLIGHT_SWITCH\0"
+		"TASK_WANDER_STANDARD\0"
+		"PRINT_HELP_FOREVER\0"
+		"BEGIN_CHAR_SEARCH_CRITERIA\0"
+		"SET_CHAR_ONLY_DAMAGED_BY_PLAYER\0"
+		"IS_CHAR_IN_ANY_POLICE_VEHICLE\0"
+		"SET_CHAR_WEAPON_SKILL\0"
+		"CREATE_CHAR_AS_PASSENGER\0"
+		"TASK_AIM_GUN_AT_CHAR\0"
+		"SET_CAM_PROPAGATE\0"
+		"SET_REDUCE_PED_MODEL_BUDGET\0"
+		"SET_CHAR_WILL_ONLY_FIRE_WITH_CLEAR_LOS\0"
+		"LOAD_PATH_NODES_IN_AREA\0"
+		"MUTE_GAMEWORLD_AUDIO\0"
+		"ADD_TO_PREVIOUS_BRIEF\0"
+		"CELL_CAM_ACTIVATE\0"
+		"POINT_CAM_AT_CAM\0"
+		"PRINT_HELP_WITH_NUMBER\0"
+		"GET_MOUSE_INPUT\0"
+		"BLOCK_CHAR_VISEME_ANIMS\0"
+		"NETWORK_AM_I_MUTED_BY_PLAYER\0"
+		"SET_HINT_MOVE_IN_DIST_DEFAULT\0"
+		"POINT_CAM_AT_COORD\0"
+		"SET_CAM_ATTACH_OFFSET_IS_RELATIVE\0"
+		"GET_OFFSET_FROM_OBJECT_IN_WORLD_COORDS\0"
+		"IS_CHAR_IN_AREA_3D\0"
+		"NETWORK_STRING_VERIFY_PENDING\0"
+		"GIVE_PED_AMBIENT_OBJECT\0"
+		"ADD_SIMPLE_BLIP_FOR_PICKUP\0"
+		"GET_PLAYER_WANTED_LEVEL_INCREMENT\0"
+		"REMOVE_TXD\0"
+		"CHANGE_BLIP_SCALE\0"
+		"SET_SENSE_RANGE\0"
+		"DRAW_FRONTEND_HELPER_TEXT\0"
+		"GET_DOOR_ANGLE_RATIO\0"
+		"CREATE_TEMPORARY_RADAR_BLIPS_FOR_PICKUPS_IN_AREA\0"
+		"GET_START_FROM_FILTER_MENU\0"
+		"GET_OBJECT_PED_IS_HOLDING\0"
+		"HAS_CAR_RECORDING_BEEN_LOADED\0"
+		"UPDATE_PTFX_OFFSETS\0"
+		"FIX_SCRIPT_MIC_TO_CURRENT_POSISITION\0"
+		"FORWARD_TO_TIME_OF_DAY\0"
+		"MAKE_PLAYER_SAFE_FOR_CUTSCENE\0"
+		"SET_CHAR_DRUGGED_UP\0"
+		"IS_THIS_PRINT_BEING_DISPLAYED\0"
+		"GET_PED_PATH_MAY_DROP_FROM_HEIGHT\0"
+		"CLEAR_PLAYER_HAS_DAMAGED_AT_LEAST_ONE_PED\0"
+		"IS_RADIO_RETUNING\0"
+		"SET_BLOCK_CAMERA_TOGGLE\0"
+		"SET_INTERP_FROM_GAME_TO_SCRIPT\0"
+		"SET_STAT_FRONTEND_VISIBILITY\0"
+		"SET_OBJECT_LIGHTS\0"
+		"IS_CHAR_IN_MODEL\0"
+		"FORCE_INTERIOR_LIGHTING_FOR_PLAYER\0"
+		"TASK_FOLLOW_FOOTSTEPS\0"
+		"IS_GAME_KEYBOARD_NAV_DOWN_PRESSED\0"
+		"ADD_CAR_TO_MISSION_DELETION_LIST\0"
+		"GET_GROUP_SIZE\0"
+		"IS_RADIO_HUD_ON\0"
+		"SET_CHAR_MAX_TIME_IN_WATER\0"
+		"SET_GAME_CAM_HEADING\0"
+		"SET_TAXI_LIGHTS\0"
+		"IS_VEH_STUCK\0"
+		"SET_MOBILE_PHONE_POSITION\0"
+		"DOES_CHAR_EXIST\0"
+		"HAS_RESPRAY_HAPPENED\0"
+		"TELL_NET_PLAYER_TO_START_PLAYING\0"
+		"GET_CHAR_EXTRACTED_DISPLACEMENT\0"
+		"VDIST\0"
+		"TASK_CLIMB\0"
+		"GET_CAR_HEADING\0"
+		"IS_CAR_STUCK_ON_ROOF\0"
+		"SET_PLAYER_PLAYER_TARGETTING\0"
+		"DOES_CAM_EXIST\0"
+		"SET_CHAR_HEADING\0"
+		"SET_OBJECT_HEALTH\0"
+		"SPOT_CHECK7\0"
+		"GET_CLOSEST_NETWORK_RESTART_NODE\0"
+		"CREATE_RANDOM_CHAR_AS_PASSENGER\0"
+		"GET_STATION_NAME\0"
+		"IS_PEDS_VEHICLE_HOT\0"
+		"REMOVE_DECISION_MAKER\0"
+		"SET_CAR_CAN_BE_VISIBLY_DAMAGED\0"
+		"IS_OBJECT_WITHIN_BRAIN_ACTIVATION_RANGE\0"
+		"COPY_GROUP_CHAR_DECISION_MAKER\0"
+		"DESTROY_THREAD\0"
+		"SET_TRAIN_FORCED_TO_SLOW_DOWN\0"
+		"GET_TIME_SINCE_LAST_ARREST\0"
+		"TASK_USE_NEAREST_SCENARIO_TO_POS_WARP\0"
+		"HIGH_FALL_SCREAM\0"
+		"GET_CAR_FORWARD_X\0"
+		"IS_EXPLOSION_IN_SPHERE\0"
+		"SET_CAM_SPLINE_SPEED_GRAPH\0"
+		"PLAY_SOUND\0"
+		"SET_CHAR_RANDOM_COMPONENT_VARIATION\0"
+		"SET_CELLPHONE_RANKED\0"
+		"INIT_CUTSCENE\0"
+		"STOP_END_CREDITS_MUSIC\0"
+		"STOP_SYNCING_SCRIPT_ANIMATIONS\0"
+		"SET_FILTER_SAVE_SETTING\0"
+		"SET_SIREN_WITH_NO_DRIVER\0"
+		"NETWORK_HOST_RENDEZVOUS_E1\0"
+		"COUNT_SCRIPT_CAMS\0"
+		"CHANGE_PLAYER_PHONE_MODEL_OFFSETS\0"
+		"DOES_SCENARIO_EXIST_IN_AREA\0"
+		"TASK_PLAY_ANIM_SECONDARY_IN_CAR\0"
+		"HAS_ADDITIONAL_TEXT_LOADED\0"
+		"GET_NEXT_STATION_FOR_TRAIN\0"
+		"TASK_CAR_DRIVE_TO_COORD_NOT_AGAINST_TRAFFIC\0"
+		"CLONE_CAM\0"
+		"REMOVE_CAR_RECORDING\0"
+		"SET_NM_MESSAGE_INSTANCE_INDEX\0"
+		"THIS_SCRIPT_SHOULD_BE_SAVED\0"
+		"IS_PED_LOOKING_AT_CAR\0"
+		"PLAY_AUDIO_EVENT\0"
+		"NETWORK_HAVE_SUMMONS\0"
+		"SET_CAM_BEHIND_PED\0"
+		"GET_STRING_WIDTH_WITH_STRING\0"
+		"GET_INT_STAT\0"
+		"NETWORK_END_SESSION_PENDING\0"
+		"PED_QUEUE_CONSIDER_PEDS_WITH_FLAG_TRUE\0"
+		"NETWORK_GET_LAN_SESSION\0"
+		"GET_NTH_GROUP_MEMBER\0"
+		"RETUNE_RADIO_TO_STATION_INDEX\0"
+		"IS_PLAYER_VEHICLE_ENTRY_DISABLED\0"
+		"SET_NM_MESSAGE_INT\0"
+		"FLOOR\0"
+		"TIMESTEPUNWARPED\0"
+		"GET_OBJECT_ROTATION_VELOCITY\0"
+		"MARK_OBJECT_AS_NO_LONGER_NEEDED\0"
+		"POINT_CAM_AT_PED\0"
+		"CANCEL_CURRENTLY_PLAYING_AMBIENT_SPEECH\0"
+		"IS_CHAR_DUCKING\0"
+		"GET_ASCII_PRESSED\0"
+		"FIND_STREET_NAME_AT_POSITION\0"
+		"NETWORK_LEAVE_GAME_PENDING\0"
+		"PRINT_WITH_NUMBER_BIG\0"
+		"TASK_GO_STRAIGHT_TO_COORD_RELATIVE_TO_CAR\0"
+		"SET_DRIVE_TASK_CRUISE_SPEED\0"
+		"SETTIMERC\0"
+		"REGISTER_CLIENT_BROADCAST_VARIABLES\0"
+		"TASK_SET_COMBAT_DECISION_MAKER\0"
+		"IS_STRING_NULL\0"
+		"SET_CAR_HEALTH\0"
+		"GET_OBJECT_COORDINATES\0"
+		"SET_VEH_INTERIORLIGHT\0"
+		"IS_CAR_PLAYING_ANIM\0"
+		"SET_DEATH_WEAPONS_PERSIST\0"
+		"SHUTDOWN_AND_LAUNCH_SINGLE_PLAYER_GAME\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_PERCENTAGE_COPS\0"
+		"IS_CAR_STOPPED\0"
+		"GET_NETWORK_JOIN_FAIL\0"
+		"SET_USE_HIGHDOF\0"
+		"TASK_LOOK_AT_VEHICLE\0"
+		"ADD_WIDGET_READ_ONLY\0"
+		"CREATE_EMERGENCY_SERVICES_CAR_THEN_WALK\0"
+		"SET_VEHICLE_ALWAYS_RENDER\0"
+		"CLEAR_THIS_BIG_PRINT\0"
+		"CREATE_CHAR\0"
+		"IS_CHAR_FATALLY_INJURED\0"
+		"GET_RADAR_VIEWPORT_ID\0"
+		"EXPLODE_CHAR_HEAD\0"
+		"NETWORK_IS_SESSION_INVITABLE\0"
+		"LOCATE_CHAR_ON_FOOT_OBJECT_3D\0"
+		"ADD_WIDGET_SLIDER\0"
+		"IS_CHAR_GETTING_UP\0"
+		"SET_LOAD_COLLISION_FOR_CHAR_FLAG\0"
+		"PLAY_STREAM_FROM_OBJECT\0"
+		"CLEAR_CHAR_TASKS\0"
+		"SET_PLAYER_CAN_USE_COVER\0"
+		"GET_OBJECT_HEALTH\0"
+		"GET_NUMBER_OF_STICKY_BOMBS_STUCK_TO_OBJECT\0"
+		"DEACTIVATE_NETWORK_SETTINGS_MENU\0"
+		"REGISTER_NETWORK_BEST_GAME_SCORES\0"
+		"SET_CAM_SPLINE_DURATION\0"
+		"IS_MOBILE_PHONE_RADIO_ACTIVE\0"
+		"REMOVE_PTFX\0"
+		"GET_KEYBOARD_MOVE_INPUT\0"
+		"DEBUG_ON\0"
+		"CHANGE_BLIP_TEAM_RELEVANCE\0"
+		"SET_AMBIENT_PLANES_SPEED_MULTIPLIER\0"
+		"SET_PLAYER_DISABLE_JUMP\0"
+		"NETWORK_IS_FRIEND_IN_SAME_TITLE\0"
+		"PLAY_FIRE_SOUND_FROM_POSITION\0"
+		"GET_STREAM_PLAYTIME\0"
+		"DRAW_CURVED_WINDOW\0"
+		"GET_CHAR_HEALTH\0"
+		"SET_EXTRA_HOSPITAL_RESTART_POINT\0"
+		"GET_CURRENT_ZONE_SCUMMINESS\0"
+		"DISPLAY_TEXT_WITH_TWO_LITERAL_STRINGS\0"
+		"FREEZE_ONSCREEN_TIMER\0"
+		"NETWORK_HAVE_ONLINE_PRIVILEGES\0"
+		"IS_VEHICLE_EXTRA_TURNED_ON\0"
+		"IS_CHAR_IN_ANY_PLANE\0"
+		"TRIGGER_MISSION_COMPLETE_AUDIO\0"
+		"PLAY_AUDIO_EVENT_FROM_OBJECT\0"
+		"DRAW_SPRITE_PHOTO\0"
+		"LOAD_ALL_OBJECTS_NOW\0"
+		"IS_RELATIONSHIP_SET\0"
+		"ADD_SCENARIO_BLOCKING_AREA\0"
+		"GET_BLIP_COORDS\0"
+		"MARK_ROAD_NODE_AS_DONT_WANDER\0"
+		"GET_PLAYER_TEAM\0"
+		"SWITCH_ROADS_OFF\0"
+		"SET_CAM_ROLL\0"
+		"SUPPRESS_PED_MODEL\0"
+		"GET_FOLLOW_VEHICLE_CAM_SUBMODE\0"
+		"GET_CHAR_ALLOWED_TO_RUN_ON_BOATS\0"
+		"ADD_WIDGET_FLOAT_READ_ONLY\0"
+		"SET_GPS_REMAINS_WHEN_TARGET_REACHED_FLAG\0"
+		"ADD_BLIP_FOR_WEAPON\0"
+		"LIMIT_ANGLE\0"
+		"IS_CONTROL_JUST_PRESSED\0"
+		"HELI_AUDIO_SHOULD_SKIP_STARTUP\0"
+		"SET_HINT_TIMES\0"
+		"SET_ANIM_GROUP_FOR_CHAR\0"
+		"NETWORK_CHANGE_EXTENDED_GAME_CONFIG\0"
+		"IS_STREAMING_THIS_ADDITIONAL_TEXT\0"
+		"IS_THIS_HELP_MESSAGE_WITH_STRING_BEING_DISPLAYED\0"
+		"CONVERT_METRES_TO_FEET\0"
+		"IS_OBJECT_PLAYING_ANIM\0"
+		"SET_MENU_COLUMN\0"
+		"LOCATE_CHAR_IN_CAR_CAR_3D\0"
+		"GET_CAR_HEALTH\0"
+		"IS_VEHICLE_ON_ALL_WHEELS\0"
+		"PRINT_WITH_4_NUMBERS\0"
+		"CLEAR_CAR_LAST_DAMAGE_ENTITY\0"
+		"HAS_CLOSEST_OBJECT_OF_TYPE_BEEN_DAMAGED_BY_CAR\0"
+		"REMOVE_PTFX_FROM_OBJECT\0"
+		"ACTIVATE_VIEWPORT\0"
+		"REGISTER_TRACK_NUMBER\0"
+		"DISPLAY_NTH_ONSCREEN_COUNTER_WITH_STRING\0"
+		"LOCATE_CHAR_ON_FOOT_CHAR_3D\0"
+		"PRINT_STRING_IN_STRING\0"
+		"PLAY_SOUND_FRONTEND\0"
+		"TASK_SEEK_COVER_TO_OBJECT\0"
+		"SET_SCRIPT_MIC_LOOK_AT\0"
+		"IS_HUD_RETICULE_COMPLEX\0"
+		"GET_VIEWPORT_POS_AND_SIZE\0"
+		"CREATE_OBJECT\0"
+		"FLASH_BLIP\0"
+		"START_NEW_SCRIPT\0"
+		"IS_NETWORK_PLAYER_ACTIVE\0"
+		"IS_DEBUG_CAMERA_ON\0"
+		"SET_NETWORK_ID_EXISTS_ON_ALL_MACHINES\0"
+		"NETWORK_GET_NUM_OPEN_PUBLIC_SLOTS\0"
+		"STOP_PED_DOING_FALL_OFF_TESTS_WHEN_SHOT\0"
+		"GET_PLAYER_RADIO_STATION_INDEX\0"
+		"SET_MSG_FOR_LOADING_SCREEN\0"
+		"HOW_LONG_HAS_NETWORK_PLAYER_BEEN_DEAD_FOR\0"
+		"HAS_MODEL_LOADED\0"
+		"SWITCH_AMBIENT_PLANES\0"
+		"SET_HELI_STABILISER\0"
+		"FORCE_LOADING_SCREEN\0"
+		"CELL_CAM_SET_COLOUR_BRIGHTNESS\0"
+		"IS_CHAR_INJURED\0"
+		"HAS_CUTSCENE_FINISHED\0"
+		"SET_CAMERA_STATE\0"
+		"TURN_OFF_RADIOHUD_IN_LOBBY\0"
+		"GET_NAVMESH_ROUTE_RESULT\0"
+		"ADD_TO_WIDGET_COMBO\0"
+		"STOP_CREDITS\0"
+		"GET_SCRIPT_FIRE_COORDS\0"
+		"SET_PLAYER_GROUP_TO_FOLLOW_NEVER\0"
+		"SET_PED_PATH_MAY_DROP_FROM_HEIGHT\0"
+		"SET_OBJECT_HEADING\0"
+		"CHANGE_PICKUP_BLIP_SCALE\0"
+		"SET_USE_LEG_IK\0"
+		"GET_POSITION_OF_ANALOGUE_STICKS\0"
+		"SET_PLAYER_CAN_DROP_WEAPONS_IN_CAR\0"
+		"PANIC_SCREAM\0"
+		"GET_CREATE_RANDOM_COPS\0"
+		"NETWORK_AM_I_BLOCKED_BY_PLAYER\0"
+		"SET_HELP_MESSAGE_BOX_SIZE\0"
+		"SET_CHAR_DEFAULT_COMPONENT_VARIATION\0"
+		"LOCATE_CHAR_ANY_MEANS_OBJECT_2D\0"
+		"NETWORK_ACCEPT_INVITE\0"
+		"ARE_WIDESCREEN_BORDERS_ACTIVE\0"
+		"SET_GLOBAL_RENDER_FLAGS\0"
+		"GET_WEAPONTYPE_MODEL\0"
+		"SET_MISSION_FLAG\0"
+		"IS_GAME_IN_CONTROL_OF_MUSIC\0"
+		"REQUEST_MODEL\0"
+		"TRIGGER_PTFX_ON_OBJ\0"
+		"SET_NM_ANIM_POSE\0"
+		"GET_PED_PATH_MAY_USE_LADDERS\0"
+		"GET_NETWORK_ID_FROM_OBJECT\0"
+		"IS_OUR_PLAYER_HIGHER_PRIORITY_FOR_CAR_GENERATION\0"
+		"EXPLODE_CAR\0"
+		"IS_THIS_HELP_MESSAGE_BEING_DISPLAYED\0"
+		"RENDER_RACE_TRACK\0"
+		"SET_CHAR_ONLY_DAMAGED_BY_RELATIONSHIP_GROUP\0"
+		"HAS_OBJECT_BEEN_DAMAGED_BY_CAR\0"
+		"OPEN_GARAGE\0"
+		"GET_FILTER_MENU_ON\0"
+		"SET_INFORM_RESPECTED_FRIENDS\0"
+		"LIMIT_TWO_PLAYER_DISTANCE\0"
+		"PLAYSTATS_MISSION_FAILED\0"
+		"DISPLAY_ALTIMETER_THIS_FRAME\0"
+		"NETWORK_IS_GAME_RANKED\0"
+		"GET_CAM_NEAR_DOF\0"
+		"IS_SNIPER_INVERTED\0"
+		"SET_CAM_TARGET_PED\0"
+		"DISABLE_PLAYER_AUTO_VEHICLE_EXIT\0"
+		"LOCATE_CHAR_ON_FOOT_2D\0"
+		"STOP_CUTSCENE\0"
+		"SET_SYNC_WEATHER_AND_GAME_TIME\0"
+		"PLAYSTATS_INT_FLOAT\0"
+		"GET_PLAYER_CHAR\0"
+		"IS_EPISODIC_DISC_BUILD\0"
+		"SET_FIXED_CAM_POS\0"
+		"UPDATE_LOAD_SCENE\0"
+		"IS_CHAR_WAITING_FOR_WORLD_COLLISION\0"
+		"TASK_TURN_CHAR_TO_FACE_COORD\0"
+		"CLEAR_CHAR_PROP\0"
+		"TASK_SIT_DOWN_ON_OBJECT\0"
+		"TOGGLE_TOPLEVEL_SPRITE\0"
+		"GET_MOBILE_PHONE_TASK_SUB_TASK\0"
+		"IS_SCORE_GREATER\0"
+		"GET_MOUSE_WHEEL\0"
+		"GET_SERVER_ID\0"
+		"GET_CAM_ROT\0"
+		"SET_CAM_INHERIT_ROLL_VEHICLE\0"
+		"SET_CHAR_DEFENSIVE_AREA_ATTACHED_TO_PED\0"
+		"NETWORK_IS_FIND_RESULT_VALID\0"
+		"SET_WANTED_MULTIPLIER\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_CAN_CHANGE_TARGET\0"
+		"HAS_OVERRIDEN_SIT_IDLE_ANIM_FINISHED\0"
+		"SET_TIME_OF_DAY\0"
+		"PRINT_HELP_WITH_STRING\0"
+		"SET_FLOAT_STAT\0"
+		"FORCE_RANDOM_CAR_MODEL\0"
+		"TASK_PLAY_ANIM_NON_INTERRUPTABLE\0"
+		"SPOT_CHECK6\0"
+		"RESTORE_SCRIPT_ARRAY_FROM_SCRATCHPAD\0"
+		"NETWORK_IS_BEING_KICKED\0"
+		"SET_SPRITE_HDR_MULTIPLIER\0"
+		"CAM_PROCESS\0"
+		"TASK_STAND_STILL\0"
+		"NETWORK_GET_MAX_SLOTS\0"
+		"DISPLAY_HUD\0"
+		"SET_COMBAT_DECISION_MAKER\0"
+		"IS_PLAYER_IN_REMOTE_MODE\0"
+		"GET_RANDOM_CAR_IN_SPHERE\0"
+		"SET_MOBILE_PHONE_RADIO_STATE\0"
+		"SET_CAM_COMPONENT_SHAKE\0"
+		"SET_TEXT_TO_USE_TEXT_FILE_COLOURS\0"
+		"SET_PED_NON_REMOVAL_AREA\0"
+		"SET_CHAR_ANIM_PLAYING_FLAG\0"
+		"GET_PLAYER_MAX_HEALTH\0"
+		"SET_CAM_FAR_DOF\0"
+		"LOAD_TXD\0"
+		"SET_OBJECT_COORDINATES\0"
+		"POINT_FIXED_CAM_AT_VEHICLE\0"
+		"GET_ACCEPT_BUTTON\0"
+		"GET_NUM_STREAMING_REQUESTS\0"
+		"TASK_SHIMMY\0"
+		"ENABLE_FRONTEND_RADIO\0"
+		"START_PLAYBACK_RECORDED_CAR\0"
+		"DELETE_HTML_SCRIPT_OBJECT\0"
+		"START_CUTSCENE_NOW\0"
+		"SET_CAR_FOV_RATE\0"
+		"IS_BIT_SET\0"
+		"ADD_SCORE\0"
+		"CAM_RESTORE_JUMPCUT\0"
+		"SET_FADE_IN_AFTER_LOAD\0"
+		"GET_FREE_CAM\0"
+		"DRAW_DEBUG_SPHERE\0"
+		"LOCATE_CHAR_IN_CAR_CAR_2D\0"
+		"SET_ARMOUR_PICKUP_NETWORK_REGEN_TIME\0"
+		"HAS_CHAR_ANIM_FINISHED\0"
+		"IS_GAME_KEYBOARD_KEY_JUST_PRESSED\0"
+		"SET_PED_DENSITY_MULTIPLIER\0"
+		"ADD_NEW_CONVERSATION_SPEAKER\0"
+		"START_LOAD_SCENE\0"
+		"NETWORK_IS_PLAYER_TALKING\0"
+		"SET_PLAYER_MOOD_NORMAL\0"
+		"NETWORK_GET_HEALTH_RETICULE_OPTION\0"
+		"IS_PLAYER_SIGNED_IN_LOCALLY\0"
+		"HAS_OBJECT_BEEN_DAMAGED_BY_WEAPON\0"
+		"INCREMENT_FLOAT_STAT\0"
+		"GET_CHAR_MAX_MOVE_BLEND_RATIO\0"
+		"SET_CHAR_FORCE_DIE_IN_CAR\0"
+		"SET_ALL_PICKUPS_OF_TYPE_COLLECTABLE_BY_CAR\0"
+		"HAVE_REQUESTED_PATH_NODES_BEEN_LOADED\0"
+		"MP_GET_AMOUNT_OF_VARIATION_COMPONENT\0"
+		"REVIVE_INJURED_PED\0"
+		"MP_GET_PREFERENCE_VALUE\0"
+		"GET_IS_AUTOSAVE_OFF\0"
+		"DELETE_ALL_TRAINS\0"
+		"GET_MAXIMUM_NUMBER_OF_PASSENGERS\0"
+		"FORCE_AIR_DRAG_MULT_FOR_PLAYERS_CAR\0"
+		"IS_CAR_DOOR_FULLY_OPEN\0"
+		"PED_QUEUE_CONSIDER_PEDS_WITH_FLAG_FALSE\0"
+		"GET_CHAR_ANIM_CURRENT_TIME\0"
+		"SET_FOLLOW_VEHICLE_PITCH_LIMIT_UP\0"
+		"PRINT_HELP_FOREVER_WITH_STRING_NO_SOUND\0"
+		"ENABLE_FOV_LOD_MULTIPLIER\0"
+		"IS_CAM_SEQUENCE_COMPLETE\0"
+		"ADD_UPSIDEDOWN_CAR_CHECK\0"
+		"SET_HELI_BLADES_FULL_SPEED\0"
+		"RESERVE_NETWORK_MISSION_PEDS_FOR_HOST\0"
+		"CREATE_WIDGET_GROUP\0"
+		"IS_PED_IN_CUTSCENE_BLOCKING_BOUNDS\0"
+		"RELEASE_MOVIE\0"
+		"SET_CAM_FOV\0"
+		"NETWORK_LEAVE_GAME\0"
+		"SET_WEB_PAGE_SCROLL\0"
+		"REMOVE_ANIMS\0"
+		"GIVE_PED_FAKE_NETWORK_NAME\0"
+		"GET_ANIM_GROUP_FROM_CHAR\0"
+		"SET_PLAYER_CAN_DO_DRIVE_BY\0"
+		"GET_ROOM_KEY_FROM_OBJECT\0"
+		"IS_AMBIENT_SPEECH_DISABLED\0"
+		"SET_FOLLOW_VEHICLE_CAM_OFFSET\0"
+		"TASK_PLAY_ANIM_SECONDARY_NO_INTERRUPT\0"
+		"SWITCH_ROADS_ON\0"
+		"RELOAD_WEB_PAGE\0"
+		"GET_BLIP_INFO_ID_CAR_INDEX\0"
+		"SET_CAR_COORDINATES\0"
+		"FORCE_PED_PINNED_DOWN\0"
+		"SET_CHAR_SPHERE_DEFENSIVE_AREA\0"
+		"CLOSE_ALL_CAR_DOORS\0"
+		"DISPLAY_GRIME_THIS_FRAME\0"
+		"HANDLE_AUDIO_ANIM_EVENT\0"
+		"TASK_COMBAT_TIMED\0"
+		"PLAY_SOUND_FROM_PED\0"
+		"GET_PLAYER_NAME\0"
+		"GET_VEHICLE_DIRT_LEVEL\0"
+		"CLEAR_ALL_CHAR_RELATIONSHIPS\0"
+		"REMOVE_CHAR_ELEGANTLY\0"
+		"SET_CHAR_PROP_INDEX_TEXTURE\0"
+		"SET_GLOBAL_INSTANCE_PRIORITY\0"
+		"SET_SERVER_ID\0"
+		"GET_PROFILE_SETTING\0"
+		"SET_CHAR_HEALTH\0"
+		"ATTACH_OBJECT_TO_PED\0"
+		"ANCHOR_OBJECT\0"
+		"HAS_OBJECT_BEEN_PHOTOGRAPHED\0"
+		"SET_GAME_CAMERA_CONTROLS_ACTIVE\0"
+		"SET_PED_STEERS_AROUND_PEDS\0"
+		"SET_CAM_POINT_DAMPING_PARAMS\0"
+		"TASK_SMART_FLEE_CHAR_PREFERRING_PAVEMENTS\0"
+		"SET_CHAR_COORDINATES_NO_OFFSET\0"
+		"ABORT_SCRIPTED_CONVERSATION\0"
+		"FORCE_RANDOM_PED_TYPE\0"
+		"IS_THIS_MODEL_A_BIKE\0"
+		"GET_GAME_VIEWPORT_ID\0"
+		"NETWORK_SET_SERVER_NAME\0"
+		"SET_GROUP_COMBAT_DECISION_MAKER\0"
+		"DISABLE_CAR_GENERATORS\0"
+		"GET_SCRIPT_RENDERTARGET_RENDER_ID\0"
+		"IS_PLAYER_PRESSING_HORN\0"
+		"SET_NETWORK_JOIN_FAIL\0"
+		"IS_BULLET_IN_AREA\0"
+		"SAVE_SETTINGS\0"
+		"LOCATE_DEAD_CAR_3D\0"
+		"ALLOW_GANG_RELATIONSHIPS_TO_BE_CHANGED_BY_NEXT_COMMAND\0"
+		"RELEASE_TEXTURE\0"
+		"NETWORK_START_SESSION_SUCCEEDED\0"
+		"HAS_OBJECT_BEEN_UPROOTED\0"
+		"START_END_CREDITS_MUSIC\0"
+		"NETWORK_START_SESSION\0"
+		"FREEZE_CAR_POSITION_AND_DONT_LOAD_COLLISION\0"
+		"GET_RANDOM_CAR_NODE\0"
+		"GET_GAME_CAM_CHILD\0"
+		"IS_PLAYER_TARGETTING_CHAR\0"
+		"GET_BITS_IN_RANGE\0"
+		"RETUNE_RADIO_TO_STATION_NAME\0"
+		"GET_TIME_SINCE_PLAYER_HIT_CAR\0"
+		"DRAW_SPRITE_WITH_UV\0"
+		"LOCATE_CHAR_ANY_MEANS_CAR_3D\0"
+		"GET_PED_GROUP_INDEX\0"
+		"SET_DEFAULT_GLOBAL_INSTANCE_PRIORITY\0"
+		"SET_TEXT_DROPSHADOW\0"
+		"TASK_OPEN_PASSENGER_DOOR\0"
+		"SET_CHAR_WILL_COWER_INSTEAD_OF_FLEEING\0"
+		"ASIN\0"
+		"DOES_BLIP_EXIST\0"
+		"ADD_GROUP_TO_NETWORK_RESTART_NODE_GROUP_LIST\0"
+		"GET_NEXT_CLOSEST_CAR_NODE\0"
+		"IS_POS_IN_CUTSCENE_BLOCKING_BOUNDS\0"
+		"START_CUSTOM_MOBILE_PHONE_RINGING\0"
+		"IS_CHAR_ON_SCREEN\0"
+		"SHOW_UPDATE_STATS\0"
+		"TASK_STAND_GUARD\0"
+		"GET_GROUP_FORMATION\0"
+		"NETWORK_VERIFY_USER_STRING\0"
+		"CONVERT_INT_TO_PLAYERINDEX\0"
+		"LOCATE_OBJECT_2D\0"
+		"NETWORK_GET_HOST_MATCH_PROGRESS\0"
+		"GET_BLIP_COLOUR\0"
+		"NETWORK_ALL_PARTY_MEMBERS_PRESENT\0"
+		"PICKUPS_PASS_TIME\0"
+		"GET_NTH_CLOSEST_CAR_NODE_WITH_HEADING_ON_ISLAND\0"
+		"SET_PICKUPS_FIX_CARS\0"
+		"IS_CAR_ON_SCREEN\0"
+		"IS_SCREEN_FADED_OUT\0"
+		"NETWORK_JOIN_GAME_SUCCEEDED\0"
+		"REQUEST_IPL\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_AREA\0"
+		"FREEZE_POSITION_OF_CLOSEST_OBJECT_OF_TYPE\0"
+		"GET_NUMBER_OF_INSTANCES_OF_STREAMED_SCRIPT\0"
+		"GIVE_PLAYER_RAGDOLL_CONTROL\0"
+		"IS_DAMAGE_TRACKER_ACTIVE_ON_NETWORK_ID\0"
+		"DISPLAY_TEXT_WITH_NUMBER\0"
+		"FLUSH_COVER_BLOCKING_AREAS\0"
+		"SET_DONT_ACTIVATE_RAGDOLL_FROM_PLAYER_IMPACT\0"
+		"SET_CAM_SPLINE_PROGRESS\0"
+		"SET_CHAR_MELEE_MOVEMENT_CONSTAINT_BOX\0"
+		"GET_NUM_CAR_COLOURS\0"
+		"SET_PED_ALPHA\0"
+		"DID_SAVE_COMPLETE_SUCCESSFULLY\0"
+		"CAM_SET_INTERPOLATION_DETAILS\0"
+		"GET_CURRENT_CHAR_WEAPON\0"
+		"NETWORK_SET_FRIENDLY_FIRE_OPTION\0"
+		"POW\0"
+		"NETWORK_IS_PLAYER_TYPING\0"
+		"SET_CURRENT_MOVIE\0"
+		"SET_RICH_PRESENCE_TEMPLATEMP2\0"
+		"SYNCH_AMBIENT_PLANES\0"
+		"IS_CAR_DOOR_DAMAGED\0"
+		"TASK_GO_TO_OBJECT\0"
+		"STOP_PREVIEW_RINGTONE\0"
+		"ENABLE_POLICE_SCANNER\0"
+		"GET_SPAWN_COORDINATES_FOR_CAR_NODE\0"
+		"REGISTER_SCRIPT_WITH_AUDIO\0"
+		"GET_MENU_POSITION\0"
+		"GET_CAR_ANIM_CURRENT_TIME\0"
+		"SET_CLEAR_MANIFOLDS\0"
+		"LOCATE_CHAR_ANY_MEANS_2D\0"
+		"DOES_OBJECT_EXIST_WITH_NETWORK_ID\0"
+		"SET_GARAGE_LEAVE_CAMERA_ALONE\0"
+		"GET_ANGLE_BETWEEN_2D_VECTORS\0"
+		"SET_CHAR_ALL_ANIMS_SPEED\0"
+		"ADD_POINT_TO_GPS_RACE_TRACK\0"
+		"IS_AREA_OCCUPIED\0"
+		"GET_NUMBER_OF_PASSENGERS\0"
+		"NETWORK_HOST_GAME_E1\0"
+		"TASK_ENTER_CAR_AS_DRIVER\0"
+		"DISPLAY_SNIPER_SCOPE_THIS_FRAME\0"
+		"SET_TEXT_LINE_HEIGHT_MULT\0"
+		"GET_SORTED_NETWORK_RESTART_NODE\0"
+		"LOCAL_PLAYER_IS_READY_TO_START_PLAYING\0"
+		"ARE_ENEMY_PEDS_IN_AREA\0"
+		"CLOSE_GARAGE\0"
+		"SET_USE_POOL_GAME_PHYSICS_SETTINGS\0"
+		"SET_PED_COMPONENTS_TO_NETWORK_PLAYERSETTINGS_MODEL\0"
+		"STRING_TO_INT\0"
+		"SET_RADAR_AS_INTERIOR_THIS_FRAME\0"
+		"GET_CHAR_READY_TO_BE_STUNNED\0"
+		"START_PTFX_ON_VEH\0"
+		"IS_NON_FRAG_OBJECT_SMASHED\0"
+		"IS_PED_IN_COVER\0"
+		"SET_CREATE_RANDOM_COPS\0"
+		"IS_CHAR_GETTING_IN_TO_A_CAR\0"
+		"SET_GROUP_CHAR_DUCKS_WHEN_AIMED_AT\0"
+		"NETWORK_SET_MATCH_PROGRESS\0"
+		"TASK_CHAT_WITH_CHAR\0"
+		"CAN_PHONE_BE_SEEN_ON_SCREEN\0"
+		"GET_NAME_OF_INFO_ZONE\0"
+		"GET_OBJECT_MODEL\0"
+		"PRINT_WITH_4_NUMBERS_NOW\0"
+		"MODIFY_CHAR_MOVE_STATE\0"
+		"CAN_CREATE_RANDOM_CHAR\0"
+		"REMOVE_PLAYER_HELMET\0"
+		"SAY_AMBIENT_SPEECH\0"
+		"IS_SCREEN_FADING_IN\0"
+		"SET_TRAIN_STOPS_FOR_STATIONS\0"
+		"SECUROM_SPOT_CHECK3\0"
+		"PRINT_WITH_2_NUMBERS_NOW\0"
+		"IS_VIEWPORT_ACTIVE\0"
+		"PLAY_OBJECT_ANIM\0"
+		"GET_PAD_STATE\0"
+		"NETWORK_FIND_GAME\0"
+		"TASK_TOGGLE_PED_THREAT_SCANNER\0"
+		"IS_OBJECT_IN_ANGLED_AREA_3D\0"
+		"GET_CONSOLE_COMMAND_TOKEN\0"
+		"SET_MAX_WANTED_LEVEL\0"
+		"EXTINGUISH_CHAR_FIRE\0"
+		"GET_CAR_MASS\0"
+		"CAM_SEQUENCE_OPEN\0"
+		"GET_SAFE_POSITION_FOR_CHAR\0"
+		"START_PLAYBACK_RECORDED_CAR_USING_AI\0"
+		"CAM_SEQUENCE_CLOSE\0"
+		"SET_VIEWPORT_PRIORITY\0"
+		"START_FIRING_AMNESTY\0"
+		"ABORT_ALL_GARAGE_ACTIVITY\0"
+		"GET_GROUP_LEADER\0"
+		"SET_CHAR_MOVE_ANIM_SPEED_MULTIPLIER\0"
+		"IS_PED_LOOKING_AT_OBJECT\0"
+		"IS_CHAR_RESPONDING_TO_ANY_EVENT\0"
+		"HAS_CUTSCENE_LOADED\0"
+		"SET_PLAYER_MOOD_PISSED_OFF\0"
+		"IS_SCREEN_FADED_IN\0"
+		"SWAP_NEAREST_BUILDING_MODEL\0"
+		"SET_GROUP_MEMBER\0"
+		"DESTROY_ALL_SCRIPT_VIEWPORTS\0"
+		"NETWORK_GET_UNACCEPTED_INVITE_GAME_MODE\0"
+		"IS_PED_FLEEING\0"
+		"GET_WEAPONTYPE_SLOT\0"
+		"TRIGGER_VEH_ALARM\0"
+		"ATTACH_CAM_TO_VEHICLE\0"
+		"SET_ZONE_SCUMMINESS\0"
+		"POINT_CAM_AT_OBJECT\0"
+		"TASK_PAUSE\0"
+		"GET_CHAR_IN_CAR_PASSENGER_SEAT\0"
+		"SHUT_CAR_DOOR\0"
+		"IS_WORLD_POINT_WITHIN_BRAIN_ACTIVATION_RANGE\0"
+		"GET_MOBILE_PHONE_RENDER_ID\0"
+		"SET_CHAR_WILL_REMAIN_ON_BOAT_AFTER_MISSION_ENDS\0"
+		"ALLOW_STUNT_JUMPS_TO_TRIGGER\0"
+		"TASK_JUMP\0"
+		"FAIL_KILL_FRENZY\0"
+		"SET_CHAR_NEVER_TARGETTED\0"
+		"SET_CAR_STAY_IN_FAST_LANE\0"
+		"PRINT_WITH_5_NUMBERS_NOW\0"
+		"END_CHAR_SEARCH_CRITERIA\0"
+		"AWARD_ACHIEVEMENT\0"
+		"GET_MAP_AREA_FROM_COORDS\0"
+		"NETWORK_GET_FRIEND_COUNT\0"
+		"SET_CAR_FOV_FADE_MULT\0"
+		"GET_SCRIPT_CAM\0"
+		"GET_LENGTH_OF_STRING_WITH_THIS_TEXT_LABEL_INS_NUM\0"
+		"CLEAR_AREA_OF_COPS\0"
+		"SET_CHAR_WILL_USE_COVER\0"
+		"ALTER_WANTED_LEVEL_NO_DROP\0"
+		"REGISTER_TARGET\0"
+		"USING_STANDARD_CONTROLS\0"
+		"ARE_TAXI_LIGHTS_ON\0"
+		"SET_CHAR_READY_TO_BE_EXECUTED\0"
+		"SET_WEB_PAGE_LINK_ACTIVE\0"
+		"IS_SYSTEM_UI_SHOWING\0"
+		"SET_CAM_INTERP_DETAIL_ROT_STYLE_ANGLES\0"
+		"START_CUTSCENE\0"
+		"GET_TOTAL_DURATION_OF_CAR_RECORDING\0"
+		"DO_SCREEN_FADE_IN_UNHACKED\0"
+		"HAS_STREAMED_TXD_LOADED\0"
+		"IS_GAME_KEYBOARD_KEY_PRESSED\0"
+		"GET_HEIGHT_OF_VEHICLE\0"
+		"NETWORK_SET_SESSION_INVITABLE\0"
+		"START_CHAR_FIRE\0"
+		"EXTINGUISH_OBJECT_FIRE\0"
+		"REGISTER_MISSION_PASSED\0"
+		"CLEAR_ROOM_FOR_CAR\0"
+		"GET_BLIP_INFO_ID_PED_INDEX\0"
+		"SET_COLLIDE_WITH_PEDS\0"
+		"PRINT_WITH_3_NUMBERS\0"
+		"SET_CHAR_PROP_INDEX\0"
+		"GET_CAR_MODEL\0"
+		"SET_VEH_ALARM_DURATION\0"
+		"GET_EPISODE_NAME\0"
+		"IS_AUTO_SAVE_IN_PROGRESS\0"
+		"REMOVE_ADDITIONAL_POPULATION_MODEL\0"
+		"SET_CHAR_GRAVITY\0"
+		"IS_BIG_VEHICLE\0"
+		"HIDE_HUD_AND_RADAR_THIS_FRAME\0"
+		"DAMAGE_CHAR\0"
+		"NETWORK_IS_RENDEZVOUS\0"
+		"NETWORK_JOIN_GAME\0"
+		"ACTIVATE_MENU_ITEM\0"
+		"IS_BULLET_IN_BOX\0"
+		"START_PTFX_ON_OBJ_BONE\0"
+		"ACTIVATE_NETWORK_SETTINGS_MENU\0"
+		"REGISTER_INT_STAT\0"
+		"SET_CAM_NEAR_DOF\0"
+		"PLAY_SOUND_FROM_OBJECT\0"
+		"IS_CHAR_USING_MAP_ATTRACTOR\0"
+		"GET_CAM_POS\0"
+		"ALTER_WANTED_LEVEL\0"
+		"PLAYSTATS_MISSION_CANCELLED\0"
+		"SET_MISSION_PASSED_CASH\0"
+		"SET_HAS_BEEN_OWNED_FOR_CAR_GENERATOR\0"
+		"SET_CHAR_AS_MISSION_CHAR\0"
+		"TAKE_CAR_OUT_OF_PARKED_CARS_BUDGET\0"
+		"GET_VEHICLE_TYPE_OF_MODEL\0"
+		"CLEAR_TIMECYCLE_MODIFIER\0"
+		"IS_CHAR_IN_ANGLED_AREA_3D\0"
+		"ACTIVATE_REPLAY_MENU\0"
+		"PLAY_AUDIO_EVENT_FROM_PED\0"
+		"FLASH_BLIP_ALT\0"
+		"IS_LCPD_DATA_VALID\0"
+		"SET_RICH_PRESENCE_TEMPLATEMP3\0"
+		"GET_AMMO_IN_CLIP\0"
+		"IS_PLAYER_PERFORMING_WHEELIE\0"
+		"HAS_CAR_BEEN_DAMAGED_BY_CHAR\0"
+		"GET_BLIP_ALPHA\0"
+		"DESTROY_ALL_CAMS\0"
+		"SET_SPRITES_DRAW_BEFORE_FADE\0"
+		"PRINTSTRING\0"
+		"SET_VIEWPORT_MIRRORED\0"
+		"INIT_FRONTEND_HELPER_TEXT\0"
+		"SET_CHAR_RELATIONSHIP_GROUP\0"
+		"PRINTVECTOR\0"
+		"SET_POLICE_IGNORE_PLAYER\0"
+		"REGISTER_HATED_TARGETS_IN_AREA\0"
+		"PED_QUEUE_REJECT_PEDS_WITH_FLAG_FALSE\0"
+		"DISPLAY_FRONTEND_MAP_BLIPS\0"
+		"IS_PLAYER_ONLINE\0"
+		"ATTACH_CAR_TO_OBJECT\0"
+		"SET_MOBILE_PHONE_SCALE\0"
+		"FORCE_PED_TO_LOAD_COVER\0"
+		"IS_INTERIOR_SCENE\0"
+		"GET_CAR_PITCH\0"
+		"SET_CAR_STRONG\0"
+		"SET_ROOM_FOR_CHAR_BY_KEY\0"
+		"FORCE_FULL_VOICE\0"
+		"REMOVE_ALL_INACTIVE_GROUPS_FROM_CLEANUP_LIST\0"
+		"GET_NUMBER_OF_PLAYERS\0"
+		"SET_CHAR_COORDINATES_DONT_WARP_GANG\0"
+		"SWITCH_ROADS_BACK_TO_ORIGINAL\0"
+		"ADD_PED_TO_CINEMATOGRAPHY_AI\0"
+		"TASK_PERFORM_SEQUENCE_FROM_PROGRESS\0"
+		"DELETE_PLAYER\0"
+		"END_CAM_COMMANDS\0"
+		"IS_CHAR_USING_SCENARIO\0"
+		"NETWORK_CLEAR_SUMMONS\0"
+		"TIMERB\0"
+		"SET_CHAR_WILL_TRY_TO_LEAVE_BOAT_AFTER_LEADER\0"
+		"NETWORK_INVITE_FRIEND\0"
+		"IS_THIS_MODEL_A_VEHICLE\0"
+		"GET_PLAYER_ID\0"
+		"IS_THIS_MODEL_A_HELI\0"
+		"DISPLAY_CASH\0"
+		"CLEAR_NAMED_CUTSCENE\0"
+		"DELETE_OBJECT\0"
+		"UNOBFUSCATE_INT_ARRAY\0"
+		"SET_PLAYER_AS_DAMAGED_PLAYER\0"
+		"GET_SOUND_ID\0"
+		"SECUROM_SPOT_CHECK1\0"
+		"RESET_NO_LAW_VEHICLES_DESTROYED_BY_LOCAL_PLAYER\0"
+		"FORCE_WEATHER_NOW\0"
+		"DOES_SCRIPT_FIRE_EXIST\0"
+		"EXTINGUISH_CAR_FIRE\0"
+		"ARE_CREDITS_FINISHED\0"
+		"CAM_SET_CINEMATIC\0"
+		"THIS_SCRIPT_IS_SAFE_FOR_NETWORK_GAME\0"
+		"DISABLE_POLICE_SCANNER\0"
+		"IS_IN_CAR_FIRE_BUTTON_PRESSED\0"
+		"DONT_DISPATCH_COPS_FOR_PLAYER\0"
+		"GET_CLOSEST_ROAD\0"
+		"GET_NO_LAW_VEHICLES_DESTROYED_BY_LOCAL_PLAYER\0"
+		"CODE_WANTS_MOBILE_PHONE_REMOVED\0"
+		"SET_VEH_HAS_STRONG_AXLES\0"
+		"IS_PLAYER_FREE_FOR_AMBIENT_TASK\0"
+		"IS_CAR_HEALTH_GREATER\0"
+		"SET_CHAR_MAX_MOVE_BLEND_RATIO\0"
+		"ATTACH_CAR_TO_CAR\0"
+		"SET_CHAR_DUCKING\0"
+		"IS_STREAMING_PRIORITY_REQUESTS\0"
+		"IS_MOUSE_USING_VERTICAL_INVERSION\0"
+		"GET_STRING_WIDTH\0"
+		"FIND_STATIC_EMITTER_INDEX\0"
+		"SET_PLAYER_CONTROL_FOR_AMBIENT_SCRIPT\0"
+		"GET_DOOR_STATE\0"
+		"TASK_MOBILE_CONVERSATION\0"
+		"REMOVE_CHAR_FROM_GROUP\0"
+		"SET_FORCE_LOOK_BEHIND\0"
+		"SET_GROUP_FOLLOW_STATUS\0"
+		"IS_CHAR_USING_ANY_SCENARIO\0"
+		"CLEAR_OBJECT_LAST_DAMAGE_ENTITY\0"
+		"SET_MONEY_CARRIED_BY_ALL_NEW_PEDS\0"
+		"GET_CORRECTED_COLOUR\0"
+		"SHIFT_RIGHT\0"
+		"HAS_PLAYER_DAMAGED_AT_LEAST_ONE_PED\0"
+		"GET_WIDTH_OF_SUBSTRING_GIVEN_TEXT_LABEL\0"
+		"GET_CAM_MOTION_BLUR\0"
+		"SET_ZONE_NO_COPS\0"
+		"DESTROY_VIEWPORT\0"
+		"SKIP_TO_NEXT_ALLOWED_STATION\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_TARGET_LOSS_RESPONSE\0"
+		"ADD_CHAR_DECISION_MAKER_EVENT_RESPONSE\0"
+		"SET_STAT_FRONTEND_ALWAYS_VISIBLE\0"
+		"PLAY_SOUND_FROM_POSITION\0"
+		"TASK_GOTO_CHAR_OFFSET\0"
+		"REMOVE_IPL_DISCREETLY\0"
+		"BLEND_OUT_CHAR_MOVE_ANIMS\0"
+		"SET_UP_TRIP_SKIP_FOR_SPECIFIC_VEHICLE\0"
+		"IS_GARAGE_OPEN\0"
+		"FLUSH_ALL_SPAWN_BLOCKING_AREAS\0"
+		"NETWORK_IS_SESSION_STARTED\0"
+		"SET_CAR_FORWARD_SPEED\0"
+		"CHANGE_PICKUP_BLIP_COLOUR\0"
+		"GET_TIME_SINCE_PLAYER_RAN_LIGHT\0"
+		"DO_SCREEN_FADE_OUT\0"
+		"TASK_GOTO_CHAR_AIMING\0"
+		"SAVE_INT_TO_DEBUG_FILE\0"
+		"REQUEST_ANIMS\0"
+		"SET_HINT_MOVE_IN_DIST\0"
+		"DISPLAY_TEXT_WITH_LITERAL_STRING\0"
+		"SET_CHAR_ALLOWED_TO_RUN_ON_BOATS\0"
+		"SET_ROT_ORDER\0"
+		"SAVE_FLOAT_TO_DEBUG_FILE\0"
+		"REMOVE_BLIP_AND_CLEAR_INDEX\0"
+		"TASK_GO_TO_CHAR\0"
+		"IS_PLAYER_TARGETTING_ANYTHING\0"
+		"SET_PETROL_TANK_WEAKPOINT\0"
+		"SET_TELESCOPE_CAM_ANGLE_LIMITS\0"
+		"DISPLAY_TEXT_WITH_TWO_STRINGS\0"
+		"FREEZE_OBJECT_POSITION_AND_DONT_LOAD_COLLISION\0"
+		"STOP_STREAM\0"
+		"IS_USING_CONTROLLER\0"
+		"GET_CAR_BLOCKING_CAR\0"
+		"SET_TIMER_BEEP_COUNTDOWN_TIME\0"
+		"DEACTIVATE_SCRIPT_POPULATION_ZONE\0"
+		"SHAKE_PAD\0"
+		"DOES_DECISION_MAKER_EXIST\0"
+		"CLEAR_BIT\0"
+		"ACTIVATE_INTERIOR\0"
+		"REQUEST_COLLISION_FOR_MODEL\0"
+		"FIND_NETWORK_RESTART_POINT\0"
+		"ADD_WIDGET_TOGGLE\0"
+		"IS_PED_CLIMBING\0"
+		"LOCK_CAR_DOORS\0"
+		"GET_LATEST_CONSOLE_COMMAND\0"
+		"START_MOBILE_PHONE_CALLING\0"
+		"DEBUG_OFF\0"
+		"SET_OBJECT_EXISTS_ON_ALL_MACHINES\0"
+		"IS_CHAR_PLAYING_ANIM\0"
+		"HAS_PLAYER_DAMAGED_AT_LEAST_ONE_VEHICLE\0"
+		"IS_GROUP_MEMBER\0"
+		"CREATE_PICKUP_ROTATE\0"
+		"IS_EXPLOSION_IN_AREA\0"
+		"IS_PED_JACKING\0"
+		"SET_OBJECT_CCD\0"
+		"GET_CURRENT_PLAYBACK_NUMBER_FOR_CAR\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_RETREATING_BEHAVIOUR\0"
+		"IS_PLAYER_TARGETTING_OBJECT\0"
+		"SET_MESSAGE_FORMATTING\0"
+		"SET_PED_FIRE_FX_LOD_SCALER\0"
+		"DOES_VEHICLE_EXIST\0"
+		"GET_NUMBER_LINES\0"
+		"GET_WATER_HEIGHT_NO_WAVES\0"
+		"SET_PED_IS_DRUNK\0"
+		"ADD_OBJECT_TO_INTERIOR_ROOM_BY_KEY\0"
+		"SWITCH_PED_PATHS_ON\0"
+		"GET_GROUP_FORMATION_SPACING\0"
+		"LOCATE_CHAR_ON_FOOT_OBJECT_2D\0"
+		"SET_PLAYER_INVISIBLE_TO_AI\0"
+		"TASK_HANDS_UP\0"
+		"CREATE_EMERGENCY_SERVICES_CAR_RETURN_DRIVER\0"
+		"STORE_DAMAGE_TRACKER_FOR_NETWORK_PLAYER\0"
+		"SET_CAM_INTERP_STYLE_DETAILED\0"
+		"GIVE_PED_PICKUP_OBJECT\0"
+		"ENABLE_CHASE_AUDIO\0"
+		"SET_CAM_SHAKE\0"
+		"GET_DISTANCE_BETWEEN_COORDS_2D\0"
+		"SET_MOBILE_RADIO_ENABLED_DURING_GAMEPLAY\0"
+		"IS_CHAR_IN_MELEE_COMBAT\0"
+		"MAINTAIN_FLASHING_STAR_AFTER_OFFENCE\0"
+		"GET_OFFSET_FROM_INTERIOR_IN_WORLD_COORDS\0"
+		"SET_CHAR_COORDINATES\0"
+		"SET_PLAYER_ICON_COLOUR\0"
+		"SET_CHAR_CLIMB_ANIM_RATE\0"
+		"SET_FOV_CHANNEL_SCRIPT\0"
+		"IS_PED_BEING_JACKED\0"
+		"SET_DEAD_CHAR_COORDINATES\0"
+		"IS_MESSAGE_BEING_DISPLAYED\0"
+		"IS_MINIGAME_IN_PROGRESS\0"
+		"GET_HASH_KEY\0"
+		"BURST_CAR_TYRE\0"
+		"SHAKE_PLAYERPAD_WHEN_CONTROLLER_DISABLED\0"
+		"SET_GROUP_FORMATION_SPACING\0"
+		"SET_CAM_MOTION_BLUR\0"
+		"WASH_VEHICLE_TEXTURES\0"
+		"CREATE_CAM\0"
+		"SET_PED_ENABLE_LEG_IK\0"
+		"NETWORK_SHOW_FRIEND_PROFILE_UI\0"
+		"IS_HUD_PREFERENCE_SWITCHED_ON\0"
+		"TASK_CAR_DRIVE_TO_COORD\0"
+		"PLAYER_HAS_FLASHING_STARS_ABOUT_TO_DROP\0"
+		"IS_MOBILE_PHONE_CALL_ONGOING\0"
+		"UNREGISTER_SCRIPT_WITH_AUDIO\0"
+		"GET_CHAR_WILL_COWER_INSTEAD_OF_FLEEING\0"
+		"ALLOW_EMERGENCY_SERVICES\0"
+		"VDIST2\0"
+		"SET_INTERP_FROM_SCRIPT_TO_GAME\0"
+		"IS_FONT_LOADED\0"
+		"DOES_VEHICLE_EXIST_WITH_NETWORK_ID\0"
+		"SET_CAR_GENERATORS_ACTIVE_IN_AREA\0"
+		"SAVE_NEWLINE_TO_DEBUG_FILE\0"
+		"ACTIVATE_CHEAT\0"
+		"CHANGE_BLIP_PRIORITY\0"
+		"POINT_CAM_AT_VEHICLE\0"
+		"GET_PED_FROM_NETWORK_ID\0"
+		"DONT_SUPPRESS_ANY_CAR_MODELS\0"
+		"ALLOW_PLAYER_TO_CARRY_NON_MISSION_OBJECTS\0"
+		"REMOVE_UPSIDEDOWN_CAR_CHECK\0"
+		"IS_OBJECT_TOUCHING_OBJECT\0"
+		"GET_STREAM_BEAT_INFO\0"
+		"REPORT_SUSPECT_DOWN\0"
+		"NETWORK_RETURN_TO_RENDEZVOUS_PENDING\0"
+		"IS_CHAR_DEAD\0"
+		"SET_OBJECT_ANIM_PLAYING_FLAG\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_NUM_SCENARIO_PEDS\0"
+		"WARP_CHAR_FROM_CAR_TO_COORD\0"
+		"FORCE_RADIO_TRACK\0"
+		"CHANGE_BLIP_SPRITE\0"
+		"SET_CAR_COLLISION\0"
+		"IS_OBJECT_ON_SCREEN\0"
+		"USE_MASK\0"
+		"GET_BLIP_INFO_ID_TYPE\0"
+		"REQUEST_ADDITIONAL_TEXT\0"
+		"SWITCH_PED_ROADS_BACK_TO_ORIGINAL\0"
+		"CREATE_HTML_SCRIPT_OBJECT\0"
+		"SET_PED_HELMET_TEXTURE_INDEX\0"
+		"GET_CURRENT_STACK_SIZE\0"
+		"DRAW_SPRITE\0"
+		"SET_HINT_TIMES_DEFAULT\0"
+		"IS_EMERGENCY_SERVICES_VEHICLE\0"
+		"GET_ONLINE_LAN\0"
+		"RETUNE_RADIO_UP\0"
+		"SET_PED_PATH_MAY_USE_LADDERS\0"
+		"DETACH_OBJECT_NO_COLLIDE\0"
+		"DISABLE_FRONTEND_RADIO\0"
+		"IS_CAR_LOW_RIDER\0"
+		"SET_RICH_PRESENCE_TEMPLATEFILTER\0"
+		"SPOT_CHECK5\0"
+		"GET_CELLPHONE_RANKED\0"
+		"TASK_LEAVE_CAR\0"
+		"SET_CONTENTS_OF_TEXT_WIDGET\0"
+		"SET_ONLINE_SCORE\0"
+		"REMOVE_ALL_CHAR_WEAPONS\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_CAUTION\0"
+		"SET_PLAYER_MAY_ONLY_ENTER_THIS_VEHICLE\0"
+		"IS_CAR_ATTACHED\0"
+		"ON_FIRE_SCREAM\0"
+		"GET_LENGTH_OF_STRING_WITH_THIS_HASH_KEY\0"
+		"STRING_STRING\0"
+		"RESET_LOCAL_PLAYER_WEAPON_STAT\0"
+		"NEW_SCRIPTED_CONVERSATION\0"
+		"SET_RICH_PRESENCE_TEMPLATEMP1\0"
+		"ENABLE_ALL_PED_HELMETS\0"
+		"SET_PLAYER_KEEPS_WEAPONS_WHEN_RESPAWNED\0"
+		"IS_MISSION_COMPLETE_PLAYING\0"
+		"IS_CHAR_MODEL\0"
+		"NETWORK_IS_ROCKSTART_SESSION_ID_VALID\0"
+		"IS_PAUSE_MENU_ACTIVE\0"
+		"GET_GAMER_NETWORK_SCORE\0"
+		"GET_VEHICLE_QUATERNION\0"
+		"TASK_GET_OFF_BOAT\0"
+		"HAND_VEHICLE_CONTROL_BACK_TO_PLAYER\0"
+		"SET_CHAR_SIGNAL_AFTER_KILL\0"
+		"LINE\0"
+		"MP_GET_AMOUNT_OF_ANCHOR_POINTS\0"
+		"CHANGE_BLIP_NAME_FROM_ASCII\0"
+		"KNOCK_PED_OFF_BIKE\0"
+		"GET_CAR_COLOURS\0"
+		"SET_EXTRA_CAR_COLOURS\0"
+		"ADD_NAVMESH_REQUIRED_REGION\0"
+		"TASK_SIT_DOWN_INSTANTLY\0"
+		"GET_GFWL_HAS_SAFE_HOUSE\0"
+		"LOCATE_CHAR_IN_CAR_OBJECT_2D\0"
+		"SET_NM_MESSAGE_FLOAT\0"
+		"TASK_SET_IGNORE_WEAPON_RANGE_FLAG\0"
+		"TASK_LEAVE_CAR_AND_FLEE\0"
+		"HAS_THIS_ADDITIONAL_TEXT_LOADED\0"
+		"SET_CURRENT_CHAR_WEAPON\0"
+		"ENABLE_DEFERRED_LIGHTING\0"
+		"SET_TEXT_DRAW_BEFORE_FADE\0"
+		"GET_ONLINE_SCORE\0"
+		"SET_GROUP_FORMATION\0"
+		"LOCATE_CHAR_ANY_MEANS_OBJECT_3D\0"
+		"GET_CHAR_WALK_ALONGSIDE_LEADER_WHEN_APPROPRIATE\0"
+		"CAN_PED_SHIMMY_IN_DIRECTION\0"
+		"ADD_BLIP_FOR_CAR\0"
+		"NETWORK_CHANGE_GAME_MODE_SUCCEEDED\0"
+		"GET_RANDOM_CAR_OF_TYPE_IN_ANGLED_AREA_NO_SAVE\0"
+		"POINT_FIXED_CAM_AT_POS\0"
+		"GET_CHAR_WILL_TRY_TO_LEAVE_BOAT_AFTER_LEADER\0"
+		"PLAYER_IS_NEAR_FIRST_PIGEON\0"
+		"TASK_ACHIEVE_HEADING\0"
+		"IS_OBJECT_IN_AREA_3D\0"
+		"GET_LENGTH_OF_STRING_WITH_THIS_TEXT_LABEL\0"
+		"GET_TOTAL_NUMBER_OF_STATS\0"
+		"GET_GROUND_Z_FOR_3D_COORD\0"
+		"SET_CHAR_RELATIONSHIP\0"
+		"SET_PICKUP_COLLECTABLE_BY_CAR\0"
+		"SET_CHAR_CURRENT_WEAPON_VISIBLE\0"
+		"DOES_OBJECT_EXIST\0"
+		"HAS_CHAR_BEEN_DAMAGED_BY_WEAPON\0"
+		"LOCATE_OBJECT_3D\0"
+		"GET_LEFT_PLAYER_CASH_TO_REACH_LEVEL\0"
+		"SET_VISIBILITY_OF_NEARBY_ENTITY_WITH_SPECIAL_ATTRIBUTE\0"
+		"STOP_PED_WEAPON_FIRING_WHEN_DROPPED\0"
+		"CHANGE_GARAGE_TYPE\0"
+		"CLEAR_SCRIPT_ARRAY_FROM_SCRATCHPAD\0"
+		"SET_AMMO_IN_CLIP\0"
+		"IS_NETWORK_SESSION\0"
+		"SET_CHAR_ALLOWED_TO_DUCK\0"
+		"SET_PED_FORCE_FLY_THROUGH_WINDSCREEN\0"
+		"GET_NEXT_CLOSEST_CAR_NODE_FAVOUR_DIRECTION\0"
+		"SWITCH_STREAMING\0"
+		"BLEND_FROM_NM_WITH_ANIM\0"
+		"IS_SNIPER_BULLET_IN_AREA\0"
+		"IS_HELP_MESSAGE_BEING_DISPLAYED\0"
+		"SET_BIKE_RIDER_WILL_PUT_FOOT_DOWN_WHEN_STOPPED\0"
+		"SET_PED_ALLOW_MISSION_ONLY_DRIVEBY_USE\0"
+		"ADD_COVER_BLOCKING_AREA\0"
+		"SET_NETWORK_PED_USING_PARACHUTE\0"
+		"SET_NM_MESSAGE_VEC3\0"
+		"LOAD_SCENE_FOR_ROOM_BY_KEY\0"
+		"IS_CAR_WAITING_FOR_WORLD_COLLISION\0"
+		"IS_THIS_MODEL_A_CAR\0"
+		;
+	inline const char ms_sNamePool1[] =
+		"NETWORK_IS_RENDEZVOUS_HOST\0"
+		"LOOK_AT_NEARBY_ENTITY_WITH_SPECIAL_ATTRIBUTE\0"
+		"GET_RANDOM_CHAR_IN_AREA_OFFSET_NO_SAVE\0"
+		"CANCEL_OVERRIDE_RESTART\0"
+		"ALLOW_SCENARIO_PEDS_TO_BE_RETURNED_BY_NEXT_COMMAND\0"
+		"SET_CHAR_DESIRED_HEADING\0"
+		"SET_TARGET_CAR_FOR_MISSION_GARAGE\0"
+		"NETWORK_SHOW_PLAYER_PROFILE_UI\0"
+		"TASK_WARP_CHAR_INTO_CAR_AS_DRIVER\0"
+		"END_WIDGET_GROUP\0"
+		"GET_NTH_CLOSEST_CAR_NODE_FAVOUR_DIRECTION\0"
+		"REMOVE_TEMPORARY_RADAR_BLIPS_FOR_PICKUPS\0"
+		"ADD_WIDGET_FLOAT_SLIDER\0"
+		"GET_BLIP_INFO_ID_ROTATION\0"
+		"GET_RANDOM_WATER_NODE\0"
+		"NETWORK_SHOW_PLAYER_FEEDBACK_UI\0"
+		"SET_CHAR_WILL_FLY_THROUGH_WINDSCREEN\0"
+		"NETWORK_SET_LAN_SESSION\0"
+		"ALLOW_LOCKON_TO_RANDOM_PEDS\0"
+		"REQUEST_SCRIPT\0"
+		"SET_PLAYER_GROUP_TO_FOLLOW_ALWAYS\0"
+		"IS_OBJECT_ATTACHED\0"
+		"TASK_TIRED\0"
+		"SET_SELECTED_MENU_ITEM\0"
+		"GET_EPISODE_INDEX_FROM_SUMMONS\0"
+		"TASK_SHOOT_AT_COORD\0"
+		"SET_ZONE_POPULATION_TYPE\0"
+		"APPLY_WANTED_LEVEL_CHANGE_NOW\0"
+		"START_NEW_SCRIPT_WITH_ARGS\0"
+		"GIVE_DELAYED_WEAPON_TO_CHAR\0"
+		"SET_ADVANCED_BOOL_IN_DECISION_MAKER\0"
+		"REGISTER_HATED_TARGETS_AROUND_PED\0"
+		"SET_PLAYER_PAIN_ROOT_BANK_NAME\0"
+		"UPDATE_NETWORK_STATISTICS\0"
+		"IS_CHAR_STUCK_UNDER_CAR\0"
+		"ADD_BLIP_FOR_OBJECT\0"
+		"SET_LOAD_COLLISION_FOR_OBJECT_FLAG\0"
+		"SET_CHAR_ROTATION\0"
+		"MARK_STREAMED_TXD_AS_NO_LONGER_NEEDED\0"
+		"SPECIFY_SCRIPT_POPULATION_ZONE_GROUPS\0"
+		"LAUNCH_LOCAL_PLAYER_IN_NETWORK_GAME\0"
+		"PRINT_HELP\0"
+		"STOP_PED_SPEAKING\0"
+		"OVERRIDE_FREEZE_FLAGS\0"
+		"SET_CHAR_MAX_TIME_UNDERWATER\0"
+		"DISABLE_PLAYER_LOCKON\0"
+		"IS_CHAR_IN_ANY_CAR\0"
+		"SET_OBJECT_QUATERNION\0"
+		"GET_PED_PATH_MAY_USE_CLIMBOVERS\0"
+		"SET_TEXT_CENTRE_WRAPX\0"
+		"GET_MAX_WANTED_LEVEL\0"
+		"GET_WEB_PAGE_LINK_POSN\0"
+		"CLEAR_CHAR_LAST_WEAPON_DAMAGE\0"
+		"SET_SCRIPTED_ANIM_SEAT_OFFSET\0"
+		"TASK_CHAR_ARREST_CHAR\0"
+		"SET_CHAR_COMPONENT_VARIATION\0"
+		"ENABLE_CAM_COLLISION\0"
+		"NETWORK_IS_OPERATION_PENDING\0"
+		"FORCE_CAR_LIGHTS\0"
+		"ALLOCATE_SCRIPT_TO_OBJECT\0"
+		"STOP_PLAYBACK_RECORDED_CAR\0"
+		"SET_VEH_INDICATORLIGHTS\0"
+		"GET_NUMBER_LINES_WITH_LITERAL_STRINGS\0"
+		"TASK_PLAY_ANIM_FACIAL\0"
+		"SET_REDUCE_VEHICLE_MODEL_BUDGET\0"
+		"SET_VEHICLE_IS_CONSIDERED_BY_PLAYER\0"
+		"NEW_MOBILE_PHONE_CALL\0"
+		"SET_CAM_INTERP_STYLE_CORE\0"
+		"SHOW_SIGNIN_UI\0"
+		"TERMINATE_ALL_SCRIPTS_WITH_THIS_NAME\0"
+		"TASK_SIT_DOWN_ON_NEAREST_OBJECT\0"
+		"SET_INSTANT_WIDESCREEN_BORDERS\0"
+		"TASK_SWAP_WEAPON\0"
+		"DEACTIVATE_FRONTEND\0"
+		"REMOVE_CLOSE_MIC_PED\0"
+		"TASK_DUCK\0"
+		"SET_CAM_ATTACH_OFFSET\0"
+		"CONVERT_THEN_ADD_STRING_TO_HTML_SCRIPT_OBJECT\0"
+		"DONT_SUPPRESS_ANY_PED_MODELS\0"
+		"IS_COP_VEHICLE_IN_AREA_3D_NO_SAVE\0"
+		"APPLY_FORCE_TO_PED\0"
+		"CHANGE_BLIP_NAME_TO_PLAYER_NAME\0"
+		"GET_INTERIOR_HEADING\0"
+		"WINCH_CAN_PICK_OBJECT_UP\0"
+		"RESET_STUCK_TIMER\0"
+		"REMOVE_PROJTEX_FROM_OBJECT\0"
+		"SET_RETURN_TO_FILTER_MENU\0"
+		"GET_PLAYER_ID_FOR_THIS_PED\0"
+		"BLOCK_STATS_MENU_ACTIONS\0"
+		"CODE_WANTS_MOBILE_PHONE_REMOVED_FOR_WEAPON_SWITCHING\0"
+		"ALLOW_AUTO_CONVERSATION_LOOKATS\0"
+		"IS_SCREEN_FADING\0"
+		"ARE_ALL_NAVMESH_REGIONS_LOADED\0"
+		"GET_OFFSET_FROM_CHAR_IN_WORLD_COORDS\0"
+		"TASK_SMART_FLEE_POINT\0"
+		"DOES_THIS_MINIGAME_SCRIPT_ALLOW_NON_MINIGAME_HELP_MESSAGES\0"
+		"SET_RICH_PRESENCE\0"
+		"PRINT_NOW\0"
+		"GET_PLAYER_RGB_COLOUR\0"
+		"SET_CHAR_DECISION_MAKER_TO_DEFAULT\0"
+		"WARP_CHAR_INTO_CAR\0"
+		"NETWORK_IS_TVT\0"
+		"SET_PED_MOTION_BLUR\0"
+		"INIT_DEBUG_WIDGETS\0"
+		"DISPLAY_NON_MINIGAME_HELP_MESSAGES\0"
+		"SET_DISABLE_PLAYER_SHOVE_ANIMATION\0"
+		"GET_NTH_CLOSEST_CAR_NODE\0"
+		"NETWORK_GET_HOST_LATENCY\0"
+		"GET_MINUTES_TO_TIME_OF_DAY\0"
+		"GET_CONTENTS_OF_TEXT_WIDGET\0"
+		"TASK_USE_NEAREST_SCENARIO_TO_POS\0"
+		"FREEZE_CHAR_POSITION_AND_DONT_LOAD_COLLISION\0"
+		"SET_MIN_MAX_PED_ACCURACY\0"
+		"SET_CAM_ROT\0"
+		"DISPLAY_TEXT_WITH_3_NUMBERS\0"
+		"GET_CHAR_GRAVITY\0"
+		"GET_FRONTEND_DESIGN_VALUE\0"
+		"SET_CAR_LIGHT_MULTIPLIER\0"
+		"CHEAT_HAPPENED_RECENTLY\0"
+		"SET_TEXT_RIGHT_JUSTIFY\0"
+		"GET_RANDOM_CAR_OF_TYPE_IN_AREA_NO_SAVE\0"
+		"SET_DRUNK_CAM\0"
+		"GET_SCRIPT_TASK_STATUS\0"
+		"SET_PED_STOP_CLONING\0"
+		"GENERATE_RANDOM_FLOAT_IN_RANGE\0"
+		"SET_CAR_ANIM_SPEED\0"
+		"GET_CHAR_WEAPON_IN_SLOT\0"
+		"GET_PED_PATH_WILL_AVOID_DYNAMIC_OBJECTS\0"
+		"ENABLE_FANCY_WATER\0"
+		"DONT_REMOVE_OBJECT\0"
+		"DOES_OBJECT_HAVE_THIS_MODEL\0"
+		"ADD_LINE_TO_CONVERSATION\0"
+		"GET_WEB_PAGE_LINK_HREF\0"
+		"SET_CHAR_NAME_DEBUG\0"
+		"GET_CAM_FAR_CLIP\0"
+		"NETWORK_END_SESSION\0"
+		"TASK_EXTEND_ROUTE\0"
+		"SET_TEXT_FONT\0"
+		"ADD_TEXT_WIDGET\0"
+		"NETWORK_SET_TALKER_FOCUS\0"
+		"FLUSH_SCENARIO_BLOCKING_AREAS\0"
+		"REQUEST_AMBIENT_AUDIO_BANK\0"
+		"TASK_PLAY_ANIM_WITH_FLAGS\0"
+		"GET_PED_OBJECT_IS_ATTACHED_TO\0"
+		"SET_GFWL_IS_RETURNING_TO_SINGLE_PLAYER\0"
+		"IS_NETWORK_GAME_PENDING\0"
+		"TIMERA\0"
+		"GET_HOST_MATCH_ON\0"
+		"USE_PLAYER_COLOUR_INSTEAD_OF_TEAM_COLOUR\0"
+		"ABSI\0"
+		"SEND_NM_MESSAGE\0"
+		"SET_ROOM_FOR_DUMMY_CHAR_BY_NAME\0"
+		"GET_NUM_OF_MODELS_KILLED_BY_PLAYER\0"
+		"CREATE_OBJECT_NO_OFFSET\0"
+		"IS_KEYBOARD_KEY_JUST_PRESSED\0"
+		"NETWORK_PLAYER_HAS_DIED_RECENTLY\0"
+		"IS_CHAR_SWIMMING\0"
+		"IS_ANY_PICKUP_AT_COORDS\0"
+		"GET_ROOT_CAM\0"
+		"GET_PED_STEERS_AROUND_OBJECTS\0"
+		"SET_CAR_HEADING\0"
+		"SET_RADAR_SCALE\0"
+		"SET_OVERRIDE_NO_SPRINTING_ON_PHONE_IN_MULTIPLAYER\0"
+		"ADD_FIRST_N_CHARACTERS_OF_STRING_TO_HTML_SCRIPT_OBJECT\0"
+		"TASK_FLUSH_ROUTE\0"
+		"CEIL\0"
+		"SWITCH_PED_TO_ANIMATED\0"
+		"SET_BLOCKING_OF_NON_TEMPORARY_EVENTS\0"
+		"PLAY_SOUND_FROM_VEHICLE\0"
+		"SECUROM_SPOT_CHECK4\0"
+		"FIND_NETWORK_KILLER_OF_PLAYER\0"
+		"GET_PAD_PITCH_ROLL\0"
+		"GET_CHAR_LAST_DAMAGE_BONE\0"
+		"NETWORK_RESULT_MATCHES_SEARCH_CRITERIA\0"
+		"ADD_STRING_WITH_THIS_TEXT_LABEL_TO_PREVIOUS_BRIEF\0"
+		"CREATE_EMERGENCY_SERVICES_CAR\0"
+		"SET_TEXT_BACKGROUND\0"
+		"SUPPRESS_CAR_MODEL\0"
+		"GET_CURRENT_BASIC_POLICE_CAR_MODEL\0"
+		"DRAW_SPHERE\0"
+		"SET_CAN_RESPRAY_CAR\0"
+		"PRINT_WITH_NUMBER\0"
+		"GET_LOCAL_PLAYER_MP_CASH\0"
+		"NETWORK_JOIN_GAME_PENDING\0"
+		"TASK_PICKUP_AND_CARRY_OBJECT\0"
+		"DELETE_CAR_GENERATOR\0"
+		"CHANGE_PLAYBACK_TO_USE_AI\0"
+		"SET_CHAR_PROOFS\0"
+		"CELL_CAM_IS_CHAR_VISIBLE_NO_FACE_CHECK\0"
+		"IS_MODEL_IN_CDIMAGE\0"
+		"SET_CHAR_MELEE_ACTION_FLAG0\0"
+		"REMOVE_NAVMESH_REQUIRED_REGION\0"
+		"NETWORK_IS_INVITEE_ONLINE\0"
+		"GET_CAR_DOOR_LOCK_STATUS\0"
+		"CREATE_USER_3D_MARKER\0"
+		"IS_PLACE_CAR_BOMB_ACTIVE\0"
+		"LOAD_SETTINGS\0"
+		"SWITCH_CAR_SIREN\0"
+		"AWARD_PLAYER_MISSION_RESPECT\0"
+		"ATTACH_CAR_TO_CAR_PHYSICALLY\0"
+		"RESET_CAM_INTERP_CUSTOM_SPEED_GRAPH\0"
+		"SET_ROCKET_LAUNCHER_FREEBIE_IN_HELI\0"
+		"SET_RICH_PRESENCE_TEMPLATELOBBY\0"
+		"LOOP_RACE_TRACK\0"
+		"IS_REPLAY_SAVING\0"
+		"ATTACH_PED_TO_OBJECT_PHYSICALLY\0"
+		"CREATE_GROUP\0"
+		"SET_CAR_ONLY_DAMAGED_BY_RELATIONSHIP_GROUP\0"
+		"START_STREAMING_REQUEST_LIST\0"
+		"VMAG2\0"
+		"TASK_DESTROY_CAR\0"
+		"REMOVE_IPL\0"
+		"IS_CLOSEST_OBJECT_OF_TYPE_SMASHED_OR_DAMAGED\0"
+		"FIX_AMBIENCE_ORIENTATION\0"
+		"LOCATE_CHAR_ON_FOOT_CAR_2D\0"
+		"ACTIVATE_SAVE_MENU\0"
+		"ATTACH_CAM_TO_PED\0"
+		"LOAD_WEB_PAGE\0"
+		"RESET_CAR_WHEELS\0"
+		"TRIGGER_POLICE_REPORT\0"
+		"DISABLE_HELI_CHASE_CAM_THIS_UPDATE\0"
+		"IS_PED_ATTACHED_TO_ANY_CAR\0"
+		"SET_PED_FALL_OFF_BIKES_WHEN_SHOT\0"
+		"GET_PROGRESS_PERCENTAGE\0"
+		"UNPAUSE_RADIO\0"
+		"CAN_BE_DESCRIBED_AS_A_CAR\0"
+		"GET_OBJECT_HEADING\0"
+		"MARK_CAR_AS_CONVOY_CAR\0"
+		"START_MOBILE_PHONE_CALL\0"
+		"IS_GAME_KEYBOARD_NAV_LEFT_PRESSED\0"
+		"GET_VEHICLE_FROM_NETWORK_ID\0"
+		"PRINT_HELP_FOREVER_WITH_TWO_NUMBERS\0"
+		"SET_PLANE_UNDERCARRIAGE_UP\0"
+		"SET_COLLECTABLE1_TOTAL\0"
+		"CLEAR_CUTSCENE\0"
+		"PREVIEW_RINGTONE\0"
+		"FLASH_WEAPON_ICON\0"
+		"SET_PED_EXISTS_ON_ALL_MACHINES\0"
+		"SET_CHAR_CAN_BE_SHOT_IN_VEHICLE\0"
+		"GET_CHAR_HEIGHT_ABOVE_GROUND\0"
+		"MUTE_GAMEWORLD_AND_POSITIONED_RADIO_FOR_TV\0"
+		"START_PED_MOBILE_RINGING\0"
+		"IS_PLAYER_BEING_ARRESTED\0"
+		"SET_FORCE_PLAYER_TO_ENTER_THROUGH_DIRECT_DOOR\0"
+		"TASK_CHAR_SLIDE_TO_COORD_AND_PLAY_ANIM\0"
+		"GET_HOST_ID\0"
+		"GET_OBJECT_FRAGMENT_DAMAGE_HEALTH\0"
+		"SET_TIME_ONE_DAY_FORWARD\0"
+		"PED_QUEUE_REJECT_PEDS_WITH_FLAG_TRUE\0"
+		"CONNECT_LODS\0"
+		"TASK_DRIVE_POINT_ROUTE_ADVANCED\0"
+		"IS_PED_RETREATING\0"
+		"IS_OBJECT_ON_FIRE\0"
+		"OPEN_DEBUG_FILE\0"
+		"IS_CAR_A_MISSION_CAR\0"
+		"SET_HELP_MESSAGE_BOX_SIZE_F\0"
+		"CLEAR_ROOM_FOR_VIEWPORT\0"
+		"SET_DO_NOT_SPAWN_PARKED_CARS_ON_TOP\0"
+		"SET_PLAYER_GROUP_RECRUITMENT\0"
+		"GET_OBJECT_FROM_NETWORK_ID\0"
+		"CAM_SEQUENCE_GET_PROGRESS\0"
+		"SET_HEADING_OF_CLOSEST_OBJECT_OF_TYPE\0"
+		"SELECT_WEAPONS_FOR_VEHICLE\0"
+		"DOES_CAR_HAVE_ROOF\0"
+		"IS_CAR_TOUCHING_CAR\0"
+		"GET_BLIP_INFO_ID_OBJECT_INDEX\0"
+		"IS_OBJECT_STATIC\0"
+		"TASK_SHIMMY_IN_DIRECTION\0"
+		"SPOT_CHECK8\0"
+		"IS_CHAR_IN_WATER\0"
+		"CHANGE_CHAR_SIT_IDLE_ANIM\0"
+		"GET_IS_PROJECTILE_TYPE_IN_AREA\0"
+		"GET_PLAYER_RANK_LEVEL_DURING_MP\0"
+		"GET_CHAR_EXTRACTED_VELOCITY\0"
+		"SET_CHAR_MONEY\0"
+		"SET_VEHICLE_EXPLODES_ON_HIGH_EXPLOSION_DAMAGE\0"
+		"DOES_PICKUP_EXIST\0"
+		"SET_VEHICLE_DEFORMATION_MULT\0"
+		"UNLOCK_LAZLOW_STATION\0"
+		"SET_RECORDING_TO_POINT_NEAREST_TO_COORS\0"
+		"IS_CHAR_HEALTH_GREATER\0"
+		"IS_THIS_MODEL_A_TRAIN\0"
+		"IS_NEXT_STATION_ALLOWED\0"
+		"SET_ROUTE\0"
+		"SET_CAR_EXISTS_ON_ALL_MACHINES\0"
+		"IS_PROJECTILE_IN_AREA\0"
+		"REMOVE_BLIP\0"
+		"GET_CHAR_WILL_TRY_TO_LEAVE_WATER\0"
+		"SET_ENABLE_RC_DETONATE_ON_CONTACT\0"
+		"SET_WIDESCREEN_FORMAT\0"
+		"GET_NETWORK_ID_FROM_PED\0"
+		"GET_CAM_FOV\0"
+		"IS_OBJECT_IN_WATER\0"
+		"TASK_LEAVE_CAR_IMMEDIATELY\0"
+		"IS_CHAR_TOUCHING_OBJECT_ON_FOOT\0"
+		"ALWAYS_USE_HEAD_ON_HORN_ANIM_WHEN_DEAD_IN_CAR\0"
+		"HAS_COLLISION_FOR_MODEL_LOADED\0"
+		"CHECK_NM_FEEDBACK\0"
+		"SET_MENU_ITEM_WITH_2_NUMBERS\0"
+		"CLEAR_SMALL_PRINTS\0"
+		"GET_LOCAL_GAMERLEVEL_FROM_PROFILESETTINGS\0"
+		"ADD_BLIP_FOR_CONTACT\0"
+		"GET_MAX_AMMO\0"
+		"REQUEST_STREAMED_TXD\0"
+		"ROUND\0"
+		"FREEZE_OBJECT_POSITION\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_TARGET_INJURED_REACTION\0"
+		"DRAW_SPRITE_WITH_FIXED_ROTATION\0"
+		"SET_MENU_COLUMN_ORIENTATION\0"
+		"STOP_VEHICLE_ALWAYS_RENDER\0"
+		"SWITCH_CAR_GENERATOR\0"
+		"DONT_SUPPRESS_PED_MODEL\0"
+		"EXPLODE_CAR_IN_CUTSCENE_SHAKE_AND_BIT\0"
+		"SET_CHAR_WILL_LEAVE_CAR_IN_COMBAT\0"
+		"IS_CHAR_IN_CAR\0"
+		"SET_KILLSTREAK\0"
+		"SET_PED_STEERS_AROUND_OBJECTS\0"
+		"IS_OBJECT_REASSIGNMENT_IN_PROGRESS\0"
+		"SET_CAR_MOTION_BLUR_EFFECT_BOAT\0"
+		"GET_DEBUG_CAM\0"
+		"TRIGGER_PTFX_ON_PED_BONE\0"
+		"IS_CHAR_IN_ANGLED_AREA_2D\0"
+		"DELETE_MISSION_TRAINS\0"
+		"GET_CHAR_MONEY\0"
+		"REGISTER_KILL_IN_MULTIPLAYER_GAME\0"
+		"IS_CHAR_MALE\0"
+		"GET_CURRENT_EPISODE\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_STANDING_STYLE\0"
+		"IS_CAM_HAPPY\0"
+		"PLAYER_WANTS_TO_JOIN_NETWORK_GAME\0"
+		"DELETE_MISSION_TRAIN\0"
+		"IS_WANTED_LEVEL_GREATER\0"
+		"SET_MESSAGES_WAITING\0"
+		"CREATE_MENU\0"
+		"DRAW_CURVED_WINDOW_TEXT\0"
+		"DECREMENT_INT_STAT\0"
+		"PRINT_STRING_WITH_TWO_LITERAL_STRINGS_NOW\0"
+		"GET_CUTSCENE_TIME\0"
+		"REGISTER_SAVE_HOUSE\0"
+		"HAS_OBJECT_BEEN_DAMAGED\0"
+		"SET_ONLINE_LAN\0"
+		"FIND_MAX_NUMBER_OF_GROUP_MEMBERS\0"
+		"SET_PED_MOBILE_RING_TYPE\0"
+		"CREATE_PICKUP\0"
+		"CLEAR_ANGLED_AREA_OF_CARS\0"
+		"POPULATE_NOW\0"
+		"SET_DOOR_STATE\0"
+		"DOES_GAME_CODE_WANT_TO_LEAVE_NETWORK_SESSION\0"
+		"GET_CAR_FORWARD_VECTOR\0"
+		"GET_VEHICLE_MODEL_FROM_INDEX\0"
+		"SET_PLAYER_FORCED_AIM\0"
+		"GET_CAMERA_FROM_NETWORK_ID\0"
+		"ENABLE_MAX_AMMO_CAP\0"
+		"SET_MOBILE_PHONE_ROTATION\0"
+		"ATTACH_OBJECT_TO_CAR\0"
+		"NETWORK_KICK_PLAYER\0"
+		"IS_XBOX360_VERSION\0"
+		"DISPLAY_TEXT_WITH_BLIP_NAME\0"
+		"IS_PC_USING_JOYPAD\0"
+		"SET_PLAYER_INVINCIBLE\0"
+		"IS_CAR_IN_AREA_2D\0"
+		"IS_CAM_PROPAGATING\0"
+		"SET_DECISION_MAKER_ATTRIBUTE_TEAMWORK\0"
+		"ADD_STRING_TO_HTML_SCRIPT_OBJECT\0"
+		"HAS_GAMER_CHANGED_NETWORK_MODEL_SETTINGS\0"
+		"GET_RADIO_NAME\0"
+		"NETWORK_IS_FIND_RESULT_UPDATED\0"
+		"CLEAR_SEQUENCE_TASK\0"
+		"CAN_CHAR_SEE_DEAD_CHAR\0"
+		"ATTACH_PARACHUTE_MODEL_TO_PLAYER\0"
+		"ADD_ADDITIONAL_POPULATION_MODEL\0"
+		"TASK_DIE\0"
+		"DISPLAY_TEXT_WITH_SUBSTRING_GIVEN_HASH_KEY\0"
+		"FORCE_WEATHER\0"
+		"SET_OBJECT_ALPHA\0"
+		"IS_PED_LOOKING_AT_PED\0"
+		"CHANGE_PLAYER_PHONE_MODEL\0"
+		"START_CREDITS\0"
+		"IS_CHAR_IN_AREA_2D\0"
+		"GET_NEAREST_CABLE_CAR\0"
+		"OVERRIDE_NUMBER_OF_PARKED_CARS\0"
+		"ASCII_INT_TO_STRING\0"
+		"ADD_FOLLOW_NAVMESH_TO_PHONE_TASK\0"
+		"DELETE_CAR\0"
+		"LOAD_CHAR_DECISION_MAKER\0"
+		"NETWORK_START_SESSION_PENDING\0"
+		"GET_TRAIN_CARRIAGE\0"
+		"GET_OFFSET_FROM_CAR_IN_WORLD_COORDS\0"
+		"PLAYER_IS_PISSED_OFF\0"
+		"IS_CHAR_IN_FLYING_VEHICLE\0"
+		"PAUSE_GAME\0"
+		"IS_POINT_OBSCURED_BY_A_MISSION_ENTITY\0"
+		"ALLOW_MULTIPLE_DRIVEBY_PICKUPS\0"
+		"SWITCH_RANDOM_BOATS\0"
+		"CLEAR_CHAR_SECONDARY_TASK\0"
+		"IS_BUTTON_PRESSED\0"
+		"SET_HOT_WEAPON_SWAP\0"
+		"ATTACH_PED_TO_CAR_PHYSICALLY\0"
+		"ATAN\0"
+		;
+	inline const char* const ms_aNamePools[] = { ms_sNamePool0, ms_sNamePool1 };
+
+	inline const tNativeInfo* Find(uint32_t nHash)
+	{
+		int32_t index = FindIndex(nHash);
+		return index < 0 ? nullptr : &ms_aNatives[index];
+	}
+
+	inline const char* GetName(const tNativeInfo& info) { return &ms_aNamePools[info.m_nNamePool][info.m_nNameOffset]; }
+
+	// nullptr for hashes that aren't natives
+	inline const char* GetName(uint32_t nHash)
+	{
+		auto info = Find(nHash);
+		return info ? GetName(*info) : nullptr;
+	}
+
+	// -1 if the hash isn't a native or the count isn't known
+	inline int32_t GetArgCount(uint32_t nHash)
+	{
+		auto info = Find(nHash);
+		return info && info->m_nArgs != UnknownArgs ? (int32_t)info->m_nArgs : -1;
+	}
+}
@@ -0,0 +1,215 @@
+// opt-in native call profiler, define IVSDK_NATIVE_PROFILER before including IVSDK.cpp to enable it
+// every thread that calls natives gets its own table so recording never takes a lock, WriteReport merges them
+#pragma once
+
+#ifdef IVSDK_NATIVE_PROFILER
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+#include "NativeNames.h"
+
+namespace NativeProfiler
+{
+	enum
+	{
+		TableSize = 4096,	// power of two, above the number of natives
+		NumBuckets = 32,	// log2 buckets of QPC ticks
+	};
+
+	struct tNativeStats
+	{
+		std::atomic<uint32_t> m_nHash;
+		std::atomic<uint32_t> m_nCalls;
+		std::atomic<uint64_t> m_nTotalTicks;
+		std::atomic<uint64_t> m_nMaxTicks;
+		std::atomic<uint32_t> m_aBuckets[NumBuckets];
+	};
+
+	// only the owning thread writes to a table, the atomics are there so the report can read it while the game runs
+	struct tThreadTable
+	{
+		tNativeStats m_aStats[TableSize];
+	};
+
+	inline std::mutex ms_TablesMutex;
+	inline std::vector<tThreadTable*> ms_aTables;
+	inline std::atomic<uint32_t> ms_nDropped{ 0 };	// calls that found their thread's table full
+
+	inline tThreadTable* GetThreadTable()
+	{
+		thread_local tThreadTable* pTable = nullptr;
+		if (!pTable)
+		{
+			pTable = new tThreadTable();
+			std::lock_guard<std::mutex> lock(ms_TablesMutex);
+			ms_aTables.push_back(pTable);
+		}
+		return pTable;
+	}
+
+	inline uint32_t GetBucket(uint64_t ticks)
+	{
+		uint32_t bucket = 0;
+		while (ticks > 1 && bucket < NumBuckets - 1)
+		{
+			ticks >>= 1;
+			bucket++;
+		}
+		return bucket;
+	}
+
+	inline void Record(uint32_t hash, uint64_t ticks)
+	{
+		tThreadTable* pTable = GetThreadTable();
+
+		// hash 0 marks an empty slot, no native uses it
+		// one pass over the table at most, a full table drops the call instead of probing forever
+		uint32_t slot = hash & (TableSize - 1);
+		for (uint32_t probe = 0; probe < TableSize; probe++)
+		{
+			tNativeStats& stats = pTable->m_aStats[slot];
+			uint32_t slotHash = stats.m_nHash.load(std::memory_order_relaxed);
+			if (slotHash == hash || slotHash == 0)
+			{
+				stats.m_nCalls.store(stats.m_nCalls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				stats.m_nTotalTicks.store(stats.m_nTotalTicks.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+				if (ticks > stats.m_nMaxTicks.load(std::memory_order_relaxed)) stats.m_nMaxTicks.store(ticks, std::memory_order_relaxed);
+				auto& bucket = stats.m_aBuckets[GetBucket(ticks)];
+				bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+				if (slotHash == 0) stats.m_nHash.store(hash, std::memory_order_release);
+				return;
+			}
+			slot = (slot + 1) & (TableSize - 1);
+		}
+		ms_nDropped.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	inline uint64_t GetTicks()
+	{
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		return counter.QuadPart;
+	}
+
+	struct ScopedCall
+	{
+		uint32_t m_nHash;
+		uint64_t m_nStart;
+
+		ScopedCall(uint32_t hash) : m_nHash(hash), m_nStart(GetTicks()) {}
+		~ScopedCall() { Record(m_nHash, GetTicks() - m_nStart); }
+	};
+
+	struct tReportEntry
+	{
+		uint32_t m_nHash;
+		uint64_t m_nCalls;
+		uint64_t m_nTotalTicks;
+		uint64_t m_nMaxTicks;
+		uint64_t m_aBuckets[NumBuckets];
+	};
+
+	// all threads merged, most expensive natives first
+	inline std::vector<tReportEntry> Collect()
+	{
+		std::vector<tReportEntry> entries;
+
+		std::lock_guard<std::mutex> lock(ms_TablesMutex);
+		for (auto pTable : ms_aTables)
+		{
+			for (auto& stats : pTable->m_aStats)
+			{
+				uint32_t hash = stats.m_nHash.load(std::memory_order_acquire);
+				if (hash == 0) continue;
+
+				auto it = std::find_if(entries.begin(), entries.end(), [hash](const tReportEntry& e) { return e.m_nHash == hash; });
+				if (it == entries.end())
+				{
+					entries.push_back({ hash });
+					it = entries.end() - 1;
+				}
+				it->m_nCalls += stats.m_nCalls.load(std::memory_order_relaxed);
+				it->m_nTotalTicks += stats.m_nTotalTicks.load(std::memory_order_relaxed);
+				uint64_t maxTicks = stats.m_nMaxTicks.load(std::memory_order_relaxed);
+				if (maxTicks > it->m_nMaxTicks) it->m_nMaxTicks = maxTicks;
+				for (int i = 0; i < NumBuckets; i++)
+				{
+					it->m_aBuckets[i] += stats.m_aBuckets[i].load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const tReportEntry& a, const tReportEntry& b) { return a.m_nTotalTicks > b.m_nTotalTicks; });
+		return entries;
+	}
+
+	// upper bound of the bucket the percentile falls into, in ticks
+	inline uint64_t GetPercentileTicks(const tReportEntry& entry, float percentile)
+	{
+		uint64_t target = (uint64_t)(entry.m_nCalls * percentile);
+		uint64_t count = 0;
+		for (int i = 0; i < NumBuckets; i++)
+		{
+			count += entry.m_aBuckets[i];
+			if (count > target)
+			{
+				uint64_t bound = (uint64_t)2 << i;
+				return bound < entry.m_nMaxTicks ? bound : entry.m_nMaxTicks;
+			}
+		}
+		return entry.m_nMaxTicks;
+	}
+
+	// times are written in microseconds
+	inline bool WriteReport(const char* sPath, bool bJson = false)
+	{
+		FILE* file = fopen(sPath, "w");
+		if (!file) return false;
+
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		double toMicroseconds = 1000000.0 / frequency.QuadPart;
+
+		auto entries = Collect();
+		uint32_t dropped = ms_nDropped.load(std::memory_order_relaxed);
+		if (bJson) fprintf(file, "[\n");
+		else fprintf(file, "hash,name,calls,total_us,avg_us,p50_us,p99_us,max_us\n");
+
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			auto& entry = entries[i];
+			double total = entry.m_nTotalTicks * toMicroseconds;
+			double avg = total / entry.m_nCalls;
+			double p50 = GetPercentileTicks(entry, 0.5f) * toMicroseconds;
+			double p99 = GetPercentileTicks(entry, 0.99f) * toMicroseconds;
+			double maxTime = entry.m_nMaxTicks * toMicroseconds;
+			const char* name = NativeNames::GetName(entry.m_nHash);
+			if (!name) name = "";
+
+			if (bJson)
+			{
+				fprintf(file, "\t{ \"hash\": \"0x%08X\", \"name\": \"%s\", \"calls\": %llu, \"total_us\": %.3f, \"avg_us\": %.3f, \"p50_us\": %.3f, \"p99_us\": %.3f, \"max_us\": %.3f }%s\n",
+					entry.m_nHash, name, entry.m_nCalls, total, avg, p50, p99, maxTime, i + 1 < entries.size() || dropped ? "," : "");
+			}
+			else
+			{
+				fprintf(file, "0x%08X,%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f\n", entry.m_nHash, name, entry.m_nCalls, total, avg, p50, p99, maxTime);
+			}
+		}
+
+		// calls that didn't fit in their thread's table go in as one row with only the count
+		if (dropped)
+		{
+			if (bJson) fprintf(file, "\t{ \"hash\": \"0x00000000\", \"name\": \"dropped\", \"calls\": %u }\n", dropped);
+			else fprintf(file, "0x00000000,dropped,%u,0,0,0,0,0\n", dropped);
+		}
+
+		if (bJson) fprintf(file, "]\n");
+		fclose(file);
+		return true;
+	}
+}
+#endif
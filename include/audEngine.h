@@ -4,7 +4,7 @@ public:
 
 	void LoadFromFile(char* path)
 	{
-		((void(__thiscall*)(audConfig*, char*))(AddressSetter::Get(0x8E4020, 0x3AC520)))(this, path);
+		((void(__thiscall*)(audConfig*, char*))(AddressSetter::Get<0x8E4020, 0x3AC520>()))(this, path);
 	}
 };
 
@@ -18,7 +18,7 @@ public:
 	// this is used after every category patch, but the parameter is 1 in ep2 and 0 in the rest
 	void SetUnknown(float unk1)
 	{
-		((void(__thiscall*)(audEngine*, float))(AddressSetter::Get(0x8DC360, 0x39CC60)))(this, unk1);
+		((void(__thiscall*)(audEngine*, float))(AddressSetter::Get<0x8DC360, 0x39CC60>()))(this, unk1);
 	}
 };
 
@@ -180,18 +180,18 @@ public:
 
 	static void Initialise()
 	{
-		((void(__cdecl*)())(AddressSetter::Get(0x571FC0, 0x7A2C10)))();
+		((void(__cdecl*)())(AddressSetter::Get<0x571FC0, 0x7A2C10>()))();
 	}
 	static void LoadHandlingData(char* sPath)
 	{
-		((void(__cdecl*)(char*))(AddressSetter::Get(0x571D60, 0x7A29B0)))(sPath);
+		((void(__cdecl*)(char*))(AddressSetter::Get<0x571D60, 0x7A29B0>()))(sPath);
 	}
 	static tHandlingData* GetHandlingData(int id)
 	{
-		return ((tHandlingData*(__cdecl*)(int))(AddressSetter::Get(0x5719C0, 0x7A2610)))(id);
+		return ((tHandlingData*(__cdecl*)(int))(AddressSetter::Get<0x5719C0, 0x7A2610>()))(id);
 	}
 	static int GetHandlingId(char* handlingName)
 	{
-		return ((int(__cdecl*)(char*))(AddressSetter::Get(0x571BF0, 0x7A2840)))(handlingName);
+		return ((int(__cdecl*)(char*))(AddressSetter::Get<0x571BF0, 0x7A2840>()))(handlingName);
 	}
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 namespace rage
 {
+	// devices are usually globals, so the vftables use the runtime Get, Get<> is 0 until DllMain has run
 	class fiDeviceLocal
 	{
 		uint32_t m_pVFTable = AddressSetter::Get(0x95A9BC, 0x9894C4);
@@ -17,17 +18,17 @@ namespace rage
 
 		uint32_t SetPath(char* path, bool bAbsolute)
 		{
-			return ((uint32_t(__thiscall*)(fiDevice*, char*, bool))(AddressSetter::Get(0x1B43F0, 0x6F7D0)))(this, path, bAbsolute);
+			return ((uint32_t(__thiscall*)(fiDevice*, char*, bool))(AddressSetter::Get<0x1B43F0, 0x6F7D0>()))(this, path, bAbsolute);
 		}
 
 		uint32_t SetMountPath(char* path)
 		{
-			return ((uint32_t(__thiscall*)(fiDevice*, const char*))(AddressSetter::Get(0x1B4480, 0x6F860)))(this, path);
+			return ((uint32_t(__thiscall*)(fiDevice*, const char*))(AddressSetter::Get<0x1B4480, 0x6F860>()))(this, path);
 		}
 
 		static bool Mount(char* path, fiDeviceLocal* device, bool bUnk1)
 		{
-			return ((char(__cdecl*)(const char*, fiDeviceLocal*, int))(AddressSetter::Get(0x1ABE20, 0x5DDA0)))(path, device, bUnk1);
+			return ((char(__cdecl*)(const char*, fiDeviceLocal*, int))(AddressSetter::Get<0x1ABE20, 0x5DDA0>()))(path, device, bUnk1);
 		}
 	};
 	VALIDATE_SIZE(fiDevice, 0x210);
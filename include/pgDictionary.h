@@ -6,7 +6,7 @@ namespace rage
 	public:
 		T* getEntryByKey(uint32_t nHash)
 		{
-			return ((T * (__thiscall*)(pgDictionary*, uint32_t))(AddressSetter::Get(0x24B60, 0x3A490)))(this, nHash);
+			return ((T * (__thiscall*)(pgDictionary*, uint32_t))(AddressSetter::Get<0x24B60, 0x3A490>()))(this, nHash);
 		}
 	};
 }
\ No newline at end of file
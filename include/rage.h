@@ -3,8 +3,143 @@ namespace rage
 {
 	HWND& g_pHWND = AddressSetter::GetRef<HWND>(0x1449DDC, 0x1352060);
 	IDirect3DDevice9*& g_pDirect3DDevice = AddressSetter::GetRef<IDirect3DDevice9*>(0x148AB48, 0x1345630);
+
+	// jenkins one-at-a-time, same as the game's: case insensitive, '\\' hashes as '/', and a string starting with a quote stops at the next one
+	constexpr char atHashFoldChar(char c)
+	{
+		return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : (c == '\\' ? '/' : c);
+	}
+
+	// hash without the final mix, feed the result back in as nInitValue to keep hashing more of the same string
+	constexpr uint32_t atPartialStringHash(const char* sString, uint32_t nInitValue = 0)
+	{
+		bool quoted = *sString == '"';
+		if (quoted) sString++;
+
+		uint32_t key = nInitValue;
+		for (; *sString && !(quoted && *sString == '"'); sString++)
+		{
+			key += (uint8_t)atHashFoldChar(*sString);
+			key += key << 10;
+			key ^= key >> 6;
+		}
+		return key;
+	}
+
+	constexpr uint32_t atFinalizeHash(uint32_t nPartialHash)
+	{
+		uint32_t key = nPartialHash;
+		key += key << 3;
+		key ^= key >> 11;
+		key += key << 15;
+		return key;
+	}
+
+	// works before the addresses are set up and at compile time
+	constexpr uint32_t atLiteralStringHash(const char* sString, uint32_t nExistingHash = 0)
+	{
+		return atFinalizeHash(atPartialStringHash(sString, nExistingHash));
+	}
+
+	// the game's version, only needed for the nExistingHash pointer form, everything else is hashed here
 	static uint32_t atStringHash(const char* sString, uint32_t* nExistingHash = nullptr)
 	{
-		return ((uint32_t(__cdecl*)(const char*, uint32_t*))(AddressSetter::Get(0x1B1C30, 0x5CF50)))(sString, nExistingHash);
+		if (!nExistingHash) return atLiteralStringHash(sString);
+
+		// this form still calls into the game every time, so it's no faster than before, atStringHashBatch doesn't cover it
+		// and it only works once the addresses are set up
+		return ((uint32_t(__cdecl*)(const char*, uint32_t*))(AddressSetter::Get<0x1B1C30, 0x5CF50>()))(sString, nExistingHash);
 	}
-}
\ No newline at end of file
+
+	// one character of 4 hashes at once, for atStringHashBatch
+	inline __m128i atHashStep(__m128i key, __m128i c, __m128i mask)
+	{
+		// atHashFoldChar, A-Z to lowercase and '\\' to '/'
+		__m128i upper = _mm_and_si128(_mm_cmpgt_epi32(c, _mm_set1_epi32('A' - 1)), _mm_cmplt_epi32(c, _mm_set1_epi32('Z' + 1)));
+		c = _mm_add_epi32(c, _mm_and_si128(upper, _mm_set1_epi32('a' - 'A')));
+		__m128i slash = _mm_cmpeq_epi32(c, _mm_set1_epi32('\\'));
+		c = _mm_sub_epi32(c, _mm_and_si128(slash, _mm_set1_epi32('\\' - '/')));
+
+		// finished lanes keep their key
+		__m128i k = _mm_add_epi32(key, c);
+		k = _mm_add_epi32(k, _mm_slli_epi32(k, 10));
+		k = _mm_xor_si128(k, _mm_srli_epi32(k, 6));
+		return _mm_or_si128(_mm_and_si128(mask, k), _mm_andnot_si128(mask, key));
+	}
+
+	inline __m128i atHashFinalize(__m128i key)
+	{
+		key = _mm_add_epi32(key, _mm_slli_epi32(key, 3));
+		key = _mm_xor_si128(key, _mm_srli_epi32(key, 11));
+		return _mm_add_epi32(key, _mm_slli_epi32(key, 15));
+	}
+
+	// hashes count strings 8 at a time for big name lists, two sse vectors of 4 lanes
+	// every step of the hash waits on the one before, so one vector alone is no faster than hashing the strings one by one
+	// the strings are interleaved into a zero padded buffer first so every step is one 4 byte load per vector, no per lane end checks
+	inline void atStringHashBatch(const char* const* aStrings, uint32_t count, uint32_t* aOut)
+	{
+		const uint32_t MaxInterleaved = 64;
+		alignas(16) uint8_t interleaved[MaxInterleaved * 8];
+
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const char* str[8];
+			int32_t length[8];
+			int32_t maxLength = 0;
+			for (uint32_t j = 0; j < 8; j++)
+			{
+				const char* s = aStrings[i + j];
+				if (*s == '"')
+				{
+					s++;
+					const char* end = strchr(s, '"');
+					length[j] = (int32_t)(end ? end - s : strlen(s));
+				}
+				else length[j] = (int32_t)strlen(s);
+				str[j] = s;
+				if (length[j] > maxLength) maxLength = length[j];
+			}
+
+			// the odd long name goes the normal way
+			if (maxLength > (int32_t)MaxInterleaved)
+			{
+				for (uint32_t j = 0; j < 8; j++) aOut[i + j] = atLiteralStringHash(aStrings[i + j]);
+				continue;
+			}
+
+			memset(interleaved, 0, maxLength * 8);
+			for (uint32_t j = 0; j < 8; j++)
+			{
+				for (int32_t n = 0; n < length[j]; n++) interleaved[n * 8 + j] = (uint8_t)str[j][n];
+			}
+
+			const __m128i zero = _mm_setzero_si128();
+			__m128i lengthsA = _mm_loadu_si128((__m128i*)&length[0]);
+			__m128i lengthsB = _mm_loadu_si128((__m128i*)&length[4]);
+			__m128i keyA = zero, keyB = zero;
+			for (int32_t n = 0; n < maxLength; n++)
+			{
+				__m128i c = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)&interleaved[n * 8]), zero);
+				__m128i step = _mm_set1_epi32(n);
+				keyA = atHashStep(keyA, _mm_unpacklo_epi16(c, zero), _mm_cmpgt_epi32(lengthsA, step));
+				keyB = atHashStep(keyB, _mm_unpackhi_epi16(c, zero), _mm_cmpgt_epi32(lengthsB, step));
+			}
+			_mm_storeu_si128((__m128i*)&aOut[i], atHashFinalize(keyA));
+			_mm_storeu_si128((__m128i*)&aOut[i + 4], atHashFinalize(keyB));
+		}
+		for (; i < count; i++)
+		{
+			aOut[i] = atLiteralStringHash(aStrings[i]);
+		}
+	}
+}
+
+// "rom"_joaat == rage::atStringHash("rom"), evaluated at compile time
+constexpr uint32_t operator""_joaat(const char* sString, size_t)
+{
+	return rage::atLiteralStringHash(sString);
+}
+static_assert("player"_joaat == 0x6F0783F5, "atLiteralStringHash doesn't match the game");
+static_assert("M_Y_MULTIPLAYER"_joaat == 0x879495E2, "atLiteralStringHash doesn't match the game");
\ No newline at end of file
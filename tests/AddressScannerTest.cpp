@@ -0,0 +1,203 @@
+// pattern parsing, Find on synthetic buffers and the cache file round trip with truncated and corrupt files,
+// then Find against a plain byte by byte scan over something the size of the game's code section
+#include "Test.h"
+#include "AddressScanner.h"
+#include <vector>
+
+using namespace AddressScanner;
+
+const char* gPath = "AddressScannerTest.bin";
+
+// what Find would be without the anchor prefilter
+const uint8_t* NaiveFind(const uint8_t* pData, size_t nSize, const tPattern& pattern)
+{
+	if (nSize < pattern.m_nLength) return nullptr;
+	for (size_t i = 0; i <= nSize - pattern.m_nLength; i++)
+	{
+		if (MatchAt(pData + i, pattern)) return pData + i;
+	}
+	return nullptr;
+}
+
+void TestParse()
+{
+	tPattern pattern;
+	CHECK(ParsePattern("8B 0D ? ? ?? ? 85 c9", pattern));
+	CHECK(pattern.m_nLength == 8);
+	CHECK(pattern.m_nAnchor == 0);
+	CHECK(pattern.m_aBytes[1] == 0x0D && pattern.m_aMask[1] == 0xFF);
+	CHECK(pattern.m_aMask[2] == 0 && pattern.m_aMask[4] == 0 && pattern.m_aMask[5] == 0);
+	CHECK(pattern.m_aBytes[7] == 0xC9);
+
+	// the anchor is the first byte that isn't a wildcard
+	CHECK(ParsePattern("? ?? E8", pattern));
+	CHECK(pattern.m_nLength == 3 && pattern.m_nAnchor == 2);
+
+	CHECK(!ParsePattern("", pattern));
+	CHECK(!ParsePattern("? ? ?", pattern));
+	CHECK(!ParsePattern("8G", pattern));
+	CHECK(!ParsePattern("8", pattern));
+
+	std::string longest;
+	for (uint32_t i = 0; i < MAX_PATTERN_LENGTH; i++) longest += "AA ";
+	CHECK(ParsePattern(longest.c_str(), pattern));
+	CHECK(!ParsePattern((longest + "BB").c_str(), pattern));
+}
+
+void TestFind()
+{
+	std::vector<uint8_t> data(4096);
+	for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)(i * 7 + 3);
+	tPattern pattern;
+
+	// wildcards match anything, the anchor byte shows up earlier without the rest of the pattern
+	const uint8_t code[] = { 0x8B, 0x0D, 0x11, 0x22, 0x33, 0x44, 0x85, 0xC9 };
+	memcpy(&data[1000], code, sizeof(code));
+	data[500] = 0x8B;
+	data[501] = 0x0D;
+	CHECK(ParsePattern("8B 0D ? ? ? ? 85 C9", pattern));
+	CHECK(Find(data.data(), data.size(), pattern) == &data[1000]);
+
+	// a leading wildcard moves the anchor but not the match
+	CHECK(ParsePattern("? 0D 11 ?? 33", pattern));
+	CHECK(Find(data.data(), data.size(), pattern) == &data[1000]);
+
+	// the very last bytes, past the last full 16 byte block
+	const uint8_t tail[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x42 };
+	for (size_t size : { 4096, 4095, 4081, 4080, 4079, 17, 16, 15, 5 })
+	{
+		std::vector<uint8_t> buffer(data.begin(), data.begin() + size);
+		memcpy(&buffer[size - sizeof(tail)], tail, sizeof(tail));
+		CHECK(ParsePattern("DE AD ? EF 42", pattern));
+		CHECK(Find(buffer.data(), size, pattern) == &buffer[size - sizeof(tail)]);
+		// one byte short of fitting
+		CHECK(Find(buffer.data(), size - 1, pattern) == nullptr);
+	}
+
+	// nothing to find, and a buffer smaller than the pattern
+	CHECK(ParsePattern("CC CC CC CC CC CC", pattern));
+	CHECK(Find(data.data(), data.size(), pattern) == nullptr);
+	CHECK(Find(data.data(), 3, pattern) == nullptr);
+	CHECK(Find(data.data(), 0, pattern) == nullptr);
+
+	// against the plain scan on random data with short patterns, so there are plenty of hits and near misses
+	srand(1);
+	std::vector<uint8_t> noise(2000);
+	uint32_t mismatches = 0;
+	for (uint32_t round = 0; round < 2000; round++)
+	{
+		for (auto& b : noise) b = (uint8_t)(rand() & 3);
+		char text[64];
+		snprintf(text, sizeof(text), "0%d ? 0%d 0%d", rand() & 3, rand() & 3, rand() & 3);
+		CHECK(ParsePattern(text, pattern));
+		size_t size = rand() % noise.size();
+		if (Find(noise.data(), size, pattern) != NaiveFind(noise.data(), size, pattern)) mismatches++;
+	}
+	CHECK(mismatches == 0);
+}
+
+void WriteBytes(const void* pData, size_t nSize)
+{
+	FILE* file = fopen(gPath, "wb");
+	fwrite(pData, 1, nSize, file);
+	fclose(file);
+}
+
+std::vector<uint8_t> ReadBytes()
+{
+	std::vector<uint8_t> bytes;
+	FILE* file = fopen(gPath, "rb");
+	int c;
+	while ((c = fgetc(file)) != EOF) bytes.push_back((uint8_t)c);
+	fclose(file);
+	return bytes;
+}
+
+void TestCache()
+{
+	tCache cache;
+	cache.m_nImageHash = 0x1234;
+	cache.m_nGameVersion = 2;
+	for (uint32_t i = 0; i < 10; i++) cache.Add(GetPatternKey("8B 0D", i), 0x1000 + i);
+	CHECK(cache.Save(gPath));
+
+	tCache loaded;
+	CHECK(loaded.Load(gPath, 0x1234));
+	CHECK(loaded.m_nGameVersion == 2 && loaded.m_aEntries.size() == 10);
+	uint32_t offset = 0;
+	CHECK(loaded.Find(GetPatternKey("8B 0D", 7), offset) && offset == 0x1007);
+	CHECK(!loaded.Find(GetPatternKey("8B 0D", 10), offset));
+	CHECK(!loaded.Find(GetPatternKey("8B 0E", 7), offset));
+
+	// another exe
+	tCache other;
+	CHECK(!other.Load(gPath, 0x1235));
+	CHECK(!other.Load("AddressScannerTestMissing.bin", 0x1234));
+
+	// cut anywhere, the header included
+	std::vector<uint8_t> bytes = ReadBytes();
+	uint32_t accepted = 0;
+	for (size_t size = 0; size < bytes.size(); size++)
+	{
+		WriteBytes(bytes.data(), size);
+		tCache truncated;
+		if (truncated.Load(gPath, 0x1234)) accepted++;
+		if (!truncated.m_aEntries.empty()) accepted++;
+	}
+	CHECK(accepted == 0);
+
+	// a count that doesn't match the size is never used to size anything, not even one that would fit in memory
+	for (uint32_t count : { 0u, 9u, 11u, 0x10000000u, 0xFFFFFFFFu })
+	{
+		std::vector<uint8_t> corrupt = bytes;
+		memcpy(&corrupt[offsetof(tCacheHeader, m_nNumEntries)], &count, sizeof(count));
+		WriteBytes(corrupt.data(), corrupt.size());
+		tCache bad;
+		CHECK(!bad.Load(gPath, 0x1234));
+		CHECK(bad.m_aEntries.empty());
+	}
+
+	// extra bytes on the end are wrong too
+	bytes.push_back(0);
+	WriteBytes(bytes.data(), bytes.size());
+	tCache trailing;
+	CHECK(!trailing.Load(gPath, 0x1234));
+
+	// an empty cache round trips
+	tCache empty;
+	empty.m_nImageHash = 0x99;
+	CHECK(empty.Save(gPath));
+	CHECK(loaded.Load(gPath, 0x99));
+	CHECK(loaded.m_aEntries.empty());
+	remove(gPath);
+}
+
+void Benchmark()
+{
+	// about the size of the game's .text, random code-ish bytes with the pattern at the very end
+	size_t size = IsQuickRun() ? (1 << 20) : (12 << 20);
+	std::vector<uint8_t> data(size);
+	srand(2);
+	for (auto& b : data) b = (uint8_t)rand();
+	const uint8_t code[] = { 0x8B, 0x0D, 0x11, 0x22, 0x33, 0x44, 0x85, 0xC9, 0x74, 0x05 };
+	memcpy(&data[size - sizeof(code)], code, sizeof(code));
+
+	tPattern pattern;
+	ParsePattern("8B 0D ? ? ? ? 85 C9 74 05", pattern);
+	CHECK(Find(data.data(), size, pattern) == NaiveFind(data.data(), size, pattern));
+
+	const uint8_t* found = nullptr;
+	double findNs = TimeNs(1, [&](uint32_t i) { found = Find(data.data(), size, pattern); });
+	double naiveNs = TimeNs(1, [&](uint32_t i) { found = NaiveFind(data.data(), size, pattern); });
+	DoNotOptimise(found);
+	printf("scanning %zu MB: Find %.2f ms, naive %.2f ms (%.1fx)\n", size >> 20, findNs / 1e6, naiveNs / 1e6, naiveNs / findNs);
+}
+
+int main()
+{
+	TestParse();
+	TestFind();
+	TestCache();
+	Benchmark();
+	return Finish("AddressScannerTest");
+}
@@ -0,0 +1,87 @@
+// Get<a, b>() against the runtime Get(a, b), both have to give the same address
+#include "HostSdk.h"
+
+using namespace AddressSetter;
+
+// a spread of pairs like the ones in the sdk headers
+#define LOOKUP(i) Get<0x1000 + i * 0x10, 0x2000 + i * 0x20>()
+#define RUNTIME(i) Get(0x1000 + i * 0x10, 0x2000 + i * 0x20)
+
+uint32_t TemplateLookup(uint32_t i)
+{
+	switch (i & 7)
+	{
+	case 0: return LOOKUP(0);
+	case 1: return LOOKUP(1);
+	case 2: return LOOKUP(2);
+	case 3: return LOOKUP(3);
+	case 4: return LOOKUP(4);
+	case 5: return LOOKUP(5);
+	case 6: return LOOKUP(6);
+	default: return LOOKUP(7);
+	}
+}
+
+uint32_t RuntimeLookup(uint32_t i)
+{
+	switch (i & 7)
+	{
+	case 0: return RUNTIME(0);
+	case 1: return RUNTIME(1);
+	case 2: return RUNTIME(2);
+	case 3: return RUNTIME(3);
+	case 4: return RUNTIME(4);
+	case 5: return RUNTIME(5);
+	case 6: return RUNTIME(6);
+	default: return RUNTIME(7);
+	}
+}
+
+int main()
+{
+	// Get<> doesn't init on its own, nothing is resolved before Init
+	CHECK(TemplateLookup(0) == 0);
+
+	// stands in for Init, the host has no exe to read a version from
+	gBaseAddress = 0x400000;
+	plugin::gameVer = plugin::VERSION_1080;
+	bAddressesRead = true;
+	for (uint32_t i = 1; i < gNumRegisteredAddresses; i++)
+	{
+		gResolvedAddresses[i] = Resolve(gAddressPairs[i].addr1070, gAddressPairs[i].addr1080);
+	}
+
+	CHECK(gNumRegisteredAddresses == 9);
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		CHECK(TemplateLookup(i) == RuntimeLookup(i));
+		CHECK(TemplateLookup(i) == 0x400000 + 0x2000 + i * 0x20);
+	}
+
+	// a full table hands out 0
+	uint32_t saved = gNumRegisteredAddresses;
+	gNumRegisteredAddresses = MAX_REGISTERED_ADDRESSES;
+#ifdef NDEBUG
+	CHECK(Register(1, 2) == 0);
+#endif
+	gNumRegisteredAddresses = saved;
+
+	// same again for a 1070 exe
+	plugin::gameVer = plugin::VERSION_1070;
+	for (uint32_t i = 1; i < gNumRegisteredAddresses; i++)
+	{
+		gResolvedAddresses[i] = Resolve(gAddressPairs[i].addr1070, gAddressPairs[i].addr1080);
+	}
+	CHECK(TemplateLookup(3) == 0x400000 + 0x1000 + 3 * 0x10);
+	CHECK(TemplateLookup(3) == RuntimeLookup(3));
+
+	uint32_t iterations = IsQuickRun() ? 100000 : 50000000;
+	uint32_t sum = 0;
+	double templateNs = TimeNs(iterations, [&](uint32_t i) { sum += TemplateLookup(i); });
+	double runtimeNs = TimeNs(iterations, [&](uint32_t i) { sum += RuntimeLookup(i); });
+	DoNotOptimise(sum);
+	printf("Get<a, b>()  %.2f ns/call\n", templateNs);
+	printf("Get(a, b)    %.2f ns/call\n", runtimeNs);
+
+	return Finish("AddressTableBench");
+}
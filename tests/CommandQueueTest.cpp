@@ -0,0 +1,298 @@
+// the command queue single threaded and with several producers, closures that throw, the budget against a fake clock,
+// then the cost per command, throughput with producers on other threads and post to run latency
+#include "Test.h"
+#include <atomic>
+#include <stdexcept>
+#include "CBoundedQueue.h"
+#include "CCommandQueue.h"
+
+// advances by gClockStep every time Drain looks at it
+uint64_t gClockNow = 0;
+uint64_t gClockStep = 0;
+uint64_t FakeClock()
+{
+	uint64_t now = gClockNow;
+	gClockNow += gClockStep;
+	return now;
+}
+
+// counts live copies so leaks and double destroys show up
+struct tTracked
+{
+	static inline int ms_nAlive = 0;
+	std::vector<int>* m_pLog;
+	int m_nValue;
+	uint8_t m_aPadding[64];		// too big for the cell, goes on the heap
+
+	tTracked(std::vector<int>* pLog, int nValue) : m_pLog(pLog), m_nValue(nValue) { ms_nAlive++; }
+	tTracked(const tTracked& rhs) : m_pLog(rhs.m_pLog), m_nValue(rhs.m_nValue) { ms_nAlive++; }
+	~tTracked() { ms_nAlive--; }
+	void operator()() const { m_pLog->push_back(m_nValue); }
+};
+
+// throws when copied once armed
+struct tThrowOnCopy
+{
+	static inline bool ms_bArmed = false;
+	tThrowOnCopy() {}
+	tThrowOnCopy(const tThrowOnCopy&) { if (ms_bArmed) throw 1; }
+	void operator()() const {}
+};
+
+void TestOrder()
+{
+	CCommandQueue queue(8);
+	queue.m_nBudgetMicroseconds = 0;
+	std::vector<int> log;
+	CHECK(queue.Drain() == 0);
+
+	for (int i = 0; i < 4; i++)
+	{
+		CHECK(queue.Post([&log, i]() { log.push_back(i); }));
+		CHECK(queue.Post(tTracked(&log, 100 + i)));
+	}
+	CHECK(queue.GetNumQueued() == 8);
+	CHECK(!queue.Post([&log]() { log.push_back(-1); }));
+	CHECK(queue.GetNumDropped() == 1);
+
+	CHECK(queue.Drain() == 8);
+	CHECK((log == std::vector<int>{ 0, 100, 1, 101, 2, 102, 3, 103 }));
+	CHECK(tTracked::ms_nAlive == 0);
+
+	// a full lap later the same cells still work
+	log.clear();
+	for (int round = 0; round < 20; round++)
+	{
+		CHECK(queue.Post([&log, round]() { log.push_back(round); }));
+		CHECK(queue.Drain() == 1);
+	}
+	CHECK(log.size() == 20 && log.back() == 19);
+}
+
+void TestDestructor()
+{
+	std::vector<int> log;
+	{
+		CCommandQueue queue(8);
+		queue.Post(tTracked(&log, 1));
+		queue.Post(tTracked(&log, 2));
+		CHECK(tTracked::ms_nAlive == 2);
+	}
+	CHECK(tTracked::ms_nAlive == 0);
+	CHECK(log.empty());
+}
+
+void TestExceptions()
+{
+	CCommandQueue queue(4);
+	queue.m_nBudgetMicroseconds = 0;
+	std::vector<int> log;
+
+	// the throwing command is destroyed, its cell freed and counted, the ones after it still run in the same Drain
+	queue.Post(tTracked(&log, 1));
+	queue.Post([]() { throw 5; });
+	queue.Post(tTracked(&log, 2));
+	queue.Post([]() { throw std::runtime_error("bad"); });
+	CHECK(queue.Drain() == 4);
+	CHECK(queue.GetNumQueued() == 0);
+	CHECK(queue.GetNumFailed() == 2);
+	CHECK((log == std::vector<int>{ 1, 2 }));
+	CHECK(tTracked::ms_nAlive == 0);
+
+	// every cell goes round again, nothing is stuck on the one that threw
+	for (int i = 0; i < 4; i++) CHECK(queue.Post(tTracked(&log, 10 + i)));
+	CHECK(queue.Drain() == 4);
+	CHECK(log.size() == 6);
+	CHECK(queue.GetNumFailed() == 2);
+
+	// a copy that throws comes out of Post and leaves an empty command that Drain gets past
+	tThrowOnCopy fn;
+	tThrowOnCopy::ms_bArmed = true;
+	bool caught = false;
+	try
+	{
+		queue.Post(fn);
+	}
+	catch (int)
+	{
+		caught = true;
+	}
+	tThrowOnCopy::ms_bArmed = false;
+	CHECK(caught);
+	queue.Post(tTracked(&log, 20));
+	CHECK(queue.Drain() == 2);
+	CHECK(log.back() == 20);
+	CHECK(tTracked::ms_nAlive == 0);
+}
+
+void TestBudget()
+{
+	CCommandQueue queue(64, FakeClock);
+	queue.m_nBudgetMicroseconds = 250;
+	int ran = 0;
+	for (int i = 0; i < 10; i++) queue.Post([&ran]() { ran++; });
+
+	// start at 0, then 100, 200 and 300 after each command, 300 is past the end so three run
+	gClockNow = 0;
+	gClockStep = 100;
+	CHECK(queue.Drain() == 3);
+	CHECK(ran == 3);
+
+	// a budget smaller than one step still runs one
+	queue.m_nBudgetMicroseconds = 1;
+	CHECK(queue.Drain() == 1);
+
+	// a clock that doesn't move runs everything
+	gClockStep = 0;
+	queue.m_nBudgetMicroseconds = 250;
+	CHECK(queue.Drain() == 6);
+	CHECK(ran == 10);
+	CHECK(queue.Drain() == 0);
+}
+
+void TestProducers()
+{
+	const uint32_t numProducers = 4;
+	const uint32_t perProducer = IsQuickRun() ? 20000 : 200000;
+	CCommandQueue queue(1024);
+	queue.m_nBudgetMicroseconds = 0;
+
+	// each producer's commands have to come out in the order it posted them
+	std::vector<uint32_t> last(numProducers, 0);
+	uint32_t outOfOrder = 0;
+	uint32_t ran = 0;
+	std::atomic<uint32_t> done{ 0 };
+
+	std::vector<std::thread> threads;
+	for (uint32_t p = 0; p < numProducers; p++)
+	{
+		threads.emplace_back([&, p]()
+		{
+			for (uint32_t i = 1; i <= perProducer; i++)
+			{
+				while (!queue.Post([&, p, i]()
+				{
+					if (last[p] + 1 != i) outOfOrder++;
+					last[p] = i;
+					ran++;
+				})) std::this_thread::yield();
+			}
+			done++;
+		});
+	}
+	while (done < numProducers || queue.GetNumQueued()) queue.Drain();
+	for (auto& thread : threads) thread.join();
+
+	CHECK(ran == numProducers * perProducer);
+	CHECK(outOfOrder == 0);
+}
+
+// what a command costs without any other thread involved, post then drain in batches of 64
+void BenchmarkSingleThread()
+{
+	CCommandQueue queue(64);
+	queue.m_nBudgetMicroseconds = 0;
+	uint32_t sum = 0;
+	std::vector<int> log;
+	log.reserve(64);
+
+	uint32_t iterations = IsQuickRun() ? 200 : 20000;
+	double inlineNs = TimeNs(iterations, [&](uint32_t i)
+	{
+		for (uint32_t j = 0; j < 64; j++) queue.Post([&sum, j]() { sum += j; });
+		queue.Drain();
+	});
+	double heapNs = TimeNs(iterations, [&](uint32_t i)
+	{
+		log.clear();
+		for (uint32_t j = 0; j < 64; j++) queue.Post(tTracked(&log, j));
+		queue.Drain();
+	});
+	DoNotOptimise(sum);
+	printf("post + run: inline %.1f ns, heap %.1f ns per command\n", inlineNs / 64, heapNs / 64);
+}
+
+// commands per second from n producers to one consumer, everyone yields when the queue is full or empty
+void BenchmarkThroughput(uint32_t numProducers)
+{
+	const uint32_t perProducer = IsQuickRun() ? 20000 : 1000000;
+	CCommandQueue queue(4096);
+	queue.m_nBudgetMicroseconds = 0;
+
+	uint32_t ran = 0;
+	std::atomic<uint32_t> done{ 0 };
+	std::atomic<bool> go{ false };
+	std::vector<std::thread> threads;
+	for (uint32_t p = 0; p < numProducers; p++)
+	{
+		threads.emplace_back([&]()
+		{
+			while (!go) std::this_thread::yield();
+			for (uint32_t i = 0; i < perProducer; i++)
+			{
+				while (!queue.Post([&ran]() { ran++; })) std::this_thread::yield();
+			}
+			done++;
+		});
+	}
+
+	uint64_t start = GetHostNanoseconds();
+	go = true;
+	while (done < numProducers || queue.GetNumQueued())
+	{
+		if (!queue.Drain()) std::this_thread::yield();
+	}
+	uint64_t elapsed = GetHostNanoseconds() - start;
+	for (auto& thread : threads) thread.join();
+
+	CHECK(ran == numProducers * perProducer);
+	printf("%u producer%s: %.1f M commands/s\n", numProducers, numProducers == 1 ? "" : "s", ran * 1000.0 / elapsed);
+}
+
+// one command at a time from another thread, the time from Post to it running with a consumer that's polling
+void BenchmarkLatency()
+{
+	const uint32_t count = IsQuickRun() ? 2000 : 100000;
+	CCommandQueue queue(64);
+	queue.m_nBudgetMicroseconds = 0;
+
+	std::vector<uint32_t> latencies;
+	latencies.reserve(count);
+	std::atomic<uint32_t> ran{ 0 };
+	std::thread producer([&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint64_t posted = GetHostNanoseconds();
+			queue.Post([&, posted]()
+			{
+				latencies.push_back((uint32_t)(GetHostNanoseconds() - posted));
+				ran.store(ran.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+			});
+			while (ran.load(std::memory_order_acquire) != i + 1) std::this_thread::yield();
+		}
+	});
+	while (ran.load(std::memory_order_acquire) != count)
+	{
+		if (!queue.Drain()) std::this_thread::yield();
+	}
+	producer.join();
+
+	std::sort(latencies.begin(), latencies.end());
+	auto percentile = [&](double p) { return latencies[(size_t)(p * (latencies.size() - 1))] / 1000.0; };
+	printf("post to run: p50 %.2f us, p99 %.2f us, max %.2f us (%u cores)\n", percentile(0.5), percentile(0.99), percentile(1.0), std::thread::hardware_concurrency());
+}
+
+int main()
+{
+	TestOrder();
+	TestDestructor();
+	TestExceptions();
+	TestBudget();
+	TestProducers();
+	BenchmarkSingleThread();
+	BenchmarkThroughput(1);
+	BenchmarkThroughput(4);
+	BenchmarkLatency();
+	return Finish("CommandQueueTest");
+}
@@ -0,0 +1,99 @@
+// ordering, handles, removal during dispatch, and dispatch cost for 1 to 1000 callbacks
+#include "Test.h"
+#include "EventDispatcher.h"
+
+std::vector<int> gOrder;
+EventDispatcher<int> gDispatcher;
+uint32_t gSelfHandle = 0;
+uint32_t gOtherHandle = 0;
+
+void First(int) { gOrder.push_back(1); }
+void Second(int) { gOrder.push_back(2); }
+void Third(int) { gOrder.push_back(3); }
+void Context(void* context, int value) { gOrder.push_back(*(int*)context + value); }
+
+void RemoveSelf(int)
+{
+	gOrder.push_back(10);
+	gDispatcher.Remove(gSelfHandle);
+}
+
+void RemoveOther(int)
+{
+	gOrder.push_back(20);
+	gDispatcher.Remove(gOtherHandle);
+}
+
+void AddAnother(int)
+{
+	gOrder.push_back(30);
+	gDispatcher.Add(First, 100);
+}
+
+void TestOrdering()
+{
+	EventDispatcher<int> dispatcher;
+	dispatcher.Add(Third, 5);
+	dispatcher.Add(First, -5);
+	dispatcher.Add(Second);
+	int base = 40;
+	uint32_t handle = dispatcher.Add(Context, &base);
+
+	gOrder.clear();
+	dispatcher.Run(2);
+	// equal priorities keep the order they were added in
+	CHECK((gOrder == std::vector<int>{ 1, 2, 42, 3 }));
+
+	CHECK(handle != 0);
+	CHECK(dispatcher.Remove(handle));
+	CHECK(!dispatcher.Remove(handle));
+	CHECK(dispatcher.Size() == 3);
+
+	dispatcher.Clear();
+	CHECK(dispatcher.Size() == 0);
+}
+
+void TestChangesDuringDispatch()
+{
+	gDispatcher.Clear();
+	gSelfHandle = gDispatcher.Add(RemoveSelf);
+	gDispatcher.Add(RemoveOther);
+	gOtherHandle = gDispatcher.Add(Second);
+	gDispatcher.Add(AddAnother);
+
+	// the run that made the changes still sees the array it started with
+	gOrder.clear();
+	gDispatcher.Run(0);
+	CHECK((gOrder == std::vector<int>{ 10, 20, 2, 30 }));
+
+	gOrder.clear();
+	gDispatcher.Run(0);
+	CHECK((gOrder == std::vector<int>{ 20, 30, 1 }));
+	CHECK(gDispatcher.Size() == 4);
+}
+
+uint32_t gCalls = 0;
+void Count(int value) { gCalls += value; }
+
+void Bench()
+{
+	printf("callbacks  ns/dispatch  ns/callback\n");
+	for (uint32_t n : { 1u, 10u, 100u, 1000u })
+	{
+		EventDispatcher<int> dispatcher;
+		for (uint32_t i = 0; i < n; i++) dispatcher.Add(Count, (int32_t)(i % 7));
+
+		uint32_t iterations = (IsQuickRun() ? 200000 : 20000000) / n;
+		double ns = TimeNs(iterations, [&](uint32_t) { dispatcher.Run(1); });
+		printf("%9u  %11.1f  %11.2f\n", n, ns, ns / n);
+	}
+	DoNotOptimise(gCalls);
+}
+
+int main()
+{
+	TestOrdering();
+	TestChangesDuringDispatch();
+	Bench();
+	return Finish("EventDispatcherTest");
+}
@@ -0,0 +1,377 @@
+// the frame tracer's rings: wrapping, the frame window and unmatched ends, then the json it writes, with names that need
+// escaping and from a writer thread, then what recording costs and how a flush splits between the copy and the write
+#define IVSDK_FRAME_TRACER
+#include "Test.h"
+#include "FrameTracer.h"
+#include <string>
+#include <vector>
+
+using namespace FrameTracer;
+
+const char* gPath = "FrameTracerTest.json";
+
+// just enough of a json parser to say whether the file is valid, every string it reads is kept decoded
+struct tJsonReader
+{
+	const char* m_pText;
+	std::vector<std::string> m_aStrings;
+
+	void SkipSpace()
+	{
+		while (*m_pText == ' ' || *m_pText == '\n' || *m_pText == '\r' || *m_pText == '\t') m_pText++;
+	}
+
+	bool String()
+	{
+		if (*m_pText++ != '"') return false;
+		std::string value;
+		while (*m_pText != '"')
+		{
+			uint8_t c = (uint8_t)*m_pText++;
+			if (c < 0x20) return false;
+			if (c != '\\')
+			{
+				value += (char)c;
+				continue;
+			}
+			switch (*m_pText++)
+			{
+			case '"': value += '"'; break;
+			case '\\': value += '\\'; break;
+			case '/': value += '/'; break;
+			case 'n': value += '\n'; break;
+			case 't': value += '\t'; break;
+			case 'r': value += '\r'; break;
+			case 'b': value += '\b'; break;
+			case 'f': value += '\f'; break;
+			case 'u':
+			{
+				char hex[5] = {};
+				for (int i = 0; i < 4; i++)
+				{
+					if (!isxdigit((uint8_t)m_pText[i])) return false;
+					hex[i] = m_pText[i];
+				}
+				m_pText += 4;
+				// the tracer only escapes control characters this way
+				value += (char)strtoul(hex, nullptr, 16);
+				break;
+			}
+			default: return false;
+			}
+		}
+		m_pText++;
+		m_aStrings.push_back(value);
+		return true;
+	}
+
+	bool Value()
+	{
+		SkipSpace();
+		char c = *m_pText;
+		if (c == '"') return String();
+		if (c == '{' || c == '[')
+		{
+			char close = c == '{' ? '}' : ']';
+			m_pText++;
+			SkipSpace();
+			if (*m_pText == close)
+			{
+				m_pText++;
+				return true;
+			}
+			while (true)
+			{
+				if (c == '{')
+				{
+					SkipSpace();
+					if (!String()) return false;
+					SkipSpace();
+					if (*m_pText++ != ':') return false;
+				}
+				if (!Value()) return false;
+				SkipSpace();
+				if (*m_pText == ',')
+				{
+					m_pText++;
+					continue;
+				}
+				return *m_pText++ == close;
+			}
+		}
+		if (c == '-' || isdigit((uint8_t)c))
+		{
+			char* end;
+			strtod(m_pText, &end);
+			if (end == m_pText) return false;
+			m_pText = end;
+			return true;
+		}
+		for (const char* literal : { "true", "false", "null" })
+		{
+			if (!strncmp(m_pText, literal, strlen(literal)))
+			{
+				m_pText += strlen(literal);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool Document()
+	{
+		if (!Value()) return false;
+		SkipSpace();
+		return *m_pText == 0;
+	}
+};
+
+std::string ReadFile(const char* sPath)
+{
+	std::string text;
+	if (FILE* file = fopen(sPath, "rb"))
+	{
+		char chunk[4096];
+		size_t size;
+		while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0) text.append(chunk, size);
+		fclose(file);
+	}
+	return text;
+}
+
+uint32_t Count(const std::string& text, const char* sWhat)
+{
+	uint32_t count = 0;
+	for (size_t pos = text.find(sWhat); pos != std::string::npos; pos = text.find(sWhat, pos + 1)) count++;
+	return count;
+}
+
+// the main thread's ring starts over, the other threads' rings are left alone
+void ResetRing()
+{
+	GetThreadBuffer()->m_nHead = 0;
+}
+
+const tSnapshot::tThread* FindThread(const tSnapshot& snapshot)
+{
+	for (auto& thread : snapshot.m_aThreads)
+	{
+		if (thread.m_nTid == GetThreadBuffer()->m_nIndex + 1) return &thread;
+	}
+	return nullptr;
+}
+
+void TestWraparound()
+{
+	ResetRing();
+	CHECK(FindThread(Snapshot(0))->m_aEvents.empty());
+
+	// a lap and a bit, the slot after the head could be half written so only EventsPerThread - 1 come back
+	uint32_t total = EventsPerThread + 100;
+	for (uint32_t i = 0; i < total; i++) RecordSpan("span", "test", i, i + 1);
+	auto snapshot = Snapshot(0);
+	auto& events = FindThread(snapshot)->m_aEvents;
+	CHECK(events.size() == EventsPerThread - 1);
+	CHECK(events.front().m_nTime == total - EventsPerThread + 1);
+	CHECK(events.back().m_nTime == total - 1);
+	uint32_t outOfOrder = 0;
+	for (size_t i = 1; i < events.size(); i++)
+	{
+		if (events[i].m_nTime != events[i - 1].m_nTime + 1) outOfOrder++;
+	}
+	CHECK(outOfOrder == 0);
+
+	// the copy wraps at the same place with the head anywhere
+	ResetRing();
+	for (uint32_t i = 0; i < EventsPerThread + EventsPerThread / 2 + 7; i++) RecordSpan("span", "test", i, i + 1);
+	CHECK(FindThread(Snapshot(0))->m_aEvents.back().m_nTime == EventsPerThread + EventsPerThread / 2 + 6);
+}
+
+void TestUnmatched()
+{
+	ResetRing();
+	End("lost");
+	Begin("outer");
+	Begin("inner");
+	End("inner");
+	End("outer");
+	End("extra");
+	Begin("open");
+
+	auto snapshot = Snapshot(0);
+	auto& events = FindThread(snapshot)->m_aEvents;
+	std::vector<std::string> names;
+	for (auto& event : events) names.push_back(std::string(event.m_nType == EVENT_BEGIN ? "B " : "E ") + event.m_sName);
+	// a begin without an end is fine, perfetto shows it running to the end of the trace
+	CHECK((names == std::vector<std::string>{ "B outer", "B inner", "E inner", "E outer", "B open" }));
+}
+
+void TestFrameWindow()
+{
+	ResetRing();
+	NextFrame();
+	RecordSpan("first", "test", GetTime(), GetTime());
+	NextFrame();
+	RecordSpan("second", "test", GetTime(), GetTime());
+	Begin("across");
+	NextFrame();
+	End("across");
+	RecordSpan("third", "test", GetTime(), GetTime());
+
+	auto names = [](uint32_t numFrames)
+	{
+		std::vector<std::string> names;
+		auto snapshot = Snapshot(numFrames);
+		for (auto& event : FindThread(snapshot)->m_aEvents)
+		{
+			if (event.m_nType != EVENT_FRAME) names.push_back(event.m_sName);
+		}
+		return names;
+	};
+	// the end of a scope that started before the window is dropped with it
+	CHECK((names(1) == std::vector<std::string>{ "third" }));
+	CHECK((names(2) == std::vector<std::string>{ "second", "across", "across", "third" }));
+	CHECK((names(3) == names(0)));
+	// further back than there have been frames is everything
+	CHECK((names(100000) == names(0)));
+}
+
+void TestEscaping()
+{
+	ResetRing();
+	const char* threadName = "main \"thread\" C:\\ivsdk\\";
+	const char* eventName = "say \"hi\"\n\tand \\ leave";
+	const char* category = "cat\\\"egory\x01";
+	SetThreadName(threadName);
+	RecordSpan(eventName, category, 1000, 3000);
+	Begin(eventName, 5);
+	End(eventName);
+
+	CHECK(Flush(gPath, 0));
+	std::string text = ReadFile(gPath);
+	tJsonReader reader{ text.c_str() };
+	CHECK(reader.Document());
+
+	auto found = [&](const char* sString)
+	{
+		for (auto& s : reader.m_aStrings)
+		{
+			if (s == sString) return true;
+		}
+		return false;
+	};
+	CHECK(found(threadName));
+	CHECK(found(eventName));
+	CHECK(found(category));
+	CHECK(Count(text, "\"ph\":\"X\"") == 1);
+	CHECK(Count(text, "\"dur\":2.000") == 1);
+	CHECK(Count(text, "\"ph\":\"B\"") == 1);
+	CHECK(Count(text, "\"ph\":\"E\"") == 1);
+	SetThreadName("main");
+}
+
+void TestThreads()
+{
+	ResetRing();
+	const uint32_t numThreads = 3;
+	const char* names[numThreads] = { "worker 0", "worker 1", "worker 2" };
+	std::vector<std::thread> threads;
+	for (uint32_t t = 0; t < numThreads; t++)
+	{
+		threads.emplace_back([&, t]()
+		{
+			SetThreadName(names[t]);
+			for (uint32_t i = 0; i <= t; i++)
+			{
+				IVSDK_TRACE_SCOPE("work", i);
+			}
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	// every thread that recorded something has its own ring and tid
+	auto snapshot = Snapshot(0);
+	uint32_t matched = 0;
+	for (auto& thread : snapshot.m_aThreads)
+	{
+		for (uint32_t t = 0; t < numThreads; t++)
+		{
+			if (thread.m_sName == names[t] && thread.m_aEvents.size() == (t + 1) * 2) matched++;
+		}
+	}
+	CHECK(matched == numThreads);
+
+	CHECK(Flush(gPath, 0));
+	std::string text = ReadFile(gPath);
+	tJsonReader reader{ text.c_str() };
+	CHECK(reader.Document());
+	CHECK(Count(text, "\"thread_name\"") >= numThreads + 1);
+	CHECK(Count(text, "\"name\":\"work\"") == 12);
+}
+
+void TestAsync()
+{
+	ResetRing();
+	for (uint32_t i = 0; i < 1000; i++) RecordSpan("async", "test", i * 10, i * 10 + 5);
+
+	remove(gPath);
+	CHECK(FlushAsync(gPath, 0));
+	// anything recorded after FlushAsync returns isn't in the file
+	RecordSpan("late", "test", 20000, 20001);
+	WaitForFlush(true);
+	CHECK(!ms_bWriting);
+	std::string text = ReadFile(gPath);
+	tJsonReader reader{ text.c_str() };
+	CHECK(reader.Document());
+	CHECK(Count(text, "\"name\":\"async\"") == 1000);
+	CHECK(Count(text, "\"name\":\"late\"") == 0);
+
+	// a second flush while one is still writing does nothing
+	CHECK(FlushAsync(gPath, 0));
+	if (ms_bWriting) CHECK(!FlushAsync("FrameTracerTestSkipped.json", 0));
+	// the unload path waits for the write and lets the thread go
+	WaitForFlush(false);
+	CHECK(!ms_bWriting && !ms_Writer.joinable());
+	text = ReadFile(gPath);
+	reader = tJsonReader{ text.c_str() };
+	CHECK(reader.Document());
+	CHECK(Count(text, "\"name\":\"late\"") == 1);
+	remove("FrameTracerTestSkipped.json");
+
+	// nothing in flight is fine too
+	WaitForFlush(true);
+	WaitForFlush(false);
+}
+
+void Benchmark()
+{
+	ResetRing();
+	uint32_t iterations = IsQuickRun() ? 20000 : 2000000;
+	double recordNs = TimeNs(iterations, [](uint32_t i) { Record("bench", EVENT_BEGIN, i); });
+	double spanNs = TimeNs(iterations, [](uint32_t i) { RecordSpan("bench", "bench", i, i + 100); });
+	printf("record: %.1f ns, span: %.1f ns\n", recordNs, spanNs);
+
+	// a full ring, the snapshot is what the game thread waits for now, the write used to be on top of it
+	ResetRing();
+	for (uint32_t i = 0; i < EventsPerThread; i++) RecordSpan("bench", "bench", i * 100, i * 100 + 50);
+	uint32_t flushes = IsQuickRun() ? 1 : 10;
+	double snapshotNs = TimeNs(flushes, [](uint32_t i) { DoNotOptimise(Snapshot(0)); });
+	tSnapshot snapshot = Snapshot(0);
+	double writeNs = TimeNs(flushes, [&](uint32_t i) { Write(snapshot, gPath); });
+	printf("flushing %u events: snapshot %.2f ms on the game thread, write %.2f ms on the writer\n",
+		EventsPerThread, snapshotNs / 1e6, writeNs / 1e6);
+	remove(gPath);
+}
+
+int main()
+{
+	SetThreadName("main");
+	TestWraparound();
+	TestUnmatched();
+	TestFrameWindow();
+	TestEscaping();
+	TestThreads();
+	TestAsync();
+	Benchmark();
+	return Finish("FrameTracerTest");
+}
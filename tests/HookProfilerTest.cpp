@@ -0,0 +1,167 @@
+// the hook profiler's histogram buckets and percentiles, then Record end to end and the spans it leaves in FrameTracer's ring
+#define IVSDK_HOOK_PROFILER
+#include "Test.h"
+#include "FrameTracer.h"
+#include "HookProfiler.h"
+
+using namespace HookProfiler;
+
+bool Close(double a, double b, double tolerance)
+{
+	return fabs(a - b) <= tolerance;
+}
+
+void TestBuckets()
+{
+	// exact below 8, then every bucket's limit covers it and the one before doesn't
+	for (uint32_t ticks = 0; ticks < 8; ticks++)
+	{
+		CHECK(GetBucket(ticks) == ticks);
+		CHECK(GetBucketLimit(ticks) == ticks);
+	}
+
+	uint32_t previous = 0;
+	uint32_t failures = 0;
+	auto check = [&](uint32_t ticks)
+	{
+		uint32_t bucket = GetBucket(ticks);
+		if (bucket >= NumBuckets) failures++;
+		else if (GetBucketLimit(bucket) < ticks) failures++;
+		else if (bucket > 0 && GetBucketLimit(bucket - 1) >= ticks) failures++;
+	};
+	for (uint32_t ticks = 0; ticks < 1 << 20; ticks++)
+	{
+		check(ticks);
+		uint32_t bucket = GetBucket(ticks);
+		if (bucket < previous) failures++;
+		previous = bucket;
+	}
+	for (uint32_t shift = 20; shift < 32; shift++)
+	{
+		uint32_t power = 1u << shift;
+		check(power - 1);
+		check(power);
+		check(power + 1);
+		check(power + power / 4);
+		check(power + power / 2 + 7);
+	}
+	check(UINT32_MAX);
+	CHECK(failures == 0);
+	CHECK(GetBucket(UINT32_MAX) < NumBuckets);
+	CHECK(GetBucketLimit(GetBucket(UINT32_MAX)) == UINT32_MAX);
+
+	// 4 buckets per power of 2, so a limit is never more than 25% over
+	for (uint32_t bucket = 8; bucket <= GetBucket(UINT32_MAX); bucket++)
+	{
+		uint64_t low = (uint64_t)GetBucketLimit(bucket - 1) + 1;
+		uint64_t high = GetBucketLimit(bucket);
+		CHECK(high >= low);
+		CHECK(high - low + 1 <= (low + 3) / 4);
+	}
+}
+
+void TestPercentiles()
+{
+	uint32_t buckets[NumBuckets] = {};
+	CHECK(GetPercentileTicks(buckets, 0, 0, 0.5f) == 0);
+
+	// 90 calls at 5 ticks and 10 at 1000
+	buckets[5] = 90;
+	buckets[GetBucket(1000)] = 10;
+	CHECK(GetPercentileTicks(buckets, 100, 1000, 0.5f) == 5);
+	CHECK(GetPercentileTicks(buckets, 100, 1000, 0.89f) == 5);
+	CHECK(GetPercentileTicks(buckets, 100, 1000, 0.9f) == 1000);
+	CHECK(GetPercentileTicks(buckets, 100, 1000, 0.99f) == 1000);
+
+	// the bucket's limit is capped by the largest call actually seen
+	uint32_t limit = GetBucketLimit(GetBucket(1000));
+	CHECK(limit > 1000);
+	CHECK(GetPercentileTicks(buckets, 100, 5000, 0.99f) == limit);
+
+	// one call
+	uint32_t single[NumBuckets] = {};
+	single[GetBucket(123456)] = 1;
+	CHECK(GetPercentileTicks(single, 1, 123456, 0.5f) == 123456);
+	CHECK(GetPercentileTicks(single, 1, 123456, 0.99f) == 123456);
+}
+
+uint32_t CountSpans(const char* sName)
+{
+	uint32_t count = 0;
+	for (uint32_t b = 0; b < FrameTracer::ms_nNumBuffers; b++)
+	{
+		auto buffer = FrameTracer::ms_aBuffers[b];
+		uint32_t head = buffer->m_nHead;
+		for (uint32_t i = head > FrameTracer::EventsPerThread ? head - FrameTracer::EventsPerThread : 0; i != head; i++)
+		{
+			auto& event = buffer->m_aEvents[i & (FrameTracer::EventsPerThread - 1)];
+			if (event.m_nType == FrameTracer::EVENT_SPAN && event.m_sName == sName) count++;
+		}
+	}
+	return count;
+}
+
+void Callback() {}
+
+void TestRecord()
+{
+	tCallbackStats* stats = Register("testEvent", 7, (const void*)Callback, -3);
+	CHECK(stats->m_nHandle == 7 && stats->m_nPriority == -3);
+
+	// 500 calls of 2us and 10 of 300us, ticks are nanoseconds
+	uint64_t time = 1000000;
+	for (uint32_t i = 0; i < 500; i++, time += 10000) Record(*stats, time, time + 2000);
+	for (uint32_t i = 0; i < 10; i++, time += 10000) Record(*stats, time, time + 300000);
+
+	auto timings = GetTimings("testEvent");
+	CHECK(timings.size() == 1);
+	auto& t = timings[0];
+	CHECK(t.m_nCalls == 510);
+	CHECK(Close(t.m_fMax, 300.0, 0.001));
+	CHECK(Close(t.m_fLast, 300.0, 0.001));
+	CHECK(Close(t.m_fAverage, (500 * 2.0 + 10 * 300.0) / 510, 0.01));
+	// p50 is in 2000's bucket, p99 in 300000's capped by the max
+	CHECK(t.m_fP50 >= 2.0 && t.m_fP50 <= 2.5);
+	CHECK(Close(t.m_fP99, 300.0, 0.001));
+
+	// every call is a span in this thread's ring with the same start and duration
+	CHECK(CountSpans(stats->m_sName) == 510);
+	auto buffer = FrameTracer::GetThreadBuffer();
+	auto& last = buffer->m_aEvents[(buffer->m_nHead - 1) & (FrameTracer::EventsPerThread - 1)];
+	CHECK(last.m_nType == FrameTracer::EVENT_SPAN);
+	CHECK(last.m_nTime == time - 10000 && last.m_nArg == 300000);
+	CHECK(strcmp(last.m_sCategory, "testEvent") == 0);
+
+	// a few windows later the 300us calls are gone from the percentiles but not from the all time max
+	for (uint32_t i = 0; i < WindowCalls * 2; i++, time += 10000) Record(*stats, time, time + 4000);
+	t = GetTimings("testEvent")[0];
+	CHECK(t.m_fP99 >= 4.0 && t.m_fP99 <= 5.0);
+	CHECK(Close(t.m_fWindowMax, 4.0, 0.001));
+	CHECK(Close(t.m_fMax, 300.0, 0.001));
+
+	Unregister(stats);
+	CHECK(GetTimings("testEvent")[0].m_bRemoved);
+	Reset();
+	CHECK(GetTimings("testEvent")[0].m_nCalls == 0);
+}
+
+void Benchmark()
+{
+	tCallbackStats* stats = Register("benchEvent", 1, (const void*)Callback, 0);
+	uint32_t iterations = IsQuickRun() ? 20000 : 2000000;
+	double ns = TimeNs(iterations, [&](uint32_t i)
+	{
+		uint64_t start = GetTicks();
+		Record(*stats, start, GetTicks());
+	});
+	printf("timing one callback: %.1f ns\n", ns);
+}
+
+int main()
+{
+	TestBuckets();
+	TestPercentiles();
+	TestRecord();
+	Benchmark();
+	return Finish("HookProfilerTest");
+}
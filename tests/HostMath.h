@@ -0,0 +1,71 @@
+// the math headers in the order IVSDK.h includes them
+#pragma once
+#include "Test.h"
+#include "CVector.h"
+#include "CVector2D.h"
+#include "CQuaternion.h"
+#include "CMatrix.h"
+#include "CMatrixBatch.h"
+#include "CSimdVector.h"
+
+inline uint32_t gRandomState = 12345;
+
+// -1 to 1
+inline float RandomFloat()
+{
+	gRandomState = gRandomState * 1664525 + 1013904223;
+	return (float)(gRandomState >> 8) / (float)(1 << 23) - 1.0f;
+}
+
+inline CVector RandomVector(float scale = 1.0f)
+{
+	return CVector(RandomFloat() * scale, RandomFloat() * scale, RandomFloat() * scale);
+}
+
+inline CQuaternion RandomQuaternion()
+{
+	CQuaternion q = { RandomFloat(), RandomFloat(), RandomFloat(), RandomFloat() };
+	return q.Normalized();
+}
+
+// rotation, scale and translation, the w lanes get junk like the flags of a game matrix
+inline CMatrix RandomMatrix()
+{
+	CMatrix m = QuaternionToMatrix(RandomQuaternion());
+	float scale = 0.75f + RandomFloat() * 0.25f;
+	m.right = CVector_pad(m.right.x * scale, m.right.y * scale, m.right.z * scale);
+	m.at = CVector_pad(m.at.x * scale, m.at.y * scale, m.at.z * scale);
+	m.up = CVector_pad(m.up.x * scale, m.up.y * scale, m.up.z * scale);
+	CVector pos = RandomVector(1000.0f);
+	m.pos = CVector_pad(pos.x, pos.y, pos.z);
+	m.right.flags = 0x7FC00001;
+	m.at.flags = 0xFFFFFFFF;
+	m.up.flags = 0x12345678;
+	m.pos.flags = 0x7F800000;
+	return m;
+}
+
+inline bool Near(float a, float b, float tolerance)
+{
+	return fabsf(a - b) <= tolerance * (1.0f + fabsf(a) + fabsf(b));
+}
+
+inline bool Near(const CVector& a, const CVector& b, float tolerance)
+{
+	return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) && Near(a.z, b.z, tolerance);
+}
+
+// every level this cpu can run, the batch functions go through gSimdLevel
+inline std::vector<eSimdLevel> GetSimdLevels()
+{
+	std::vector<eSimdLevel> levels = { SIMD_SCALAR };
+	eSimdLevel detected = DetectSimdLevel();
+	if (detected >= SIMD_SSE) levels.push_back(SIMD_SSE);
+	if (detected >= SIMD_AVX) levels.push_back(SIMD_AVX);
+	return levels;
+}
+
+inline const char* GetSimdLevelName(eSimdLevel level)
+{
+	return level == SIMD_AVX ? "avx" : level == SIMD_SSE ? "sse" : "scalar";
+}
@@ -0,0 +1,13 @@
+// HostStubs.h plus the start of IVSDK.h, for tests of headers that reach for AddressSetter
+// nothing resolves against a real exe, tests that call Get set up gBaseAddress and plugin::gameVer themselves
+#pragma once
+#include "Test.h"
+
+namespace plugin
+{
+	enum eGameVersion { VERSION_NONE, VERSION_1070, VERSION_1080 };
+	eGameVersion gameVer = VERSION_NONE;
+}
+
+#include "AddressScanner.h"
+#include "NewAddressSet.h"
@@ -0,0 +1,147 @@
+// just enough of windows.h for the portable parts of the sdk to build on a linux host
+// nothing here talks to a game, the tests fill in whatever game state they need themselves
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <immintrin.h>
+
+#ifndef _WIN32
+typedef uint32_t DWORD;
+typedef unsigned int UINT;
+typedef int BOOL;
+typedef long LONG;
+typedef uint16_t WORD;
+typedef uint8_t BYTE;
+typedef BYTE* LPBYTE;
+typedef char* LPSTR;
+typedef char TCHAR;
+typedef const char* LPCTSTR;
+typedef void* HMODULE;
+#define VOID void
+#define FAR
+#define TEXT(s) s
+#define MAX_PATH 260
+#define __declspec(x)
+#define __forceinline inline
+#define _cdecl
+#define __cdecl
+#define __thiscall
+
+union LARGE_INTEGER
+{
+	long long QuadPart;
+};
+
+// nanoseconds, same as steady_clock
+inline BOOL QueryPerformanceCounter(LARGE_INTEGER* counter)
+{
+	counter->QuadPart = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	return 1;
+}
+inline BOOL QueryPerformanceFrequency(LARGE_INTEGER* frequency)
+{
+	frequency->QuadPart = 1000000000;
+	return 1;
+}
+
+inline unsigned char _BitScanForward(unsigned long* index, uint32_t mask)
+{
+	if (!mask) return 0;
+	*index = __builtin_ctz(mask);
+	return 1;
+}
+inline unsigned char _BitScanReverse(unsigned long* index, uint32_t mask)
+{
+	if (!mask) return 0;
+	*index = 31 - __builtin_clz(mask);
+	return 1;
+}
+
+inline DWORD GetCurrentThreadId()
+{
+	return (DWORD)std::hash<std::thread::id>()(std::this_thread::get_id());
+}
+inline short GetAsyncKeyState(int) { return 0; }
+inline void Sleep(DWORD ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+#define GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT 2
+#define GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS 4
+inline HMODULE GetModuleHandle(const char*) { return nullptr; }
+inline BOOL GetModuleHandleEx(DWORD, LPCTSTR, HMODULE* module) { *module = nullptr; return 0; }
+inline DWORD GetModuleFileName(HMODULE, char* path, DWORD size) { if (size) path[0] = '\0'; return 0; }
+inline DWORD GetModuleFileNameA(HMODULE module, char* path, DWORD size) { return GetModuleFileName(module, path, size); }
+
+// version resources, there's never one on the host
+struct VS_FIXEDFILEINFO
+{
+	DWORD dwSignature;
+	DWORD dwStrucVersion;
+	DWORD dwFileVersionMS;
+	DWORD dwFileVersionLS;
+};
+inline DWORD GetFileVersionInfoSize(const char*, DWORD*) { return 0; }
+inline BOOL GetFileVersionInfo(const char*, DWORD, DWORD, void*) { return 0; }
+inline BOOL VerQueryValue(const void*, const char*, void**, UINT*) { return 0; }
+
+// pe headers, only the fields the sdk reads
+struct IMAGE_DOS_HEADER
+{
+	WORD e_magic;
+	WORD e_unused[29];
+	LONG e_lfanew;
+};
+struct IMAGE_FILE_HEADER
+{
+	WORD Machine;
+	WORD NumberOfSections;
+	DWORD TimeDateStamp;
+	DWORD PointerToSymbolTable;
+	DWORD NumberOfSymbols;
+	WORD SizeOfOptionalHeader;
+	WORD Characteristics;
+};
+struct IMAGE_NT_HEADERS
+{
+	DWORD Signature;
+	IMAGE_FILE_HEADER FileHeader;
+	BYTE OptionalHeader[224];
+};
+struct IMAGE_SECTION_HEADER
+{
+	BYTE Name[8];
+	union
+	{
+		DWORD PhysicalAddress;
+		DWORD VirtualSize;
+	} Misc;
+	DWORD VirtualAddress;
+	DWORD SizeOfRawData;
+	DWORD PointerToRawData;
+	DWORD PointerToRelocations;
+	DWORD PointerToLinenumbers;
+	WORD NumberOfRelocations;
+	WORD NumberOfLinenumbers;
+	DWORD Characteristics;
+};
+#define IMAGE_SCN_CNT_CODE 0x00000020
+#define IMAGE_FIRST_SECTION(nt) ((IMAGE_SECTION_HEADER*)((uint8_t*)(nt) + sizeof(IMAGE_NT_HEADERS)))
+#endif
+
+// the part of IVSDK.h everything else expects, the layouts are the 32-bit game's so they aren't checked on a 64-bit host
+#ifndef VALIDATE_SIZE
+#define VALIDATE_SIZE(struc, size) static_assert(true, "")
+#define VALIDATE_OFFSET(struc, member, offset) static_assert(true, "")
+#endif
+
+// windows.h has these as macros
+using std::min;
+using std::max;
@@ -0,0 +1,44 @@
+// jobs run, Shutdown joins the workers, and the job system starts again afterwards
+#include "Test.h"
+#include "CJobSystem.h"
+
+void RunBatch(CJobSystem& jobs, uint32_t count)
+{
+	std::atomic<uint32_t> sum{ 0 };
+	CJobSystem::tJobCounter counter;
+	jobs.ParallelFor(count, 16, counter, [&sum](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; i++) sum.fetch_add(i, std::memory_order_relaxed);
+	});
+	jobs.Wait(counter);
+	CHECK(counter.IsDone());
+	CHECK(sum == count * (count - 1) / 2);
+}
+
+int main()
+{
+	// not started, everything runs on the calling thread
+	{
+		CJobSystem jobs;
+		RunBatch(jobs, 1000);
+	}
+
+	{
+		CJobSystem jobs;
+		jobs.Start(4);
+		CHECK(jobs.IsRunning());
+		RunBatch(jobs, 10000);
+		jobs.Shutdown();
+		CHECK(!jobs.IsRunning());
+
+		// after Shutdown Push runs jobs inline again
+		RunBatch(jobs, 100);
+
+		jobs.Start();
+		RunBatch(jobs, 10000);
+		jobs.Shutdown(false);
+		CHECK(!jobs.IsRunning());
+	}
+
+	return Finish("JobSystemTest");
+}
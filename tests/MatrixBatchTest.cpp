@@ -0,0 +1,121 @@
+// the batch transforms at every simd level against the scalar CMatrix.h functions, then how much faster they are
+#include "HostMath.h"
+
+const float Tolerance = 1e-5f;
+
+void TestTransforms(eSimdLevel level)
+{
+	gSimdLevel = level;
+	// odd sizes so every tail loop runs
+	for (uint32_t count : { 0u, 1u, 3u, 7u, 8u, 9u, 31u, 100u })
+	{
+		CMatrix m = RandomMatrix();
+		std::vector<CVector> in(count), out(count);
+		std::vector<CVector_pad> inPad(count), outPad(count);
+		std::vector<float> x(count), y(count), z(count), ox(count), oy(count), oz(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			in[i] = RandomVector(100.0f);
+			inPad[i] = CVector_pad(in[i], 0xABC00000 + i);
+			x[i] = in[i].x;
+			y[i] = in[i].y;
+			z[i] = in[i].z;
+		}
+
+		TransformPositions(m, in.data(), out.data(), count);
+		for (uint32_t i = 0; i < count; i++) CHECK(Near(out[i], TransformPosition(m, in[i]), Tolerance));
+		TransformVectors(m, in.data(), out.data(), count);
+		for (uint32_t i = 0; i < count; i++) CHECK(Near(out[i], TransformVector(m, in[i]), Tolerance));
+
+		TransformPositions(m, inPad.data(), outPad.data(), count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			CHECK(Near(outPad[i], TransformPosition(m, in[i]), Tolerance));
+			CHECK(outPad[i].flags == inPad[i].flags);
+		}
+		TransformVectors(m, inPad.data(), outPad.data(), count);
+		for (uint32_t i = 0; i < count; i++) CHECK(Near(outPad[i], TransformVector(m, in[i]), Tolerance));
+
+		TransformPositionsSoA(m, x.data(), y.data(), z.data(), ox.data(), oy.data(), oz.data(), count);
+		for (uint32_t i = 0; i < count; i++) CHECK(Near(CVector(ox[i], oy[i], oz[i]), TransformPosition(m, in[i]), Tolerance));
+		TransformVectorsSoA(m, x.data(), y.data(), z.data(), ox.data(), oy.data(), oz.data(), count);
+		for (uint32_t i = 0; i < count; i++) CHECK(Near(CVector(ox[i], oy[i], oz[i]), TransformVector(m, in[i]), Tolerance));
+
+		// in place
+		std::vector<CVector> inPlace = in;
+		TransformPositions(m, inPlace.data(), inPlace.data(), count);
+		for (uint32_t i = 0; i < count; i++) CHECK(Near(inPlace[i], TransformPosition(m, in[i]), Tolerance));
+
+		std::vector<CMatrix> a(count), b(count), product(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			a[i] = RandomMatrix();
+			b[i] = RandomMatrix();
+		}
+		MultiplyMatrices(a.data(), b.data(), product.data(), count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			CMatrix expected = MultiplyMatrix(a[i], b[i]);
+			CHECK(Near(product[i].right, expected.right, Tolerance));
+			CHECK(Near(product[i].at, expected.at, Tolerance));
+			CHECK(Near(product[i].up, expected.up, Tolerance));
+			CHECK(Near(product[i].pos, expected.pos, Tolerance));
+			// the masked flags can't turn into nans
+			CHECK(product[i].pos.flags == 0);
+		}
+	}
+}
+
+void Bench()
+{
+	const uint32_t count = 4096;
+	CMatrix m = RandomMatrix();
+	std::vector<CVector> in(count), out(count);
+	std::vector<CVector_pad> inPad(count), outPad(count);
+	std::vector<float> x(count), y(count), z(count), ox(count), oy(count), oz(count);
+	std::vector<CMatrix> a(count), b(count), product(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		in[i] = RandomVector(100.0f);
+		inPad[i] = CVector_pad(in[i]);
+		x[i] = in[i].x;
+		y[i] = in[i].y;
+		z[i] = in[i].z;
+		a[i] = RandomMatrix();
+		b[i] = RandomMatrix();
+	}
+
+	uint32_t iterations = IsQuickRun() ? 20 : 5000;
+	double scalarNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) out[i] = TransformPosition(m, in[i]);
+		DoNotOptimise(out[0]);
+	});
+	double scalarMulNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) product[i] = MultiplyMatrix(a[i], b[i]);
+		DoNotOptimise(product[0]);
+	});
+	printf("%u points, ns per point (matrices for multiply)\n", count);
+	printf("level    CVector  CVector_pad  SoA    multiply\n");
+	printf("loop     %7.2f  %11s  %5s  %8.2f\n", scalarNs / count, "", "", scalarMulNs / count);
+
+	for (eSimdLevel level : GetSimdLevels())
+	{
+		gSimdLevel = level;
+		double vectorNs = TimeNs(iterations, [&](uint32_t) { TransformPositions(m, in.data(), out.data(), count); DoNotOptimise(out[0]); });
+		double padNs = TimeNs(iterations, [&](uint32_t) { TransformPositions(m, inPad.data(), outPad.data(), count); DoNotOptimise(outPad[0]); });
+		double soaNs = TimeNs(iterations, [&](uint32_t) { TransformPositionsSoA(m, x.data(), y.data(), z.data(), ox.data(), oy.data(), oz.data(), count); DoNotOptimise(ox[0]); });
+		double mulNs = TimeNs(iterations, [&](uint32_t) { MultiplyMatrices(a.data(), b.data(), product.data(), count); DoNotOptimise(product[0]); });
+		printf("%-7s  %7.2f  %11.2f  %5.2f  %8.2f\n", GetSimdLevelName(level), vectorNs / count, padNs / count, soaNs / count, mulNs / count);
+	}
+	gSimdLevel = DetectSimdLevel();
+}
+
+int main()
+{
+	for (eSimdLevel level : GetSimdLevels()) TestTransforms(level);
+	gSimdLevel = DetectSimdLevel();
+	Bench();
+	return Finish("MatrixBatchTest");
+}
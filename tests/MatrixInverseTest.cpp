@@ -0,0 +1,303 @@
+// the affine, 4x4 and projection inverses give back the identity, the singular and badly scaled cases fail or don't the way
+// the relative determinant test says they should, and unprojecting what the screen projector projected gets the point back
+#include "HostMath.h"
+#include "CViewport.h"
+#include "CScreenProjector.h"
+
+const float Tolerance = 1e-5f;
+const float NearClip = 0.25f, FarClip = 1000.0f;
+
+CMatrix Identity()
+{
+	CMatrix m;
+	m.right = CVector_pad(1, 0, 0);
+	m.at = CVector_pad(0, 1, 0);
+	m.up = CVector_pad(0, 0, 1);
+	m.pos = CVector_pad(0, 0, 0);
+	return m;
+}
+
+CMatrix Scaled(const CMatrix& m, float scale)
+{
+	CMatrix out = m;
+	float* p = &out.right.x;
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		if ((i & 3) != 3) p[i] *= scale;
+	}
+	return out;
+}
+
+// largest element of the 3x3 part of a * b - identity, and of the translation relative to how far a moves things
+void AffineError(const CMatrix& a, const CMatrix& b, float& rotation, float& translation)
+{
+	CMatrix p = (CSimdMatrix(a) * CSimdMatrix(b)).ToMatrix();
+	CMatrix identity = Identity();
+	rotation = 0;
+	for (uint32_t row = 0; row < 3; row++)
+	{
+		const float* x = &(&p.right)[row].x;
+		const float* y = &(&identity.right)[row].x;
+		for (uint32_t i = 0; i < 3; i++) rotation = fmaxf(rotation, fabsf(x[i] - y[i]));
+	}
+	translation = ToVector(p.pos).Magnitude() / (1.0f + ToVector(a.pos).Magnitude() + ToVector(b.pos).Magnitude());
+}
+
+bool AffineInverts(const CMatrix& m)
+{
+	CMatrix inv;
+	if (!InverseMatrixAffine(m, inv)) return false;
+	float rotation, translation, rotation2, translation2;
+	AffineError(m, inv, rotation, translation);
+	AffineError(inv, m, rotation2, translation2);
+	return rotation < Tolerance && rotation2 < Tolerance && translation < Tolerance && translation2 < Tolerance
+		&& inv.right.flags == 0 && inv.at.flags == 0 && inv.up.flags == 0 && inv.pos.flags == 0;
+}
+
+// out has to come back exactly as it went in when the inverse fails
+template<typename F>
+bool FailsUntouched(F&& invert)
+{
+	CMatrix out;
+	memset(&out, 0xCD, sizeof(out));
+	CMatrix before = out;
+	return !invert(out) && !memcmp(&out, &before, sizeof(out));
+}
+
+void TestAffine()
+{
+	uint32_t failed = 0;
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		// scale and flags from RandomMatrix, plus some shear
+		CMatrix m = RandomMatrix();
+		float shear = RandomFloat() * 0.5f;
+		m.up = CVector_pad(m.up.x + m.right.x * shear, m.up.y + m.right.y * shear, m.up.z + m.right.z * shear, m.up.flags);
+		if (!AffineInverts(m)) failed++;
+
+		// points go there and back
+		CMatrix inv;
+		InverseMatrixAffine(m, inv);
+		CVector v = RandomVector(100.0f);
+		if (!Near(TransformPosition(inv, TransformPosition(m, v)), v, 1e-4f)) failed++;
+	}
+	CHECK(failed == 0);
+
+	// the threshold is relative, a uniformly small or large scale is as easy to invert as scale 1
+	// the old absolute 1e-12 threshold refused anything scaled by 1e-4 or less
+	for (float scale : { 1e-6f, 1e-5f, 1e-4f, 1e-2f, 1.0f, 1e2f, 1e4f })
+	{
+		CMatrix m = Scaled(QuaternionToMatrix(RandomQuaternion()), scale);
+		m.pos = CVector_pad(RandomVector(10.0f * scale));
+		CHECK(AffineInverts(m));
+	}
+
+	// while a nearly flat matrix fails whatever its determinant is
+	CMatrix flat = Identity();
+	flat.up = CVector_pad(1000, 1000, 1e-4f);
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseMatrixAffine(flat, out); }));
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseMatrixAffine(Scaled(flat, 1e4f), out); }));
+
+	// plain singular ones, and nan
+	CMatrix singular = RandomMatrix();
+	singular.up = singular.right;
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseMatrixAffine(singular, out); }));
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseMatrixAffine(Scaled(Identity(), 0), out); }));
+	CMatrix nan = Identity();
+	nan.at.y = NAN;
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseMatrixAffine(nan, out); }));
+}
+
+CMatrix RandomMatrix4x4()
+{
+	CMatrix m;
+	float* p = &m.right.x;
+	for (uint32_t i = 0; i < 16; i++) p[i] = RandomFloat() * 0.5f + (i % 5 == 0 ? 2.0f : 0.0f);
+	return m;
+}
+
+bool Inverts4x4(const CMatrix& m)
+{
+	CMatrix inv;
+	float error;
+	if (!InverseMatrix4x4(m, inv, &error)) return false;
+	// the other way round too, InverseError only checks m * inv
+	float error2 = CSimdMatrix::Load4x4(inv).InverseError(CSimdMatrix::Load4x4(m));
+	return error < Tolerance && error2 < Tolerance;
+}
+
+void Test4x4()
+{
+	uint32_t failed = 0;
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		if (!Inverts4x4(RandomMatrix4x4())) failed++;
+	}
+	CHECK(failed == 0);
+
+	for (float scale : { 1e-6f, 1e-3f, 1e3f })
+	{
+		CMatrix m = RandomMatrix4x4();
+		float* p = &m.right.x;
+		for (uint32_t i = 0; i < 16; i++) p[i] *= scale;
+		CHECK(Inverts4x4(m));
+	}
+
+	// the last row is the sum of the first two, all four lanes
+	CMatrix singular = RandomMatrix4x4();
+	float* rows = &singular.right.x;
+	for (uint32_t i = 0; i < 4; i++) rows[12 + i] = rows[i] + rows[4 + i];
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseMatrix4x4(singular, out); }));
+}
+
+// d3d right handed perspective like the game's viewport, cx and cy shift the centre for off axis projections
+CMatrix MakeProjection(float fov, float aspect, float cx = 0, float cy = 0)
+{
+	CMatrix m;
+	memset(&m, 0, sizeof(m));
+	float* p = &m.right.x;
+	p[5] = 1.0f / tanf(fov * 0.5f * 3.14159265f / 180.0f);
+	p[0] = p[5] / aspect;
+	p[8] = cx;
+	p[9] = cy;
+	p[10] = FarClip / (NearClip - FarClip);
+	p[11] = -1.0f;
+	p[14] = NearClip * FarClip / (NearClip - FarClip);
+	return m;
+}
+
+void TestProjection()
+{
+	for (CMatrix proj : { MakeProjection(70, 16.0f / 9.0f), MakeProjection(30, 4.0f / 3.0f), MakeProjection(90, 2.0f, 0.1f, -0.2f) })
+	{
+		CMatrix inv, general;
+		float error;
+		CHECK(InverseProjectionMatrix(proj, inv, &error));
+		CHECK(error < Tolerance);
+		CHECK(CSimdMatrix::Load4x4(inv).InverseError(CSimdMatrix::Load4x4(proj)) < Tolerance);
+
+		// the closed form agrees with the general inverse
+		CHECK(InverseMatrix4x4(proj, general));
+		const float* a = &inv.right.x;
+		const float* b = &general.right.x;
+		uint32_t differ = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			if (!Near(a[i], b[i], 1e-4f)) differ++;
+		}
+		CHECK(differ == 0);
+	}
+
+	// orthographic isn't the perspective shape, it goes through the general inverse
+	CMatrix ortho;
+	memset(&ortho, 0, sizeof(ortho));
+	float* p = &ortho.right.x;
+	p[0] = 2.0f / 1920.0f;
+	p[5] = 2.0f / 1080.0f;
+	p[10] = 1.0f / (NearClip - FarClip);
+	p[14] = NearClip / (NearClip - FarClip);
+	p[15] = 1.0f;
+	CMatrix inv;
+	float error;
+	CHECK(InverseProjectionMatrix(ortho, inv, &error));
+	CHECK(error < Tolerance);
+
+	// a zero field of view
+	CMatrix flat = MakeProjection(70, 1.0f);
+	flat.right.x = 0;
+	CHECK(FailsUntouched([&](CMatrix& out) { return InverseProjectionMatrix(flat, out); }));
+}
+
+tViewportData MakeViewport(uint32_t resX, uint32_t resY)
+{
+	static tViewportData data;
+	memset(&data, 0, sizeof(data));
+	data.m_nResX = resX;
+	data.m_nResY = resY;
+	data.m_fFOV = 70.0f;
+	data.m_fAspect = (float)resX / resY;
+	data.m_fNearClip = NearClip;
+	data.m_fFarClip = FarClip;
+	data.m_mProjectionMatrix = MakeProjection(data.m_fFOV, data.m_fAspect);
+	return data;
+}
+
+void TestUnproject()
+{
+	CMatrix cam = QuaternionToMatrix(RandomQuaternion());
+	CVector camPos(100, 200, 30);
+	cam.pos = CVector_pad(camPos);
+	tViewportData data = MakeViewport(1920, 1080);
+	CScreenProjector projector;
+	projector.SetViewport(data, CScreenProjector::BuildViewMatrix(cam));
+
+	CMatrix invViewProj;
+	CHECK(InverseMatrix4x4(projector.GetViewProjection(), invViewProj));
+
+	// the projector's pixels back to ndc, then back into the world
+	uint32_t visible = 0, failed = 0;
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		CVector point = camPos + RandomVector(300.0f);
+		CVector2D screen;
+		float depth;
+		if (projector.Project(point, screen, &depth) != PROJECT_VISIBLE) continue;
+		visible++;
+
+		float ndcX = screen.x / 1920.0f * 2.0f - 1.0f;
+		float ndcY = 1.0f - screen.y / 1080.0f * 2.0f;
+		CVector back;
+		if (!UnprojectPoint(invViewProj, ndcX, ndcY, depth, back))
+		{
+			failed++;
+			continue;
+		}
+		// depth gets flat quickly, a few float ulps of it are distance * distance / near clip * 6e-8 each
+		float distance = (point - camPos).Magnitude();
+		if ((back - point).Magnitude() > 4e-6f * distance * distance / NearClip + 1e-3f) failed++;
+	}
+	CHECK(visible > 100);
+	CHECK(failed == 0);
+
+	// the middle of the screen is straight down the camera's at, on the near and far planes
+	CVector nearPoint, farPoint;
+	CHECK(UnprojectPoint(invViewProj, 0, 0, 0, nearPoint));
+	CHECK(UnprojectPoint(invViewProj, 0, 0, 1, farPoint));
+	CHECK(Near(nearPoint, camPos + ToVector(cam.at) * NearClip, 1e-4f));
+	CHECK(Near(farPoint, camPos + ToVector(cam.at) * FarClip, 1e-3f));
+
+	// nothing comes back for w = 0
+	CMatrix zero;
+	memset(&zero, 0, sizeof(zero));
+	CVector unused;
+	CHECK(!UnprojectPoint(zero, 0, 0, 0.5f, unused));
+}
+
+void Benchmark()
+{
+	uint32_t count = IsQuickRun() ? 1000 : 100000;
+	std::vector<CMatrix> affine(count), full(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		affine[i] = RandomMatrix();
+		full[i] = RandomMatrix4x4();
+	}
+	CMatrix proj = MakeProjection(70, 16.0f / 9.0f);
+
+	CMatrix out;
+	double rigidNs = TimeNs(count, [&](uint32_t i) { out = InverseMatrix(affine[i]); DoNotOptimise(out); });
+	double affineNs = TimeNs(count, [&](uint32_t i) { InverseMatrixAffine(affine[i], out); DoNotOptimise(out); });
+	double fullNs = TimeNs(count, [&](uint32_t i) { InverseMatrix4x4(full[i], out); DoNotOptimise(out); });
+	double projNs = TimeNs(count, [&](uint32_t i) { InverseProjectionMatrix(proj, out); DoNotOptimise(out); });
+	printf("InverseMatrix %.2f ns, affine %.2f ns, 4x4 %.2f ns, projection %.2f ns\n", rigidNs, affineNs, fullNs, projNs);
+}
+
+int main()
+{
+	TestAffine();
+	Test4x4();
+	TestProjection();
+	TestUnproject();
+	Benchmark();
+	return Finish("MatrixInverseTest");
+}
@@ -0,0 +1,89 @@
+// NativeInvoke's function pointer cache against a stub resolver, the resolver only gets asked once per native
+#include "Test.h"
+#include "CVector.h"
+#include "CQuaternion.h"
+
+// stands in for the game's lookup, a binary search over the native hashes plus the call count
+uint32_t gNumResolves = 0;
+bool gResolveFails = false;
+uint32_t gNumCalls = 0;
+
+void StubNative(void* context)
+{
+	gNumCalls++;
+}
+
+struct CTheScripts
+{
+	static uint32_t FindNativeAddress(uint32_t nativeHash);
+};
+
+#include "Scripting/NativeInvoke.h"
+
+uint32_t CTheScripts::FindNativeAddress(uint32_t nativeHash)
+{
+	gNumResolves++;
+	if (gResolveFails) return 0;
+	if (!std::binary_search(NativeNames::ms_aHashes, NativeNames::ms_aHashes + NativeNames::NumNatives, nativeHash)) return 0;
+	// the test target is linked without pie so this fits
+	return (uint32_t)(uintptr_t)&StubNative;
+}
+
+void TestIndex()
+{
+	for (uint32_t i = 0; i < NativeNames::NumNatives; i++)
+	{
+		CHECK(NativeNames::FindIndex(NativeNames::ms_aHashes[i]) == (int32_t)i);
+	}
+	CHECK(NativeNames::FindIndex(0x12345678) == -1);
+	CHECK(NativeNames::FindIndex(NativeNames::ms_aHashes[0] + 1) == -1);
+}
+
+void TestCache()
+{
+	uint32_t hash = NativeNames::ms_aHashes[100];
+
+	// a failed lookup isn't cached
+	gResolveFails = true;
+	CHECK(NativeInvoke::Invoke<int>(hash) == 0);
+	gResolveFails = false;
+	gNumResolves = 0;
+	gNumCalls = 0;
+	for (int i = 0; i < 10; i++) NativeInvoke::Invoke<int>(hash, 1, 2.0f);
+	CHECK(gNumResolves == 1);
+	CHECK(gNumCalls == 10);
+
+	// hashes that aren't in NativeHashes.h resolve every time
+	gNumResolves = 0;
+	for (int i = 0; i < 3; i++) NativeInvoke::Invoke<int>(0x12345678u);
+	CHECK(gNumResolves == 3);
+
+	gNumResolves = 0;
+	CHECK(NativeInvoke::Preload(NativeNames::ms_aHashes, NativeNames::NumNatives) == NativeNames::NumNatives);
+	CHECK(gNumResolves == NativeNames::NumNatives - 1);
+}
+
+int main()
+{
+	TestIndex();
+	TestCache();
+
+	// every native once per pass, like a script walking lots of different natives
+	uint32_t iterations = IsQuickRun() ? 100000 : 20000000;
+	double cachedNs = TimeNs(iterations, [](uint32_t i)
+	{
+		NativeInvoke::Invoke<int>(NativeNames::ms_aHashes[i % NativeNames::NumNatives], 1, 2);
+	});
+	double resolveNs = TimeNs(iterations, [](uint32_t i)
+	{
+		NativeContext cxt;
+		cxt.PushArguments(1, 2);
+		auto func = (void(*)(void*))(uintptr_t)CTheScripts::FindNativeAddress(NativeNames::ms_aHashes[i % NativeNames::NumNatives]);
+		func(&cxt);
+	});
+	DoNotOptimise(gNumCalls);
+	printf("cached Invoke           %.2f ns/call\n", cachedNs);
+	printf("resolve on every call   %.2f ns/call (stub resolver)\n", resolveNs);
+
+	return Finish("NativeInvokeBench");
+}
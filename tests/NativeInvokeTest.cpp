@@ -0,0 +1,226 @@
+// what NativeInvoke hands a native: the argument slots, the unused bytes of narrow arguments, the argument count,
+// and that vector results are only copied back for calls that have a vector argument, then InvokeBatch's results and Preload
+#include "Test.h"
+#include "CVector.h"
+#include "CQuaternion.h"
+
+struct CTheScripts
+{
+	static uint32_t FindNativeAddress(uint32_t nativeHash);
+};
+
+#include "Scripting/NativeInvoke.h"
+
+// what the last call to the recording native saw
+uint32_t gArgs[NativeContext::MaxNativeParams];
+uint32_t gArgCount = 0;
+
+void RecordNative(IVNativeCallContext* pContext)
+{
+	memcpy(gArgs, pContext->m_pArgs, sizeof(gArgs));
+	gArgCount = pContext->m_nArgCount;
+	*(int*)pContext->m_pReturn = 42;
+}
+
+// the game fills m_pOriginalData with the vector pointers it was passed and writes the results to m_TemporaryData,
+// the stub points them at globals whatever it was passed so a copy back that shouldn't happen shows up
+CVector gVectorOut[2];
+
+void VectorNative(IVNativeCallContext* pContext)
+{
+	pContext->m_nDataCount = 2;
+	pContext->m_pOriginalData[0] = &gVectorOut[0];
+	pContext->m_pOriginalData[1] = &gVectorOut[1];
+	pContext->m_TemporaryData[0] = { 1, 2, 3, 4 };
+	pContext->m_TemporaryData[1] = { 5, 6, 7, 8 };
+	*(int*)pContext->m_pReturn = 7;
+}
+
+// handle * 10 + the other argument, then scribbles over every slot the way natives with several results do
+uint32_t gBatchCalls = 0;
+
+void BatchNative(IVNativeCallContext* pContext)
+{
+	gBatchCalls++;
+	int* slots = (int*)pContext->m_pArgs;
+	int result = slots[0] * 10 + slots[1];
+	for (uint32_t i = 0; i < NativeContext::MaxNativeParams; i++) slots[i] = -1;
+	*(int*)pContext->m_pReturn = pContext->m_nArgCount == 2 ? result : -1000;
+}
+
+const uint32_t RecordHash = NativeNames::ms_aHashes[0];
+const uint32_t VectorHash = NativeNames::ms_aHashes[1];
+const uint32_t BatchHash = NativeNames::ms_aHashes[2];
+const uint32_t MissingHash = NativeNames::ms_aHashes[3];
+
+uint32_t gNumResolves = 0;
+
+uint32_t CTheScripts::FindNativeAddress(uint32_t nativeHash)
+{
+	gNumResolves++;
+	// the test target is linked without pie so these fit
+	if (nativeHash == RecordHash) return (uint32_t)(uintptr_t)&RecordNative;
+	if (nativeHash == VectorHash) return (uint32_t)(uintptr_t)&VectorNative;
+	if (nativeHash == BatchHash) return (uint32_t)(uintptr_t)&BatchNative;
+	return 0;
+}
+
+uint32_t Bits(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+const uint32_t* Slots(NativeContext& cxt)
+{
+	return (const uint32_t*)cxt.m_pArgs;
+}
+
+void TestLayout()
+{
+	// one 4 byte slot per argument in order, whatever the type
+	memset(gArgs, 0, sizeof(gArgs));
+	CHECK(NativeInvoke::Invoke<int>(RecordHash, 1, -2, 3.5f, 0xDEADBEEFu) == 42);
+	CHECK(gArgCount == 4);
+	CHECK(gArgs[0] == 1 && gArgs[1] == 0xFFFFFFFE && gArgs[2] == Bits(3.5f) && gArgs[3] == 0xDEADBEEF);
+
+	// floats come back as floats, the return value shares the first slot
+	NativeContext cxt;
+	cxt.PushArguments(2.5f);
+	*(float*)cxt.m_pReturn = -0.75f;
+	CHECK(cxt.GetReturnValue<float>() == -0.75f);
+
+	// no arguments at all
+	CHECK(NativeInvoke::Invoke<int>(RecordHash) == 42);
+	CHECK(gArgCount == 0);
+
+	// all 16
+	NativeInvoke::Invoke<int>(RecordHash, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	CHECK(gArgCount == 16);
+	uint32_t wrong = 0;
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		if (gArgs[i] != i) wrong++;
+	}
+	CHECK(wrong == 0);
+}
+
+void TestZeroing()
+{
+	// a reused context, like InvokeBatch's, with every byte of every slot set
+	NativeContext cxt;
+	cxt.PushArguments(-1, -1, -1, -1, -1, -1);
+	CHECK(cxt.m_nArgCount == 6);
+
+	// narrow arguments clear the rest of their slot so the native reads the same value as a 4 byte load
+	cxt.PushArguments(true, (uint8_t)0xAB, (int8_t)-1, (int16_t)-2, (uint16_t)0x1234);
+	CHECK(cxt.m_nArgCount == 5);
+	const uint32_t* slots = Slots(cxt);
+	CHECK(slots[0] == 1);
+	CHECK(slots[1] == 0xAB);
+	CHECK(slots[2] == 0xFF);
+	CHECK(slots[3] == 0xFFFE);
+	CHECK(slots[4] == 0x1234);
+	// the slot after the last argument isn't the native's business, it's left as it was
+	CHECK(slots[5] == 0xFFFFFFFF);
+
+	// and the same through Push, which stops at 16
+	NativeContext pushed;
+	for (uint32_t i = 0; i < 16; i++) pushed.Push(-1);
+	pushed.m_nArgCount = 0;
+	pushed.Push(false);
+	pushed.Push((uint8_t)7);
+	CHECK(Slots(pushed)[0] == 0 && Slots(pushed)[1] == 7);
+	for (uint32_t i = 0; i < 20; i++) pushed.Push(i);
+	CHECK(pushed.m_nArgCount == 16);
+	CHECK(Slots(pushed)[15] == 13);
+}
+
+// pointers to scalars are plain out parameters, anything else is a vector the game copies through its temporary data
+static_assert(!NativeInvoke::HasVectorArgument<>);
+static_assert(!NativeInvoke::HasVectorArgument<int, float, unsigned int, bool>);
+static_assert(!NativeInvoke::HasVectorArgument<int*, float*, unsigned int*, const char*>);
+static_assert(NativeInvoke::HasVectorArgument<CVector*>);
+static_assert(NativeInvoke::HasVectorArgument<int, float*, CVector*>);
+static_assert(NativeInvoke::HasVectorArgument<CQuaternion*, int>);
+
+void TestCopyBack()
+{
+	// the host is 64-bit so a CVector* can't go through a 4 byte slot, the calls with vector arguments are checked
+	// through the trait above and the hand built context, which always copies back in GetResult
+	gVectorOut[0] = CVector(0, 0, 0);
+	gVectorOut[1] = CVector(0, 0, 0);
+	CHECK(NativeInvoke::Invoke<int>(VectorHash, 1, 2.0f) == 7);
+	CHECK(gVectorOut[0].x == 0 && gVectorOut[1].x == 0);
+
+	NativeContext cxt;
+	cxt.Push(1);
+	NativeInvoke::Invoke2(&cxt, VectorHash);
+	CHECK(cxt.GetResult<int>() == 7);
+	CHECK(cxt.m_nDataCount == 0);
+	CHECK(gVectorOut[0].x == 1 && gVectorOut[0].y == 2 && gVectorOut[0].z == 3);
+	CHECK(gVectorOut[1].x == 5 && gVectorOut[1].y == 6 && gVectorOut[1].z == 7);
+
+	// nothing left to copy the second time
+	gVectorOut[0] = CVector(0, 0, 0);
+	cxt.CopyBackVectors();
+	CHECK(gVectorOut[0].x == 0);
+}
+
+void TestBatch()
+{
+	// one result per handle, every call gets all of its arguments again after the last one scribbled over them
+	int handles[300];
+	int results[300];
+	for (int i = 0; i < 300; i++) handles[i] = i + 1;
+	memset(results, 0, sizeof(results));
+	gBatchCalls = 0;
+	CHECK(NativeInvoke::InvokeBatch<int>(BatchHash, handles, 300, results, 7));
+	CHECK(gBatchCalls == 300);
+	uint32_t wrong = 0;
+	for (int i = 0; i < 300; i++)
+	{
+		if (results[i] != handles[i] * 10 + 7) wrong++;
+	}
+	CHECK(wrong == 0);
+
+	// the results are optional, and an empty batch calls nothing
+	gBatchCalls = 0;
+	CHECK(NativeInvoke::InvokeBatch<int>(BatchHash, handles, 10, (int*)nullptr, 7));
+	CHECK(gBatchCalls == 10);
+	CHECK(NativeInvoke::InvokeBatch<int>(BatchHash, handles, 0, results, 7));
+	CHECK(gBatchCalls == 10);
+
+	// a native that doesn't resolve calls nothing and leaves the results alone
+	results[0] = 12345;
+	CHECK(!NativeInvoke::InvokeBatch<int>(MissingHash, handles, 300, results, 7));
+	CHECK(results[0] == 12345);
+
+	// the same as calling Invoke once per handle
+	int single = NativeInvoke::Invoke<int>(BatchHash, handles[5], 7);
+	CHECK(single == results[5]);
+}
+
+void TestPreload()
+{
+	// the first three were cached by the calls above and aren't looked up again, the failed ones are asked for every time
+	uint32_t hashes[] = { RecordHash, VectorHash, BatchHash, MissingHash, 0x12345678u };
+	gNumResolves = 0;
+	CHECK(NativeInvoke::Preload(hashes, 5) == 3);
+	CHECK(gNumResolves == 2);
+	gNumResolves = 0;
+	CHECK(NativeInvoke::Preload(hashes, 5) == 3);
+	CHECK(gNumResolves == 2);
+	CHECK(NativeInvoke::Preload(hashes, 0) == 0);
+}
+
+int main()
+{
+	TestLayout();
+	TestZeroing();
+	TestCopyBack();
+	TestBatch();
+	TestPreload();
+	return Finish("NativeInvokeTest");
+}
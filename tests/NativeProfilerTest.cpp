@@ -0,0 +1,79 @@
+// the native profiler's per-thread table: calls add up per hash, and a table with every slot taken drops new hashes
+// instead of probing forever, then the report with the dropped row
+#define IVSDK_NATIVE_PROFILER
+#include "Test.h"
+#include "Scripting/NativeProfiler.h"
+
+using namespace NativeProfiler;
+
+const tReportEntry* FindEntry(const std::vector<tReportEntry>& entries, uint32_t hash)
+{
+	for (auto& entry : entries)
+	{
+		if (entry.m_nHash == hash) return &entry;
+	}
+	return nullptr;
+}
+
+void TestRecord()
+{
+	// 0x1000 and 0x2000 land on the same slot and probe past each other
+	for (int i = 0; i < 10; i++) Record(0x1000, 8);
+	Record(0x2000, 1000);
+	Record(0x2000, 3);
+
+	auto entries = Collect();
+	auto a = FindEntry(entries, 0x1000);
+	auto b = FindEntry(entries, 0x2000);
+	CHECK(a && a->m_nCalls == 10 && a->m_nTotalTicks == 80 && a->m_nMaxTicks == 8);
+	CHECK(b && b->m_nCalls == 2 && b->m_nTotalTicks == 1003 && b->m_nMaxTicks == 1000);
+	// most expensive first
+	CHECK(entries[0].m_nHash == 0x2000);
+	CHECK(GetPercentileTicks(*a, 0.5f) == 8);
+	CHECK(ms_nDropped == 0);
+}
+
+// a thread's table fills up, every slot is taken so the next new hash has nowhere to go
+void TestFullTable()
+{
+	std::thread thread([]()
+	{
+		for (uint32_t i = 1; i <= TableSize; i++) Record(i * 0x10001, 5);
+		CHECK(ms_nDropped == 0);
+
+		// used to spin forever here
+		Record(0xDEADBEEF, 5);
+		Record(0xDEADBEEF, 5);
+		CHECK(ms_nDropped == 2);
+
+		// hashes already in the table still count
+		Record(7 * 0x10001, 5);
+		CHECK(ms_nDropped == 2);
+	});
+	thread.join();
+
+	auto entries = Collect();
+	CHECK(!FindEntry(entries, 0xDEADBEEF));
+	auto seventh = FindEntry(entries, 7 * 0x10001);
+	CHECK(seventh && seventh->m_nCalls == 2);
+
+	// the dropped calls show up in the report as their own row
+	CHECK(WriteReport("NativeProfilerTest.csv"));
+	FILE* file = fopen("NativeProfilerTest.csv", "r");
+	char line[256];
+	bool found = false;
+	while (fgets(line, sizeof(line), file))
+	{
+		if (!strcmp(line, "0x00000000,dropped,2,0,0,0,0,0\n")) found = true;
+	}
+	fclose(file);
+	CHECK(found);
+	remove("NativeProfilerTest.csv");
+}
+
+int main()
+{
+	TestRecord();
+	TestFullTable();
+	return Finish("NativeProfilerTest");
+}
@@ -0,0 +1,160 @@
+// FindNextUsed against a plain loop over the flags and the iterator with slots the loop body changes,
+// then both timed against plain loops on pools the size of the game's ped, object and building pools
+#include "HostSdk.h"
+#include "CPool.h"
+
+struct tObject
+{
+	uint32_t m_nValue;
+	uint8_t pad[60];
+};
+
+// the game's pools are made by the game, this just fills in the fields the helpers read
+CPool<tObject>* MakePool(std::vector<uint8_t>& flags, std::vector<tObject>& objects)
+{
+	alignas(CPool<tObject>) static uint8_t storage[sizeof(CPool<tObject>)];
+	CPool<tObject>* pool = (CPool<tObject>*)storage;
+	pool->m_pObjects = (uint8_t*)objects.data();
+	pool->m_pFlags = flags.data();
+	pool->m_nCount = (uint32_t)flags.size();
+	pool->m_nEntrySize = sizeof(tObject);
+	return pool;
+}
+
+void Fill(std::vector<uint8_t>& flags, float occupancy, uint32_t seed)
+{
+	for (auto& flag : flags)
+	{
+		seed = seed * 1664525 + 1013904223;
+		// low bits are the slot's reference counter in the game, keep some set on both used and free slots
+		flag = (uint8_t)((seed >> 8) & 0x7F);
+		if ((seed >> 16) % 1000 >= occupancy * 1000) flag |= 0x80;
+	}
+}
+
+int ScalarFindNextUsed(const std::vector<uint8_t>& flags, int curr)
+{
+	for (int i = curr; i < (int)flags.size(); i++)
+	{
+		if (!(flags[i] & 0x80)) return i;
+	}
+	return -1;
+}
+
+void TestFindNextUsed()
+{
+	for (uint32_t count : { 0u, 1u, 15u, 16u, 17u, 100u, 1000u, 1023u })
+	{
+		for (float occupancy : { 0.0f, 0.01f, 0.5f, 1.0f })
+		{
+			std::vector<uint8_t> flags(count);
+			std::vector<tObject> objects(count);
+			Fill(flags, occupancy, count * 31 + (uint32_t)(occupancy * 100));
+			CPool<tObject>* pool = MakePool(flags, objects);
+			for (int i = 0; i <= (int)count; i++)
+			{
+				CHECK(pool->FindNextUsed(i) == ScalarFindNextUsed(flags, i));
+			}
+		}
+	}
+}
+
+void TestIterator()
+{
+	std::vector<uint8_t> flags(200, 0x80);
+	std::vector<tObject> objects(200);
+	for (uint32_t i = 0; i < 200; i++) objects[i].m_nValue = i;
+	for (int i : { 3, 10, 50, 51, 120 }) flags[i] = 0;
+	CPool<tObject>* pool = MakePool(flags, objects);
+
+	// 10 fills a slot behind the lookahead, which isn't visited, 50 frees the lookahead 51 and 120 after it
+	std::vector<uint32_t> seen;
+	for (auto object : pool)
+	{
+		seen.push_back(object->m_nValue);
+		if (object->m_nValue == 10) flags[30] = 0;
+		if (object->m_nValue == 50)
+		{
+			flags[51] = 0x80;
+			flags[120] = 0x80;
+			flags[150] = 0;
+		}
+	}
+	CHECK((seen == std::vector<uint32_t>{ 3, 10, 50, 150 }));
+
+	// and the next time round the filled one is there
+	seen.clear();
+	for (auto object : pool) seen.push_back(object->m_nValue);
+	CHECK((seen == std::vector<uint32_t>{ 3, 10, 30, 50, 150 }));
+
+	// every occupancy gives the same slots as FindNextUsed
+	std::vector<uint8_t> big(1000);
+	std::vector<tObject> bigObjects(1000);
+	for (uint32_t i = 0; i < 1000; i++) bigObjects[i].m_nValue = i;
+	for (float occupancy : { 0.01f, 0.3f, 0.9f })
+	{
+		Fill(big, occupancy, 99);
+		CPool<tObject>* bigPool = MakePool(big, bigObjects);
+		std::vector<uint32_t> expected;
+		for (int i = ScalarFindNextUsed(big, 0); i != -1; i = ScalarFindNextUsed(big, i + 1)) expected.push_back(i);
+		seen.clear();
+		for (auto object : bigPool) seen.push_back(object->m_nValue);
+		CHECK(seen == expected);
+	}
+	pool = MakePool(flags, objects);
+
+	std::fill(flags.begin(), flags.end(), 0x80);
+	seen.clear();
+	for (auto object : pool) seen.push_back(object->m_nValue);
+	CHECK(seen.empty());
+}
+
+// the pool sizes here are round numbers in the range of the game's, the building pool is by far the biggest
+void Bench(const char* sName, uint32_t count)
+{
+	printf("%s pool, %u slots\n", sName, count);
+	printf("occupancy  FindNextUsed  scalar scan  iterator  Get loop   (ns/pass)\n");
+	for (float occupancy : { 0.01f, 0.1f, 0.5f, 0.9f })
+	{
+		std::vector<uint8_t> flags(count);
+		std::vector<tObject> objects(count);
+		for (uint32_t i = 0; i < count; i++) objects[i].m_nValue = i;
+		Fill(flags, occupancy, 1234);
+		CPool<tObject>* pool = MakePool(flags, objects);
+
+		uint32_t iterations = IsQuickRun() ? 20 : 200000000 / count;
+		uint32_t sum = 0;
+		double findNs = TimeNs(iterations, [&](uint32_t)
+		{
+			for (int i = pool->FindNextUsed(0); i != -1; i = pool->FindNextUsed(i + 1)) sum += i;
+		});
+		double scalarNs = TimeNs(iterations, [&](uint32_t)
+		{
+			for (int i = ScalarFindNextUsed(flags, 0); i != -1; i = ScalarFindNextUsed(flags, i + 1)) sum += i;
+		});
+		// these two read every object they visit, like any real loop over a pool would
+		double iteratorNs = TimeNs(iterations, [&](uint32_t)
+		{
+			for (auto object : pool) sum += object->m_nValue;
+		});
+		double getNs = TimeNs(iterations, [&](uint32_t)
+		{
+			for (uint32_t i = 0; i < pool->m_nCount; i++)
+			{
+				if (tObject* object = pool->Get(i)) sum += object->m_nValue;
+			}
+		});
+		DoNotOptimise(sum);
+		printf("%9.2f  %12.1f  %11.1f  %8.1f  %8.1f\n", occupancy, findNs, scalarNs, iteratorNs, getNs);
+	}
+}
+
+int main()
+{
+	TestFindNextUsed();
+	TestIterator();
+	Bench("ped", 140 * 8);
+	Bench("object", 1300);
+	Bench("building", 25000);
+	return Finish("PoolIteratorTest");
+}
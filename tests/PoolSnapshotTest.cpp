@@ -0,0 +1,164 @@
+// a pool job over a synthetic pool: the snapshot, the kernel on the workers and the merge on the next tick,
+// entities removed or slots reused in between, and Shutdown(false) leaving no worker behind in the job system
+#include "HostSdk.h"
+#include "CPool.h"
+#include "CJobSystem.h"
+#include "CPoolSnapshot.h"
+
+struct tObject
+{
+	uint32_t m_nValue;
+	uint8_t pad[60];
+};
+
+struct tData
+{
+	uint32_t m_nValue;
+};
+
+// the game's pools are made by the game, this just fills in the fields the helpers read
+CPool<tObject>* MakePool(std::vector<uint8_t>& flags, std::vector<tObject>& objects)
+{
+	alignas(CPool<tObject>) static uint8_t storage[sizeof(CPool<tObject>)];
+	CPool<tObject>* pool = (CPool<tObject>*)storage;
+	pool->m_pObjects = (uint8_t*)objects.data();
+	pool->m_pFlags = flags.data();
+	pool->m_nCount = (uint32_t)flags.size();
+	pool->m_nEntrySize = sizeof(tObject);
+	return pool;
+}
+
+void TestSnapshot()
+{
+	std::vector<uint8_t> flags(100, 0x80);
+	std::vector<tObject> objects(100);
+	for (uint32_t i = 0; i < 100; i++) objects[i].m_nValue = i * 10;
+	for (int i : { 2, 17, 40, 99 }) flags[i] = 3;
+	CPool<tObject>* pool = MakePool(flags, objects);
+
+	CPoolSnapshot<tObject, tData> snapshot;
+	snapshot.Take(pool, [](tObject* object) { return tData{ object->m_nValue }; });
+	CHECK(snapshot.Size() == 4);
+	CHECK((snapshot.m_aSlots == std::vector<int32_t>{ 2, 17, 40, 99 }));
+	CHECK(snapshot.m_aData[3].m_nValue == 990);
+	CHECK(snapshot.Get(pool, 1) == &objects[17]);
+
+	// removed, and reused by something else with the counter in the low bits moved on
+	flags[17] = 0x83;
+	flags[40] = 4;
+	CHECK(snapshot.Get(pool, 1) == nullptr);
+	CHECK(snapshot.Get(pool, 2) == nullptr);
+	CHECK(snapshot.Get(pool, 0) == &objects[2]);
+}
+
+void TestPoolJob(uint32_t numWorkers)
+{
+	CJobSystem& jobs = JobSystem;
+	if (numWorkers) jobs.Start(numWorkers);
+
+	const uint32_t count = 5000;
+	std::vector<uint8_t> flags(count, 0x80);
+	std::vector<tObject> objects(count);
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		objects[i].m_nValue = i;
+		if (i % 3 == 0) continue;
+		flags[i] = 1;
+		used++;
+	}
+	CPool<tObject>* pool = MakePool(flags, objects);
+
+	CPoolJob<tObject, tData, uint32_t> job;
+	auto extract = [](tObject* object) { return tData{ object->m_nValue }; };
+	auto kernel = [](const tData& data) { return data.m_nValue * 2 + 1; };
+
+	// the first tick only starts the work, nothing to merge yet
+	uint32_t merges = 0;
+	uint32_t wrong = 0;
+	uint32_t merged = 0;
+	uint32_t gone = 0;
+	auto merge = [&](const CPoolSnapshot<tObject, tData>& snapshot, const std::vector<uint32_t>& results)
+	{
+		merges++;
+		CHECK(results.size() == snapshot.Size());
+		for (uint32_t i = 0; i < snapshot.Size(); i++)
+		{
+			tObject* object = snapshot.Get(pool, i);
+			if (!object)
+			{
+				gone++;
+				continue;
+			}
+			if (results[i] != object->m_nValue * 2 + 1) wrong++;
+			merged++;
+		}
+	};
+	CHECK(job.Process(pool, extract, kernel, merge, 64));
+	CHECK(merges == 0);
+
+	// the game changes the pool before the next tick, the merge has to notice: 1 is removed, 2 reused and 3 filled
+	flags[1] = 0x81;
+	flags[2] = 2;
+	flags[3] = 1;
+
+	// the next tick merges the last one's results once they're in, then snapshots again
+	while (!job.Process(pool, extract, kernel, merge, 64)) std::this_thread::yield();
+	CHECK(merges == 1);
+	CHECK(wrong == 0);
+	CHECK(gone == 2);
+	CHECK(merged == used - 2);
+
+	// Flush waits and merges straight away, this snapshot has 2 and 3 but not 1
+	merged = 0;
+	gone = 0;
+	job.Flush(merge);
+	CHECK(merges == 2);
+	CHECK(wrong == 0 && gone == 0);
+	CHECK(merged == used);
+	job.Flush(merge);
+	CHECK(merges == 2);
+
+	if (numWorkers) jobs.Shutdown();
+}
+
+// Process won't start anything new while a kernel is still running
+void TestInFlight()
+{
+	JobSystem.Start(2);
+	std::vector<uint8_t> flags(4, 0);
+	std::vector<tObject> objects(4);
+	CPool<tObject>* pool = MakePool(flags, objects);
+
+	std::atomic<bool> release{ false };
+	CPoolJob<tObject, tData, uint32_t> job;
+	auto extract = [](tObject* object) { return tData{ object->m_nValue }; };
+	auto kernel = [&release](const tData& data)
+	{
+		while (!release) std::this_thread::yield();
+		return data.m_nValue;
+	};
+	uint32_t merges = 0;
+	auto merge = [&](const CPoolSnapshot<tObject, tData>&, const std::vector<uint32_t>&) { merges++; };
+
+	CHECK(job.Process(pool, extract, kernel, merge, 1));
+	CHECK(!job.Process(pool, extract, kernel, merge, 1));
+	CHECK(merges == 0);
+	release = true;
+	job.Flush(merge);
+	CHECK(merges == 1);
+
+	// the unload path, workers have left the job system for good when it returns
+	JobSystem.Shutdown(false);
+	CHECK(!JobSystem.IsRunning());
+}
+
+int main()
+{
+	TestSnapshot();
+	// inline on the calling thread, then on workers
+	TestPoolJob(0);
+	TestPoolJob(3);
+	TestInFlight();
+	return Finish("PoolSnapshotTest");
+}
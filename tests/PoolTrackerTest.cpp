@@ -0,0 +1,150 @@
+// the pool tracker's flag byte diff on a synthetic pool: created, removed and reused slots in the 16 wide part and the tail,
+// then random frames checked against a plain byte by byte diff
+#include "HostSdk.h"
+#include "CPool.h"
+#include "EventDispatcher.h"
+
+class CPed;
+class CVehicle;
+#include "CPoolTracker.h"
+
+struct tObject
+{
+	uint32_t m_nValue;
+	uint8_t pad[60];
+};
+
+// the game's pools are made by the game, this just fills in the fields the helpers read
+CPool<tObject>* MakePool(std::vector<uint8_t>& flags, std::vector<tObject>& objects)
+{
+	alignas(CPool<tObject>) static uint8_t storage[sizeof(CPool<tObject>)];
+	CPool<tObject>* pool = (CPool<tObject>*)storage;
+	pool->m_pObjects = (uint8_t*)objects.data();
+	pool->m_pFlags = flags.data();
+	pool->m_nCount = (uint32_t)flags.size();
+	pool->m_nEntrySize = sizeof(tObject);
+	return pool;
+}
+
+std::vector<int32_t> gCreated;
+std::vector<uint32_t> gCreatedValues;
+std::vector<int32_t> gRemoved;
+
+void OnCreated(tObject* object, int32_t slot)
+{
+	gCreated.push_back(slot);
+	gCreatedValues.push_back(object->m_nValue);
+}
+
+void OnRemoved(int32_t slot)
+{
+	gRemoved.push_back(slot);
+}
+
+void TestUpdate()
+{
+	// 37 slots, two full blocks of 16 and a tail of 5
+	std::vector<uint8_t> flags(37, 0x80);
+	std::vector<tObject> objects(37);
+	for (uint32_t i = 0; i < 37; i++) objects[i].m_nValue = i * 10;
+	for (int i : { 2, 20, 33 }) flags[i] = 1;
+	CPool<tObject>* pool = MakePool(flags, objects);
+
+	CPoolTracker<tObject> tracker;
+	tracker.m_OnCreated.Add(OnCreated);
+	tracker.m_OnRemoved.Add(OnRemoved);
+	CHECK(tracker.IsActive());
+
+	// the first update only takes the current state
+	tracker.Update(pool);
+	CHECK(tracker.m_aAdded.empty() && tracker.m_aRemoved.empty());
+	CHECK(gCreated.empty() && gRemoved.empty());
+
+	// nothing changed
+	tracker.Update(pool);
+	CHECK(tracker.m_aAdded.empty() && tracker.m_aRemoved.empty());
+
+	// created in a block and in the tail, removed from a block, reused in a block and in the tail
+	flags[5] = 1;
+	flags[35] = 1;
+	flags[20] = 0x81;
+	flags[2] = 2;
+	flags[33] = 2;
+	// a free slot whose counter moved on is still free, nothing to report
+	flags[10] = 0x85;
+	tracker.Update(pool);
+	CHECK((tracker.m_aAdded == std::vector<int32_t>{ 2, 5, 33, 35 }));
+	CHECK((tracker.m_aRemoved == std::vector<int32_t>{ 2, 20, 33 }));
+	CHECK((gCreated == tracker.m_aAdded));
+	CHECK((gCreatedValues == std::vector<uint32_t>{ 20, 50, 330, 350 }));
+	CHECK((gRemoved == tracker.m_aRemoved));
+
+	// and the next update starts from there
+	tracker.Update(pool);
+	CHECK(tracker.m_aAdded.empty() && tracker.m_aRemoved.empty());
+
+	// the last slot of the tail and the first of the pool
+	flags[36] = 1;
+	flags[0] = 1;
+	tracker.Update(pool);
+	CHECK((tracker.m_aAdded == std::vector<int32_t>{ 0, 36 }));
+
+	// a pool of another size starts over
+	std::vector<uint8_t> other(16, 0);
+	std::vector<tObject> otherObjects(16);
+	tracker.Update(MakePool(other, otherObjects));
+	CHECK(tracker.m_aAdded.empty() && tracker.m_aRemoved.empty());
+	tracker.Update(nullptr);
+	CHECK(tracker.m_aAdded.empty());
+}
+
+// random changes every frame against comparing the bytes one at a time
+void TestRandom()
+{
+	for (uint32_t count : { 1u, 15u, 16u, 17u, 140u, 1001u })
+	{
+		std::vector<uint8_t> flags(count, 0x80);
+		std::vector<tObject> objects(count);
+		CPool<tObject>* pool = MakePool(flags, objects);
+		CPoolTracker<tObject> tracker;
+		tracker.m_bEnabled = true;
+		tracker.Update(pool);
+
+		uint32_t seed = count;
+		uint32_t mismatches = 0;
+		for (uint32_t frame = 0; frame < 200; frame++)
+		{
+			std::vector<uint8_t> before = flags;
+			for (uint32_t c = 0; c < count / 8 + 1; c++)
+			{
+				seed = seed * 1664525 + 1013904223;
+				uint32_t slot = (seed >> 8) % count;
+				// free, fill or bump the counter
+				switch ((seed >> 4) % 3)
+				{
+				case 0: flags[slot] |= 0x80; break;
+				case 1: flags[slot] &= 0x7F; break;
+				default: flags[slot] = (flags[slot] & 0x80) | ((flags[slot] + 1) & 0x7F); break;
+				}
+			}
+
+			std::vector<int32_t> added, removed;
+			for (uint32_t i = 0; i < count; i++)
+			{
+				if (before[i] == flags[i]) continue;
+				if (!(before[i] & 0x80)) removed.push_back(i);
+				if (!(flags[i] & 0x80)) added.push_back(i);
+			}
+			tracker.Update(pool);
+			if (tracker.m_aAdded != added || tracker.m_aRemoved != removed) mismatches++;
+		}
+		CHECK(mismatches == 0);
+	}
+}
+
+int main()
+{
+	TestUpdate();
+	TestRandom();
+	return Finish("PoolTrackerTest");
+}
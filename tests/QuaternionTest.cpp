@@ -0,0 +1,160 @@
+// quaternion math against double precision references and the matrix functions, then the cost of the blends
+#include "HostMath.h"
+
+struct tQuatD
+{
+	double x, y, z, w;
+};
+
+tQuatD ToDouble(const CQuaternion& q) { return { q.x, q.y, q.z, q.w }; }
+
+// textbook slerp with the real acos
+CQuaternion ReferenceSlerp(const CQuaternion& qa, const CQuaternion& qb, float t)
+{
+	tQuatD a = ToDouble(qa), b = ToDouble(qb);
+	double cosTheta = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+	if (cosTheta < 0)
+	{
+		b = { -b.x, -b.y, -b.z, -b.w };
+		cosTheta = -cosTheta;
+	}
+	double theta = acos(cosTheta < 1.0 ? cosTheta : 1.0);
+	double s = sin(theta);
+	double ta = s > 1e-9 ? sin((1 - t) * theta) / s : 1 - t;
+	double tb = s > 1e-9 ? sin(t * theta) / s : t;
+	return { (float)(a.x * ta + b.x * tb), (float)(a.y * ta + b.y * tb), (float)(a.z * ta + b.z * tb), (float)(a.w * ta + b.w * tb) };
+}
+
+// q and -q are the same rotation
+bool SameRotation(const CQuaternion& a, const CQuaternion& b, float tolerance)
+{
+	return fabsf(fabsf(a.Dot(b)) - 1.0f) <= tolerance;
+}
+
+bool Near(const CQuaternion& a, const CQuaternion& b, float tolerance)
+{
+	return Near(a.x, b.x, tolerance) && Near(a.y, b.y, tolerance) && Near(a.z, b.z, tolerance) && Near(a.w, b.w, tolerance);
+}
+
+void TestBasics()
+{
+	for (int i = 0; i < 1000; i++)
+	{
+		CQuaternion a = RandomQuaternion(), b = RandomQuaternion();
+		CVector v = RandomVector(10.0f);
+
+		// a * b applies b first
+		CHECK(Near((a * b).Rotate(v), a.Rotate(b.Rotate(v)), 1e-5f));
+		// the matrix does the same thing as Rotate
+		CHECK(Near(TransformVector(QuaternionToMatrix(a), v), a.Rotate(v), 1e-5f));
+		CHECK(Near(a.Conjugate().Rotate(a.Rotate(v)), v, 1e-5f));
+		CHECK(SameRotation(a * a.Conjugate(), { 0, 0, 0, 1 }, 1e-6f));
+		CHECK(SameRotation(MatrixToQuaternion(QuaternionToMatrix(a)), a, 1e-5f));
+
+		CMatrix simd = CSimdMatrix::FromQuaternion(a).ToMatrix();
+		CMatrix scalar = QuaternionToMatrix(a);
+		CHECK(Near(simd.right, scalar.right, 1e-6f));
+		CHECK(Near(simd.at, scalar.at, 1e-6f));
+		CHECK(Near(simd.up, scalar.up, 1e-6f));
+	}
+
+	CHECK(Near(CQuaternion{ 0, 0, 0, 0 }.Normalized(), CQuaternion{ 0, 0, 0, 1 }, 0.0f));
+
+	float maxError = 0.0f;
+	for (int i = 0; i <= 10000; i++)
+	{
+		float x = i / 10000.0f;
+		float error = fabsf(FastAcos(x) - (float)acos((double)x));
+		if (error > maxError) maxError = error;
+	}
+	CHECK(maxError < 1e-4f);
+}
+
+void TestBlends()
+{
+	const uint32_t count = 1000;
+	std::vector<CQuaternion> a(count), b(count), out(count);
+	std::vector<float> t(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		a[i] = RandomQuaternion();
+		// some pairs nearly equal to hit the nlerp fallback, some on opposite hemispheres
+		if (i % 4 == 0)
+		{
+			CQuaternion small = CQuaternion{ RandomFloat() * 0.01f, RandomFloat() * 0.01f, RandomFloat() * 0.01f, 1.0f }.Normalized();
+			b[i] = a[i] * small;
+		}
+		else b[i] = RandomQuaternion();
+		if (i % 3 == 0) b[i] = { -b[i].x, -b[i].y, -b[i].z, -b[i].w };
+		t[i] = (RandomFloat() + 1.0f) * 0.5f;
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		CQuaternion reference = ReferenceSlerp(a[i], b[i], t[i]);
+		CHECK(Near(Slerp(a[i], b[i], t[i]), reference, 1e-4f));
+		CHECK(fabsf(Slerp(a[i], b[i], t[i]).Magnitude() - 1.0f) < 1e-4f);
+		// the ends are exact whichever way round
+		CHECK(SameRotation(Slerp(a[i], b[i], 0.0f), a[i], 1e-5f));
+		CHECK(SameRotation(Slerp(a[i], b[i], 1.0f), b[i], 1e-4f));
+		CHECK(SameRotation(Nlerp(a[i], b[i], 1.0f), b[i], 1e-5f));
+	}
+
+	NlerpQuaternions(a.data(), b.data(), t.data(), out.data(), count);
+	for (uint32_t i = 0; i < count; i++) CHECK(Near(out[i], Nlerp(a[i], b[i], t[i]), 1e-5f));
+
+	SlerpQuaternions(a.data(), b.data(), t.data(), out.data(), count);
+	for (uint32_t i = 0; i < count; i++) CHECK(Near(out[i], Slerp(a[i], b[i], t[i]), 0.0f));
+
+	// in place
+	std::vector<CQuaternion> inPlace = a;
+	NlerpQuaternions(inPlace.data(), b.data(), t.data(), inPlace.data(), count);
+	for (uint32_t i = 0; i < count; i++) CHECK(Near(inPlace[i], Nlerp(a[i], b[i], t[i]), 1e-5f));
+}
+
+void Bench()
+{
+	const uint32_t count = 4096;
+	std::vector<CQuaternion> a(count), b(count), out(count);
+	std::vector<float> t(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		a[i] = RandomQuaternion();
+		b[i] = RandomQuaternion();
+		t[i] = (RandomFloat() + 1.0f) * 0.5f;
+	}
+
+	uint32_t iterations = IsQuickRun() ? 20 : 2000;
+	double referenceNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) out[i] = ReferenceSlerp(a[i], b[i], t[i]);
+		DoNotOptimise(out[0]);
+	});
+	double slerpNs = TimeNs(iterations, [&](uint32_t) { SlerpQuaternions(a.data(), b.data(), t.data(), out.data(), count); DoNotOptimise(out[0]); });
+	double nlerpNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) out[i] = Nlerp(a[i], b[i], t[i]);
+		DoNotOptimise(out[0]);
+	});
+	double batchNs = TimeNs(iterations, [&](uint32_t) { NlerpQuaternions(a.data(), b.data(), t.data(), out.data(), count); DoNotOptimise(out[0]); });
+	double mulNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) out[i] = a[i] * b[i];
+		DoNotOptimise(out[0]);
+	});
+
+	printf("%u pairs, ns per pair\n", count);
+	printf("double slerp (acos)     %.2f\n", referenceNs / count);
+	printf("Slerp                   %.2f\n", slerpNs / count);
+	printf("Nlerp                   %.2f\n", nlerpNs / count);
+	printf("NlerpQuaternions        %.2f\n", batchNs / count);
+	printf("operator*               %.2f\n", mulNs / count);
+}
+
+int main()
+{
+	TestBasics();
+	TestBlends();
+	Bench();
+	return Finish("QuaternionTest");
+}
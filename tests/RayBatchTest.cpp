@@ -0,0 +1,179 @@
+// the ray queue and Process with a stub ray function, single threaded and with several producers
+#include "HostMath.h"
+
+// just what CRayBatch touches, the game's versions need a running game
+struct tLineOfSightResults
+{
+	CVector m_vEndPosition;
+	uint32_t m_nFlags;
+};
+
+struct CWorld
+{
+	static bool ProcessLineOfSight(CVector*, CVector*, uint32_t*, tLineOfSightResults*, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) { return false; }
+};
+
+#include "CBoundedQueue.h"
+#include "CRayBatch.h"
+
+std::atomic<uint32_t> gNumRays{ 0 };
+
+// hits anything with a positive target x, the end position is the target
+bool StubRay(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough)
+{
+	gNumRays++;
+	pResults->m_vEndPosition = *target;
+	pResults->m_nFlags = nFlags + nSeeThroughShootThrough;
+	return target->x > 0.0f;
+}
+
+struct tCallbackLog
+{
+	std::vector<float> m_aTargets;
+	uint32_t m_nInvalid = 0;
+};
+
+void LogResult(const tRayResult& result, void* context)
+{
+	auto log = (tCallbackLog*)context;
+	if (!result.m_bValid) log->m_nInvalid++;
+	else log->m_aTargets.push_back(result.m_Results.m_vEndPosition.x);
+}
+
+void TestSingleThread()
+{
+	CRayBatch batch(8, StubRay);
+	CHECK(batch.Process() == 0);
+
+	auto hit = batch.Submit(CVector(0, 0, 0), CVector(5, 0, 0), 2, 1);
+	auto miss = batch.Submit(CVector(0, 0, 0), CVector(-5, 0, 0), 2);
+	tCallbackLog log;
+	CHECK(batch.Submit(CVector(0, 0, 0), CVector(7, 0, 0), 0, LogResult, &log));
+	CHECK(batch.GetNumQueued() == 3);
+	CHECK(hit.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+
+	CHECK(batch.Process() == 3);
+	tRayResult result = hit.get();
+	CHECK(result.m_bValid && result.m_bHit && result.m_Results.m_vEndPosition.x == 5.0f && result.m_Results.m_nFlags == 3);
+	result = miss.get();
+	CHECK(result.m_bValid && !result.m_bHit);
+	CHECK((log.m_aTargets == std::vector<float>{ 7.0f }));
+
+	// 8 cells, the 9th doesn't fit
+	std::vector<std::future<tRayResult>> futures;
+	for (int i = 0; i < 8; i++) futures.push_back(batch.Submit(CVector(0, 0, 0), CVector((float)i, 0, 0), 0));
+	auto dropped = batch.Submit(CVector(0, 0, 0), CVector(1, 0, 0), 0);
+	CHECK(dropped.wait_for(std::chrono::seconds(0)) == std::future_status::ready && !dropped.get().m_bValid);
+	CHECK(!batch.Submit(CVector(0, 0, 0), CVector(1, 0, 0), 0, LogResult, &log));
+
+	// over the per Process limit waits for the next one, in order
+	batch.m_nMaxRaysPerProcess = 5;
+	CHECK(batch.Process() == 5);
+	CHECK(batch.Process() == 3);
+	for (int i = 0; i < 8; i++) CHECK(futures[i].get().m_Results.m_vEndPosition.x == (float)i);
+}
+
+void TestDestroyed()
+{
+	tCallbackLog log;
+	std::future<tRayResult> future;
+	{
+		CRayBatch batch(16, StubRay);
+		future = batch.Submit(CVector(0, 0, 0), CVector(1, 0, 0), 0);
+		batch.Submit(CVector(0, 0, 0), CVector(1, 0, 0), 0, LogResult, &log);
+	}
+	// nothing is left waiting forever
+	CHECK(!future.get().m_bValid);
+	CHECK(log.m_nInvalid == 1);
+}
+
+void TestProducers()
+{
+	const uint32_t numThreads = 4, perThread = 20000;
+	CRayBatch batch(1024, StubRay);
+	std::atomic<uint32_t> numDropped{ 0 };
+	std::atomic<uint32_t> numDone{ 0 };
+	std::vector<std::vector<uint32_t>> seen(numThreads, std::vector<uint32_t>(perThread, 0));
+
+	struct tContext
+	{
+		std::vector<std::vector<uint32_t>>* m_pSeen;
+	} context = { &seen };
+	auto callback = [](const tRayResult& result, void* context)
+	{
+		auto& seen = *((tContext*)context)->m_pSeen;
+		// thread and index are packed into the target
+		uint32_t thread = (uint32_t)result.m_Results.m_vEndPosition.y;
+		uint32_t index = (uint32_t)result.m_Results.m_vEndPosition.z;
+		seen[thread][index]++;
+	};
+
+	std::vector<std::thread> threads;
+	for (uint32_t t = 0; t < numThreads; t++)
+	{
+		threads.emplace_back([&, t]
+		{
+			for (uint32_t i = 0; i < perThread; i++)
+			{
+				// a full queue is retried, the consumer is draining it
+				while (!batch.Submit(CVector(0, 0, 0), CVector(1, (float)t, (float)i), 0, callback, &context))
+				{
+					numDropped++;
+					std::this_thread::yield();
+				}
+			}
+			numDone++;
+		});
+	}
+
+	uint32_t processed = 0;
+	while (numDone < numThreads || batch.GetNumQueued()) processed += batch.Process();
+	for (auto& thread : threads) thread.join();
+	processed += batch.Process();
+
+	CHECK(processed == numThreads * perThread);
+	bool once = true;
+	for (auto& counts : seen)
+	{
+		for (uint32_t count : counts) once &= count == 1;
+	}
+	CHECK(once);
+}
+
+void Bench()
+{
+	const uint32_t count = 4096;
+	CRayBatch batch(count, StubRay);
+	uint32_t iterations = IsQuickRun() ? 20 : 2000;
+	uint32_t hits = 0;
+	auto callback = [](const tRayResult& result, void* context) { *(uint32_t*)context += result.m_bHit; };
+
+	double submitNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) batch.Submit(CVector(0, 0, 0), CVector((float)i, 0, 0), 0, callback, &hits);
+		batch.Process();
+	}) / count;
+
+	double futureNs = TimeNs(IsQuickRun() ? 5 : 200, [&](uint32_t)
+	{
+		std::vector<std::future<tRayResult>> futures;
+		futures.reserve(count);
+		for (uint32_t i = 0; i < count; i++) futures.push_back(batch.Submit(CVector(0, 0, 0), CVector((float)i, 0, 0), 0));
+		batch.Process();
+		for (auto& future : futures) hits += future.get().m_bHit;
+	}) / count;
+	DoNotOptimise(hits);
+
+	printf("per ray with the stub ray function\n");
+	printf("callback, submit + Process   %.1f ns\n", submitNs);
+	printf("future, submit + Process     %.1f ns\n", futureNs);
+}
+
+int main()
+{
+	TestSingleThread();
+	TestDestroyed();
+	TestProducers();
+	Bench();
+	return Finish("RayBatchTest");
+}
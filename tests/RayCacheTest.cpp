@@ -0,0 +1,197 @@
+// the ray cache against a stub ray function and fake pools, mostly that moved, deleted and reused entities invalidate a result
+#include "HostSdk.h"
+#include "HostMath.h"
+#include "CPool.h"
+
+// just the fields CRayCache reads
+struct CEntity
+{
+	CMatrix* m_pMatrix;
+	struct
+	{
+		CVector m_vPosition;
+	} m_placement;
+};
+struct CPed : CEntity { uint8_t pad[40]; };
+struct CVehicle : CEntity { uint8_t pad[72]; };
+struct CObject : CEntity {};
+struct CBuilding : CEntity {};
+
+struct CPools
+{
+	static inline CPool<CPed>* ms_pPedPool = nullptr;
+	static inline CPool<CVehicle>* ms_pVehiclePool = nullptr;
+	static inline CPool<CObject>* ms_pObjectPool = nullptr;
+	static inline CPool<CBuilding>* ms_pBuildingPool = nullptr;
+};
+
+struct tLineOfSightResults
+{
+	CVector m_vEndPosition;
+	uint32_t m_nFlags;
+};
+
+struct CWorld
+{
+	static bool ProcessLineOfSight(CVector*, CVector*, uint32_t*, tLineOfSightResults*, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) { return false; }
+};
+
+#include "CBoundedQueue.h"
+#include "CRayBatch.h"
+#include "CRayCache.h"
+
+uint32_t gNumRays = 0;
+
+bool StubRay(CVector* source, CVector* target, tLineOfSightResults* pResults, uint32_t nFlags, uint32_t nSeeThroughShootThrough)
+{
+	gNumRays++;
+	pResults->m_vEndPosition = *target;
+	pResults->m_nFlags = nFlags;
+	return target->x > 0.0f;
+}
+
+// the slots start out used with a flag byte of 1
+template<typename T>
+struct tFakePool
+{
+	std::vector<T> m_aObjects;
+	std::vector<uint8_t> m_aFlags;
+	alignas(CPool<T>) uint8_t m_aStorage[sizeof(CPool<T>)] = {};
+
+	tFakePool(uint32_t count) : m_aObjects(count), m_aFlags(count, 1)
+	{
+		CPool<T>* pool = Get();
+		pool->m_pObjects = (uint8_t*)m_aObjects.data();
+		pool->m_pFlags = m_aFlags.data();
+		pool->m_nCount = count;
+		pool->m_nEntrySize = sizeof(T);
+	}
+
+	CPool<T>* Get() { return (CPool<T>*)m_aStorage; }
+
+	void Delete(uint32_t slot) { m_aFlags[slot] |= 0x80; }
+	void Reuse(uint32_t slot) { m_aFlags[slot] = ((m_aFlags[slot] & 0x7F) + 1) & 0x7F; }
+};
+
+bool Ray(CRayCache& cache, const CVector& source, const CVector& target, CEntity* pSource = nullptr, CEntity* pTarget = nullptr)
+{
+	CVector s = source, t = target;
+	tLineOfSightResults results;
+	return cache.ProcessLineOfSight(&s, &t, &results, 7, 0, pSource, pTarget);
+}
+
+void TestKeys()
+{
+	CRayCache cache(16, StubRay);
+	gNumRays = 0;
+
+	CHECK(Ray(cache, CVector(0, 0, 0), CVector(10, 0, 0)));
+	// the same ray and one that moved less than m_fQuantum
+	CHECK(Ray(cache, CVector(0, 0, 0), CVector(10, 0, 0)));
+	CHECK(Ray(cache, CVector(0.01f, 0, 0), CVector(10.01f, 0, 0)));
+	CHECK(gNumRays == 1 && cache.m_nHits == 2 && cache.m_nMisses == 1);
+
+	CHECK(!Ray(cache, CVector(0, 0, 0), CVector(-10, 0, 0)));
+	CHECK(gNumRays == 2);
+
+	// different flags are a different key
+	CVector s(0, 0, 0), t(10, 0, 0);
+	tLineOfSightResults results;
+	cache.ProcessLineOfSight(&s, &t, &results, 8);
+	CHECK(gNumRays == 3 && results.m_nFlags == 8);
+
+	// expires after m_nMaxAgeFrames
+	for (uint32_t i = 0; i < cache.m_nMaxAgeFrames; i++) cache.NextFrame();
+	Ray(cache, CVector(0, 0, 0), CVector(10, 0, 0));
+	CHECK(gNumRays == 4 && cache.m_nExpired == 1);
+
+	cache.m_nMaxAgeFrames = 0;
+	Ray(cache, CVector(0, 0, 0), CVector(10, 0, 0));
+	CHECK(gNumRays == 5);
+}
+
+void TestEntities()
+{
+	tFakePool<CPed> peds(8);
+	tFakePool<CVehicle> vehicles(4);
+	tFakePool<CObject> objects(4);
+	CPools::ms_pPedPool = peds.Get();
+	CPools::ms_pVehiclePool = vehicles.Get();
+	CPools::ms_pObjectPool = objects.Get();
+
+	CMatrix matrix;
+	matrix.pos = CVector_pad(1, 2, 3);
+	CPed& ped = peds.m_aObjects[5];
+	ped.m_pMatrix = &matrix;
+	CVehicle& vehicle = vehicles.m_aObjects[2];
+	vehicle.m_pMatrix = nullptr;
+	vehicle.m_placement.m_vPosition = CVector(20, 0, 0);
+
+	CRayCache cache(64, StubRay);
+	gNumRays = 0;
+	CVector source(0, 0, 0), target(20, 0, 0);
+
+	Ray(cache, source, target, &ped, &vehicle);
+	Ray(cache, source, target, &ped, &vehicle);
+	CHECK(gNumRays == 1 && cache.m_nHits == 1);
+
+	// under the threshold is still the same result
+	matrix.pos.x += cache.m_fMoveThreshold * 0.5f;
+	Ray(cache, source, target, &ped, &vehicle);
+	CHECK(gNumRays == 1);
+
+	matrix.pos.x += cache.m_fMoveThreshold * 2.0f;
+	Ray(cache, source, target, &ped, &vehicle);
+	CHECK(gNumRays == 2 && cache.m_nMoved == 1);
+
+	vehicle.m_placement.m_vPosition.x += 1.0f;
+	Ray(cache, source, target, &ped, &vehicle);
+	CHECK(gNumRays == 3 && cache.m_nMoved == 2);
+	Ray(cache, source, target, &ped, &vehicle);
+	CHECK(gNumRays == 3);
+
+	// deleted, the position isn't looked at anymore so even garbage there doesn't matter
+	vehicles.Delete(2);
+	vehicle.m_placement.m_vPosition = CVector(NAN, NAN, NAN);
+	Ray(cache, source, target, &ped);
+	CHECK(gNumRays == 4 && cache.m_nMoved == 3);
+
+	// something else took the ped's slot without the position changing
+	Ray(cache, source, target, &ped);
+	CHECK(gNumRays == 4);
+	peds.Reuse(5);
+	Ray(cache, source, target, &ped);
+	CHECK(gNumRays == 5 && cache.m_nMoved == 4);
+	Ray(cache, source, target, &ped);
+	CHECK(gNumRays == 5);
+
+	// an entity from the object pool goes through the same way
+	CObject& object = objects.m_aObjects[0];
+	object.m_pMatrix = nullptr;
+	object.m_placement.m_vPosition = CVector(0, 0, 5);
+	CVector objectTarget(0, 0, 5);
+	Ray(cache, source, objectTarget, nullptr, &object);
+	Ray(cache, source, objectTarget, nullptr, &object);
+	CHECK(gNumRays == 6);
+	objects.Delete(0);
+	Ray(cache, source, objectTarget, nullptr, &object);
+	CHECK(gNumRays == 7);
+
+	// not in any pool, never cached
+	CEntity loose = {};
+	uint32_t misses = cache.m_nMisses;
+	Ray(cache, source, CVector(-3, 0, 0), &loose);
+	Ray(cache, source, CVector(-3, 0, 0), &loose);
+	CHECK(gNumRays == 9 && cache.m_nUncached == 2 && cache.m_nMisses == misses);
+
+	CPools::ms_pPedPool = nullptr;
+	CPools::ms_pVehiclePool = nullptr;
+	CPools::ms_pObjectPool = nullptr;
+}
+
+int main()
+{
+	TestKeys();
+	TestEntities();
+	return Finish("RayCacheTest");
+}
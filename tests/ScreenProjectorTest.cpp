@@ -0,0 +1,138 @@
+// the batched projector against the single point one, with a synthetic viewport instead of the game's
+#include "HostMath.h"
+#include "CViewport.h"
+#include "CScreenProjector.h"
+
+const float NearClip = 0.25f, FarClip = 1000.0f;
+
+// d3d right handed perspective, row vectors, looking down -z like rage's view space
+tViewportData MakeViewport(float fov, uint32_t resX, uint32_t resY)
+{
+	static tViewportData data;
+	memset(&data, 0, sizeof(data));
+	data.m_nResX = resX;
+	data.m_nResY = resY;
+	data.m_fFOV = fov;
+	data.m_fAspect = (float)resX / resY;
+	data.m_fNearClip = NearClip;
+	data.m_fFarClip = FarClip;
+
+	float sy = 1.0f / tanf(fov * 0.5f * 3.14159265f / 180.0f);
+	float sx = sy / data.m_fAspect;
+	float* p = &data.m_mProjectionMatrix.right.x;
+	p[0] = sx;
+	p[5] = sy;
+	p[10] = FarClip / (NearClip - FarClip);
+	p[11] = -1.0f;
+	p[14] = NearClip * FarClip / (NearClip - FarClip);
+	return data;
+}
+
+// camera at pos looking along +y with z up, the way the game's camera matrices are laid out
+CMatrix MakeCamera(const CVector& pos)
+{
+	CMatrix cam;
+	cam.right = CVector_pad(1, 0, 0);
+	cam.at = CVector_pad(0, 1, 0);
+	cam.up = CVector_pad(0, 0, 1);
+	cam.pos = CVector_pad(pos.x, pos.y, pos.z);
+	return cam;
+}
+
+CScreenProjector MakeProjector()
+{
+	tViewportData data = MakeViewport(70.0f, 1920, 1080);
+	CScreenProjector projector;
+	projector.SetViewport(data, CScreenProjector::BuildViewMatrix(MakeCamera(CVector(100, 200, 30))));
+	return projector;
+}
+
+void TestKnownPoints()
+{
+	CScreenProjector projector = MakeProjector();
+	CVector2D screen;
+	float depth;
+
+	// straight ahead is the middle of the screen
+	CHECK(projector.Project(CVector(100, 250, 30), screen, &depth) == PROJECT_VISIBLE);
+	CHECK(Near(screen.x, 960.0f, 1e-5f) && Near(screen.y, 540.0f, 1e-5f));
+	CHECK(depth > 0.0f && depth < 1.0f);
+
+	// up is up the screen, right is right
+	CHECK(projector.Project(CVector(101, 250, 31), screen) == PROJECT_VISIBLE);
+	CHECK(screen.x > 960.0f && screen.y < 540.0f);
+
+	CHECK(projector.Project(CVector(100, 150, 30), screen) == PROJECT_BEHIND_CAMERA);
+	CHECK(screen.x == 0.0f && screen.y == 0.0f);
+	// off to the side, closer than the near plane and past the far plane
+	CHECK(projector.Project(CVector(300, 210, 30), screen) == PROJECT_OUTSIDE);
+	CHECK(projector.Project(CVector(100, 200.1f, 30), screen) == PROJECT_OUTSIDE);
+	CHECK(projector.Project(CVector(100, 1300, 30), screen) == PROJECT_OUTSIDE);
+}
+
+std::vector<CVector> RandomPoints(uint32_t count)
+{
+	std::vector<CVector> points(count);
+	for (auto& point : points) point = CVector(100, 200, 30) + RandomVector(300.0f);
+	return points;
+}
+
+void TestBatch(eSimdLevel level)
+{
+	gSimdLevel = level;
+	CScreenProjector projector = MakeProjector();
+	for (uint32_t count : { 0u, 1u, 3u, 4u, 5u, 13u, 1000u })
+	{
+		std::vector<CVector> in = RandomPoints(count);
+		std::vector<CVector2D> out(count);
+		std::vector<uint8_t> flags(count);
+		std::vector<float> depth(count);
+		uint32_t numVisible = projector.Project(in.data(), out.data(), flags.data(), count, depth.data());
+
+		uint32_t expectedVisible = 0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			CVector2D screen;
+			float d;
+			uint8_t f = projector.Project(in[i], screen, &d);
+			CHECK(flags[i] == f);
+			CHECK(Near(out[i].x, screen.x, 1e-5f) && Near(out[i].y, screen.y, 1e-5f));
+			CHECK(Near(depth[i], d, 1e-5f));
+			expectedVisible += f == PROJECT_VISIBLE;
+		}
+		CHECK(numVisible == expectedVisible);
+	}
+}
+
+void Bench()
+{
+	const uint32_t count = 10000;
+	CScreenProjector projector = MakeProjector();
+	std::vector<CVector> in = RandomPoints(count);
+	std::vector<CVector2D> out(count);
+	std::vector<uint8_t> flags(count);
+
+	uint32_t iterations = IsQuickRun() ? 10 : 2000;
+	double singleNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) flags[i] = projector.Project(in[i], out[i]);
+		DoNotOptimise(out[0]);
+	});
+	printf("%u points, ns per point\n", count);
+	printf("one at a time   %.2f\n", singleNs / count);
+	for (eSimdLevel level : GetSimdLevels())
+	{
+		gSimdLevel = level;
+		double batchNs = TimeNs(iterations, [&](uint32_t) { projector.Project(in.data(), out.data(), flags.data(), count); DoNotOptimise(out[0]); });
+		printf("batch %-7s   %.2f\n", GetSimdLevelName(level), batchNs / count);
+	}
+	gSimdLevel = DetectSimdLevel();
+}
+
+int main()
+{
+	TestKnownPoints();
+	for (eSimdLevel level : GetSimdLevels()) TestBatch(level);
+	Bench();
+	return Finish("ScreenProjectorTest");
+}
@@ -0,0 +1,188 @@
+// CSimdVector and CSimdMatrix against the scalar CVector and CMatrix.h functions, junk in the w lanes included,
+// then what dot, cross and normalize cost each way
+#include "HostMath.h"
+
+const float Tolerance = 1e-5f;
+
+bool Near(const CSimdVector& a, const CVector& b, float tolerance)
+{
+	return Near(a.ToVector(), b, tolerance);
+}
+
+bool Same(const CMatrix& a, const CMatrix& b)
+{
+	return !memcmp(&a, &b, sizeof(CMatrix));
+}
+
+void TestLoadStore()
+{
+	// from a CVector the w lane is zero, from floats it's whatever was passed
+	CSimdVector v(CVector(1, 2, 3));
+	CHECK(v.x == 1 && v.y == 2 && v.z == 3 && v.w == 0);
+	CSimdVector f(4, 5, 6, 7);
+	CHECK(f.w == 7);
+	CSimdVector g(f.Get());
+	CHECK(g.x == 4 && g.y == 5 && g.z == 6 && g.w == 7);
+
+	// the padded copy drops the w lane instead of carrying it over as flags
+	CHECK(Near(f.ToVector(), CVector(4, 5, 6), 0));
+	CVector_pad padded = f.ToPadded();
+	CHECK(padded.x == 4 && padded.y == 5 && padded.z == 6 && padded.flags == 0);
+
+	// From works in place, flags and all
+	alignas(16) CVector_pad game(1, 2, 3, 0x7FC00001);
+	CSimdVector& alias = CSimdVector::From(game);
+	CHECK((void*)&alias == (void*)&game);
+	CHECK(alias.x == 1 && alias.z == 3);
+	CHECK(*(uint32_t*)&alias.w == 0x7FC00001);
+	alias.y = 20;
+	CHECK(game.y == 20);
+	const CVector_pad& constGame = game;
+	CHECK(CSimdVector::From(constGame).y == 20);
+
+	// the copying constructor masks the flags off, From and ToMatrix keep the layout
+	CMatrix m = RandomMatrix();
+	CSimdMatrix copy(m);
+	for (const CSimdVector* row : { &copy.right, &copy.at, &copy.up, &copy.pos }) CHECK(row->w == 0);
+	CHECK(copy.right.x == m.right.x && copy.at.y == m.at.y && copy.up.z == m.up.z && copy.pos.x == m.pos.x);
+	CMatrix back = copy.ToMatrix();
+	CHECK(back.right.flags == 0 && back.at.flags == 0 && back.up.flags == 0 && back.pos.flags == 0);
+	for (const float* p : { &back.right.x, &back.at.x, &back.up.x, &back.pos.x })
+	{
+		const float* q = &m.right.x + (p - &back.right.x);
+		CHECK(p[0] == q[0] && p[1] == q[1] && p[2] == q[2]);
+	}
+
+	alignas(16) CMatrix aligned = m;
+	CSimdMatrix& matrixAlias = CSimdMatrix::From(aligned);
+	CHECK((void*)&matrixAlias == (void*)&aligned);
+	CHECK(*(uint32_t*)&matrixAlias.up.w == 0x12345678);
+
+	// Load4x4 and Store4x4 keep every lane
+	CMatrix stored;
+	CSimdMatrix::Load4x4(m).Store4x4(stored);
+	CHECK(Same(stored, m));
+}
+
+void TestVectorMath()
+{
+	uint32_t dotMisses = 0, crossMisses = 0, normalizeMisses = 0, magnitudeMisses = 0;
+	for (uint32_t i = 0; i < 10000; i++)
+	{
+		CVector a = RandomVector(100.0f), b = RandomVector(100.0f);
+		// the w lanes are nan and junk, none of it may show up in a 3 component result
+		uint32_t nan = 0x7FC00001, junk = 0xFFFFFFFF;
+		CSimdVector sa(a.x, a.y, a.z, *(float*)&nan), sb(b.x, b.y, b.z, *(float*)&junk);
+
+		float scale = 1.0f + a.MagnitudeSqr() + b.MagnitudeSqr();
+		if (fabsf(sa.Dot(sb) - Dot(a, b)) > Tolerance * scale) dotMisses++;
+		if (_mm_cvtss_f32(CSimdVector::Dot3(sa.Get(), sb.Get())) != sa.Dot(sb)) dotMisses++;
+		if (fabsf(sa.MagnitudeSqr() - a.MagnitudeSqr()) > Tolerance * scale) magnitudeMisses++;
+		if (!Near(sa.Magnitude(), a.Magnitude(), Tolerance)) magnitudeMisses++;
+
+		CVector cross = Cross(a, b);
+		CSimdVector simdCross = sa.Cross(sb);
+		// the subtractions cancel, so the error is relative to the inputs rather than the result
+		if (fabsf(simdCross.x - cross.x) > Tolerance * scale || fabsf(simdCross.y - cross.y) > Tolerance * scale
+			|| fabsf(simdCross.z - cross.z) > Tolerance * scale || simdCross.w != 0) crossMisses++;
+
+		CSimdVector n = sa.Normalized();
+		if (!Near(n, Normalize(a), Tolerance) || n.w != 0) normalizeMisses++;
+		CSimdVector inPlace = sa;
+		inPlace.Normalize();
+		if (memcmp(&inPlace, &n, sizeof(n))) normalizeMisses++;
+	}
+	CHECK(dotMisses == 0);
+	CHECK(crossMisses == 0);
+	CHECK(normalizeMisses == 0);
+	CHECK(magnitudeMisses == 0);
+
+	// cross of parallel vectors and the right handedness CMatrix.h relies on
+	CHECK(Near(CSimdVector(1, 0, 0).Cross(CSimdVector(0, 1, 0)), CVector(0, 0, 1), 0));
+	CHECK(Near(CSimdVector(2, 4, 6).Cross(CSimdVector(1, 2, 3)), CVector(0, 0, 0), 0));
+
+	// zero and very short vectors normalize to zero on both sides of CVector's 1e-6 length cutoff
+	CHECK(Near(CSimdVector(0, 0, 0).Normalized(), CVector(0, 0, 0), 0));
+	CHECK(Near(CSimdVector(1e-7f, 0, 0).Normalized(), CVector(1e-7f, 0, 0).Normalized(), 0));
+	CHECK(Near(CSimdVector(1e-5f, 0, 0).Normalized(), CVector(1, 0, 0), Tolerance));
+	// long ones still come out unit length, and the w lane never counts towards the length
+	CHECK(Near(CSimdVector(3e15f, 4e15f, 0).Normalized(), CVector(0.6f, 0.8f, 0), Tolerance));
+	CHECK(Near(CSimdVector(1, 1, 1, 1000).Magnitude(), sqrtf(3.0f), Tolerance));
+}
+
+void TestMatrixMath()
+{
+	uint32_t misses = 0;
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		CMatrix a = RandomMatrix(), b = RandomMatrix();
+		CSimdMatrix sa(a), sb(b);
+		CVector v = RandomVector(100.0f);
+		CSimdVector sv(v);
+		if (!Near(sa.TransformVector(sv), TransformVector(a, v), Tolerance)) misses++;
+		if (!Near(sa.TransformPosition(sv), TransformPosition(a, v), Tolerance)) misses++;
+
+		// the game's matrices are aligned, used in place the flags can't leak into the results either
+		alignas(16) CMatrix aligned = a;
+		const CSimdMatrix& alias = CSimdMatrix::From(aligned);
+		CSimdVector p = alias.TransformPosition(sv);
+		if (!Near(p, TransformPosition(a, v), Tolerance) || p.w != 0) misses++;
+
+		CMatrix product = (sa * sb).ToMatrix();
+		CMatrix reference = MultiplyMatrix(a, b);
+		for (uint32_t row = 0; row < 4; row++)
+		{
+			const CVector_pad* rows = &product.right;
+			const CVector_pad* references = &reference.right;
+			if (!Near(rows[row], references[row], Tolerance)) misses++;
+		}
+
+		// rotation and translation only
+		CMatrix rigid = QuaternionToMatrix(RandomQuaternion());
+		rigid.pos = CVector_pad(RandomVector(1000.0f));
+		CMatrix inverse = CSimdMatrix(rigid).InverseOrthonormal().ToMatrix();
+		CMatrix scalarInverse = InverseMatrix(rigid);
+		for (uint32_t row = 0; row < 4; row++)
+		{
+			if (!Near((&inverse.right)[row], (&scalarInverse.right)[row], Tolerance)) misses++;
+		}
+	}
+	CHECK(misses == 0);
+}
+
+void Benchmark()
+{
+	uint32_t count = IsQuickRun() ? 1000 : 100000;
+	std::vector<CVector> a(count), b(count);
+	std::vector<CSimdVector> sa(count), sb(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		a[i] = RandomVector(100.0f);
+		b[i] = RandomVector(100.0f);
+		sa[i] = CSimdVector(a[i]);
+		sb[i] = CSimdVector(b[i]);
+	}
+
+	float sum = 0;
+	double dotNs = TimeNs(count, [&](uint32_t i) { sum += Dot(a[i], b[i]); });
+	double simdDotNs = TimeNs(count, [&](uint32_t i) { sum += sa[i].Dot(sb[i]); });
+	double crossNs = TimeNs(count, [&](uint32_t i) { sum += Cross(a[i], b[i]).x; });
+	double simdCrossNs = TimeNs(count, [&](uint32_t i) { sum += sa[i].Cross(sb[i]).x; });
+	double normalizeNs = TimeNs(count, [&](uint32_t i) { sum += Normalize(a[i]).x; });
+	double simdNormalizeNs = TimeNs(count, [&](uint32_t i) { sum += sa[i].Normalized().x; });
+	DoNotOptimise(sum);
+
+	printf("           CVector  CSimdVector\n");
+	printf("dot        %7.2f  %11.2f\n", dotNs, simdDotNs);
+	printf("cross      %7.2f  %11.2f\n", crossNs, simdCrossNs);
+	printf("normalize  %7.2f  %11.2f\n", normalizeNs, simdNormalizeNs);
+}
+
+int main()
+{
+	TestLoadStore();
+	TestVectorMath();
+	TestMatrixMath();
+	Benchmark();
+	return Finish("SimdVectorTest");
+}
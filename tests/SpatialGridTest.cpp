@@ -0,0 +1,223 @@
+// radius, box and nearest queries against a brute force walk, then the 10k entity benchmark
+#include "HostSdk.h"
+#include "HostMath.h"
+#include "CPool.h"
+
+// just the fields Update reads
+struct CEntity
+{
+	CMatrix* m_pMatrix;
+	struct
+	{
+		CVector m_vPosition;
+	} m_placement;
+};
+
+struct CPools
+{
+	static inline CPool<CEntity>* ms_pPedPool = nullptr;
+	static inline CPool<CEntity>* ms_pVehiclePool = nullptr;
+};
+
+#include "CSpatialGrid.h"
+
+std::vector<CVector> MakePositions(uint32_t count, float extent)
+{
+	std::vector<CVector> positions(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		// a dense cluster, the spread out rest and a few exactly on cell borders
+		if (i % 10 == 0) positions[i] = RandomVector(40.0f);
+		else if (i % 10 == 1) positions[i] = CVector(floorf(RandomFloat() * 100.0f) * 16.0f, 32.0f, 0.0f);
+		else positions[i] = CVector(RandomFloat() * extent, RandomFloat() * extent, RandomFloat() * 50.0f);
+	}
+	return positions;
+}
+
+void Build(CSpatialGrid& grid, const std::vector<CVector>& positions)
+{
+	grid.Clear();
+	for (uint32_t i = 0; i < positions.size(); i++) grid.Add(positions[i], nullptr, (int32_t)i);
+	grid.Build();
+}
+
+std::vector<int32_t> Slots(const std::vector<const tSpatialEntry*>& entries)
+{
+	std::vector<int32_t> slots;
+	for (auto e : entries) slots.push_back(e->m_nSlot);
+	return slots;
+}
+
+std::vector<int32_t> Sorted(std::vector<int32_t> slots)
+{
+	std::sort(slots.begin(), slots.end());
+	return slots;
+}
+
+// brute force k nearest, ties broken by slot so both sides agree on equal distances
+std::vector<int32_t> BruteNearest(const std::vector<CVector>& positions, const CVector& center, uint32_t k, float maxRadius)
+{
+	std::vector<std::pair<float, int32_t>> all;
+	for (uint32_t i = 0; i < positions.size(); i++)
+	{
+		float distSqr = (positions[i] - center).MagnitudeSqr();
+		if (distSqr <= maxRadius * maxRadius) all.push_back({ distSqr, (int32_t)i });
+	}
+	std::sort(all.begin(), all.end());
+	std::vector<int32_t> slots;
+	for (uint32_t i = 0; i < all.size() && i < k; i++) slots.push_back(all[i].second);
+	return slots;
+}
+
+void TestQueries(float cellSize, uint32_t numBuckets)
+{
+	std::vector<CVector> positions = MakePositions(3000, 2000.0f);
+	CSpatialGrid grid(cellSize, numBuckets);
+	Build(grid, positions);
+	CHECK(grid.Size() == positions.size());
+
+	std::vector<const tSpatialEntry*> out;
+	for (int q = 0; q < 200; q++)
+	{
+		CVector center = q % 4 == 0 ? RandomVector(40.0f) : CVector(RandomFloat() * 2200.0f, RandomFloat() * 2200.0f, RandomFloat() * 60.0f);
+		float radius = q % 5 == 0 ? 500.0f : 5.0f + (RandomFloat() + 1.0f) * 40.0f;
+
+		std::vector<int32_t> expected;
+		for (uint32_t i = 0; i < positions.size(); i++)
+		{
+			if ((positions[i] - center).MagnitudeSqr() <= radius * radius) expected.push_back((int32_t)i);
+		}
+		grid.QueryRadius(center, radius, out);
+		CHECK(Sorted(Slots(out)) == expected);
+
+		CVector vMin = center - CVector(radius, radius * 0.5f, 30.0f), vMax = center + CVector(radius, radius, 30.0f);
+		expected.clear();
+		for (uint32_t i = 0; i < positions.size(); i++)
+		{
+			const CVector& p = positions[i];
+			if (p.x >= vMin.x && p.x <= vMax.x && p.y >= vMin.y && p.y <= vMax.y && p.z >= vMin.z && p.z <= vMax.z) expected.push_back((int32_t)i);
+		}
+		grid.QueryBox(vMin, vMax, out);
+		CHECK(Sorted(Slots(out)) == expected);
+
+		for (uint32_t k : { 1u, 5u, 32u })
+		{
+			float maxRadius = q % 3 == 0 ? radius : FLT_MAX;
+			grid.QueryNearest(center, k, out, maxRadius);
+			std::vector<int32_t> nearest = BruteNearest(positions, center, k, maxRadius);
+			CHECK(out.size() == nearest.size());
+			// equal distances can come back in either order, compare the distances
+			for (uint32_t i = 0; i < out.size() && i < nearest.size(); i++)
+			{
+				CHECK((out[i]->m_vPos - center).MagnitudeSqr() == (positions[nearest[i]] - center).MagnitudeSqr());
+			}
+		}
+	}
+
+	// far away from everything
+	grid.QueryNearest(CVector(100000.0f, 100000.0f, 0.0f), 3, out);
+	CHECK(Slots(out) == BruteNearest(positions, CVector(100000.0f, 100000.0f, 0.0f), 3, FLT_MAX));
+	CHECK(grid.QueryRadius(CVector(100000.0f, 100000.0f, 0.0f), 10.0f, out) == 0);
+
+	grid.Clear();
+	CHECK(grid.QueryNearest(CVector(0, 0, 0), 3, out) == 0);
+}
+
+void TestUpdate()
+{
+	std::vector<uint8_t> flags(64, 0x80);
+	std::vector<CEntity> entities(64);
+	CMatrix matrix;
+	matrix.pos = CVector_pad(5, 6, 7);
+	flags[3] = 0;
+	entities[3].m_pMatrix = &matrix;
+	flags[40] = 0;
+	entities[40].m_pMatrix = nullptr;
+	entities[40].m_placement.m_vPosition = CVector(-100, 50, 0);
+
+	alignas(CPool<CEntity>) uint8_t storage[sizeof(CPool<CEntity>)] = {};
+	CPool<CEntity>* pool = (CPool<CEntity>*)storage;
+	pool->m_pObjects = (uint8_t*)entities.data();
+	pool->m_pFlags = flags.data();
+	pool->m_nCount = 64;
+	pool->m_nEntrySize = sizeof(CEntity);
+	CPools::ms_pPedPool = pool;
+
+	CSpatialGrid grid;
+	grid.Update();
+	CPools::ms_pPedPool = nullptr;
+
+	std::vector<const tSpatialEntry*> out;
+	CHECK(grid.QueryNearest(CVector(0, 0, 0), 2, out) == 2);
+	CHECK(out.size() == 2 && out[0]->m_nSlot == 3 && out[0]->m_nType == SPATIAL_PED && out[0]->m_pEntity == &entities[3]);
+	CHECK(out.size() == 2 && out[1]->m_nSlot == 40 && out[1]->m_vPos.x == -100.0f);
+}
+
+void Bench()
+{
+	const uint32_t count = 10000;
+	// roughly the size of the map
+	std::vector<CVector> positions = MakePositions(count, 3000.0f);
+	std::vector<CVector> centers(256);
+	for (auto& center : centers) center = CVector(RandomFloat() * 3000.0f, RandomFloat() * 3000.0f, 20.0f);
+
+	CSpatialGrid grid;
+	uint32_t iterations = IsQuickRun() ? 5 : 500;
+	double buildNs = TimeNs(iterations, [&](uint32_t) { Build(grid, positions); });
+
+	std::vector<const tSpatialEntry*> out;
+	uint32_t found = 0;
+	double radiusNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (auto& center : centers) found += grid.QueryRadius(center, 50.0f, out);
+	}) / centers.size();
+	double bruteRadiusNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (auto& center : centers)
+		{
+			for (auto& p : positions) found += (p - center).MagnitudeSqr() <= 2500.0f;
+		}
+	}) / centers.size();
+	double nearestNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (auto& center : centers) found += grid.QueryNearest(center, 8, out);
+	}) / centers.size();
+	// a linear walk keeping the best 8 in a heap, what finding the nearest looks like without the grid
+	std::vector<float> heap;
+	double bruteNearestNs = TimeNs(iterations, [&](uint32_t)
+	{
+		for (auto& center : centers)
+		{
+			heap.clear();
+			for (auto& p : positions)
+			{
+				float distSqr = (p - center).MagnitudeSqr();
+				if (heap.size() == 8)
+				{
+					if (distSqr >= heap.front()) continue;
+					std::pop_heap(heap.begin(), heap.end());
+					heap.pop_back();
+				}
+				heap.push_back(distSqr);
+				std::push_heap(heap.begin(), heap.end());
+			}
+			found += (uint32_t)heap.size();
+		}
+	}) / centers.size();
+	DoNotOptimise(found);
+
+	printf("%u entities\n", count);
+	printf("Build                    %9.1f us\n", buildNs / 1000.0);
+	printf("QueryRadius 50           %9.1f ns  (linear walk %.1f ns)\n", radiusNs, bruteRadiusNs);
+	printf("QueryNearest k=8         %9.1f ns  (linear walk %.1f ns)\n", nearestNs, bruteNearestNs);
+}
+
+int main()
+{
+	TestQueries(16.0f, 4096);
+	// a tiny table so cells share buckets and the big query fallbacks run
+	TestQueries(4.0f, 16);
+	TestUpdate();
+	Bench();
+	return Finish("SpatialGridTest");
+}
@@ -0,0 +1,156 @@
+// atStringHashBatch against atLiteralStringHash one string at a time, then the two timed over a model name sized list
+#include "HostSdk.h"
+
+// rage.h's globals, never touched here
+typedef void* HWND;
+struct IDirect3DDevice9;
+
+// initialised before them, so their GetRef skips Init, the host has no exe for it to read
+bool gSkipInit = (AddressSetter::bAddressesRead = true);
+
+#include "rage.h"
+
+uint32_t gSeed = 12345;
+uint32_t NextRandom()
+{
+	gSeed = gSeed * 1664525 + 1013904223;
+	return gSeed >> 8;
+}
+
+// mixed case, backslashes, quotes in and around the string, and the odd byte above 0x7F
+std::string RandomString(uint32_t maxLength)
+{
+	static const char chars[] = "abcxyzABCXYZ_019/\\\" .\x80\xFF";
+	std::string s;
+	uint32_t length = NextRandom() % (maxLength + 1);
+	for (uint32_t i = 0; i < length; i++) s += chars[NextRandom() % (sizeof(chars) - 1)];
+	return s;
+}
+
+bool CheckBatch(const std::vector<std::string>& strings)
+{
+	std::vector<const char*> pointers;
+	for (auto& s : strings) pointers.push_back(s.c_str());
+
+	// one past the end so an overrun shows up
+	std::vector<uint32_t> hashes(strings.size() + 1, 0xDEADBEEF);
+	rage::atStringHashBatch(pointers.data(), (uint32_t)pointers.size(), hashes.data());
+
+	bool ok = hashes.back() == 0xDEADBEEF;
+	for (uint32_t i = 0; i < strings.size(); i++)
+	{
+		if (hashes[i] != rage::atLiteralStringHash(pointers[i]))
+		{
+			printf("  \"%s\": batch %08X scalar %08X\n", pointers[i], hashes[i], rage::atLiteralStringHash(pointers[i]));
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+void TestKnown()
+{
+	// lanes that end at different times, quoting, and folding that has to match the scalar version
+	std::vector<std::string> strings = { "player", "M_Y_MULTIPLAYER", "", "a", "\"quoted\"rest", "\"", "\"\"", "\"unterminated",
+		"PATH\\TO\\FILE", "path/to/file", "x", "a much longer string than the other three lanes in this group" };
+	CHECK(CheckBatch(strings));
+
+	std::vector<const char*> pointers;
+	for (auto& s : strings) pointers.push_back(s.c_str());
+	std::vector<uint32_t> hashes(strings.size());
+	rage::atStringHashBatch(pointers.data(), (uint32_t)pointers.size(), hashes.data());
+	CHECK(hashes[0] == 0x6F0783F5);
+	CHECK(hashes[1] == 0x879495E2);
+	CHECK(hashes[4] == rage::atLiteralStringHash("quoted"));
+	CHECK(hashes[8] == hashes[9]);
+}
+
+void TestRandom()
+{
+	// every count up to a few groups of 8, so the scalar tail is covered for every remainder
+	for (uint32_t count = 0; count <= 20; count++)
+	{
+		for (int round = 0; round < 50; round++)
+		{
+			std::vector<std::string> strings;
+			// past 64 characters a group goes the scalar way
+			for (uint32_t i = 0; i < count; i++) strings.push_back(RandomString(round < 20 ? 4 : round < 40 ? 40 : 80));
+			CHECK(CheckBatch(strings));
+		}
+	}
+}
+
+// every MODEL_NAME = 0x... in ScriptingEnums.h is the game's hash of NAME
+void TestModelHashes()
+{
+	std::string path = __FILE__;
+	path = path.substr(0, path.find_last_of("/\\") + 1) + "../include/Scripting/ScriptingEnums.h";
+	FILE* file = fopen(path.c_str(), "r");
+	CHECK(file);
+	if (!file) return;
+
+	std::vector<std::string> names;
+	std::vector<uint32_t> expected;
+	char line[512];
+	while (fgets(line, sizeof(line), file))
+	{
+		char name[256];
+		uint32_t hash;
+		if (sscanf(line, " MODEL_%255[A-Za-z0-9_] = 0x%x", name, &hash) == 2)
+		{
+			names.push_back(name);
+			expected.push_back(hash);
+		}
+	}
+	fclose(file);
+	CHECK(names.size() > 1000);
+
+	std::vector<const char*> pointers;
+	for (auto& s : names) pointers.push_back(s.c_str());
+	std::vector<uint32_t> hashes(names.size());
+	rage::atStringHashBatch(pointers.data(), (uint32_t)pointers.size(), hashes.data());
+	uint32_t wrong = 0;
+	for (uint32_t i = 0; i < names.size(); i++)
+	{
+		if (hashes[i] != expected[i] || rage::atLiteralStringHash(pointers[i]) != expected[i]) wrong++;
+	}
+	CHECK(wrong == 0);
+}
+
+void Benchmark()
+{
+	// roughly what a model or native name list looks like
+	uint32_t count = IsQuickRun() ? 256 : 4096;
+	std::vector<std::string> strings;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "M_Y_MODEL_%c%c%u", 'A' + NextRandom() % 26, 'A' + NextRandom() % 26, NextRandom() % 100000);
+		strings.push_back(name);
+	}
+	std::vector<const char*> pointers;
+	for (auto& s : strings) pointers.push_back(s.c_str());
+	std::vector<uint32_t> hashes(count);
+
+	uint32_t iterations = IsQuickRun() ? 20 : 500;
+	double scalar = TimeNs(iterations, [&](uint32_t)
+	{
+		for (uint32_t i = 0; i < count; i++) hashes[i] = rage::atLiteralStringHash(pointers[i]);
+		DoNotOptimise(hashes.data());
+	});
+	double batch = TimeNs(iterations, [&](uint32_t)
+	{
+		rage::atStringHashBatch(pointers.data(), count, hashes.data());
+		DoNotOptimise(hashes.data());
+	});
+	printf("hash %u names: scalar %.1f ns/name, batch %.1f ns/name (%.2fx)\n", count, scalar / count, batch / count, scalar / batch);
+}
+
+int main()
+{
+	TestKnown();
+	TestRandom();
+	TestModelHashes();
+	Benchmark();
+	return Finish("StringHashTest");
+}
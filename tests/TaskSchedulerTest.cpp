@@ -0,0 +1,253 @@
+// the task scheduler driven by fake clocks, so millis() and the budget are exact
+// built as c++20, the header is empty without coroutines
+#include "Test.h"
+#include "CTaskScheduler.h"
+
+uint32_t gTime = 0;
+uint64_t gMicroseconds = 0;
+uint64_t gMicrosecondsStep = 0;	// added every time the budget is checked
+
+uint32_t FakeTime() { return gTime; }
+uint64_t FakeMicroseconds()
+{
+	uint64_t now = gMicroseconds;
+	gMicroseconds += gMicrosecondsStep;
+	return now;
+}
+
+// counts coroutine frames that are still around
+struct tAlive
+{
+	static inline int ms_nCount = 0;
+	tAlive() { ms_nCount++; }
+	~tAlive() { ms_nCount--; }
+};
+
+std::vector<std::string> gLog;
+
+CTask Wait(const char* sName, uint32_t ms)
+{
+	tAlive alive;
+	gLog.push_back(std::string(sName) + " start");
+	co_await millis(ms);
+	gLog.push_back(std::string(sName) + " done");
+}
+
+CTask Frames(const char* sName, int count)
+{
+	tAlive alive;
+	for (int i = 0; i < count; i++)
+	{
+		gLog.push_back(std::string(sName) + " " + std::to_string(i));
+		co_await nextFrame();
+	}
+}
+
+void Reset()
+{
+	gLog.clear();
+	gTime = 0;
+	gMicroseconds = 0;
+	gMicrosecondsStep = 0;
+}
+
+void TestMillis()
+{
+	Reset();
+	CTaskScheduler scheduler(FakeTime, FakeMicroseconds);
+	uint32_t id = scheduler.Start(Wait("a", 100));
+	CHECK(scheduler.IsRunning(id));
+	CHECK(gLog.empty());
+
+	scheduler.Run();
+	CHECK((gLog == std::vector<std::string>{ "a start" }));
+
+	// game time doesn't move while paused, however many frames go by
+	for (int i = 0; i < 10; i++) scheduler.Run();
+	gTime = 99;
+	scheduler.Run();
+	CHECK(gLog.size() == 1);
+
+	gTime = 100;
+	scheduler.Run();
+	CHECK(gLog.size() == 2 && gLog[1] == "a done");
+	CHECK(!scheduler.IsRunning(id));
+	CHECK(scheduler.Size() == 0);
+	CHECK(tAlive::ms_nCount == 0);
+
+	// a wait of 0 still waits for the next Run
+	scheduler.Start(Wait("b", 0));
+	scheduler.Run();
+	CHECK(gLog.back() == "b start");
+	scheduler.Run();
+	CHECK(gLog.back() == "b done");
+
+	// wraps around with the clock
+	gTime = 0xFFFFFFF0;
+	scheduler.Start(Wait("c", 0x20));
+	scheduler.Run();
+	gTime = 0x0F;
+	scheduler.Run();
+	CHECK(gLog.back() == "c start");
+	gTime = 0x10;
+	scheduler.Run();
+	CHECK(gLog.back() == "c done");
+}
+
+void TestFrames()
+{
+	Reset();
+	CTaskScheduler scheduler(FakeTime, FakeMicroseconds);
+	scheduler.Start(Frames("a", 2));
+	scheduler.Start(Frames("b", 3));
+	for (int i = 0; i < 4; i++) scheduler.Run();
+	CHECK((gLog == std::vector<std::string>{ "a 0", "b 0", "a 1", "b 1", "b 2" }));
+	CHECK(scheduler.Size() == 0 && tAlive::ms_nCount == 0);
+}
+
+// spends 100us of fake time per step and yields with budgetExhausted
+CTask Work(const char* sName, int steps)
+{
+	tAlive alive;
+	for (int i = 0; i < steps; i++)
+	{
+		gLog.push_back(sName);
+		gMicroseconds += 100;
+		co_await budgetExhausted();
+	}
+}
+
+void TestBudget()
+{
+	Reset();
+	CTaskScheduler scheduler(FakeTime, FakeMicroseconds);
+	scheduler.m_nBudgetMicroseconds = 250;
+	scheduler.Start(Work("a", 10));
+
+	// 3 steps fit before 300 >= 250
+	scheduler.Run();
+	CHECK(gLog.size() == 3);
+	CHECK(!scheduler.IsBudgetExhausted());
+
+	// a budget smaller than one step still makes progress
+	scheduler.m_nBudgetMicroseconds = 1;
+	scheduler.Run();
+	CHECK(gLog.size() == 4);
+
+	// 0 is no budget at all
+	scheduler.m_nBudgetMicroseconds = 0;
+	scheduler.Run();
+	CHECK(gLog.size() == 10);
+	scheduler.Run();
+	CHECK(scheduler.Size() == 0 && tAlive::ms_nCount == 0);
+}
+
+void TestRoundRobin()
+{
+	Reset();
+	CTaskScheduler scheduler(FakeTime, FakeMicroseconds);
+	scheduler.Start(Frames("a", 10));
+	scheduler.Start(Frames("b", 10));
+	scheduler.Start(Frames("c", 10));
+
+	// every task costs 100us, the budget is used up after the first one each Run, the cursor moves on
+	gMicrosecondsStep = 100;
+	scheduler.m_nBudgetMicroseconds = 50;
+	for (int i = 0; i < 3; i++) scheduler.Run();
+	CHECK((gLog == std::vector<std::string>{ "a 0", "b 0", "c 0" }));
+	scheduler.Clear();
+	CHECK(tAlive::ms_nCount == 0);
+}
+
+CTaskScheduler* gScheduler = nullptr;
+uint32_t gOtherId = 0;
+
+CTask CancelOther()
+{
+	tAlive alive;
+	gLog.push_back("cancel");
+	CHECK(gScheduler->Cancel(gOtherId));
+	// marked but not gone until it's suspended
+	CHECK(!gScheduler->IsRunning(gOtherId));
+	co_await nextFrame();
+	gLog.push_back("after cancel");
+}
+
+CTask ClearAll()
+{
+	tAlive alive;
+	gLog.push_back("clear");
+	gScheduler->Start(Frames("started inside", 5));
+	gScheduler->Clear();
+	// still running until the next co_await, then it's destroyed with the rest
+	gLog.push_back("cleared");
+	co_await nextFrame();
+	gLog.push_back("never");
+}
+
+void TestCancelInsideRun()
+{
+	Reset();
+	CTaskScheduler scheduler(FakeTime, FakeMicroseconds);
+	gScheduler = &scheduler;
+
+	scheduler.Start(CancelOther());
+	gOtherId = scheduler.Start(Frames("other", 5));
+	scheduler.Run();
+	CHECK((gLog == std::vector<std::string>{ "cancel" }));
+	CHECK(scheduler.Size() == 1 && tAlive::ms_nCount == 1);
+	scheduler.Run();
+	CHECK(gLog.back() == "after cancel");
+	CHECK(scheduler.Size() == 0 && tAlive::ms_nCount == 0);
+
+	// Clear from inside a task, every frame goes once the running task is suspended, the one it's in included
+	gLog.clear();
+	scheduler.Start(Frames("a", 5));
+	scheduler.Start(ClearAll());
+	scheduler.Start(Frames("b", 5));
+	scheduler.Run();
+	CHECK((gLog == std::vector<std::string>{ "a 0", "clear", "cleared" }));
+	CHECK(scheduler.Size() == 0);
+	CHECK(tAlive::ms_nCount == 0);
+	scheduler.Run();
+	CHECK(gLog.size() == 3);
+
+	// and Clear outside of Run destroys straight away
+	scheduler.Start(Frames("c", 5));
+	scheduler.Run();
+	CHECK(tAlive::ms_nCount == 1);
+	scheduler.Clear();
+	CHECK(scheduler.Size() == 0 && tAlive::ms_nCount == 0);
+	gScheduler = nullptr;
+}
+
+void TestDestructor()
+{
+	Reset();
+	{
+		CTaskScheduler scheduler(FakeTime, FakeMicroseconds);
+		scheduler.Start(Wait("a", 1000));
+		scheduler.Run();
+		// never started, thrown away with the scheduler
+		scheduler.Start(Wait("b", 1000));
+		CHECK(tAlive::ms_nCount == 1);
+	}
+	CHECK(tAlive::ms_nCount == 0);
+
+	// a task that was never passed to Start
+	{
+		CTask task = Wait("c", 0);
+	}
+	CHECK(tAlive::ms_nCount == 0 && gLog.size() == 1);
+}
+
+int main()
+{
+	TestMillis();
+	TestFrames();
+	TestBudget();
+	TestRoundRobin();
+	TestCancelInsideRun();
+	TestDestructor();
+	return Finish("TaskSchedulerTest");
+}
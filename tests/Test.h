@@ -0,0 +1,56 @@
+// tiny check and timing helpers shared by the host tests, no framework on purpose
+#pragma once
+#include "HostStubs.h"
+#include <stdlib.h>
+
+inline int gNumFailures = 0;
+
+#define CHECK(cond) \
+	do \
+	{ \
+		if (!(cond)) \
+		{ \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+			gNumFailures++; \
+		} \
+	} while (0)
+
+// ctest sets IVSDK_BENCH_QUICK so the benchmarks only do a short pass
+inline bool IsQuickRun()
+{
+	return getenv("IVSDK_BENCH_QUICK") != nullptr;
+}
+
+inline uint64_t GetHostNanoseconds()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// keeps the optimiser from throwing away a result
+template<typename T>
+inline void DoNotOptimise(const T& value)
+{
+	asm volatile("" : : "g"(&value) : "memory");
+}
+
+// best of a few runs of fn, in nanoseconds per iteration
+template<typename F>
+inline double TimeNs(uint32_t iterations, F&& fn)
+{
+	double best = 1e30;
+	for (int run = 0; run < 5; run++)
+	{
+		uint64_t start = GetHostNanoseconds();
+		for (uint32_t i = 0; i < iterations; i++) fn(i);
+		double ns = (double)(GetHostNanoseconds() - start) / iterations;
+		if (ns < best) best = ns;
+	}
+	return best;
+}
+
+inline int Finish(const char* sName)
+{
+	if (gNumFailures) printf("%s: %d failed\n", sName, gNumFailures);
+	else printf("%s: ok\n", sName);
+	return gNumFailures ? 1 : 0;
+}
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+# generates include/Scripting/NativeIndex.h and NativeNames.h from NativeHashes.h and BaseScripting.h
+# rerun after adding natives: python3 tools/gen_native_names.py
+# python3 tools/gen_native_names.py --check only diffs against the headers and fails if they're out of date, the host tests run it
+#
+# NativeIndex.h has the sorted hashes and a hash and displace perfect hash over them, a lookup is one seed read, one slot read and one compare
+# NativeNames.h adds a (name offset, arg count) entry per hash and the names packed into string pools
+
+import difflib
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SCRIPTING = os.path.join(ROOT, "include", "Scripting")
+OUTPUT = os.path.join(SCRIPTING, "NativeNames.h")
+INDEX_OUTPUT = os.path.join(SCRIPTING, "NativeIndex.h")
+
+SLOT_BITS = 12  # 4096 slots
+NUM_BUCKETS = 1024
+UNKNOWN_ARGS = 0xFF
+POOL_CHUNK_SIZE = 0xF000  # msvc won't take a string literal over 64k, the names get split over several pools
+
+
+def mix(key, seed):
+    # has to match NativeNames::Mix in the output
+    h = (key ^ seed) & 0xFFFFFFFF
+    h = (h * 0x9E3779B1) & 0xFFFFFFFF
+    h ^= h >> 15
+    h = (h * 0x85EBCA77) & 0xFFFFFFFF
+    return h >> (32 - SLOT_BITS)
+
+
+def read_natives():
+    text = open(os.path.join(SCRIPTING, "NativeHashes.h")).read()
+    natives = {}
+    for name, value in re.findall(r"\bNATIVE_(\w+)\s*=\s*(0x[0-9A-Fa-f]+)", text):
+        natives.setdefault(int(value, 16), name)
+    return natives
+
+
+def read_arg_counts():
+    # the number of arguments the wrappers push after the hash
+    text = open(os.path.join(SCRIPTING, "BaseScripting.h")).read()
+    counts = {}
+    for match in re.finditer(r"NativeInvoke::Invoke\s*<[^>]*>\s*\(\s*NATIVE_(\w+)", text):
+        # every top level comma after the hash starts another argument
+        depth = 1
+        args = 0
+        for c in text[match.end():]:
+            if c == "(":
+                depth += 1
+            elif c == ")":
+                depth -= 1
+                if depth == 0:
+                    break
+            elif c == "," and depth == 1:
+                args += 1
+        counts.setdefault(match.group(1), args)
+    return counts
+
+
+def build_perfect_hash(keys):
+    num_slots = 1 << SLOT_BITS
+    if len(keys) > num_slots:
+        sys.exit("too many natives for %d slots, raise SLOT_BITS" % num_slots)
+
+    buckets = [[] for _ in range(NUM_BUCKETS)]
+    for key in keys:
+        buckets[key % NUM_BUCKETS].append(key)
+
+    seeds = [0] * NUM_BUCKETS
+    taken = [False] * num_slots
+    slots = {}
+    for b in sorted(range(NUM_BUCKETS), key=lambda b: -len(buckets[b])):
+        bucket = buckets[b]
+        if not bucket:
+            continue
+        for seed in range(1, 0x10000):
+            placed = [mix(key, seed) for key in bucket]
+            if len(set(placed)) == len(placed) and not any(taken[s] for s in placed):
+                break
+        else:
+            sys.exit("no seed found for bucket %d" % b)
+        seeds[b] = seed
+        for key, slot in zip(bucket, placed):
+            taken[slot] = True
+            slots[key] = slot
+    return seeds, slots
+
+
+def format_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("\t\t" + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    natives = read_natives()
+    arg_counts = read_arg_counts()
+    hashes = sorted(natives)
+
+    pools = [[]]
+    pool_size = 0
+    offsets = {}
+    for h in hashes:
+        size = len(natives[h]) + 1
+        if pool_size + size > POOL_CHUNK_SIZE:
+            pools.append([])
+            pool_size = 0
+        offsets[h] = (len(pools) - 1, pool_size)
+        pools[-1].append(natives[h])
+        pool_size += size
+
+    seeds, slots = build_perfect_hash(hashes)
+    index_of = {h: i for i, h in enumerate(hashes)}
+    slot_table = [0xFFFF] * (1 << SLOT_BITS)
+    for h, slot in slots.items():
+        slot_table[slot] = index_of[h]
+
+    index = []
+    index.append("// generated by tools/gen_native_names.py from NativeHashes.h, don't edit by hand")
+    index.append("// perfect hash over every native hash, NativeInvoke keys its function pointer cache on the index")
+    index.append("#pragma once")
+    index.append("#include <stdint.h>")
+    index.append("")
+    index.append("namespace NativeNames")
+    index.append("{")
+    index.append("\tenum")
+    index.append("\t{")
+    index.append("\t\tNumNatives = %d," % len(hashes))
+    index.append("\t\tNumBuckets = %d," % NUM_BUCKETS)
+    index.append("\t\tSlotBits = %d," % SLOT_BITS)
+    index.append("\t};")
+    index.append("")
+    index.append("\t// sorted")
+    index.append("\tinline const uint32_t ms_aHashes[NumNatives] =")
+    index.append("\t{")
+    index.append(format_array(hashes, 8, "0x%08X"))
+    index.append("\t};")
+    index.append("")
+    index.append("\tinline const uint16_t ms_aSeeds[NumBuckets] =")
+    index.append("\t{")
+    index.append(format_array(seeds, 16, "%d"))
+    index.append("\t};")
+    index.append("")
+    index.append("\t// index into ms_aHashes, 0xFFFF for empty slots")
+    index.append("\tinline const uint16_t ms_aSlots[1 << SlotBits] =")
+    index.append("\t{")
+    index.append(format_array(slot_table, 16, "%d"))
+    index.append("\t};")
+    index.append("")
+    index.append("\tinline uint32_t Mix(uint32_t key, uint32_t seed)")
+    index.append("\t{")
+    index.append("\t\tuint32_t h = (key ^ seed) * 0x9E3779B1u;")
+    index.append("\t\th ^= h >> 15;")
+    index.append("\t\th *= 0x85EBCA77u;")
+    index.append("\t\treturn h >> (32 - SlotBits);")
+    index.append("\t}")
+    index.append("")
+    index.append("\t// index into ms_aHashes, -1 for hashes that aren't natives")
+    index.append("\tinline int32_t FindIndex(uint32_t nHash)")
+    index.append("\t{")
+    index.append("\t\tuint16_t index = ms_aSlots[Mix(nHash, ms_aSeeds[nHash % NumBuckets])];")
+    index.append("\t\tif (index == 0xFFFF || ms_aHashes[index] != nHash) return -1;")
+    index.append("\t\treturn index;")
+    index.append("\t}")
+    index.append("}")
+
+    out = []
+    out.append("// generated by tools/gen_native_names.py from NativeHashes.h and BaseScripting.h, don't edit by hand")
+    out.append("// hash -> name and argument count for every native, for logging, profiling and debugging")
+    out.append("// Scripting.h doesn't pull this in, include Scripting/NativeNames.h where you need it")
+    out.append("#pragma once")
+    out.append("#include \"NativeIndex.h\"")
+    out.append("")
+    out.append("namespace NativeNames")
+    out.append("{")
+    out.append("\tenum")
+    out.append("\t{")
+    out.append("\t\tUnknownArgs = 0x%X,\t// no wrapper in BaseScripting.h to count them from" % UNKNOWN_ARGS)
+    out.append("\t};")
+    out.append("")
+    out.append("\tstruct tNativeInfo")
+    out.append("\t{")
+    out.append("\t\tuint16_t m_nNameOffset;")
+    out.append("\t\tuint8_t m_nNamePool;")
+    out.append("\t\tuint8_t m_nArgs;")
+    out.append("\t};")
+    out.append("")
+    out.append("\t// same order as ms_aHashes")
+    out.append("\tinline const tNativeInfo ms_aNatives[NumNatives] =")
+    out.append("\t{")
+    for h in hashes:
+        args = arg_counts.get(natives[h], UNKNOWN_ARGS)
+        out.append("\t\t{ %d, %d, %d },\t// 0x%08X" % (offsets[h][1], offsets[h][0], args, h))
+    out.append("\t};")
+    out.append("")
+    for i, names in enumerate(pools):
+        out.append("\tinline const char ms_sNamePool%d[] =" % i)
+        for name in names:
+            out.append("\t\t\"%s\\0\"" % name)
+        out.append("\t\t;")
+    out.append("\tinline const char* const ms_aNamePools[] = { %s };" % ", ".join("ms_sNamePool%d" % i for i in range(len(pools))))
+    out.append("")
+    out.append("\tinline const tNativeInfo* Find(uint32_t nHash)")
+    out.append("\t{")
+    out.append("\t\tint32_t index = FindIndex(nHash);")
+    out.append("\t\treturn index < 0 ? nullptr : &ms_aNatives[index];")
+    out.append("\t}")
+    out.append("")
+    out.append("\tinline const char* GetName(const tNativeInfo& info) { return &ms_aNamePools[info.m_nNamePool][info.m_nNameOffset]; }")
+    out.append("")
+    out.append("\t// nullptr for hashes that aren't natives")
+    out.append("\tinline const char* GetName(uint32_t nHash)")
+    out.append("\t{")
+    out.append("\t\tauto info = Find(nHash);")
+    out.append("\t\treturn info ? GetName(*info) : nullptr;")
+    out.append("\t}")
+    out.append("")
+    out.append("\t// -1 if the hash isn't a native or the count isn't known")
+    out.append("\tinline int32_t GetArgCount(uint32_t nHash)")
+    out.append("\t{")
+    out.append("\t\tauto info = Find(nHash);")
+    out.append("\t\treturn info && info->m_nArgs != UnknownArgs ? (int32_t)info->m_nArgs : -1;")
+    out.append("\t}")
+    out.append("}")
+
+    outputs = [(INDEX_OUTPUT, "\n".join(index) + "\n"), (OUTPUT, "\n".join(out) + "\n")]
+    if "--check" in sys.argv[1:]:
+        stale = False
+        for path, text in outputs:
+            name = os.path.relpath(path, ROOT)
+            current = ""
+            if os.path.exists(path):
+                with open(path, newline="") as f:
+                    current = f.read().replace("\r\n", "\n")
+            if current != text:
+                diff = difflib.unified_diff(current.splitlines(True), text.splitlines(True), name, "regenerated")
+                sys.stdout.writelines(list(diff)[:200])
+                print("%s is out of date" % name)
+                stale = True
+        if stale:
+            sys.exit("rerun tools/gen_native_names.py")
+        print("native tables are up to date")
+        return
+
+    for path, text in outputs:
+        with open(path, "w", newline="\r\n") as f:
+            f.write(text)
+    print("wrote %d natives to %s and %s" % (len(hashes), os.path.relpath(INDEX_OUTPUT, ROOT), os.path.relpath(OUTPUT, ROOT)))
+
+if __name__ == "__main__":
+    main()